@@ -0,0 +1,108 @@
+/**
+ * @file Allocation.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 벤치마크의 할당 횟수와 바이트 수를 집계하도록 전역 operator new와 delete를 재정의합니다.
+ * @note 컴파일러가 재정의한 연산자를 표준 컨테이너 코드에 인라인하지 않도록 별도의 번역 단위에
+ *       정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+#include "Benchmark.h"
+
+
+
+namespace {
+
+    std::atomic<uint64_t> sAllocationCount(0);
+    std::atomic<uint64_t> sAllocatedBytes(0);
+
+    void* allocate(const size_t size)
+    {
+        sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        sAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        return malloc(size == 0 ? 1 : size);
+    }
+}
+
+
+void* operator new(size_t size)
+{
+    void* pointer = allocate(size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+
+
+namespace muffin { namespace bench {
+
+    uint64_t GetAllocationCount()
+    {
+        return sAllocationCount.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetAllocatedBytes()
+    {
+        return sAllocatedBytes.load(std::memory_order_relaxed);
+    }
+}}
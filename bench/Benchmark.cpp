@@ -0,0 +1,183 @@
+/**
+ * @file Benchmark.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 호스트에서 플랫폼 독립적인 코드의 성능을 측정하는 벤치마크 실행기를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Benchmark.h"
+
+
+
+namespace muffin { namespace bench {
+
+    void Runner::Register(const char* name, benchmark_function_t function)
+    {
+        benchmark_t benchmark;
+        benchmark.Name = name;
+        benchmark.Function = function;
+        mBenchmarks.emplace_back(benchmark);
+    }
+
+    void Runner::Run(const std::string& filter)
+    {
+        mResults.clear();
+        for (const auto& benchmark : mBenchmarks)
+        {
+            if (filter.empty() == false && std::string(benchmark.Name).find(filter) == std::string::npos)
+            {
+                continue;
+            }
+            mResults.emplace_back(measure(benchmark.Name, benchmark.Function));
+        }
+    }
+
+    result_t Runner::measure(const char* name, benchmark_function_t function) const
+    {
+        typedef std::chrono::steady_clock clock;
+
+        /**
+         * @note 첫 실행에서 발생하는 지연 초기화와 캐시 미스가 결과에 포함되지 않도록 한 번
+         *       실행한 다음 반복 횟수를 두 배씩 늘려 측정 시간을 맞춥니다.
+         */
+        uint32_t checksum = function(1);
+        uint32_t iterations = 1;
+        while (iterations < MAX_ITERATIONS)
+        {
+            const clock::time_point start = clock::now();
+            checksum ^= function(iterations);
+            const uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+            if (elapsed >= MIN_DURATION_NS)
+            {
+                break;
+            }
+            iterations *= 2;
+        }
+
+        result_t result;
+        result.Name        = name;
+        result.NanosPerOp  = 0;
+        result.AllocsPerOp = 0;
+        result.BytesPerOp  = 0;
+        result.Iterations  = iterations;
+
+        for (uint8_t repetition = 0; repetition < REPETITIONS; ++repetition)
+        {
+            const clock::time_point start = clock::now();
+            checksum ^= function(iterations);
+            const uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+
+            const double nanosPerOp = static_cast<double>(elapsed) / iterations;
+            if (repetition == 0 || nanosPerOp < result.NanosPerOp)
+            {
+                result.NanosPerOp = nanosPerOp;
+            }
+        }
+
+        /**
+         * @note 준비 과정의 할당과 버퍼가 처음 커질 때의 할당을 제외하도록 반복 횟수만 다른 두
+         *       실행의 차이로 할당 횟수를 구합니다. 반복 횟수가 고정되어 있으므로 측정 시간과
+         *       관계없이 같은 결과가 나옵니다.
+         */
+        uint64_t allocations = GetAllocationCount();
+        uint64_t bytes = GetAllocatedBytes();
+        checksum ^= function(ALLOC_ITERATIONS);
+        const uint64_t baseAllocations = GetAllocationCount() - allocations;
+        const uint64_t baseBytes = GetAllocatedBytes() - bytes;
+
+        allocations = GetAllocationCount();
+        bytes = GetAllocatedBytes();
+        checksum ^= function(2 * ALLOC_ITERATIONS);
+        result.AllocsPerOp = static_cast<double>(GetAllocationCount() - allocations - baseAllocations) / ALLOC_ITERATIONS;
+        result.BytesPerOp  = static_cast<double>(GetAllocatedBytes() - bytes - baseBytes) / ALLOC_ITERATIONS;
+
+        result.Checksum = checksum;
+        return result;
+    }
+
+    void Runner::Print() const
+    {
+        printf("%-36s %14s %12s %12s %12s\n", "benchmark", "ns/op", "allocs/op", "B/op", "iterations");
+        for (const auto& result : mResults)
+        {
+            printf("%-36s %14.1f %12.2f %12.1f %12u\n",
+                result.Name.c_str(), result.NanosPerOp, result.AllocsPerOp, result.BytesPerOp, result.Iterations);
+        }
+    }
+
+    bool Runner::Save(const std::string& path) const
+    {
+        std::ofstream file(path.c_str());
+        if (file.is_open() == false)
+        {
+            fprintf(stderr, "FAILED TO OPEN BASELINE FILE: %s\n", path.c_str());
+            return false;
+        }
+
+        for (const auto& result : mResults)
+        {
+            file << result.Name << ' ' << result.NanosPerOp << ' ' << result.AllocsPerOp << '\n';
+        }
+        return file.good();
+    }
+
+    bool Runner::Compare(const std::string& path, const double threshold) const
+    {
+        std::ifstream file(path.c_str());
+        if (file.is_open() == false)
+        {
+            fprintf(stderr, "FAILED TO OPEN BASELINE FILE: %s\n", path.c_str());
+            return false;
+        }
+
+        std::map<std::string, std::pair<double, double>> baseline;
+        std::string name;
+        double nanosPerOp = 0;
+        double allocsPerOp = 0;
+        while (file >> name >> nanosPerOp >> allocsPerOp)
+        {
+            baseline[name] = std::make_pair(nanosPerOp, allocsPerOp);
+        }
+
+        bool isPassed = true;
+        for (const auto& result : mResults)
+        {
+            auto it = baseline.find(result.Name);
+            if (it == baseline.end())
+            {
+                printf("NEW   %-36s %14.1f ns/op\n", result.Name.c_str(), result.NanosPerOp);
+                continue;
+            }
+
+            const double change = it->second.first > 0 ? (result.NanosPerOp / it->second.first - 1.0) * 100.0 : 0.0;
+            const bool isSlower = change > threshold;
+            /**
+             * @note 할당 횟수는 입력이 결정적이므로 조금이라도 늘어나면 회귀로 판단합니다.
+             */
+            const bool isAllocating = result.AllocsPerOp > it->second.second;
+            printf("%s %-36s %+8.1f%%  allocs/op %.2f -> %.2f\n",
+                (isSlower || isAllocating) ? "FAIL " : "OK   ", result.Name.c_str(), change, it->second.second, result.AllocsPerOp);
+
+            if (isSlower || isAllocating)
+            {
+                isPassed = false;
+            }
+        }
+        return isPassed;
+    }
+}}
@@ -0,0 +1,106 @@
+/**
+ * @file Benchmark.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 호스트에서 플랫폼 독립적인 코드의 성능을 측정하는 벤치마크 실행기를 선언합니다.
+ * @details 각 벤치마크는 반복 횟수를 인자로 받아 같은 연산을 반복하고, 컴파일러가 연산을
+ *          제거하지 못하도록 결과로부터 계산한 검사값을 반환합니다. 실행기는 측정 시간이
+ *          MIN_DURATION_NS 이상이 될 때까지 반복 횟수를 늘린 다음 REPETITIONS번 측정한
+ *          가장 작은 ns/op를 보고합니다. 할당 횟수와 바이트 수는 전역 operator new를
+ *          재정의하여 집계합니다.
+ *
+ * @note 호스트에서 측정한 ns/op는 펌웨어의 실행 시간이 아니므로 같은 머신에서 측정한 기준값과
+ *       비교하는 용도로만 사용합니다. 할당 횟수는 입력이 결정적이므로 머신과 관계없이 같습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+
+namespace muffin { namespace bench {
+
+    typedef uint32_t (*benchmark_function_t)(const uint32_t iterations);
+
+    typedef struct BenchmarkResultType
+    {
+        std::string Name;
+        double NanosPerOp;
+        double AllocsPerOp;
+        double BytesPerOp;
+        uint32_t Iterations;
+        uint32_t Checksum;
+    } result_t;
+
+    class Random
+    {
+    public:
+        /**
+         * @note 실행할 때마다 같은 입력을 만들 수 있도록 고정된 시드의 xorshift32를 사용합니다.
+         */
+        explicit Random(const uint32_t seed = 0x9E3779B9) : mState(seed == 0 ? 1 : seed) {}
+        uint32_t Next()
+        {
+            mState ^= mState << 13;
+            mState ^= mState >> 17;
+            mState ^= mState << 5;
+            return mState;
+        }
+        uint32_t Next(const uint32_t bound) { return Next() % bound; }
+    private:
+        uint32_t mState;
+    };
+
+    class Runner
+    {
+    public:
+        Runner() {}
+        virtual ~Runner() {}
+    public:
+        void Register(const char* name, benchmark_function_t function);
+        /**
+         * @param filter 이름에 포함되어야 하는 문자열이며, 비어 있으면 모든 벤치마크를 실행합니다.
+         */
+        void Run(const std::string& filter);
+        void Print() const;
+    public:
+        bool Save(const std::string& path) const;
+        /**
+         * @brief 기준값 파일과 비교하여 ns/op가 threshold 퍼센트보다 많이 늘었거나 할당 횟수가
+         *        늘어난 벤치마크를 출력합니다.
+         * @return false 기준값을 읽지 못했거나 성능이 저하된 벤치마크가 있는 경우
+         */
+        bool Compare(const std::string& path, const double threshold) const;
+    private:
+        result_t measure(const char* name, benchmark_function_t function) const;
+    private:
+        static const uint64_t MIN_DURATION_NS  = 50 * 1000 * 1000;
+        static const uint32_t MAX_ITERATIONS   = 1 << 30;
+        static const uint8_t  REPETITIONS      = 5;
+        static const uint32_t ALLOC_ITERATIONS = 16;
+    private:
+        typedef struct BenchmarkType
+        {
+            const char* Name;
+            benchmark_function_t Function;
+        } benchmark_t;
+    private:
+        std::vector<benchmark_t> mBenchmarks;
+        std::vector<result_t> mResults;
+    };
+
+
+    uint64_t GetAllocationCount();
+    uint64_t GetAllocatedBytes();
+}}
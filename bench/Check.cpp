@@ -0,0 +1,72 @@
+/**
+ * @file Check.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 호스트에서 플랫폼 독립적인 코드의 동작을 검증하는 검사 실행기를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <stdio.h>
+
+#include "Check.h"
+
+
+
+namespace muffin { namespace bench {
+
+    void Checker::Register(const char* name, check_function_t function)
+    {
+        check_t check;
+        check.Name = name;
+        check.Function = function;
+        mChecks.emplace_back(check);
+    }
+
+    uint32_t Checker::Run(const std::string& filter)
+    {
+        uint32_t checkCount = 0;
+        uint32_t failedCheckCount = 0;
+        mFailureCount = 0;
+
+        for (const auto& check : mChecks)
+        {
+            if (filter.empty() == false && std::string(check.Name).find(filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            mCurrentName = check.Name;
+            mCurrentFailureCount = 0;
+            check.Function(this);
+
+            ++checkCount;
+            if (mCurrentFailureCount > 0)
+            {
+                ++failedCheckCount;
+            }
+            printf("%-48s %s\n", check.Name, mCurrentFailureCount == 0 ? "OK" : "FAILED");
+        }
+
+        printf("\n%u checks, %u failed\n", checkCount, failedCheckCount);
+        return mFailureCount;
+    }
+
+    void Checker::Expect(const bool condition, const char* expression, const char* file, const int line)
+    {
+        if (condition == true)
+        {
+            return;
+        }
+
+        ++mFailureCount;
+        ++mCurrentFailureCount;
+        printf("  [%s] %s:%d: EXPECT(%s)\n", mCurrentName, file, line, expression);
+    }
+}}
@@ -0,0 +1,67 @@
+/**
+ * @file Check.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 호스트에서 플랫폼 독립적인 코드의 동작을 검증하는 검사 실행기를 선언합니다.
+ * @details 각 검사는 실행기를 인자로 받아 EXPECT() 매크로로 조건을 확인합니다. 실패한 조건은
+ *          파일과 줄 번호와 함께 출력되며, 실패한 조건이 있어도 나머지 조건과 검사는 계속
+ *          실행합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+
+namespace muffin { namespace bench {
+
+    class Checker;
+
+    typedef void (*check_function_t)(Checker* checker);
+
+    class Checker
+    {
+    public:
+        Checker() : mCurrentName(nullptr), mFailureCount(0), mCurrentFailureCount(0) {}
+        virtual ~Checker() {}
+    public:
+        void Register(const char* name, check_function_t function);
+        /**
+         * @param filter 이름에 포함되어야 하는 문자열이며, 비어 있으면 모든 검사를 실행합니다.
+         * @return 실패한 조건의 수
+         */
+        uint32_t Run(const std::string& filter);
+        void Expect(const bool condition, const char* expression, const char* file, const int line);
+    private:
+        typedef struct CheckType
+        {
+            const char* Name;
+            check_function_t Function;
+        } check_t;
+    private:
+        std::vector<check_t> mChecks;
+        const char* mCurrentName;
+        uint32_t mFailureCount;
+        uint32_t mCurrentFailureCount;
+    };
+
+
+    /**
+     * @brief main.cpp에서 벤치마크와 함께 실행할 검사를 등록합니다.
+     */
+    void RegisterChecks(Checker* checker);
+}}
+
+
+#define EXPECT(checker, condition) (checker)->Expect((condition), #condition, __FILE__, __LINE__)
@@ -0,0 +1,1369 @@
+/**
+ * @file Checks.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 펌웨어의 플랫폼 독립적인 모듈을 호스트에서 검증하는 검사를 정의합니다.
+ * @details CDO, 확인 응답 대기 윈도우, 트래픽 셰이퍼, 타이머 휠, 플래시 저장 레코드 형식,
+ *          Sparkplug B 인코딩과 heatshrink 압축, 수집 데이터 변환, Base64와 Intel Hex 파싱을 검사합니다.
+ *          파일 시스템과 NVS는 bench/shims의 메모리 구현을 사용하므로 재부팅 후의 복구 과정도 같은
+ *          프로세스에서 재현합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <algorithm>
+#include <Arduino.h>
+#include <map>
+#include <Preferences.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Check.h"
+#include "Common/Base64/Base64.hpp"
+#include "Common/Time/TimerWheel.h"
+#include "Core/Replay/ReplayFile.h"
+#include "DataFormat/Heatshrink/HeatshrinkEncoder.h"
+#include "DataFormat/SparkplugB/SparkplugB.h"
+#include "IM/Custom/Constants.h"
+#include "IM/Node/Variable.h"
+#include "JARVIS/Config/Information/Node.h"
+#include "Network/CatM1/BaudRateNegotiator.h"
+#include "Protocol/MQTT/CDO.h"
+#include "Protocol/MQTT/InflightWindow.h"
+#include "Protocol/MQTT/OutboundLog.h"
+#include "Protocol/MQTT/OutboundRecordCodec.h"
+#include "Protocol/Modbus/Include/PolledDataTable.h"
+#include "Protocol/MQTT/TrafficShaper.h"
+#include "Storage/ESP32FS/ESP32FS.h"
+
+#define MT10
+#include "OTA/MEGA2560/HexParser.h"
+#undef MT10
+
+
+
+using namespace muffin;
+using namespace muffin::bench;
+
+namespace {
+
+    mqtt::MessageHandle storeAndAcquire(const mqtt::topic_e topic, const std::string& payload)
+    {
+        mqtt::cdo.Store(mqtt::Message(topic, payload));
+        return std::move(mqtt::cdo.Acquire().second);
+    }
+
+    /**
+     * @note 펌웨어에는 압축 해제기가 없으므로 heatshrink 디코더의 토큰 해석 규칙대로 복원합니다.
+     */
+    std::string decodeHeatshrink(const std::string& input, const size_t length, const uint8_t windowBits, const uint8_t lookaheadBits)
+    {
+        size_t bitPosition = 0;
+        const size_t bitCount = input.size() * 8;
+        auto readBits = [&](const uint8_t count) -> uint32_t
+        {
+            uint32_t bits = 0;
+            for (uint8_t i = 0; i < count; ++i, ++bitPosition)
+            {
+                const uint8_t byte = static_cast<uint8_t>(input[bitPosition / 8]);
+                bits = (bits << 1) | ((byte >> (7 - (bitPosition % 8))) & 0x01);
+            }
+            return bits;
+        };
+
+        std::string output;
+        while (output.size() < length)
+        {
+            if (bitPosition + 1 > bitCount)
+            {
+                break;
+            }
+
+            if (readBits(1) == 1)
+            {
+                if (bitPosition + 8 > bitCount)
+                {
+                    break;
+                }
+                output.push_back(static_cast<char>(readBits(8)));
+                continue;
+            }
+
+            if (bitPosition + windowBits + lookaheadBits > bitCount)
+            {
+                break;
+            }
+            const size_t distance = readBits(windowBits) + 1;
+            const size_t count = readBits(lookaheadBits) + 1;
+            if (distance > output.size())
+            {
+                break;
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                output.push_back(output[output.size() - distance]);
+            }
+        }
+
+        return output;
+    }
+
+    void checkHeatshrinkRoundTrip(Checker* checker)
+    {
+        HeatshrinkEncoder encoder;
+        EXPECT(checker, encoder.IsInitialized() == true);
+
+        std::vector<std::string> inputs;
+        inputs.emplace_back(std::string(2000, 'A'));
+        inputs.emplace_back("{\"a\":1,\"a\":1,\"a\":1,\"a\":1,\"a\":1,\"a\":1,\"a\":1,\"a\":1}");
+
+        std::string telemetry("{\"mc\":\"A1B2C3D4E5F6\",\"val\":[");
+        Random random;
+        char buffer[64];
+        for (uint16_t idx = 0; idx < 300; ++idx)
+        {
+            snprintf(buffer, sizeof(buffer), "%s{\"uid\":\"P%03u\",\"val\":\"%u\"}", idx == 0 ? "" : ",",
+                static_cast<unsigned int>(random.Next(64)), static_cast<unsigned int>(random.Next(1000)));
+            telemetry += buffer;
+        }
+        telemetry += "]}";
+        inputs.emplace_back(telemetry);
+
+        std::string sparse;
+        for (uint16_t idx = 0; idx < 4096; ++idx)
+        {
+            sparse.push_back(random.Next(8) == 0 ? static_cast<char>(random.Next(256)) : '\0');
+        }
+        inputs.emplace_back(sparse);
+
+        for (const auto& input : inputs)
+        {
+            std::string output;
+            const bool isCompressed = encoder.Encode(reinterpret_cast<const uint8_t*>(input.data()), input.size(), &output);
+            EXPECT(checker, isCompressed == true);
+            EXPECT(checker, output.size() < input.size());
+            EXPECT(checker, decodeHeatshrink(output, input.size(), encoder.GetWindowBits(), encoder.GetLookaheadBits()) == input);
+        }
+
+        std::string noise;
+        for (uint16_t idx = 0; idx < 1024; ++idx)
+        {
+            noise.push_back(static_cast<char>(random.Next(256)));
+        }
+        std::string output;
+        EXPECT(checker, encoder.Encode(reinterpret_cast<const uint8_t*>(noise.data()), noise.size(), &output) == false);
+    }
+
+    void checkOutboundRecordCodec(Checker* checker)
+    {
+        mqtt::OutboundRecordCodec codec;
+
+        std::string payload("{\"val\":[1,2,3]}");
+        payload.push_back('\0');
+        payload.push_back('\xFF');
+        mqtt::Message message(mqtt::topic_e::DAQ_INPUT, payload, mqtt::socket_e::SOCKET_3, 0x1234, mqtt::qos_e::QoS_1, true);
+        message.SetCompressed(true);
+
+        std::vector<uint8_t> record;
+        EXPECT(checker, codec.Encode(message, &record) == Status::Code::GOOD);
+        EXPECT(checker, record.size() == mqtt::OutboundRecordCodec::HEADER_SIZE + payload.size());
+
+        const std::pair<Status, uint16_t> length = codec.ParseHeader(record.data(), record.size());
+        EXPECT(checker, length.first == Status::Code::GOOD);
+        EXPECT(checker, length.second == payload.size());
+
+        std::vector<uint8_t> copied(record);
+        const std::pair<Status, mqtt::Message> decoded = codec.Decode(&copied);
+        EXPECT(checker, decoded.first == Status::Code::GOOD);
+        EXPECT(checker, decoded.second.GetTopicCode() == mqtt::topic_e::DAQ_INPUT);
+        EXPECT(checker, std::string(decoded.second.GetPayload(), decoded.second.GetPayloadLength()) == payload);
+        EXPECT(checker, decoded.second.GetSocketID() == mqtt::socket_e::SOCKET_3);
+        EXPECT(checker, decoded.second.GetMessageID() == 0x1234);
+        EXPECT(checker, decoded.second.GetQoS() == mqtt::qos_e::QoS_1);
+        EXPECT(checker, decoded.second.IsRetain() == true);
+        EXPECT(checker, decoded.second.IsCompressed() == true);
+
+        copied = record;
+        copied.back() ^= 0x01;
+        EXPECT(checker, codec.Decode(&copied).first == Status::Code::BAD_DECODING_ERROR);
+
+        copied = record;
+        copied.pop_back();
+        EXPECT(checker, codec.Decode(&copied).first == Status::Code::BAD_DECODING_ERROR);
+
+        copied = record;
+        copied[0] ^= 0xFF;
+        EXPECT(checker, codec.ParseHeader(copied.data(), copied.size()).first == Status::Code::BAD_DECODING_ERROR);
+        EXPECT(checker, codec.ParseHeader(record.data(), mqtt::OutboundRecordCodec::HEADER_SIZE - 1).first == Status::Code::BAD_DECODING_ERROR);
+
+        mqtt::Message oversized(mqtt::topic_e::DAQ_INPUT, std::string(UINT16_MAX + 1, 'x'));
+        EXPECT(checker, codec.Encode(oversized, &record) == Status::Code::BAD_REQUEST_TOO_LARGE);
+    }
+
+    size_t countOutboundSegments()
+    {
+        size_t count = 0;
+        for (const auto& file : esp32FS.RetrieveFiles())
+        {
+            if (file.first.find(MQTT_OUTBOUND_PREFIX) != std::string::npos)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    void checkOutboundLogRecovery(Checker* checker)
+    {
+        esp32FS.RetrieveFiles().clear();
+        Preferences::Reset();
+
+        const std::string payload(1000, 'p');
+        {
+            mqtt::OutboundLog log;
+            EXPECT(checker, log.Init() == Status::Code::GOOD);
+            EXPECT(checker, log.IsEmpty() == true);
+            EXPECT(checker, log.Read().first == Status::Code::BAD_NO_DATA);
+
+            for (uint8_t idx = 0; idx < 40; ++idx)
+            {
+                EXPECT(checker, log.Append(mqtt::Message(mqtt::topic_e::DAQ_INPUT, std::to_string(idx) + payload)) == Status::Code::GOOD);
+            }
+
+            /**
+             * @note 확인 응답을 기다리는 레코드 뒤에서 이어 읽으며, 앞선 레코드가 확인될 때까지는
+             *       뒤의 레코드가 먼저 확인되더라도 지우지 않습니다.
+             */
+            std::vector<uint32_t> sequences;
+            for (uint8_t idx = 0; idx < 16; ++idx)
+            {
+                const std::pair<Status, mqtt::Message> message = log.Read();
+                EXPECT(checker, message.first == Status::Code::GOOD);
+                EXPECT(checker, std::string(message.second.GetPayload()) == std::to_string(idx) + payload);
+                EXPECT(checker, message.second.GetOutboundSequence() != 0);
+                sequences.emplace_back(message.second.GetOutboundSequence());
+            }
+            EXPECT(checker, log.Read().first == Status::Code::BAD_WOULD_BLOCK);
+            EXPECT(checker, log.Unread(sequences[13]) == Status::Code::BAD_NOT_FOUND);
+            EXPECT(checker, log.Unread(sequences[15]) == Status::Code::GOOD);
+
+            const size_t pendingBytes = log.GetPendingBytes();
+            for (uint8_t idx = 14; idx > 0; --idx)
+            {
+                EXPECT(checker, log.Acknowledge(sequences[idx]) == Status::Code::GOOD);
+            }
+            EXPECT(checker, log.GetPendingBytes() == pendingBytes);
+            EXPECT(checker, log.Acknowledge(sequences[0]) == Status::Code::GOOD);
+            EXPECT(checker, log.GetPendingBytes() < pendingBytes);
+            EXPECT(checker, log.Acknowledge(sequences[0]) == Status::Code::BAD_NOT_FOUND);
+
+            for (uint8_t idx = 15; idx < 20; ++idx)
+            {
+                const std::pair<Status, mqtt::Message> message = log.Read();
+                EXPECT(checker, std::string(message.second.GetPayload()) == std::to_string(idx) + payload);
+                EXPECT(checker, log.Acknowledge(message.second.GetOutboundSequence()) == Status::Code::GOOD);
+            }
+
+            log.Read();
+            log.Read();
+            log.Rewind();
+            EXPECT(checker, std::string(log.Read().second.GetPayload()) == std::to_string(20) + payload);
+        }
+
+        /**
+         * @note 마지막 세그먼트의 끝 레코드가 전원 차단으로 잘린 상태에서 재부팅한 경우를 재현합니다.
+         *       읽기 위치는 16개의 확인 응답마다 저장하므로 마지막으로 저장한 위치부터 다시 전송합니다.
+         */
+        std::vector<uint8_t>* tail = nullptr;
+        for (auto& file : esp32FS.RetrieveFiles())
+        {
+            tail = &file.second;
+        }
+        EXPECT(checker, tail != nullptr);
+        if (tail != nullptr)
+        {
+            tail->resize(tail->size() - 10);
+        }
+
+        mqtt::OutboundLog rebooted;
+        EXPECT(checker, rebooted.Init() == Status::Code::GOOD);
+
+        uint8_t expected = 16;
+        while (true)
+        {
+            const std::pair<Status, mqtt::Message> message = rebooted.Read();
+            if (message.first != Status::Code::GOOD)
+            {
+                break;
+            }
+            EXPECT(checker, std::string(message.second.GetPayload()) == std::to_string(expected) + payload);
+            rebooted.Acknowledge(message.second.GetOutboundSequence());
+            ++expected;
+        }
+        EXPECT(checker, expected == 39);
+        EXPECT(checker, rebooted.IsEmpty() == true);
+        EXPECT(checker, countOutboundSegments() == 0);
+    }
+
+    void checkOutboundLogSegmentCapOnBoot(Checker* checker)
+    {
+        esp32FS.RetrieveFiles().clear();
+        Preferences::Reset();
+
+        {
+            mqtt::OutboundLog log;
+            log.Init();
+            for (uint8_t idx = 0; idx < 6 * 16; ++idx)
+            {
+                log.Append(mqtt::Message(mqtt::topic_e::DAQ_INPUT, std::to_string(idx) + std::string(1020, 'p')));
+            }
+        }
+        EXPECT(checker, countOutboundSegments() == 6);
+
+        /**
+         * @note 부팅할 때마다 새 세그먼트에 기록하므로 재부팅이 반복되어도 세그먼트 수가 한도를
+         *       넘지 않도록 가장 오래된 세그먼트를 버려야 합니다.
+         */
+        for (uint8_t boot = 0; boot < 3; ++boot)
+        {
+            mqtt::OutboundLog log;
+            EXPECT(checker, log.Init() == Status::Code::GOOD);
+            EXPECT(checker, log.GetDroppedSegmentCount() == 1);
+            EXPECT(checker, log.Append(mqtt::Message(mqtt::topic_e::DAQ_INPUT, "boot")) == Status::Code::GOOD);
+            EXPECT(checker, countOutboundSegments() <= 6);
+        }
+
+        mqtt::OutboundLog log;
+        log.Init();
+        size_t pendingMessages = 0;
+        while (true)
+        {
+            const std::pair<Status, mqtt::Message> message = log.Read();
+            if (message.first != Status::Code::GOOD)
+            {
+                break;
+            }
+            log.Acknowledge(message.second.GetOutboundSequence());
+            ++pendingMessages;
+        }
+        EXPECT(checker, pendingMessages > 0);
+        EXPECT(checker, log.IsEmpty() == true);
+    }
+
+    void checkOutboundLogAcknowledgedByBroker(Checker* checker)
+    {
+        esp32FS.RetrieveFiles().clear();
+        Preferences::Reset();
+        EXPECT(checker, mqtt::outboundLog.Init() == Status::Code::GOOD);
+        mqtt::outboundLog.Append(mqtt::Message(mqtt::topic_e::DAQ_INPUT, "first"));
+        mqtt::outboundLog.Append(mqtt::Message(mqtt::topic_e::DAQ_INPUT, "second"));
+
+        mqtt::InflightWindow window;
+        window.SetCapacity(2);
+        for (uint16_t packetID = 1; packetID <= 2; ++packetID)
+        {
+            std::pair<Status, mqtt::Message> message = mqtt::outboundLog.Read();
+            EXPECT(checker, message.first == Status::Code::GOOD);
+            std::pair<Status, mqtt::MessageHandle> handle = mqtt::cdo.Adopt(std::move(message.second));
+            EXPECT(checker, handle.first == Status::Code::GOOD);
+            EXPECT(checker, mqtt::cdo.Count(mqtt::lane_e::BULK) == 0);
+            EXPECT(checker, window.Insert(packetID, std::move(handle.second)) == Status::Code::GOOD);
+            window.MarkSent(packetID);
+        }
+
+        /**
+         * @note 해제만 된 메시지는 레코드를 지우지 않으며, 확인 응답을 받은 메시지만 레코드를 지웁니다.
+         */
+        mqtt::MessageHandle evicted;
+        EXPECT(checker, window.Withdraw(2, &evicted) == Status::Code::GOOD);
+        evicted.Release();
+        EXPECT(checker, window.Acknowledge(1) == Status::Code::GOOD);
+        EXPECT(checker, mqtt::outboundLog.IsEmpty() == false);
+        EXPECT(checker, mqtt::outboundLog.Read().first == Status::Code::BAD_NO_DATA);
+
+        mqtt::outboundLog.Rewind();
+        std::pair<Status, mqtt::Message> message = mqtt::outboundLog.Read();
+        EXPECT(checker, std::string(message.second.GetPayload()) == "second");
+        std::pair<Status, mqtt::MessageHandle> handle = mqtt::cdo.Adopt(std::move(message.second));
+        EXPECT(checker, window.Insert(3, std::move(handle.second)) == Status::Code::GOOD);
+        EXPECT(checker, window.Acknowledge(3) == Status::Code::GOOD);
+        window.MarkSent(3);
+        EXPECT(checker, mqtt::outboundLog.IsEmpty() == true);
+        EXPECT(checker, countOutboundSegments() == 0);
+        EXPECT(checker, mqtt::cdo.Count() == 0);
+    }
+
+    void checkCdoLanes(Checker* checker)
+    {
+        EXPECT(checker, mqtt::cdo.Count() == 0);
+        mqtt::cdo.Store(mqtt::Message(mqtt::topic_e::DAQ_INPUT, "bulk-1"));
+        EXPECT(checker, mqtt::cdo.PublishDiagnostic(mqtt::topic_e::LOG_STREAM, "diagnostic") == Status::Code::GOOD);
+        mqtt::cdo.Store(mqtt::Message(mqtt::topic_e::DAQ_INPUT, "bulk-2"));
+        mqtt::cdo.Store(mqtt::Message(mqtt::topic_e::ALARM, "priority"));
+        EXPECT(checker, mqtt::cdo.Count() == 4);
+
+        std::pair<Status, mqtt::MessageHandle> handle = mqtt::cdo.Acquire();
+        EXPECT(checker, handle.second.GetLane() == mqtt::lane_e::PRIORITY);
+        handle.second.Release();
+
+        handle = mqtt::cdo.Acquire();
+        EXPECT(checker, std::string(handle.second.Get().GetPayload()) == "bulk-1");
+        EXPECT(checker, mqtt::cdo.Requeue(std::move(handle.second)) == Status::Code::GOOD);
+        EXPECT(checker, handle.second.IsValid() == false);
+
+        const char* expected[] = { "bulk-1", "bulk-2", "diagnostic" };
+        for (const char* payload : expected)
+        {
+            handle = mqtt::cdo.Acquire();
+            EXPECT(checker, handle.first == Status::Code::GOOD);
+            EXPECT(checker, std::string(handle.second.Get().GetPayload()) == payload);
+            handle.second.Release();
+        }
+        EXPECT(checker, mqtt::cdo.Acquire().first == Status::Code::BAD_NO_DATA);
+        EXPECT(checker, mqtt::cdo.Count() == 0);
+
+        /**
+         * @note 주기 데이터가 몰리면 진단 메시지는 대기하지 않고 버려집니다.
+         */
+        for (uint8_t idx = 0; idx < 70; ++idx)
+        {
+            mqtt::cdo.Store(mqtt::Message(mqtt::topic_e::DAQ_INPUT, "bulk"));
+        }
+        EXPECT(checker, mqtt::cdo.GetPressure() == mqtt::pressure_e::HIGH);
+        EXPECT(checker, mqtt::cdo.PublishDiagnostic(mqtt::topic_e::LOG_STREAM, "diagnostic") == Status::Code::BAD_WOULD_BLOCK);
+        EXPECT(checker, mqtt::cdo.Count(mqtt::lane_e::DIAGNOSTIC) == 0);
+
+        mqtt::Message rejected(mqtt::topic_e::METRICS, "rejected");
+        EXPECT(checker, mqtt::cdo.Store(std::move(rejected), 0) == Status::Code::BAD_WOULD_BLOCK);
+        EXPECT(checker, std::string(rejected.GetPayload()) == "rejected");
+        while (mqtt::cdo.Acquire().first == Status::Code::GOOD)
+        {
+        }
+        EXPECT(checker, mqtt::cdo.Count() == 0);
+    }
+
+    typedef struct ProtobufFieldType
+    {
+        uint32_t Number;
+        uint64_t Varint;
+        std::string Bytes;
+    } protobuf_field_t;
+
+    /**
+     * @note 펌웨어에는 Protobuf 디코더가 없으므로 Sparkplug B가 사용하는 varint, 64비트,
+     *       길이 지정 형식만 해석합니다. 해석할 수 없으면 빈 벡터를 반환합니다.
+     */
+    std::vector<protobuf_field_t> decodeProtobuf(const std::string& input)
+    {
+        std::vector<protobuf_field_t> fields;
+        size_t position = 0;
+
+        auto readVarint = [&](uint64_t* value) -> bool
+        {
+            *value = 0;
+            for (uint8_t shift = 0; shift < 64; shift += 7)
+            {
+                if (position == input.size())
+                {
+                    return false;
+                }
+                const uint8_t byte = static_cast<uint8_t>(input[position++]);
+                *value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        while (position < input.size())
+        {
+            uint64_t key = 0;
+            if (readVarint(&key) == false)
+            {
+                return std::vector<protobuf_field_t>();
+            }
+
+            protobuf_field_t field;
+            field.Number = static_cast<uint32_t>(key >> 3);
+            field.Varint = 0;
+
+            switch (key & 0x07)
+            {
+            case 0:
+                if (readVarint(&field.Varint) == false)
+                {
+                    return std::vector<protobuf_field_t>();
+                }
+                break;
+            case 1:
+                if (input.size() - position < 8)
+                {
+                    return std::vector<protobuf_field_t>();
+                }
+                field.Bytes = input.substr(position, 8);
+                position += 8;
+                break;
+            case 2:
+            {
+                uint64_t length = 0;
+                if (readVarint(&length) == false || input.size() - position < length)
+                {
+                    return std::vector<protobuf_field_t>();
+                }
+                field.Bytes = input.substr(position, length);
+                position += length;
+                break;
+            }
+            default:
+                return std::vector<protobuf_field_t>();
+            }
+            fields.emplace_back(field);
+        }
+
+        return fields;
+    }
+
+    const protobuf_field_t* findField(const std::vector<protobuf_field_t>& fields, const uint32_t number)
+    {
+        for (const auto& field : fields)
+        {
+            if (field.Number == number)
+            {
+                return &field;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<std::vector<protobuf_field_t>> decodeSparkplugMetrics(const std::vector<protobuf_field_t>& payload)
+    {
+        std::vector<std::vector<protobuf_field_t>> metrics;
+        for (const auto& field : payload)
+        {
+            if (field.Number == 2)
+            {
+                metrics.emplace_back(decodeProtobuf(field.Bytes));
+            }
+        }
+        return metrics;
+    }
+
+    json_datum_t makeDatum(const char* nodeID, const std::string& value)
+    {
+        json_datum_t datum;
+        datum.Topic = mqtt::topic_e::SPARKPLUG_NDATA;
+        datum.SourceTimestamp = 0;
+        strncpy(datum.NodeID, nodeID, sizeof(datum.NodeID));
+        datum.Value = value;
+        return datum;
+    }
+
+    /**
+     * @note 브로커 설정의 "format" 키가 1이면 PubTask가 수행하는 NBIRTH, NDATA, NDEATH 인코딩을
+     *       순서대로 실행하고, 발행 경로와 같이 CDO를 거친 페이로드를 Sparkplug B 규격대로 해석합니다.
+     */
+    void checkSparkplugEncoding(Checker* checker)
+    {
+        SparkplugB encoder;
+        EXPECT(checker, encoder.IsBirthRequired() == true);
+
+        const std::vector<json_datum_t> metrics = {
+            makeDatum("P001", "1234"),
+            makeDatum("P002", "-12.5"),
+            makeDatum("P003", "007"),
+            makeDatum("P004", "true")
+        };
+
+        const std::string birth = encoder.EncodeBirth(metrics, 1700000000000);
+        EXPECT(checker, encoder.IsBirthRequired() == false);
+
+        const std::vector<protobuf_field_t> birthFields = decodeProtobuf(birth);
+        EXPECT(checker, birthFields.empty() == false);
+        EXPECT(checker, findField(birthFields, 1) != nullptr && findField(birthFields, 1)->Varint == 1700000000000);
+        EXPECT(checker, findField(birthFields, 3) != nullptr && findField(birthFields, 3)->Varint == 0);
+
+        const std::vector<std::vector<protobuf_field_t>> birthMetrics = decodeSparkplugMetrics(birthFields);
+        EXPECT(checker, birthMetrics.size() == metrics.size() + 1);
+        if (birthMetrics.size() != metrics.size() + 1)
+        {
+            return;
+        }
+        EXPECT(checker, findField(birthMetrics[0], 1) != nullptr && findField(birthMetrics[0], 1)->Bytes == "bdSeq");
+        EXPECT(checker, findField(birthMetrics[0], 11) != nullptr && findField(birthMetrics[0], 11)->Varint == 0);
+
+        const uint64_t expectedTypes[] = { 4, 10, 12, 11 };
+        std::map<std::string, uint64_t> aliases;
+        for (size_t idx = 0; idx < metrics.size(); ++idx)
+        {
+            const std::vector<protobuf_field_t>& metric = birthMetrics[idx + 1];
+            EXPECT(checker, findField(metric, 1) != nullptr && findField(metric, 1)->Bytes == metrics[idx].NodeID);
+            EXPECT(checker, findField(metric, 2) != nullptr);
+            EXPECT(checker, findField(metric, 4) != nullptr && findField(metric, 4)->Varint == expectedTypes[idx]);
+            if (findField(metric, 2) != nullptr)
+            {
+                aliases[metrics[idx].NodeID] = findField(metric, 2)->Varint;
+            }
+        }
+        EXPECT(checker, aliases.size() == metrics.size());
+        EXPECT(checker, findField(birthMetrics[1], 11) != nullptr && findField(birthMetrics[1], 11)->Varint == 1234);
+        EXPECT(checker, findField(birthMetrics[3], 15) != nullptr && findField(birthMetrics[3], 15)->Bytes == "007");
+        EXPECT(checker, findField(birthMetrics[4], 14) != nullptr && findField(birthMetrics[4], 14)->Varint == 1);
+
+        for (uint8_t round = 1; round < 3; ++round)
+        {
+            encoder.Begin(1700000001000);
+            EXPECT(checker, encoder.IsEmpty() == true);
+            EXPECT(checker, encoder.Append(makeDatum("P001", "1235")) == true);
+            EXPECT(checker, encoder.Append(makeDatum("P002", "MFM_NULL")) == true);
+            EXPECT(checker, encoder.Append(makeDatum("P005", "abc")) == true);
+            EXPECT(checker, encoder.GetCount() == 3);
+
+            mqtt::MessageHandle handle = storeAndAcquire(mqtt::topic_e::SPARKPLUG_NDATA, encoder.Finish());
+            EXPECT(checker, handle.IsValid() == true);
+            if (handle.IsValid() == false)
+            {
+                return;
+            }
+            EXPECT(checker, handle.Get().GetTopicCode() == mqtt::topic_e::SPARKPLUG_NDATA);
+
+            const std::vector<protobuf_field_t> dataFields = decodeProtobuf(std::string(handle.Get().GetPayload(), handle.Get().GetPayloadLength()));
+            EXPECT(checker, findField(dataFields, 3) != nullptr && findField(dataFields, 3)->Varint == round);
+
+            const std::vector<std::vector<protobuf_field_t>> dataMetrics = decodeSparkplugMetrics(dataFields);
+            EXPECT(checker, dataMetrics.size() == 3);
+            if (dataMetrics.size() != 3)
+            {
+                return;
+            }
+
+            EXPECT(checker, findField(dataMetrics[0], 1) == nullptr);
+            EXPECT(checker, findField(dataMetrics[0], 2) != nullptr && findField(dataMetrics[0], 2)->Varint == aliases["P001"]);
+            EXPECT(checker, findField(dataMetrics[0], 4) == nullptr);
+            EXPECT(checker, findField(dataMetrics[0], 11) != nullptr && findField(dataMetrics[0], 11)->Varint == 1235);
+            EXPECT(checker, findField(dataMetrics[1], 7) != nullptr && findField(dataMetrics[1], 7)->Varint == 1);
+
+            EXPECT(checker, findField(dataMetrics[2], 1) != nullptr && findField(dataMetrics[2], 1)->Bytes == "P005");
+            EXPECT(checker, findField(dataMetrics[2], 4) != nullptr && findField(dataMetrics[2], 4)->Varint == 12);
+            EXPECT(checker, findField(dataMetrics[2], 15) != nullptr && findField(dataMetrics[2], 15)->Bytes == "abc");
+        }
+
+        encoder.SetCapacity(UINT8_MAX);
+        encoder.Begin(1700000002000);
+        size_t appended = 0;
+        while (encoder.Append(makeDatum("P001", std::string(16, 'x'))) == true)
+        {
+            ++appended;
+        }
+        EXPECT(checker, appended > 0 && appended == encoder.GetCount());
+        EXPECT(checker, encoder.Finish().size() <= UINT8_MAX);
+
+        encoder.RequestBirth();
+        EXPECT(checker, encoder.IsBirthRequired() == true);
+        const std::vector<protobuf_field_t> rebirth = decodeProtobuf(encoder.EncodeBirth(metrics, 1700000003000));
+        EXPECT(checker, findField(rebirth, 3) != nullptr && findField(rebirth, 3)->Varint == 0);
+
+        const std::vector<std::vector<protobuf_field_t>> deathMetrics = decodeSparkplugMetrics(decodeProtobuf(encoder.EncodeDeath()));
+        EXPECT(checker, deathMetrics.size() == 1);
+        EXPECT(checker, deathMetrics.size() == 1 && findField(deathMetrics[0], 11) != nullptr && findField(deathMetrics[0], 11)->Varint == 1);
+    }
+
+    void checkInflightWindow(Checker* checker)
+    {
+        mqtt::InflightWindow window;
+        window.SetCapacity(mqtt::InflightWindow::MAX_CAPACITY + 1);
+        EXPECT(checker, window.GetCapacity() == mqtt::InflightWindow::MAX_CAPACITY);
+        window.SetCapacity(2);
+
+        mqtt::MessageHandle first  = storeAndAcquire(mqtt::topic_e::DAQ_INPUT, "first");
+        mqtt::MessageHandle second = storeAndAcquire(mqtt::topic_e::DAQ_INPUT, "second");
+        mqtt::MessageHandle third  = storeAndAcquire(mqtt::topic_e::DAQ_INPUT, "third");
+        EXPECT(checker, window.Insert(1, std::move(first)) == Status::Code::GOOD);
+        EXPECT(checker, window.Insert(2, std::move(second)) == Status::Code::GOOD);
+        EXPECT(checker, window.IsFull() == true);
+        EXPECT(checker, window.Insert(3, std::move(third)) == Status::Code::BAD_WOULD_BLOCK);
+        EXPECT(checker, third.IsValid() == true);
+
+        /**
+         * @note 발행 중에 확인 응답이 먼저 수신되어도 MarkSent()까지는 메시지를 참조하므로 해제하지 않습니다.
+         */
+        EXPECT(checker, window.Acknowledge(1) == Status::Code::GOOD);
+        EXPECT(checker, window.Count() == 2);
+        window.MarkSent(1);
+        EXPECT(checker, window.Count() == 1);
+        EXPECT(checker, window.Acknowledge(1) == Status::Code::BAD_NOT_FOUND);
+
+        mqtt::MessageHandle withdrawn;
+        EXPECT(checker, window.Withdraw(2, &withdrawn) == Status::Code::GOOD);
+        EXPECT(checker, std::string(withdrawn.Get().GetPayload()) == "second");
+        withdrawn.Release();
+
+        EXPECT(checker, window.Insert(3, std::move(third)) == Status::Code::GOOD);
+        window.MarkSent(3);
+
+        std::vector<uint16_t> resent;
+        auto resend = [&resent](const uint16_t packetID, const mqtt::Message&)
+        {
+            resent.emplace_back(packetID);
+            return true;
+        };
+        window.Retransmit(60 * SECOND_IN_MILLIS, resend);
+        EXPECT(checker, resent.empty() == true);
+        EXPECT(checker, window.Expire(3) == Status::Code::GOOD);
+        window.Retransmit(60 * SECOND_IN_MILLIS, resend);
+        EXPECT(checker, resent == std::vector<uint16_t>(1, 3));
+        window.ExpireAll();
+        window.Retransmit(60 * SECOND_IN_MILLIS, resend);
+        EXPECT(checker, resent.size() == 2);
+
+        mqtt::MessageHandle evicted;
+        EXPECT(checker, window.Evict(&evicted) == Status::Code::GOOD);
+        EXPECT(checker, std::string(evicted.Get().GetPayload()) == "third");
+        EXPECT(checker, window.Evict(&evicted) == Status::Code::BAD_NO_DATA);
+        evicted.Release();
+        EXPECT(checker, window.Count() == 0);
+        EXPECT(checker, mqtt::cdo.Count() == 0);
+    }
+
+    void checkTrafficShaper(Checker* checker)
+    {
+        const size_t maxPayloadSize = 4096;
+        mqtt::TrafficShaper shaper;
+        EXPECT(checker, shaper.Classify(mqtt::topic_e::ALARM) == mqtt::traffic_class_e::ALARM);
+        EXPECT(checker, shaper.Classify(mqtt::topic_e::DAQ_INPUT) == mqtt::traffic_class_e::DAQ);
+        EXPECT(checker, shaper.Classify(mqtt::topic_e::JARVIS_STATUS) == mqtt::traffic_class_e::STATUS);
+
+        for (uint8_t idx = 0; idx < 50; ++idx)
+        {
+            mqtt::MessageHandle handle = storeAndAcquire(mqtt::topic_e::DAQ_INPUT, "x");
+            EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == true);
+        }
+
+        shaper.ApplyCatM1Profile();
+        for (uint8_t idx = 0; idx < 3; ++idx)
+        {
+            mqtt::MessageHandle handle = storeAndAcquire(mqtt::topic_e::JARVIS_STATUS, "status");
+            EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == true);
+        }
+
+        /**
+         * @note 토큰이 소진되면 JSON 객체는 같은 토픽의 보류 메시지에 배열로 병합됩니다.
+         */
+        mqtt::MessageHandle handle = storeAndAcquire(mqtt::topic_e::JARVIS_STATUS, "{\"a\":1}");
+        EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == false);
+        EXPECT(checker, handle.IsValid() == false);
+        handle = storeAndAcquire(mqtt::topic_e::JARVIS_STATUS, "{\"a\":2}");
+        EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == false);
+        EXPECT(checker, handle.IsValid() == false);
+        EXPECT(checker, shaper.Count() == 1);
+
+        for (uint8_t idx = 1; idx < 16; ++idx)
+        {
+            handle = storeAndAcquire(mqtt::topic_e::JARVIS_STATUS, "plain");
+            EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == false);
+            EXPECT(checker, handle.IsValid() == false);
+        }
+
+        /**
+         * @note 보류할 공간이 없는 유형의 메시지는 호출자에게 남고, 다른 유형은 계속 발행할 수 있어야 합니다.
+         */
+        handle = storeAndAcquire(mqtt::topic_e::JARVIS_STATUS, "plain");
+        EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == false);
+        EXPECT(checker, handle.IsValid() == true);
+        handle.Release();
+
+        handle = storeAndAcquire(mqtt::topic_e::ALARM, "alarm");
+        EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == true);
+        handle.Release();
+
+        EXPECT(checker, shaper.AcquireReady().first == Status::Code::BAD_NO_DATA);
+
+        std::pair<Status, mqtt::MessageHandle> pending = shaper.AcquirePending();
+        EXPECT(checker, pending.first == Status::Code::GOOD);
+        EXPECT(checker, std::string(pending.second.Get().GetPayload()) == "[{\"a\":1},{\"a\":2}]");
+        pending.second.Release();
+        EXPECT(checker, shaper.Count() == 15);
+
+        /**
+         * @note 속도 제한을 해제하면 남아 있는 보류 메시지는 토큰 없이 순서대로 꺼냅니다.
+         */
+        shaper.ClearLimits();
+        size_t released = 0;
+        while (true)
+        {
+            pending = shaper.AcquireReady();
+            if (pending.first != Status::Code::GOOD)
+            {
+                break;
+            }
+            pending.second.Release();
+            ++released;
+        }
+        EXPECT(checker, released == 15);
+        EXPECT(checker, shaper.Count() == 0);
+
+        /**
+         * @note 두 번의 Admit() 사이에 토큰이 충전되지 않도록 충전 주기를 충분히 길게 설정합니다.
+         */
+        shaper.SetBucket(mqtt::traffic_class_e::DAQ, 10, 1);
+        handle = storeAndAcquire(mqtt::topic_e::DAQ_INPUT, "first");
+        EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == true);
+        handle.Release();
+
+        /**
+         * @note 발행 계층이 받아들이지 않아 되돌린 토큰은 다음 메시지가 사용할 수 있습니다.
+         */
+        shaper.Refund(mqtt::topic_e::DAQ_INPUT);
+        shaper.Refund(mqtt::topic_e::DAQ_INPUT);
+        handle = storeAndAcquire(mqtt::topic_e::DAQ_INPUT, "refunded");
+        EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == true);
+        handle.Release();
+
+        handle = storeAndAcquire(mqtt::topic_e::DAQ_INPUT, "second");
+        EXPECT(checker, shaper.Admit(&handle, maxPayloadSize) == false);
+        EXPECT(checker, shaper.AcquireReady().first == Status::Code::BAD_NO_DATA);
+        delay(120);
+        pending = shaper.AcquireReady();
+        EXPECT(checker, pending.first == Status::Code::GOOD);
+        EXPECT(checker, pending.second.IsValid() == true && std::string(pending.second.Get().GetPayload()) == "second");
+        pending.second.Release();
+        EXPECT(checker, mqtt::cdo.Count() == 0);
+    }
+
+    /**
+     * @brief AT+IPR 명령에 응답하는 BG96 모뎀과 보드의 UART 배선을 모사합니다.
+     * @details 배선의 한계를 넘는 속도에서는 프레임이 모두 유실되고, 한계 근처의 속도에서는
+     *          세 프레임 중 하나만 전달됩니다. 양쪽의 속도가 다르면 프레임이 전달되지 않습니다.
+     */
+    class SimulatedModem
+    {
+    public:
+        SimulatedModem(const uint32_t marginalBaudRate, const uint32_t deadBaudRate)
+            : ModemBaudRate(115200)
+            , HostBaudRate(115200)
+            , RejectedBaudRate(0)
+            , CommandCount(0)
+            , mMarginalBaudRate(marginalBaudRate)
+            , mDeadBaudRate(deadBaudRate)
+            , mFrameCount(0)
+        {
+        }
+    public:
+        BaudRateNegotiator::link_t MakeLink()
+        {
+            BaudRateNegotiator::link_t link;
+            link.SendCommand = [this](const std::string& command, const uint32_t)
+            {
+                return receive(command);
+            };
+            link.Write = [this](const std::string& command)
+            {
+                receive(command);
+            };
+            link.SetBaudRate = [this](const uint32_t baudRate)
+            {
+                HostBaudRate = baudRate;
+            };
+            link.Probe = [this]()
+            {
+                return receive("AT");
+            };
+            link.Delay = [](const uint32_t) {};
+            return link;
+        }
+        void Reset()
+        {
+            ModemBaudRate = 115200;
+            HostBaudRate  = 115200;
+        }
+    public:
+        uint32_t ModemBaudRate;
+        uint32_t HostBaudRate;
+        uint32_t RejectedBaudRate;
+        uint32_t CommandCount;
+    private:
+        bool isDelivered()
+        {
+            ++mFrameCount;
+            if (HostBaudRate != ModemBaudRate || HostBaudRate >= mDeadBaudRate)
+            {
+                return false;
+            }
+            return HostBaudRate < mMarginalBaudRate || mFrameCount % 3 == 0;
+        }
+        Status receive(const std::string& command)
+        {
+            ++CommandCount;
+            if (isDelivered() == false)
+            {
+                return Status(Status::Code::BAD_TIMEOUT);
+            }
+
+            if (command.compare(0, 7, "AT+IPR=") == 0)
+            {
+                const uint32_t baudRate = static_cast<uint32_t>(std::stoul(command.substr(7)));
+                if (baudRate == RejectedBaudRate)
+                {
+                    return Status(Status::Code::BAD);
+                }
+
+                const bool isResponded = isDelivered();
+                ModemBaudRate = baudRate;
+                return isResponded ? Status(Status::Code::GOOD) : Status(Status::Code::BAD_TIMEOUT);
+            }
+            return isDelivered() ? Status(Status::Code::GOOD) : Status(Status::Code::BAD_TIMEOUT);
+        }
+    private:
+        const uint32_t mMarginalBaudRate;
+        const uint32_t mDeadBaudRate;
+        uint32_t mFrameCount;
+    };
+
+    void checkBaudRateNegotiation(Checker* checker)
+    {
+        {
+            SimulatedModem modem(UINT32_MAX, UINT32_MAX);
+            BaudRateNegotiator negotiator(modem.MakeLink());
+            const std::pair<Status, uint32_t> ret = negotiator.Negotiate(115200, 921600);
+            EXPECT(checker, ret.first == Status::Code::GOOD);
+            EXPECT(checker, ret.second == 921600);
+            EXPECT(checker, modem.ModemBaudRate == 921600 && modem.HostBaudRate == 921600);
+        }
+
+        /**
+         * @note 흐름 제어가 없는 보드는 460,800bps를 넘는 속도를 모뎀에 요청하지 않아야 합니다.
+         */
+        {
+            SimulatedModem modem(UINT32_MAX, UINT32_MAX);
+            modem.RejectedBaudRate = 921600;
+            BaudRateNegotiator negotiator(modem.MakeLink());
+            const std::pair<Status, uint32_t> ret = negotiator.Negotiate(115200, 460800);
+            EXPECT(checker, ret.first == Status::Code::GOOD);
+            EXPECT(checker, ret.second == 460800);
+            EXPECT(checker, modem.ModemBaudRate == 460800 && modem.HostBaudRate == 460800);
+
+            SimulatedModem rejecting(UINT32_MAX, UINT32_MAX);
+            rejecting.RejectedBaudRate = 921600;
+            BaudRateNegotiator fallback(rejecting.MakeLink());
+            EXPECT(checker, fallback.Negotiate(115200, 921600).second == 460800);
+            EXPECT(checker, fallback.GetCeiling() == UINT32_MAX);
+        }
+
+        /**
+         * @note 한계 근처의 속도는 간헐적으로 응답하더라도 연속으로 응답하지 않으면 사용하지 않아야 하며,
+         *       되돌리는 명령이 유실되어도 모뎀과 ESP32가 같은 속도로 돌아와야 합니다.
+         */
+        {
+            SimulatedModem modem(921600, UINT32_MAX);
+            BaudRateNegotiator negotiator(modem.MakeLink());
+            const std::pair<Status, uint32_t> ret = negotiator.Negotiate(115200, 921600);
+            EXPECT(checker, ret.first == Status::Code::GOOD);
+            EXPECT(checker, ret.second == 460800);
+            EXPECT(checker, modem.ModemBaudRate == 460800 && modem.HostBaudRate == 460800);
+            EXPECT(checker, negotiator.GetCeiling() < 921600);
+        }
+
+        /**
+         * @note 모뎀을 되돌리지 못하면 재설정이 필요하다고 알리고, 재설정한 다음에는 실패한 속도를
+         *       다시 시도하지 않아야 합니다.
+         */
+        {
+            SimulatedModem modem(UINT32_MAX, 921600);
+            BaudRateNegotiator negotiator(modem.MakeLink());
+            std::pair<Status, uint32_t> ret = negotiator.Negotiate(115200, 921600);
+            EXPECT(checker, ret.first == Status::Code::BAD_NOT_CONNECTED);
+            EXPECT(checker, ret.second == 115200);
+
+            modem.Reset();
+            const uint32_t commandCount = modem.CommandCount;
+            ret = negotiator.Negotiate(115200, 921600);
+            EXPECT(checker, ret.first == Status::Code::GOOD);
+            EXPECT(checker, ret.second == 460800);
+            EXPECT(checker, modem.CommandCount - commandCount == 4);
+        }
+
+        {
+            SimulatedModem modem(230400, UINT32_MAX);
+            BaudRateNegotiator negotiator(modem.MakeLink());
+            const std::pair<Status, uint32_t> ret = negotiator.Negotiate(115200, 921600);
+            EXPECT(checker, ret.first == Status::Code::BAD_NO_COMMUNICATION);
+            EXPECT(checker, ret.second == 115200);
+            EXPECT(checker, modem.ModemBaudRate == 115200 && modem.HostBaudRate == 115200);
+
+            const uint32_t commandCount = modem.CommandCount;
+            EXPECT(checker, negotiator.Negotiate(115200, 921600).first == Status::Code::BAD_NO_COMMUNICATION);
+            EXPECT(checker, modem.CommandCount == commandCount);
+        }
+    }
+
+    void checkReplayFile(Checker* checker)
+    {
+        modbus::PolledDataTable table;
+        table.UpdateHoldingRegister(1, 100, 0x1234);
+        table.UpdateHoldingRegister(1, 101, -1);
+        table.UpdateHoldingRegister(1, 102, 0xBEEF);
+        table.UpdateCoil(2, 7, 1);
+        table.UpdateCoil(2, 8, 0);
+
+        std::string encoded;
+        table.Encode(&encoded);
+        modbus::PolledDataTable decoded;
+        EXPECT(checker, decoded.Decode(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size()) == Status::Code::GOOD);
+        EXPECT(checker, decoded.RetrieveHoldingRegister(1, 100).Value == 0x1234);
+        EXPECT(checker, decoded.RetrieveHoldingRegister(1, 101).IsOK == false);
+        EXPECT(checker, decoded.RetrieveHoldingRegister(1, 102).Value == 0xBEEF);
+        EXPECT(checker, decoded.RetrieveCoil(2, 7).Value == 1 && decoded.RetrieveCoil(2, 7).IsOK == true);
+        EXPECT(checker, decoded.RetrieveCoil(2, 8).Value == 0 && decoded.RetrieveCoil(2, 8).IsOK == true);
+        EXPECT(checker, decoded.Decode(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size() - 1) != Status::Code::GOOD);
+
+        /**
+         * @note 두 드라이버의 프레임을 번갈아 기록하고 전원이 꺼진 것처럼 마지막 프레임을 자릅니다.
+         */
+        esp32FS.RetrieveFiles().clear();
+        File file = esp32FS.Open("/replay.bin", FILE_WRITE, true);
+        EXPECT(checker, ReplayFile::WriteHeader(&file, 1760745600000ULL) == Status::Code::GOOD);
+        const uint64_t rtu = ReplayFile::MakeKey(replay_source_e::MODBUS_RTU, 2, 0);
+        const uint64_t tcp = ReplayFile::MakeKey(replay_source_e::MODBUS_TCP, 0x0A01A8C0, 502);
+        for (uint8_t idx = 0; idx < 3; ++idx)
+        {
+            const std::string payload(1 + idx, static_cast<char>('a' + idx));
+            EXPECT(checker, ReplayFile::WriteFrame(&file, replay_source_e::MODBUS_RTU, 2, 0, idx * 1000, payload) ==
+                ReplayFile::FRAME_HEADER_SIZE + payload.size());
+            ReplayFile::WriteFrame(&file, replay_source_e::MODBUS_TCP, 0x0A01A8C0, 502, idx * 1000 + 500, encoded);
+        }
+        ReplayFile::WriteFrame(&file, replay_source_e::MODBUS_RTU, 2, 0, 9000, std::string(32, 'z'));
+        std::vector<uint8_t>& binary = esp32FS.RetrieveFiles()["/replay.bin"];
+        binary.resize(binary.size() - 1);
+
+        ReplayFile replay;
+        EXPECT(checker, replay.Inspect(&file) == Status::Code::GOOD);
+        EXPECT(checker, replay.GetFrameCount() == 6);
+        EXPECT(checker, replay.GetChannelCount() == 2);
+        EXPECT(checker, replay.GetDurationMillis() == 2500);
+
+        std::string payload;
+        EXPECT(checker, replay.ReadFrame(&file, tcp, 499, &payload) == Status::Code::GOOD);
+        EXPECT(checker, payload.empty() == true);
+        EXPECT(checker, replay.ReadFrame(&file, tcp, 500, &payload) == Status::Code::GOOD);
+        EXPECT(checker, payload == encoded);
+
+        for (uint8_t round = 0; round < 2; ++round)
+        {
+            for (uint8_t idx = 0; idx < 3; ++idx)
+            {
+                EXPECT(checker, replay.IsExhausted() == false);
+                EXPECT(checker, replay.ReadFrame(&file, rtu, UINT64_MAX, &payload) == Status::Code::GOOD);
+                EXPECT(checker, payload == std::string(1 + idx, static_cast<char>('a' + idx)));
+            }
+            EXPECT(checker, replay.ReadFrame(&file, rtu, UINT64_MAX, &payload) == Status::Code::GOOD);
+            EXPECT(checker, payload.empty() == true);
+
+            while (replay.IsExhausted() == false)
+            {
+                EXPECT(checker, replay.ReadFrame(&file, tcp, UINT64_MAX, &payload) == Status::Code::GOOD);
+                EXPECT(checker, payload == encoded);
+            }
+            replay.Rewind();
+        }
+
+        EXPECT(checker, replay.ReadFrame(&file, ReplayFile::MakeKey(replay_source_e::MELSEC, 1, 1), UINT64_MAX, &payload) == Status::Code::BAD_NOT_FOUND);
+
+        binary[0] = 'X';
+        EXPECT(checker, replay.Inspect(&file) == Status::Code::BAD_DATA_ENCODING_INVALID);
+        binary.resize(ReplayFile::FILE_HEADER_SIZE);
+        binary[0] = 'M';
+        EXPECT(checker, replay.Inspect(&file) == Status::Code::BAD_NO_DATA);
+    }
+
+    im::poll_data_t makePolledWord(const uint16_t address, const uint16_t value, const uint64_t timestamp)
+    {
+        im::poll_data_t datum;
+        datum.StatusCode        = Status::Code::GOOD;
+        datum.AddressType       = jvs::adtp_e::NUMERIC;
+        datum.Address.Numeric   = address;
+        datum.Timestamp         = timestamp;
+        datum.ValueType         = jvs::dt_e::UINT16;
+        datum.Value.UInt16      = value;
+        return datum;
+    }
+
+    void checkVariableDecode(Checker* checker)
+    {
+        jvs::config::Node swapped;
+        swapped.SetNodeID("P001");
+        swapped.SetAddressType(jvs::adtp_e::NUMERIC);
+        jvs::addr_u address;
+        address.Numeric = 100;
+        swapped.SetAddrress(address);
+        swapped.SetNodeArea(jvs::node_area_e::HOLDING_REGISTER);
+        swapped.SetNumericAddressQuantity(2);
+        swapped.SetDataTypes(std::vector<jvs::dt_e>(1, jvs::dt_e::FLOAT32));
+        swapped.SetAttributeEvent(false);
+        swapped.SetTopic(mqtt::topic_e::DAQ_INPUT);
+
+        jvs::DataUnitOrder order(2);
+        jvs::ord_t unit;
+        unit.DataUnit  = jvs::data_unit_e::WORD;
+        unit.ByteOrder = jvs::byte_order_e::HIGHER;
+        unit.Index     = 1;
+        order.EmplaceBack(unit);
+        unit.Index     = 0;
+        order.EmplaceBack(unit);
+        swapped.SetDataUnitOrders(std::vector<jvs::DataUnitOrder>(1, order));
+
+        /**
+         * @note 워드 순서를 바꾸어 0x40490000으로 조립하므로 3.140625이며, 스케일이 없는 실수는
+         *       소수점 두 자리로 발행합니다.
+         */
+        im::Variable variable(&swapped);
+        EXPECT(checker, variable.CreateDaqStruct().first == false);
+        variable.Update({ makePolledWord(100, 0x0000, 1000), makePolledWord(101, 0x4049, 1000) });
+        std::pair<bool, json_datum_t> daq = variable.CreateDaqStruct();
+        EXPECT(checker, daq.first == true);
+        EXPECT(checker, strcmp(daq.second.NodeID, "P001") == 0);
+        EXPECT(checker, daq.second.Topic == mqtt::topic_e::DAQ_INPUT);
+        EXPECT(checker, daq.second.SourceTimestamp == 1000);
+        EXPECT(checker, daq.second.Value == "3.14");
+        EXPECT(checker, variable.RetrieveVersion() == 1);
+
+        variable.Update({ makePolledWord(100, 0x0000, 2000), makePolledWord(101, 0x4049, 2000) });
+        EXPECT(checker, variable.RetrieveVersion() == 1);
+        variable.Update({ makePolledWord(100, 0x0000, 3000), makePolledWord(101, 0x3F80, 3000) });
+        EXPECT(checker, variable.RetrieveVersion() == 2);
+        EXPECT(checker, variable.CreateDaqStruct().second.Value == "1.00");
+
+        im::poll_data_t timedOut = makePolledWord(101, 0x3F80, 4000);
+        timedOut.StatusCode = Status::Code::BAD_TIMEOUT;
+        variable.Update({ makePolledWord(100, 0x0000, 4000), timedOut });
+        EXPECT(checker, variable.CreateDaqStruct().first == false);
+        EXPECT(checker, variable.RetrieveVersion() == 3);
+
+        /**
+         * @note 부호 있는 정수에 스케일을 적용한 뒤 오프셋을 더하며, 소수점 자릿수는 스케일을 따릅니다.
+         */
+        jvs::config::Node scaled;
+        scaled.SetNodeID("P002");
+        scaled.SetAddressType(jvs::adtp_e::NUMERIC);
+        address.Numeric = 102;
+        scaled.SetAddrress(address);
+        scaled.SetNodeArea(jvs::node_area_e::INPUT_REGISTER);
+        scaled.SetNumericAddressQuantity(1);
+        scaled.SetDataTypes(std::vector<jvs::dt_e>(1, jvs::dt_e::INT16));
+        scaled.SetNumericScale(jvs::scl_e::NEGATIVE_1);
+        scaled.SetNumericOffset(10.0f);
+        scaled.SetAttributeEvent(false);
+        scaled.SetTopic(mqtt::topic_e::DAQ_INPUT);
+
+        im::Variable scaledVariable(&scaled);
+        scaledVariable.Update({ makePolledWord(102, 1234, 1000) });
+        EXPECT(checker, scaledVariable.CreateDaqStruct().second.Value == "133.4");
+        scaledVariable.Update({ makePolledWord(102, static_cast<uint16_t>(-250), 2000) });
+        EXPECT(checker, scaledVariable.CreateDaqStruct().second.Value == "-15.0");
+        EXPECT(checker, scaledVariable.RetrieveVersion() == 2);
+    }
+
+    void checkBase64(Checker* checker)
+    {
+        EXPECT(checker, DecodeBase64(SM_ID_B64_CONFIGURATION) == "urn:semyeong:sm:Configuration:Z920S:25085028:1.0");
+        EXPECT(checker, EncodeBase64("urn:semyeong:sm:Configuration:Z920S:25085028:1.0") == SM_ID_B64_CONFIGURATION);
+        EXPECT(checker, EncodeBase64("hello", false) == "aGVsbG8=");
+        EXPECT(checker, EncodeBase64("hello") == "aGVsbG8");
+        EXPECT(checker, DecodeBase64("aGVsbG8") == "hello");
+        EXPECT(checker, DecodeBase64("-_-_") == DecodeBase64("+/+/"));
+
+        psram::string binary;
+        for (uint16_t value = 0; value < 256; ++value)
+        {
+            binary += static_cast<char>(value);
+        }
+        EXPECT(checker, DecodeBase64(EncodeBase64(binary).c_str()) == binary);
+        EXPECT(checker, DecodeBase64(EncodeBase64(binary, false).c_str()) == binary);
+
+        /**
+         * @note 부호 있는 char를 쓰는 플랫폼에서도 ASCII 밖의 문자가 변환표 밖을 읽지 않아야 합니다.
+         */
+        EXPECT(checker, DecodeBase64("\xC3\xA9\xC3\xA9").size() == 3);
+    }
+
+    std::string makeHexRecord(const uint16_t address, const std::vector<uint8_t>& data)
+    {
+        char buffer[16];
+        uint8_t checksum = static_cast<uint8_t>(data.size() + (address >> 8) + (address & 0xFF));
+        snprintf(buffer, sizeof(buffer), ":%02X%04X00", static_cast<unsigned int>(data.size()), address);
+        std::string record(buffer);
+        for (const auto& byte : data)
+        {
+            snprintf(buffer, sizeof(buffer), "%02X", byte);
+            record += buffer;
+            checksum = static_cast<uint8_t>(checksum + byte);
+        }
+        snprintf(buffer, sizeof(buffer), "%02X\r\n", static_cast<uint8_t>(0x100 - checksum));
+        return record + buffer;
+    }
+
+    void checkHexParser(Checker* checker)
+    {
+        std::string image;
+        std::vector<uint8_t> expected;
+        for (uint16_t record = 0; record < 17; ++record)
+        {
+            std::vector<uint8_t> data;
+            for (uint8_t idx = 0; idx < 16; ++idx)
+            {
+                data.emplace_back(static_cast<uint8_t>(record * 16 + idx + 1));
+            }
+            expected.insert(expected.end(), data.begin(), data.end());
+            image += makeHexRecord(record * 16, data);
+        }
+        image += ":00000001FF";
+        expected.resize(2 * ota::PAGE_SIZE, 0xFF);
+
+        /**
+         * @note 레코드 중간에서 잘린 청크를 이어 받아도 페이지 경계가 유지되어야 합니다.
+         */
+        ota::HexParser parser;
+        std::string first  = image.substr(0, 100);
+        std::string second = image.substr(100);
+        EXPECT(checker, parser.Parse(first) == Status::Code::GOOD_MORE_DATA);
+        parser.Parse(second);
+        EXPECT(checker, second.empty() == true);
+        EXPECT(checker, parser.GetPageCount() == 2);
+
+        std::vector<uint8_t> parsed;
+        while (parser.GetPageCount() != 0)
+        {
+            const ota::page_t page = parser.GetPage();
+            EXPECT(checker, page.Size == ota::PAGE_SIZE);
+            parsed.insert(parsed.end(), page.Data, page.Data + page.Size);
+            parser.RemovePage();
+        }
+        EXPECT(checker, parsed == expected);
+    }
+
+    void checkTimerWheel(Checker* checker)
+    {
+        TimerWheel wheel;
+        std::vector<uint8_t> expired;
+        EXPECT(checker, wheel.RetrieveNextEventMillis() == UINT64_MAX);
+
+        wheel.Schedule(0, 10);
+        wheel.Schedule(1, 5);
+        wheel.Schedule(2, 5000);
+        EXPECT(checker, wheel.RetrieveNextEventMillis() <= 5);
+        wheel.Cancel(2);
+        EXPECT(checker, wheel.IsScheduled(2) == false);
+
+        wheel.Advance(4, &expired);
+        EXPECT(checker, expired.empty() == true);
+        wheel.Advance(10, &expired);
+        EXPECT(checker, expired == std::vector<uint8_t>({ 1, 0 }));
+        EXPECT(checker, wheel.IsScheduled(0) == false);
+
+        /**
+         * @note 임의의 예약, 취소, 진행을 만료 시각 목록과 비교하여 상위 레벨의 캐스케이드와 최상위
+         *       레벨의 범위를 넘는 타이머도 정확한 시각에 만료되는지 확인합니다.
+         */
+        Random random;
+        const uint64_t startMillis = 1760745600000ULL;
+        wheel.Init(startMillis);
+
+        uint64_t now = startMillis;
+        std::map<uint8_t, uint64_t> scheduled;
+        for (uint16_t step = 0; step < 20000; ++step)
+        {
+            const uint8_t timerID = static_cast<uint8_t>(random.Next(TimerWheel::MAX_TIMER_COUNT));
+            switch (random.Next(4))
+            {
+            case 0:
+            case 1:
+            {
+                const uint8_t scale = static_cast<uint8_t>(random.Next(6));
+                const uint64_t expiry = now + 1 + (static_cast<uint64_t>(random.Next()) >> (31 - scale * 6));
+                wheel.Schedule(timerID, expiry);
+                scheduled[timerID] = expiry;
+                break;
+            }
+            case 2:
+                wheel.Cancel(timerID);
+                scheduled.erase(timerID);
+                break;
+            default:
+            {
+                const uint64_t nextEvent = wheel.RetrieveNextEventMillis();
+                const uint64_t target = random.Next(2) == 0 && nextEvent != UINT64_MAX
+                    ? nextEvent + random.Next(64)
+                    : now + random.Next(1 << 20);
+
+                expired.clear();
+                wheel.Advance(target, &expired);
+
+                std::vector<uint8_t> expected;
+                std::map<uint8_t, uint64_t> expiries;
+                for (auto it = scheduled.begin(); it != scheduled.end();)
+                {
+                    if (it->second <= target)
+                    {
+                        expected.emplace_back(it->first);
+                        expiries.emplace(it->first, it->second);
+                        it = scheduled.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+
+                bool isOrdered = true;
+                for (size_t idx = 1; idx < expired.size(); ++idx)
+                {
+                    isOrdered = isOrdered && expiries[expired[idx - 1]] <= expiries[expired[idx]];
+                }
+                std::vector<uint8_t> sorted(expired);
+                std::sort(sorted.begin(), sorted.end());
+                EXPECT(checker, sorted == expected);
+                EXPECT(checker, isOrdered == true);
+                now = target;
+                break;
+            }
+            }
+        }
+
+        for (const auto& timer : scheduled)
+        {
+            EXPECT(checker, wheel.IsScheduled(timer.first) == true);
+        }
+    }
+}
+
+
+namespace muffin { namespace bench {
+
+    void RegisterChecks(Checker* checker)
+    {
+        checker->Register("Heatshrink/RoundTrip",              checkHeatshrinkRoundTrip);
+        checker->Register("MQTT/OutboundRecordCodec",          checkOutboundRecordCodec);
+        checker->Register("MQTT/OutboundLog/Recovery",         checkOutboundLogRecovery);
+        checker->Register("MQTT/OutboundLog/SegmentCapOnBoot", checkOutboundLogSegmentCapOnBoot);
+        checker->Register("MQTT/OutboundLog/BrokerAck",        checkOutboundLogAcknowledgedByBroker);
+        checker->Register("MQTT/CDO/Lanes",                    checkCdoLanes);
+        checker->Register("MQTT/InflightWindow",               checkInflightWindow);
+        checker->Register("MQTT/TrafficShaper",                checkTrafficShaper);
+        checker->Register("SparkplugB/Encoding",               checkSparkplugEncoding);
+        checker->Register("IM/Variable/Decode",                checkVariableDecode);
+        checker->Register("Base64/RoundTrip",                  checkBase64);
+        checker->Register("OTA/MEGA2560/HexParser",            checkHexParser);
+        checker->Register("CatM1/BaudRateNegotiation",         checkBaudRateNegotiation);
+        checker->Register("Replay/File",                       checkReplayFile);
+        checker->Register("TimerWheel/Expiry",                 checkTimerWheel);
+    }
+}}
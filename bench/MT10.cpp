@@ -0,0 +1,27 @@
+/**
+ * @file MT10.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief MT10 모델에서만 컴파일되는 플랫폼 독립적인 소스를 native 환경에서 컴파일합니다.
+ * @details native 환경은 모델 매크로를 정의하지 않으므로 ATmega2560 펌웨어 업데이트에 쓰는
+ *          Intel Hex 파서를 이 번역 단위에서만 MT10으로 컴파일합니다. 모델에 따라 선언이 달라지는
+ *          공용 헤더는 MT10을 정의하기 전에 먼저 포함하여 다른 번역 단위와 같은 선언을 사용합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+
+#include "Common/Convert/ConvertClass.h"
+#include "IM/Custom/Constants.h"
+#include "JARVIS/Include/TypeDefinitions.h"
+
+#define MT10
+#include "OTA/MEGA2560/HexParser.cpp"
+#undef MT10
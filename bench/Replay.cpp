@@ -0,0 +1,216 @@
+/**
+ * @file Replay.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 장치에서 기록한 트래픽 기록 파일을 호스트에서 재생하는 함수를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <stdio.h>
+#include <vector>
+
+#include "Core/Replay/ReplayFile.h"
+#include "Protocol/Modbus/Include/PolledDataTable.h"
+#include "Replay.h"
+#include "Storage/ESP32FS/ESP32FS.h"
+
+
+
+namespace muffin { namespace bench {
+
+    namespace {
+
+        const char* FILE_PATH = "/replay.bin";
+
+        class StageTimer
+        {
+        public:
+            StageTimer() : mCount(0), mTotalNanos(0), mMaxNanos(0) {}
+        public:
+            void Start() { mStart = std::chrono::steady_clock::now(); }
+            void Stop()
+            {
+                const uint64_t nanos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - mStart).count());
+                ++mCount;
+                mTotalNanos += nanos;
+                mMaxNanos = std::max(mMaxNanos, nanos);
+            }
+            void Print(const char* name) const
+            {
+                printf("  %-10s %10u %12.1f %12.1f %12.3f\n", name, mCount,
+                    mCount == 0 ? 0.0 : static_cast<double>(mTotalNanos) / mCount,
+                    static_cast<double>(mMaxNanos), static_cast<double>(mTotalNanos) / 1e6);
+            }
+        private:
+            std::chrono::steady_clock::time_point mStart;
+            uint32_t mCount;
+            uint64_t mTotalNanos;
+            uint64_t mMaxNanos;
+        };
+
+        typedef struct ReplayChannelType
+        {
+            modbus::PolledDataTable Table;
+            uint32_t FrameCount;
+            uint32_t ByteCount;
+            uint32_t ChangedLayoutCount;
+        } channel_t;
+
+        bool loadFile(const std::string& path)
+        {
+            FILE* input = fopen(path.c_str(), "rb");
+            if (input == nullptr)
+            {
+                return false;
+            }
+
+            std::vector<uint8_t> binary;
+            uint8_t buffer[4096];
+            size_t length = 0;
+            while ((length = fread(buffer, 1, sizeof(buffer), input)) > 0)
+            {
+                binary.insert(binary.end(), buffer, buffer + length);
+            }
+            fclose(input);
+
+            esp32FS.RetrieveFiles()[FILE_PATH] = binary;
+            return true;
+        }
+
+        void printChannel(const uint64_t key, const channel_t& channel)
+        {
+            const uint8_t source = static_cast<uint8_t>(key >> 48);
+            const uint16_t port = static_cast<uint16_t>(key >> 32);
+            const uint32_t address = static_cast<uint32_t>(key);
+
+            char name[48];
+            switch (static_cast<replay_source_e>(source))
+            {
+            case replay_source_e::MODBUS_RTU:
+                snprintf(name, sizeof(name), "ModbusRTU port %u", address);
+                break;
+            case replay_source_e::MODBUS_TCP:
+            case replay_source_e::MELSEC:
+                snprintf(name, sizeof(name), "%s %u.%u.%u.%u:%u",
+                    static_cast<replay_source_e>(source) == replay_source_e::MODBUS_TCP ? "ModbusTCP" : "Melsec",
+                    address & 0xFF, (address >> 8) & 0xFF, (address >> 16) & 0xFF, address >> 24, port);
+                break;
+            default:
+                snprintf(name, sizeof(name), "Source%u", source);
+                break;
+            }
+
+            printf("  %-32s %8u frames %10.1f B/frame %6u layout changes\n", name, channel.FrameCount,
+                channel.FrameCount == 0 ? 0.0 : static_cast<double>(channel.ByteCount) / channel.FrameCount,
+                channel.ChangedLayoutCount);
+        }
+    }
+
+
+    int Replay(const std::string& path)
+    {
+        if (loadFile(path) == false)
+        {
+            fprintf(stderr, "failed to read %s\n", path.c_str());
+            return 2;
+        }
+
+        File file = esp32FS.Open(FILE_PATH, "r", false);
+        ReplayFile replay;
+        const Status ret = replay.Inspect(&file);
+        if (ret != Status::Code::GOOD)
+        {
+            fprintf(stderr, "not a replay file: %s\n", ret.c_str());
+            return 2;
+        }
+
+        std::map<uint64_t, channel_t> channels;
+        for (const auto& key : replay.RetrieveChannelKeys())
+        {
+            channel_t& channel = channels[key];
+            channel.FrameCount = 0;
+            channel.ByteCount = 0;
+            channel.ChangedLayoutCount = 0;
+        }
+
+        StageTimer read;
+        StageTimer inject;
+        StageTimer record;
+        uint32_t failureCount = 0;
+        std::string payload;
+        std::string encoded;
+
+        /**
+         * @note 장치의 폴링 태스크와 같이 드라이버를 차례로 폴링하며 드라이버마다 다음 프레임을 적용합니다.
+         */
+        const auto startTime = std::chrono::steady_clock::now();
+        while (replay.IsExhausted() == false)
+        {
+            for (auto& pair : channels)
+            {
+                read.Start();
+                Status status = replay.ReadFrame(&file, pair.first, UINT64_MAX, &payload);
+                read.Stop();
+                if (status != Status::Code::GOOD)
+                {
+                    fprintf(stderr, "failed to read a frame: %s\n", status.c_str());
+                    return 1;
+                }
+
+                if (payload.empty() == true)
+                {
+                    continue;
+                }
+
+                inject.Start();
+                status = pair.second.Table.Decode(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
+                inject.Stop();
+                if (status != Status::Code::GOOD)
+                {
+                    ++failureCount;
+                    continue;
+                }
+
+                /**
+                 * @note 테이블은 이전 프레임의 주소를 유지하므로 다시 직렬화한 결과가 프레임과 다르면
+                 *       폴링한 주소의 구성이 바뀐 것입니다.
+                 */
+                encoded.clear();
+                record.Start();
+                pair.second.Table.Encode(&encoded);
+                record.Stop();
+
+                ++pair.second.FrameCount;
+                pair.second.ByteCount += payload.size();
+                pair.second.ChangedLayoutCount += encoded == payload ? 0 : 1;
+            }
+        }
+        const double elapsedMillis = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - startTime).count() / 1000.0;
+
+        printf("replayed %u frames from %u channels recorded over %.3f s in %.3f ms (%u failed)\n",
+            replay.GetFrameCount(), static_cast<uint32_t>(replay.GetChannelCount()),
+            replay.GetDurationMillis() / 1000.0, elapsedMillis, failureCount);
+        for (const auto& pair : channels)
+        {
+            printChannel(pair.first, pair.second);
+        }
+
+        printf("\n  %-10s %10s %12s %12s %12s\n", "stage", "count", "mean ns", "max ns", "total ms");
+        read.Print("read");
+        inject.Print("inject");
+        record.Print("record");
+        return failureCount == 0 ? 0 : 1;
+    }
+}}
@@ -0,0 +1,35 @@
+/**
+ * @file Replay.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 장치에서 기록한 트래픽 기록 파일을 호스트에서 재생하는 함수를 선언합니다.
+ * @details 장치와 같은 ReplayFile로 드라이버별 프레임을 순서대로 읽어 드라이버마다 하나의 수집
+ *          데이터 테이블에 적용하고, 적용한 테이블을 다시 직렬화합니다. 장치의 재생 속도 0과
+ *          같이 기록 시각과 관계없이 폴링할 때마다 다음 프레임을 적용하며, 단계별 처리 시간과
+ *          드라이버별 프레임 수를 출력합니다.
+ *
+ * @note 노드 갱신, JSON 발행, MQTT 전송은 ArduinoJson과 노드 구성이 필요하므로 장치에서만 재생합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <string>
+
+
+
+namespace muffin { namespace bench {
+
+    /**
+     * @param path tool/replay_file.py assemble로 합친 기록 파일의 경로
+     * @return 0 모든 프레임을 적용한 경우, 1 적용하지 못한 프레임이 있는 경우, 2 파일을 읽지 못한 경우
+     */
+    int Replay(const std::string& path);
+}}
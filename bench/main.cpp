@@ -0,0 +1,340 @@
+/**
+ * @file main.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경의 벤치마크 진입점이며 플랫폼 독립적인 모듈의 벤치마크를 등록합니다.
+ * @details 사용법:
+ *              pio run -e native -t exec -a "[--check] [--filter <이름>] [--save <파일>]
+ *                                             [--baseline <파일> [--threshold <퍼센트>]]"
+ *              pio run -e native -t exec -a "--replay <기록 파일>"
+ *          --baseline을 지정하면 기준값보다 ns/op가 threshold(기본 10%) 넘게 늘었거나 할당
+ *          횟수가 늘어난 벤치마크가 있을 때 1을 반환합니다. --check를 지정하면 벤치마크 대신
+ *          Checks.cpp의 검사를 실행하고 실패한 검사가 있을 때 1을 반환합니다. --replay를 지정하면
+ *          장치에서 기록한 트래픽 기록 파일을 재생하고 단계별 처리 시간을 출력합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Check.h"
+#include "Replay.h"
+#include "Common/Base64/Base64.hpp"
+#include "Common/CRC32/CRC32.h"
+#include "DataFormat/Heatshrink/HeatshrinkEncoder.h"
+#include "DataFormat/Protobuf/ProtobufWriter.h"
+#include "IM/Node/Variable.h"
+#include "JARVIS/Config/Information/Node.h"
+#include "JARVIS/Include/DataUnitOrder.h"
+
+
+
+using namespace muffin;
+using namespace muffin::bench;
+
+namespace {
+
+    const std::vector<uint8_t>& binaryInput()
+    {
+        static std::vector<uint8_t> input;
+        if (input.empty() == true)
+        {
+            Random random;
+            input.resize(1024);
+            for (auto& byte : input)
+            {
+                byte = static_cast<uint8_t>(random.Next());
+            }
+        }
+        return input;
+    }
+
+    /**
+     * @note 실제 발행 메시지와 비슷한 압축률을 갖도록 노드 식별자와 값만 바뀌는 DAQ JSON 배치를
+     *       만듭니다.
+     */
+    const std::string& telemetryInput()
+    {
+        static std::string input;
+        if (input.empty() == true)
+        {
+            Random random;
+            char buffer[96];
+            input = "{\"mc\":\"A1B2C3D4E5F6\",\"ts\":1760745600000,\"val\":[";
+            for (uint8_t idx = 0; idx < 40; ++idx)
+            {
+                snprintf(buffer, sizeof(buffer), "%s{\"uid\":\"P%03u\",\"ts\":%u,\"val\":\"%u\"}",
+                    idx == 0 ? "" : ",", static_cast<unsigned int>(random.Next(64)),
+                    static_cast<unsigned int>(1000 + idx * 10), static_cast<unsigned int>(random.Next(65536)));
+                input += buffer;
+            }
+            input += "]}";
+        }
+        return input;
+    }
+
+    uint32_t benchmarkCrc32Buffer(const uint32_t iterations)
+    {
+        static std::vector<uint8_t> input = binaryInput();
+        CRC32 crc32;
+        crc32.Init();
+        crc32.Reset();
+
+        uint32_t checksum = 0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            checksum ^= crc32.Calculate(input.size(), input.data());
+        }
+        return checksum;
+    }
+
+    uint32_t benchmarkCrc32String(const uint32_t iterations)
+    {
+        const std::string& input = telemetryInput();
+        CRC32 crc32;
+        crc32.Init();
+        crc32.Reset();
+
+        uint32_t checksum = 0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            checksum ^= crc32.Calculate(input);
+        }
+        return checksum;
+    }
+
+    uint32_t benchmarkHeatshrinkTelemetry(const uint32_t iterations)
+    {
+        const std::string& input = telemetryInput();
+        HeatshrinkEncoder encoder;
+
+        uint32_t checksum = 0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            std::string output;
+            encoder.Encode(reinterpret_cast<const uint8_t*>(input.data()), input.size(), &output);
+            checksum += static_cast<uint32_t>(output.size());
+        }
+        return checksum;
+    }
+
+    uint32_t benchmarkHeatshrinkRandom(const uint32_t iterations)
+    {
+        const std::vector<uint8_t>& input = binaryInput();
+        HeatshrinkEncoder encoder;
+
+        uint32_t checksum = 0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            std::string output;
+            checksum += encoder.Encode(input.data(), input.size(), &output) ? 1 : 0;
+        }
+        return checksum;
+    }
+
+    uint32_t benchmarkProtobufMetrics(const uint32_t iterations)
+    {
+        Random random;
+        uint64_t values[64];
+        for (auto& value : values)
+        {
+            value = (static_cast<uint64_t>(random.Next()) << 32) | random.Next();
+        }
+        const std::string name = "P001";
+
+        uint32_t checksum = 0;
+        std::string payload;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            payload.clear();
+            ProtobufWriter writer(&payload);
+            writer.WriteUInt64(1, 1760745600000ULL);
+            for (const auto& value : values)
+            {
+                writer.WriteString(1, name);
+                writer.WriteUInt64(2, value & 0xFFFF);
+                writer.WriteDouble(3, static_cast<double>(value >> 40));
+                writer.WriteBool(4, (value & 1) == 1);
+            }
+            checksum += static_cast<uint32_t>(payload.size());
+        }
+        return checksum;
+    }
+
+    uint32_t benchmarkDataUnitOrder(const uint32_t iterations)
+    {
+        uint32_t checksum = 0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            jvs::DataUnitOrder order(4);
+            for (uint8_t idx = 0; idx < 4; ++idx)
+            {
+                jvs::ord_t unit;
+                unit.DataUnit  = jvs::data_unit_e::WORD;
+                unit.ByteOrder = idx % 2 == 0 ? jvs::byte_order_e::HIGHER : jvs::byte_order_e::LOWER;
+                unit.Index     = 3 - idx;
+                order.EmplaceBack(unit);
+            }
+            checksum += static_cast<uint32_t>(order.RetrieveTotalSize()) + order.Retrieve(iteration % 4).second.Index;
+        }
+        return checksum;
+    }
+
+    /**
+     * @note 워드 순서를 바꾼 FLOAT32 노드에 매 주기 다른 값을 넣어 변환, 이력 저장, 버전 갱신과
+     *       발행용 문자열 생성까지 측정합니다.
+     */
+    uint32_t benchmarkVariableUpdate(const uint32_t iterations)
+    {
+        jvs::config::Node node;
+        node.SetNodeID("P001");
+        node.SetAddressType(jvs::adtp_e::NUMERIC);
+        jvs::addr_u address;
+        address.Numeric = 100;
+        node.SetAddrress(address);
+        node.SetNodeArea(jvs::node_area_e::HOLDING_REGISTER);
+        node.SetNumericAddressQuantity(2);
+        node.SetDataTypes(std::vector<jvs::dt_e>(1, jvs::dt_e::FLOAT32));
+        node.SetAttributeEvent(false);
+        node.SetTopic(mqtt::topic_e::DAQ_INPUT);
+
+        jvs::DataUnitOrder order(2);
+        jvs::ord_t unit;
+        unit.DataUnit  = jvs::data_unit_e::WORD;
+        unit.ByteOrder = jvs::byte_order_e::HIGHER;
+        unit.Index     = 1;
+        order.EmplaceBack(unit);
+        unit.Index     = 0;
+        order.EmplaceBack(unit);
+        node.SetDataUnitOrders(std::vector<jvs::DataUnitOrder>(1, order));
+
+        std::vector<im::poll_data_t> polledData(2);
+        for (uint8_t idx = 0; idx < 2; ++idx)
+        {
+            polledData[idx].StatusCode      = Status::Code::GOOD;
+            polledData[idx].AddressType     = jvs::adtp_e::NUMERIC;
+            polledData[idx].Address.Numeric = 100 + idx;
+            polledData[idx].ValueType       = jvs::dt_e::UINT16;
+        }
+        polledData[1].Value.UInt16 = 0x4049;
+
+        im::Variable variable(&node);
+        uint32_t checksum = 0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            polledData[0].Timestamp    = iteration;
+            polledData[1].Timestamp    = iteration;
+            polledData[0].Value.UInt16 = static_cast<uint16_t>(iteration);
+            variable.Update(polledData);
+            checksum += static_cast<uint32_t>(variable.CreateDaqStruct().second.Value.size());
+        }
+        return checksum + variable.RetrieveVersion();
+    }
+
+    uint32_t benchmarkBase64Telemetry(const uint32_t iterations)
+    {
+        const std::string& telemetry = telemetryInput();
+        const psram::string input(telemetry.begin(), telemetry.end());
+
+        uint32_t checksum = 0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            const psram::string encoded = EncodeBase64(input);
+            checksum += static_cast<uint32_t>(DecodeBase64(encoded.c_str()).size());
+        }
+        return checksum;
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::string filter;
+    std::string savePath;
+    std::string baselinePath;
+    std::string replayPath;
+    double threshold = 10.0;
+    bool isChecking = false;
+
+    for (int idx = 1; idx < argc; ++idx)
+    {
+        const bool hasValue = idx + 1 < argc;
+        if (strcmp(argv[idx], "--check") == 0)
+        {
+            isChecking = true;
+        }
+        else if (strcmp(argv[idx], "--replay") == 0 && hasValue)
+        {
+            replayPath = argv[++idx];
+        }
+        else if (strcmp(argv[idx], "--filter") == 0 && hasValue)
+        {
+            filter = argv[++idx];
+        }
+        else if (strcmp(argv[idx], "--save") == 0 && hasValue)
+        {
+            savePath = argv[++idx];
+        }
+        else if (strcmp(argv[idx], "--baseline") == 0 && hasValue)
+        {
+            baselinePath = argv[++idx];
+        }
+        else if (strcmp(argv[idx], "--threshold") == 0 && hasValue)
+        {
+            threshold = atof(argv[++idx]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--check] [--filter <name>] [--save <file>] [--baseline <file> [--threshold <percent>]]\n"
+                            "       %s --replay <file>\n", argv[0], argv[0]);
+            return 2;
+        }
+    }
+
+    if (replayPath.empty() == false)
+    {
+        return Replay(replayPath);
+    }
+
+    if (isChecking == true)
+    {
+        Checker checker;
+        RegisterChecks(&checker);
+        return checker.Run(filter) == 0 ? 0 : 1;
+    }
+
+    Runner runner;
+    runner.Register("CRC32/Calculate/1KiB",          benchmarkCrc32Buffer);
+    runner.Register("CRC32/Calculate/Telemetry",     benchmarkCrc32String);
+    runner.Register("Heatshrink/Encode/Telemetry",   benchmarkHeatshrinkTelemetry);
+    runner.Register("Heatshrink/Encode/Random1KiB",  benchmarkHeatshrinkRandom);
+    runner.Register("Protobuf/Write/64Metrics",      benchmarkProtobufMetrics);
+    runner.Register("JARVIS/DataUnitOrder/Build4",   benchmarkDataUnitOrder);
+    runner.Register("IM/Variable/Update/Float32",    benchmarkVariableUpdate);
+    runner.Register("Base64/RoundTrip/Telemetry",    benchmarkBase64Telemetry);
+
+    runner.Run(filter);
+    runner.Print();
+
+    if (savePath.empty() == false && runner.Save(savePath) == false)
+    {
+        return 2;
+    }
+
+    if (baselinePath.empty() == false && runner.Compare(baselinePath, threshold) == false)
+    {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file Arduino.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 Arduino 코어의 String 클래스와 시간 함수를 대체하는 shim을 선언합니다.
+ * @details String은 펌웨어 코드가 사용하는 멤버 함수만 std::string 위에 구현합니다.
+ *          진법 매크로는 Arduino 코어의 Print.h와 같은 값으로 선언합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <chrono>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+inline unsigned long micros()
+{
+    static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count());
+}
+
+inline unsigned long millis()
+{
+    return micros() / 1000;
+}
+
+inline void delay(const uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+class String
+{
+public:
+    String() {}
+    String(const char* value) : mValue(value == nullptr ? "" : value) {}
+    String(const std::string& value) : mValue(value) {}
+    explicit String(const int value) : mValue(std::to_string(value)) {}
+    explicit String(const unsigned int value) : mValue(std::to_string(value)) {}
+    explicit String(const long value) : mValue(std::to_string(value)) {}
+    explicit String(const unsigned long value) : mValue(std::to_string(value)) {}
+public:
+    const char* c_str() const { return mValue.c_str(); }
+    unsigned int length() const { return static_cast<unsigned int>(mValue.length()); }
+    bool isEmpty() const { return mValue.empty(); }
+    bool reserve(const unsigned int size) { mValue.reserve(size); return true; }
+    char charAt(const unsigned int index) const { return index < mValue.length() ? mValue[index] : '\0'; }
+    long toInt() const { return strtol(mValue.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(mValue.c_str(), nullptr); }
+    int indexOf(const char c) const { return find(mValue.find(c)); }
+    int indexOf(const String& str) const { return find(mValue.find(str.mValue)); }
+    String substring(const unsigned int begin) const { return begin < mValue.length() ? String(mValue.substr(begin)) : String(); }
+    String substring(const unsigned int begin, const unsigned int end) const { return begin < end && begin < mValue.length() ? String(mValue.substr(begin, end - begin)) : String(); }
+    bool startsWith(const String& prefix) const { return mValue.compare(0, prefix.mValue.length(), prefix.mValue) == 0; }
+    bool equals(const String& str) const { return mValue == str.mValue; }
+public:
+    String& operator+=(const String& str) { mValue += str.mValue; return *this; }
+    String& operator+=(const char* str) { mValue += str; return *this; }
+    String& operator+=(const char c) { mValue += c; return *this; }
+    char operator[](const unsigned int index) const { return charAt(index); }
+    bool operator==(const String& str) const { return mValue == str.mValue; }
+    bool operator!=(const String& str) const { return mValue != str.mValue; }
+    friend String operator+(const String& lhs, const String& rhs) { return String(lhs.mValue + rhs.mValue); }
+private:
+    static int find(const size_t position) { return position == std::string::npos ? -1 : static_cast<int>(position); }
+private:
+    std::string mValue;
+};
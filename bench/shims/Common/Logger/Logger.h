@@ -0,0 +1,46 @@
+/**
+ * @file Logger.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 MUFFIN 로거를 대체하는 shim을 선언합니다.
+ * @details include 경로에서 lib/MUFFIN/src보다 먼저 검색되어 "Common/Logger/Logger.h"를
+ *          가립니다. 로그 구문은 실행하지 않으므로 벤치마크 결과에 출력 비용이 포함되지 않습니다.
+ *          펌웨어와 마찬가지로 형식 문자열이 리터럴인지는 컴파일할 때 확인하지만, 호스트의
+ *          size_t는 ESP32보다 크므로 인자의 형식 검사는 하지 않습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <stdint.h>
+
+
+
+namespace muffin { namespace bench {
+
+    template <typename... Args>
+    inline void DiscardLog(const char*, const Args&...)
+    {
+    }
+}}
+
+#define MUFFIN_LOG_NATIVE(fmt, ...)                                             \
+    do {                                                                        \
+        if (false)                                                              \
+        {                                                                       \
+            muffin::bench::DiscardLog("" fmt, ##__VA_ARGS__);                   \
+        }                                                                       \
+    } while (0)
+
+#define LOG_ERROR(_logger, fmt, ...)    MUFFIN_LOG_NATIVE(fmt, ##__VA_ARGS__)
+#define LOG_WARNING(_logger, fmt, ...)  MUFFIN_LOG_NATIVE(fmt, ##__VA_ARGS__)
+#define LOG_INFO(_logger, fmt, ...)     MUFFIN_LOG_NATIVE(fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(_logger, fmt, ...)    MUFFIN_LOG_NATIVE(fmt, ##__VA_ARGS__)
+#define LOG_VERBOSE(_logger, fmt, ...)  MUFFIN_LOG_NATIVE(fmt, ##__VA_ARGS__)
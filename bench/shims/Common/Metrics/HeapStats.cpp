@@ -0,0 +1,23 @@
+/**
+ * @file HeapStats.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 힙 사용량 집계 shim의 전역 인스턴스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include "Common/Metrics/HeapStats.h"
+
+
+
+namespace muffin {
+
+    HeapStats heapStats;
+}
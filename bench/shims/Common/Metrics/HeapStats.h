@@ -0,0 +1,52 @@
+/**
+ * @file HeapStats.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 태그별 힙 사용량 집계를 대체하는 shim을 선언합니다.
+ * @details include 경로에서 lib/MUFFIN/src보다 먼저 검색되어 "Common/Metrics/HeapStats.h"를
+ *          가립니다. 호스트에는 ESP32의 힙 영역이 없으므로 집계하지 않으며, 할당 횟수는
+ *          벤치마크 실행기가 전역 operator new로 측정합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <stdint.h>
+
+
+
+namespace muffin {
+
+    typedef enum class HeapTagEnum
+        : uint8_t
+    {
+        UNTAGGED        = 0,
+        JARVIS_CONFIG   = 1,
+        NODE_STORE      = 2,
+        CDO_MESSAGE     = 3,
+        AAS_CONTAINER   = 4,
+        ETHERNET_IP     = 5,
+        OTA_BUFFER      = 6,
+        TOP             = 7
+    } heap_tag_e;
+
+    class HeapStats
+    {
+    public:
+        HeapStats() {}
+        virtual ~HeapStats() {}
+    public:
+        void Allocate(const heap_tag_e tag, const uint32_t bytes) { (void)tag; (void)bytes; }
+        void Release(const heap_tag_e tag, const uint32_t bytes) { (void)tag; (void)bytes; }
+    };
+
+
+    extern HeapStats heapStats;
+}
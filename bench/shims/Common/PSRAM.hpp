@@ -0,0 +1,108 @@
+/**
+ * @file PSRAM.hpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 PSRAM 할당자와 컨테이너 별칭을 대체하는 shim을 선언합니다.
+ * @details include 경로에서 lib/MUFFIN/src보다 먼저 검색되어 "Common/PSRAM.hpp"를 가립니다.
+ *          원본은 MT11 모델에서만 선언되고 heap_caps_malloc()으로 PSRAM을 할당하므로, 같은
+ *          별칭을 모델과 관계없이 선언하되 벤치마크가 할당을 집계할 수 있도록 operator new로
+ *          할당합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Common/Metrics/HeapStats.h"
+
+
+
+namespace muffin { namespace psram {
+
+
+    inline void* allocate(size_t size)
+    {
+        return ::operator new(size, std::nothrow);
+    }
+
+    inline void deallocate(void* p)
+    {
+        ::operator delete(p);
+    }
+
+    template <class T, heap_tag_e Tag = heap_tag_e::UNTAGGED>
+    struct Allocator
+    {
+        typedef T value_type;
+
+        template <class U> struct rebind
+        {
+            typedef Allocator<U, Tag> other;
+        };
+
+        Allocator() = default;
+        template <class U> constexpr Allocator(const Allocator<U, Tag>&) noexcept {}
+
+        T* allocate(std::size_t n)
+        {
+            if (n > (std::size_t(-1) / sizeof(T)))
+            {
+                return nullptr;
+            }
+
+            void* p = psram::allocate(n * sizeof(T));
+            if (!p)
+            {
+                return nullptr;
+            }
+
+            heapStats.Allocate(Tag, n * sizeof(T));
+            return static_cast<T*>(p);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            heapStats.Release(Tag, n * sizeof(T));
+            psram::deallocate(p);
+        }
+    };
+
+    template <class T, class U, heap_tag_e Tag> bool operator==(const Allocator<T, Tag>&, const Allocator<U, Tag>&)
+    {
+        return true;
+    }
+
+    template <class T, class U, heap_tag_e Tag> bool operator!=(const Allocator<T, Tag>&, const Allocator<U, Tag>&)
+    {
+        return false;
+    }
+
+    using string = std::basic_string<char, std::char_traits<char>, Allocator<char>>;
+
+    template<typename T>
+    using unique_ptr = std::unique_ptr<T, std::default_delete<T>>;
+
+    template<typename T, heap_tag_e Tag = heap_tag_e::UNTAGGED>
+    using vector = std::vector<T, Allocator<T, Tag>>;
+
+    template<typename Key, typename T, typename Compare = std::less<Key>, heap_tag_e Tag = heap_tag_e::UNTAGGED> 
+    using map = std::map<Key, T, Compare, Allocator<std::pair<const Key, T>, Tag>>;
+
+    template <typename T, typename... Args>
+    unique_ptr<T> make_unique(Args&&... args)
+    {
+        return unique_ptr<T>(new T(std::forward<Args>(args)...));
+    }
+}}
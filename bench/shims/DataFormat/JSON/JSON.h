@@ -0,0 +1,40 @@
+/**
+ * @file JSON.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 수집 데이터 구조체만 제공하는 shim을 선언합니다.
+ * @details include 경로에서 lib/MUFFIN/src보다 먼저 검색되어 "DataFormat/JSON/JSON.h"를
+ *          가립니다. 원본 헤더는 ArduinoJson과 Arduino 파일 시스템에 의존하므로 호스트에서
+ *          컴파일할 수 없으며, Sparkplug B 인코더가 사용하는 json_datum_t만 원본과 같은
+ *          배치로 선언합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Protocol/MQTT/Include/TypeDefinitions.h"
+
+
+
+namespace muffin {
+
+    typedef struct JsonDatumType
+    {
+        mqtt::topic_e Topic;
+        uint64_t SourceTimestamp;
+        char NodeID[5];
+        std::string Value;
+        std::vector<std::string> ArrayValue;
+        bool isArray = false;
+    } json_datum_t;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file IPAddress.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 Arduino의 IPAddress 클래스를 대체하는 shim을 선언합니다.
+ * @details 수집 데이터 테이블의 형식 정의가 이 헤더를 포함하므로 주소를 32비트 정수로만 보관합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <stdint.h>
+
+
+
+class IPAddress
+{
+public:
+    IPAddress() : mAddress(0) {}
+    IPAddress(const uint32_t address) : mAddress(address) {}
+    IPAddress(const uint8_t first, const uint8_t second, const uint8_t third, const uint8_t fourth)
+        : mAddress(static_cast<uint32_t>(first) | (static_cast<uint32_t>(second) << 8) |
+                   (static_cast<uint32_t>(third) << 16) | (static_cast<uint32_t>(fourth) << 24))
+    {
+    }
+public:
+    operator uint32_t() const { return mAddress; }
+private:
+    uint32_t mAddress;
+};
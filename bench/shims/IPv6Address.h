@@ -0,0 +1,17 @@
+/**
+ * @file IPv6Address.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 Arduino의 IPv6Address 헤더를 대체하는 shim을 선언합니다.
+ * @details JARVIS Wi-Fi 설정 헤더가 포함하지만 사용하지 않으므로 빈 헤더로 둡니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
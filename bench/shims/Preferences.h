@@ -0,0 +1,62 @@
+/**
+ * @file Preferences.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 NVS 기반 Preferences 클래스를 메모리로 대체하는 shim을 선언합니다.
+ * @details 네임스페이스별 값은 프로세스가 끝날 때까지 유지되므로 재부팅 후의 복구 과정을
+ *          같은 프로세스에서 재현할 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <map>
+#include <stdint.h>
+#include <string>
+
+
+
+class Preferences
+{
+public:
+    Preferences() : mValues(nullptr) {}
+    virtual ~Preferences() {}
+public:
+    bool begin(const char* name, const bool readOnly = false)
+    {
+        (void)readOnly;
+        mValues = &storage()[name];
+        return true;
+    }
+    void end() { mValues = nullptr; }
+    bool clear() { mValues->clear(); return true; }
+    bool remove(const char* key) { return mValues->erase(key) > 0; }
+    bool isKey(const char* key) { return mValues->count(key) > 0; }
+public:
+    size_t putULong(const char* key, const uint32_t value) { (*mValues)[key] = value; return sizeof(value); }
+    uint32_t getULong(const char* key, const uint32_t defaultValue = 0)
+    {
+        const auto it = mValues->find(key);
+        return it == mValues->end() ? defaultValue : static_cast<uint32_t>(it->second);
+    }
+public:
+    /**
+     * @brief 모든 네임스페이스를 지워 처음 부팅한 상태로 되돌립니다.
+     */
+    static void Reset() { storage().clear(); }
+private:
+    static std::map<std::string, std::map<std::string, uint64_t>>& storage()
+    {
+        static std::map<std::string, std::map<std::string, uint64_t>> values;
+        return values;
+    }
+private:
+    std::map<std::string, uint64_t>* mValues;
+};
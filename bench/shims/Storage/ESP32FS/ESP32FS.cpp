@@ -0,0 +1,23 @@
+/**
+ * @file ESP32FS.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 메모리 기반 파일 시스템의 전역 인스턴스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include "Storage/ESP32FS/ESP32FS.h"
+
+
+
+namespace muffin {
+
+    ESP32FS esp32FS;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file ESP32FS.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 LittleFS 파일 시스템을 메모리로 대체하는 shim을 선언합니다.
+ * @details include 경로에서 lib/MUFFIN/src보다 먼저 검색되어 "Storage/ESP32FS/ESP32FS.h"를
+ *          가립니다. 루트 디렉터리 하나만 지원하며, 파일의 내용은 프로세스가 끝날 때까지
+ *          유지되므로 재부팅 후의 복구 과정을 같은 프로세스에서 재현할 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "Common/Status.h"
+
+
+
+#define FILE_READ       "r"
+#define FILE_WRITE      "w"
+#define FILE_APPEND     "a"
+
+typedef std::map<std::string, std::vector<uint8_t>> native_files_t;
+
+class File
+{
+public:
+    File() : mFiles(nullptr), mIsDirectory(false), mPosition(0) {}
+    File(native_files_t* files, const std::string& path, const bool isDirectory)
+        : mFiles(files), mPath(path), mIsDirectory(isDirectory), mPosition(0)
+    {
+        mName = path.empty() == false && path[0] == '/' ? path.substr(1) : path;
+        mNext = files->begin();
+    }
+    virtual ~File() {}
+public:
+    operator bool() const { return mFiles != nullptr; }
+    bool isDirectory() const { return mIsDirectory; }
+    const char* name() const { return mName.c_str(); }
+    const char* path() const { return mPath.c_str(); }
+    size_t size() const { return data() == nullptr ? 0 : data()->size(); }
+    size_t position() const { return mPosition; }
+    bool seek(const size_t position) { mPosition = position; return position <= size(); }
+    void flush() {}
+    void close() { mFiles = nullptr; }
+public:
+    size_t read(uint8_t* buffer, const size_t length)
+    {
+        const std::vector<uint8_t>* bytes = data();
+        if (bytes == nullptr || mPosition >= bytes->size())
+        {
+            return 0;
+        }
+
+        const size_t count = std::min(length, bytes->size() - mPosition);
+        std::copy(bytes->begin() + mPosition, bytes->begin() + mPosition + count, buffer);
+        mPosition += count;
+        return count;
+    }
+    size_t write(const uint8_t* buffer, const size_t length)
+    {
+        std::vector<uint8_t>* bytes = data();
+        if (bytes == nullptr || mIsDirectory == true)
+        {
+            return 0;
+        }
+
+        bytes->insert(bytes->end(), buffer, buffer + length);
+        mPosition = bytes->size();
+        return length;
+    }
+    File openNextFile()
+    {
+        if (mIsDirectory == false || mNext == mFiles->end())
+        {
+            return File();
+        }
+        return File(mFiles, (mNext++)->first, false);
+    }
+private:
+    std::vector<uint8_t>* data() const
+    {
+        if (mFiles == nullptr)
+        {
+            return nullptr;
+        }
+        const auto it = mFiles->find(mPath);
+        return it == mFiles->end() ? nullptr : &it->second;
+    }
+private:
+    native_files_t* mFiles;
+    std::string mPath;
+    std::string mName;
+    bool mIsDirectory;
+    size_t mPosition;
+    native_files_t::iterator mNext;
+};
+
+
+namespace muffin {
+
+    class ESP32FS
+    {
+    public:
+        ESP32FS() {}
+        virtual ~ESP32FS() {}
+    public:
+        File Open(const char* path, const char* mode = FILE_READ, const bool create = false)
+        {
+            return Open(std::string(path), mode, create);
+        }
+        File Open(const std::string& path, const char* mode = FILE_READ, const bool create = false)
+        {
+            if (path == "/")
+            {
+                return File(&mFiles, path, true);
+            }
+
+            const bool doesExist = mFiles.count(path) > 0;
+            if (doesExist == false && (create == false || mode[0] == 'r'))
+            {
+                return File();
+            }
+
+            if (mode[0] == 'w' || doesExist == false)
+            {
+                mFiles[path].clear();
+            }
+            return File(&mFiles, path, false);
+        }
+        Status DoesExist(const std::string& path)
+        {
+            return Status(mFiles.count(path) > 0 ? Status::Code::GOOD : Status::Code::BAD_NOT_FOUND);
+        }
+        Status Remove(const char* path) { return Remove(std::string(path)); }
+        Status Remove(const std::string& path)
+        {
+            return Status(mFiles.erase(path) > 0 ? Status::Code::GOOD : Status::Code::BAD_NOT_FOUND);
+        }
+        size_t GetTotalBytes() const { return 1024 * 1024; }
+    public:
+        /**
+         * @brief 호스트 검사에서 파일의 내용을 직접 확인하거나 손상시킬 수 있도록 파일 목록을 반환합니다.
+         */
+        native_files_t& RetrieveFiles() { return mFiles; }
+    private:
+        native_files_t mFiles;
+    };
+
+
+    extern ESP32FS esp32FS;
+}
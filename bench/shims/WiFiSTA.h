@@ -0,0 +1,26 @@
+/**
+ * @file WiFiSTA.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 Arduino WiFiSTA의 WPA2 엔터프라이즈 인증 열거형을 대체하는 shim을 선언합니다.
+ * @details JARVIS Wi-Fi 설정 헤더가 요구하는 wpa2_auth_method_t만 Arduino 코어와 같은 값으로 선언합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+
+
+typedef enum
+{
+    WPA2_AUTH_TLS   = 0,
+    WPA2_AUTH_PEAP  = 1,
+    WPA2_AUTH_TTLS  = 2
+} wpa2_auth_method_t;
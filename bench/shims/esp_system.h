@@ -0,0 +1,53 @@
+/**
+ * @file esp_system.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 ESP-IDF의 시스템 API를 대체하는 shim을 선언합니다.
+ * @details ESP-IDF의 FreeRTOS.h가 이 헤더를 포함하므로 FreeRTOS shim에서 포함합니다. MAC 주소는
+ *          NIC 종류와 관계없이 고정된 값을 반환하여 토픽 문자열이 실행할 때마다 같도록 합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+
+
+typedef int esp_err_t;
+
+#define ESP_OK      0
+#define ESP_FAIL    -1
+
+typedef enum
+{
+    ESP_MAC_WIFI_STA,
+    ESP_MAC_WIFI_SOFTAP,
+    ESP_MAC_BT,
+    ESP_MAC_ETH
+} esp_mac_type_t;
+
+inline esp_err_t esp_read_mac(uint8_t* mac, const esp_mac_type_t type)
+{
+    static const uint8_t baseMAC[6] = { 0xA0, 0xB7, 0x65, 0xF1, 0xC2, 0xD0 };
+    memcpy(mac, baseMAC, sizeof(baseMAC));
+    mac[5] = static_cast<uint8_t>(mac[5] + static_cast<uint8_t>(type));
+    return ESP_OK;
+}
+
+inline uint32_t esp_random()
+{
+    static uint32_t state = 0x9E3779B9;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
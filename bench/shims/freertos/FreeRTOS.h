@@ -0,0 +1,49 @@
+/**
+ * @file FreeRTOS.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 FreeRTOS의 기본 타입과 매크로를 대체하는 shim을 선언합니다.
+ * @details 벤치마크는 단일 스레드에서 실행되므로 임계 구역은 아무 동작도 하지 않으며, 틱은
+ *          1ms 단위로 호스트의 단조 시계를 따릅니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_system.h"
+
+
+
+typedef int32_t  BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE                 (static_cast<BaseType_t>(0))
+#define pdTRUE                  (static_cast<BaseType_t>(1))
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           (static_cast<TickType_t>(0xFFFFFFFF))
+#define portTICK_PERIOD_MS      (static_cast<TickType_t>(1))
+#define pdMS_TO_TICKS(ms)       (static_cast<TickType_t>(ms))
+#define configMAX_TASK_NAME_LEN 16
+
+typedef struct
+{
+    uint32_t Owner;
+    uint32_t Count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    { 0, 0 }
+#define portMUX_INITIALIZE(mux)         ((void)(mux))
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
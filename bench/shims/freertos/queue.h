@@ -0,0 +1,113 @@
+/**
+ * @file queue.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 FreeRTOS 큐 API를 대체하는 shim을 선언합니다.
+ * @details 호스트 검사는 단일 스레드에서 실행되므로 큐는 대기하지 않으며, 항목은 생성할 때
+ *          지정한 크기만큼 복사하여 보관합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <deque>
+#include <new>
+#include <string.h>
+#include <vector>
+
+#include "FreeRTOS.h"
+
+
+
+typedef struct NativeQueueType
+{
+    UBaseType_t Length;
+    UBaseType_t ItemSize;
+    std::deque<std::vector<uint8_t>> Items;
+} native_queue_t;
+
+typedef native_queue_t* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(const UBaseType_t length, const UBaseType_t itemSize)
+{
+    QueueHandle_t queue = new(std::nothrow) native_queue_t();
+    if (queue != nullptr)
+    {
+        queue->Length   = length;
+        queue->ItemSize = itemSize;
+    }
+    return queue;
+}
+
+inline void vQueueDelete(QueueHandle_t queue)
+{
+    delete queue;
+}
+
+inline BaseType_t xQueueGenericSend(QueueHandle_t queue, const void* item, const bool isFront)
+{
+    if (queue->Items.size() >= queue->Length)
+    {
+        return pdFALSE;
+    }
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(item);
+    std::vector<uint8_t> copied(bytes, bytes + queue->ItemSize);
+    if (isFront == true)
+    {
+        queue->Items.emplace_front(std::move(copied));
+    }
+    else
+    {
+        queue->Items.emplace_back(std::move(copied));
+    }
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, const TickType_t ticks)
+{
+    (void)ticks;
+    return xQueueGenericSend(queue, item, false);
+}
+
+inline BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, const TickType_t ticks)
+{
+    (void)ticks;
+    return xQueueGenericSend(queue, item, false);
+}
+
+inline BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, const TickType_t ticks)
+{
+    (void)ticks;
+    return xQueueGenericSend(queue, item, true);
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, const TickType_t ticks)
+{
+    (void)ticks;
+    if (queue->Items.empty() == true)
+    {
+        return pdFALSE;
+    }
+
+    memcpy(item, queue->Items.front().data(), queue->ItemSize);
+    queue->Items.pop_front();
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    return static_cast<UBaseType_t>(queue->Items.size());
+}
+
+inline UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+    return queue->Length - static_cast<UBaseType_t>(queue->Items.size());
+}
@@ -0,0 +1,52 @@
+/**
+ * @file task.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief native 환경에서 FreeRTOS 태스크 API를 대체하는 shim을 선언합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+#include "FreeRTOS.h"
+
+
+
+typedef void* TaskHandle_t;
+
+inline TickType_t xTaskGetTickCount()
+{
+    static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    return static_cast<TickType_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - origin).count());
+}
+
+inline void vTaskDelay(const TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return nullptr;
+}
+
+inline const char* pcTaskGetName(TaskHandle_t handle)
+{
+    (void)handle;
+    return "native";
+}
+
+inline BaseType_t xPortGetCoreID()
+{
+    return 0;
+}
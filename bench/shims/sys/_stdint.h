@@ -0,0 +1,19 @@
+/**
+ * @file _stdint.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief newlib 전용 헤더인 <sys/_stdint.h>를 호스트의 표준 헤더로 대체합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
@@ -20,7 +20,7 @@
 namespace muffin {
 
 
-    psram::string DecodeBase64(const char* base64)
+    inline psram::string DecodeBase64(const char* base64)
     {
         psram::string safe_base64(base64);
         for (char &c : safe_base64)
@@ -66,10 +66,10 @@ namespace muffin {
         {
             uint32_t tmp = 
             (
-                (b64_table[safe_base64_cstr[idx]]       << 18) | 
-                (b64_table[safe_base64_cstr[idx + 1]]   << 12) | 
-                (b64_table[safe_base64_cstr[idx + 2]]   << 6)  | 
-                (b64_table[safe_base64_cstr[idx + 3]])
+                (b64_table[static_cast<uint8_t>(safe_base64_cstr[idx])]       << 18) | 
+                (b64_table[static_cast<uint8_t>(safe_base64_cstr[idx + 1])]   << 12) | 
+                (b64_table[static_cast<uint8_t>(safe_base64_cstr[idx + 2])]   << 6)  | 
+                (b64_table[static_cast<uint8_t>(safe_base64_cstr[idx + 3])])
             );
 
             decoded += (tmp >> 16) & 0xFF;
@@ -88,7 +88,7 @@ namespace muffin {
     }
 
     
-    psram::string EncodeBase64(const psram::string& data, const bool urlSafe = true)
+    inline psram::string EncodeBase64(const psram::string& data, const bool urlSafe = true)
     {
         static const char* base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
  
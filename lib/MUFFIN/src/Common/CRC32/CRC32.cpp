@@ -13,6 +13,12 @@
 
 
 
+/**
+ * @note 청크마다 호출되므로 DEBUG 빌드에서도 디버그 로그를 컴파일하지 않아 OTA 처리량을 유지합니다.
+ */
+#define MUFFIN_LOG_MODULE   muffin::log_module_e::CRC32
+#define MUFFIN_LOG_LEVEL    2
+
 #include "Common/Logger/Logger.h"
 #include "CRC32.h"
 
@@ -0,0 +1,165 @@
+/**
+ * @file SpscRingBuffer.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 단일 생산자, 단일 소비자(SPSC)용 고정 크기 바이트 링 버퍼 클래스를 정의합니다.
+ * @details 생산자는 쓰기 인덱스만, 소비자는 읽기 인덱스만 갱신하므로 잠금 없이 서로 다른
+ *          태스크에서 동시에 사용할 수 있습니다. 생산자 또는 소비자가 둘 이상인 경우에는
+ *          호출자가 같은 쪽끼리의 접근을 직렬화해야 합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <atomic>
+#include <esp_heap_caps.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/_stdint.h>
+
+#include "Common/Status.h"
+
+
+
+namespace muffin {
+
+    class SpscRingBuffer
+    {
+    public:
+        explicit SpscRingBuffer(const size_t capacity)
+            : mStorage(nullptr)
+            , mSize(capacity + 1)
+            , mHead(0)
+            , mTail(0)
+        {
+        }
+
+        ~SpscRingBuffer()
+        {
+            if (mStorage != nullptr)
+            {
+                free(mStorage);
+                mStorage = nullptr;
+            }
+        }
+
+        SpscRingBuffer(const SpscRingBuffer&) = delete;
+        SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    public:
+        /**
+         * @brief 저장 공간을 할당합니다. 생산자와 소비자가 사용하기 전에 한 번만 호출해야 합니다.
+         */
+        Status Init()
+        {
+            if (mStorage != nullptr)
+            {
+                return Status(Status::Code::GOOD);
+            }
+
+        #if defined(MT11)
+            mStorage = static_cast<uint8_t*>(heap_caps_malloc(mSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+        #else
+            mStorage = static_cast<uint8_t*>(malloc(mSize));
+        #endif
+            if (mStorage == nullptr)
+            {
+                return Status(Status::Code::BAD_OUT_OF_MEMORY);
+            }
+
+            return Status(Status::Code::GOOD);
+        }
+
+        /**
+         * @brief 생산자 전용입니다.
+         * @return size_t 실제로 저장한 바이트 수로, 버퍼가 가득 차면 length보다 작을 수 있습니다.
+         */
+        size_t Write(const uint8_t* data, const size_t length)
+        {
+            const size_t head = mHead.load(std::memory_order_relaxed);
+            const size_t tail = mTail.load(std::memory_order_acquire);
+            const size_t vacant = (tail + mSize - head - 1) % mSize;
+            const size_t count = length < vacant ? length : vacant;
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            const size_t firstChunk = (mSize - head) < count ? (mSize - head) : count;
+            memcpy(mStorage + head, data, firstChunk);
+            memcpy(mStorage, data + firstChunk, count - firstChunk);
+
+            mHead.store((head + count) % mSize, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief 소비자 전용입니다.
+         * @return size_t 실제로 읽은 바이트 수로, 버퍼가 비어 있으면 0입니다.
+         */
+        size_t Read(uint8_t* data, const size_t length)
+        {
+            const size_t tail = mTail.load(std::memory_order_relaxed);
+            const size_t head = mHead.load(std::memory_order_acquire);
+            const size_t available = (head + mSize - tail) % mSize;
+            const size_t count = length < available ? length : available;
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            const size_t firstChunk = (mSize - tail) < count ? (mSize - tail) : count;
+            memcpy(data, mStorage + tail, firstChunk);
+            memcpy(data + firstChunk, mStorage, count - firstChunk);
+
+            mTail.store((tail + count) % mSize, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief 소비자 전용으로, 읽기 인덱스를 갱신하지 않고 데이터를 복사합니다.
+         * @return size_t 실제로 복사한 바이트 수로, 버퍼가 비어 있으면 0입니다.
+         */
+        size_t Peek(uint8_t* data, const size_t length) const
+        {
+            const size_t tail = mTail.load(std::memory_order_relaxed);
+            const size_t head = mHead.load(std::memory_order_acquire);
+            const size_t available = (head + mSize - tail) % mSize;
+            const size_t count = length < available ? length : available;
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            const size_t firstChunk = (mSize - tail) < count ? (mSize - tail) : count;
+            memcpy(data, mStorage + tail, firstChunk);
+            memcpy(data + firstChunk, mStorage, count - firstChunk);
+            return count;
+        }
+
+        size_t GetAvailableBytes() const
+        {
+            const size_t head = mHead.load(std::memory_order_acquire);
+            const size_t tail = mTail.load(std::memory_order_acquire);
+            return (head + mSize - tail) % mSize;
+        }
+
+        size_t GetCapacity() const
+        {
+            return mSize - 1;
+        }
+
+    private:
+        uint8_t* mStorage;
+        const size_t mSize;
+        std::atomic<size_t> mHead;
+        std::atomic<size_t> mTail;
+    };
+}
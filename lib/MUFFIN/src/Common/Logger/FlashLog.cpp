@@ -0,0 +1,385 @@
+/**
+ * @file FlashLog.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 로그 메시지를 플래시 메모리의 세그먼트 파일에 순환 기록하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <algorithm>
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Common/Logger/Logger.h"
+#include "Common/Sync/LockGuard.hpp"
+#include "IM/Custom/Constants.h"
+#include "FlashLog.h"
+#include "Storage/ESP32FS/ESP32FS.h"
+
+
+
+namespace muffin {
+
+    typedef struct RtcLogRingType
+    {
+        uint32_t Magic;
+        uint32_t Head;
+        uint32_t Length;
+        char Data[1024];
+    } rtc_ring_t;
+
+    static const uint32_t RTC_RING_MAGIC = 0x4C4F4721;
+
+    /**
+     * @note RTC 메모리는 전원이 차단되지 않는 한 리셋 이후에도 내용이 유지되며, 부팅 시
+     *       초기화되지 않도록 RTC_NOINIT_ATTR 영역에 배치합니다.
+     */
+    static RTC_NOINIT_ATTR rtc_ring_t s_RtcRing;
+
+    FlashLog::FlashLog()
+        : mIsInitialized(false)
+        , mIsRtcRingCaptured(false)
+        , mBatchLength(0)
+        , mBatchMillis(0)
+        , mHeadSegment(0)
+        , mTailSegment(0)
+        , mTailSize(0)
+        , mDropCount(0)
+    {
+    }
+
+    Status FlashLog::Init()
+    {
+        size_t recoveredBytes = 0;
+        {
+            LockGuard lock(mMutex);
+            if (mIsInitialized == true)
+            {
+                return Status(Status::Code::GOOD);
+            }
+
+            File root = esp32FS.Open("/");
+            if (!root || root.isDirectory() == false)
+            {
+                return Status(Status::Code::BAD_DEVICE_FAILURE);
+            }
+
+            bool hasSegment = false;
+            uint32_t minIndex = UINT32_MAX;
+            uint32_t maxIndex = 0;
+
+            File file = root.openNextFile();
+            while (file)
+            {
+                const std::pair<bool, uint32_t> index = parseSegmentIndex(file.name());
+                if (index.first == true)
+                {
+                    hasSegment = true;
+                    minIndex = std::min(minIndex, index.second);
+                    maxIndex = std::max(maxIndex, index.second);
+                }
+                file.close();
+                file = root.openNextFile();
+            }
+            root.close();
+
+            /**
+             * @note 마지막 세그먼트의 끝이 손상되었을 수 있으므로 부팅할 때마다 새로운 세그먼트에 기록합니다.
+             */
+            mHeadSegment = hasSegment ? minIndex : 0;
+            mTailSegment = hasSegment ? maxIndex + 1 : 0;
+            mTailSize    = 0;
+            while ((mTailSegment - mHeadSegment + 1) > MAX_SEGMENT_COUNT)
+            {
+                esp32FS.Remove(makeSegmentPath(mHeadSegment++));
+            }
+            mIsInitialized = true;
+
+            /**
+             * @note 이전 부팅의 로그를 이번 부팅에서 배치 버퍼에 모은 로그보다 먼저 기록합니다.
+             */
+            captureRtcRing();
+            if (mPreviousBoot.empty() == false)
+            {
+                char banner[64] = {'\0'};
+                const int length = snprintf(banner, sizeof(banner), "---- RECOVERED FROM PREVIOUS BOOT, RESET REASON: %d ----\n",
+                    static_cast<int>(esp_reset_reason()));
+                writeSegment(banner, static_cast<size_t>(length));
+                writeSegment(mPreviousBoot.data(), mPreviousBoot.size());
+                recoveredBytes = mPreviousBoot.size();
+
+                mPreviousBoot.clear();
+                mPreviousBoot.shrink_to_fit();
+            }
+            writeBatch();
+        }
+
+        if (recoveredBytes > 0)
+        {
+            LOG_WARNING(logger, "RECOVERED %u BYTES OF LOG FROM THE PREVIOUS BOOT", recoveredBytes);
+        }
+        LOG_INFO(logger, "Flash log is ready: segment #%u to #%u", mHeadSegment, mTailSegment);
+        return Status(Status::Code::GOOD);
+    }
+
+    bool FlashLog::IsInitialized() const
+    {
+        return mIsInitialized;
+    }
+
+    uint32_t FlashLog::GetDropCount() const
+    {
+        return mDropCount;
+    }
+
+    void FlashLog::Append(const char* line)
+    {
+        /**
+         * @note 시리얼 모니터용 ANSI 색상 코드는 저장 공간만 차지하므로 제외합니다.
+         */
+        if (line[0] == '\033')
+        {
+            const char* colorEnd = strchr(line, 'm');
+            line = colorEnd == nullptr ? line : colorEnd + 1;
+        }
+        const size_t length = strlen(line);
+
+        LockGuard lock(mMutex);
+        captureRtcRing();
+        appendRtcRing(line, length);
+        appendRtcRing("\n", 1);
+
+        if (mBatchLength + length + 1 > BATCH_SIZE && mIsInitialized == true)
+        {
+            writeBatch();
+        }
+
+        if (mBatchLength + length + 1 > BATCH_SIZE)
+        {
+            ++mDropCount;
+            return;
+        }
+
+        if (mBatchLength == 0)
+        {
+            mBatchMillis = millis();
+        }
+        memcpy(mBatch + mBatchLength, line, length);
+        mBatchLength += length;
+        mBatch[mBatchLength++] = '\n';
+    }
+
+    void FlashLog::Sync(const bool isForced)
+    {
+        LockGuard lock(mMutex);
+        if (mIsInitialized == false || mBatchLength == 0)
+        {
+            return;
+        }
+
+        if (isForced == true || (millis() - mBatchMillis) >= BATCH_TIMEOUT_MILLIS)
+        {
+            writeBatch();
+        }
+    }
+
+    std::pair<uint32_t, uint32_t> FlashLog::GetSegmentRange()
+    {
+        LockGuard lock(mMutex);
+        return std::make_pair(mHeadSegment, mTailSegment);
+    }
+
+    Status FlashLog::Read(const uint32_t segment, const size_t offset, const size_t maxLength, std::string* output)
+    {
+        LockGuard lock(mMutex);
+        if (mIsInitialized == false)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        if (segment == mTailSegment)
+        {
+            writeBatch();
+        }
+
+        File file = esp32FS.Open(makeSegmentPath(segment), "r", false);
+        if (!file)
+        {
+            return Status(Status::Code::BAD_NOT_FOUND);
+        }
+
+        const size_t fileSize = file.size();
+        if (offset >= fileSize)
+        {
+            file.close();
+            return Status(Status::Code::BAD_NO_DATA);
+        }
+
+        output->resize(std::min(maxLength, fileSize - offset));
+        file.seek(offset);
+        const size_t readSize = file.read(reinterpret_cast<uint8_t*>(&(*output)[0]), output->size());
+        file.close();
+
+        output->resize(readSize);
+        return Status(Status::Code::GOOD);
+    }
+
+    std::string FlashLog::makeSegmentPath(const uint32_t index) const
+    {
+        char path[32] = {'\0'};
+        snprintf(path, sizeof(path), "/%s%08u.log", LOG_SEGMENT_PREFIX, index);
+        return std::string(path);
+    }
+
+    std::pair<bool, uint32_t> FlashLog::parseSegmentIndex(const char* name) const
+    {
+        if (name == nullptr)
+        {
+            return std::make_pair(false, 0);
+        }
+
+        if (name[0] == '/')
+        {
+            ++name;
+        }
+
+        const size_t prefixLength = strlen(LOG_SEGMENT_PREFIX);
+        if (strncmp(name, LOG_SEGMENT_PREFIX, prefixLength) != 0)
+        {
+            return std::make_pair(false, 0);
+        }
+
+        char* end = nullptr;
+        const unsigned long index = strtoul(name + prefixLength, &end, 10);
+        if (end == name + prefixLength || strcmp(end, ".log") != 0)
+        {
+            return std::make_pair(false, 0);
+        }
+
+        return std::make_pair(true, static_cast<uint32_t>(index));
+    }
+
+    void FlashLog::captureRtcRing()
+    {
+        if (mIsRtcRingCaptured == true)
+        {
+            return;
+        }
+        mIsRtcRingCaptured = true;
+
+        /**
+         * @note 정상적인 재시작에서는 종료 핸들러가 배치를 플래시에 기록하므로, 배치를 기록하지
+         *       못하는 패닉, 와치독, 브라운아웃 리셋인 경우에만 RTC 링 버퍼를 복구합니다.
+         */
+        const esp_reset_reason_t resetReason = esp_reset_reason();
+        const bool isAbnormalReset = resetReason == ESP_RST_PANIC    ||
+                                     resetReason == ESP_RST_INT_WDT  ||
+                                     resetReason == ESP_RST_TASK_WDT ||
+                                     resetReason == ESP_RST_WDT      ||
+                                     resetReason == ESP_RST_BROWNOUT;
+        const size_t capacity = sizeof(s_RtcRing.Data);
+        const bool isValid = s_RtcRing.Magic == RTC_RING_MAGIC &&
+                             s_RtcRing.Head < capacity         &&
+                             s_RtcRing.Length <= capacity;
+
+        if (isAbnormalReset == true && isValid == true && s_RtcRing.Length > 0)
+        {
+            const size_t begin = (s_RtcRing.Head + capacity - s_RtcRing.Length) % capacity;
+            const size_t firstChunk = std::min(static_cast<size_t>(s_RtcRing.Length), capacity - begin);
+            mPreviousBoot.reserve(s_RtcRing.Length);
+            mPreviousBoot.assign(s_RtcRing.Data + begin, firstChunk);
+            mPreviousBoot.append(s_RtcRing.Data, s_RtcRing.Length - firstChunk);
+
+            // 링 버퍼가 가득 차서 잘린 첫 줄은 버립니다.
+            const size_t lineEnd = mPreviousBoot.find('\n');
+            if (s_RtcRing.Length == capacity && lineEnd != std::string::npos)
+            {
+                mPreviousBoot.erase(0, lineEnd + 1);
+            }
+        }
+
+        s_RtcRing.Magic  = RTC_RING_MAGIC;
+        s_RtcRing.Head   = 0;
+        s_RtcRing.Length = 0;
+    }
+
+    void FlashLog::appendRtcRing(const char* data, const size_t length)
+    {
+        const size_t capacity = sizeof(s_RtcRing.Data);
+        if (length >= capacity)
+        {
+            data += length - capacity;
+        }
+
+        const size_t count = std::min(length, capacity);
+        const size_t firstChunk = std::min(count, capacity - s_RtcRing.Head);
+        memcpy(s_RtcRing.Data + s_RtcRing.Head, data, firstChunk);
+        memcpy(s_RtcRing.Data, data + firstChunk, count - firstChunk);
+
+        s_RtcRing.Head   = (s_RtcRing.Head + count) % capacity;
+        s_RtcRing.Length = std::min(s_RtcRing.Length + count, capacity);
+    }
+
+    void FlashLog::writeBatch()
+    {
+        if (mBatchLength == 0)
+        {
+            return;
+        }
+
+        writeSegment(mBatch, mBatchLength);
+        mBatchLength = 0;
+    }
+
+    void FlashLog::writeSegment(const char* data, const size_t length)
+    {
+        if ((mTailSize > 0) && (mTailSize + length > SEGMENT_SIZE))
+        {
+            openNextWriteSegment();
+        }
+
+        /**
+         * @note 로그를 기록하는 도중에 로그를 남기면 다시 이 함수가 호출되므로 실패는 유실
+         *       횟수로만 집계합니다. 기록하지 못한 데이터는 다시 시도하지 않고 버립니다.
+         */
+        File file = esp32FS.Open(makeSegmentPath(mTailSegment), "a", true);
+        size_t written = 0;
+        if (file)
+        {
+            written = file.write(reinterpret_cast<const uint8_t*>(data), length);
+            file.close();
+        }
+
+        if (written != length)
+        {
+            mDropCount += std::count(data + written, data + length, '\n');
+        }
+
+        mTailSize += written;
+    }
+
+    void FlashLog::openNextWriteSegment()
+    {
+        ++mTailSegment;
+        mTailSize = 0;
+
+        while ((mTailSegment - mHeadSegment + 1) > MAX_SEGMENT_COUNT)
+        {
+            esp32FS.Remove(makeSegmentPath(mHeadSegment++));
+        }
+    }
+
+
+    FlashLog flashLog;
+}
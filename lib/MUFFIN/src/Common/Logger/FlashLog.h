@@ -0,0 +1,96 @@
+/**
+ * @file FlashLog.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 로그 메시지를 플래시 메모리의 세그먼트 파일에 순환 기록하는 클래스를 선언합니다.
+ * @details 로그 태스크가 서식화한 로그를 색상 코드 없이 RAM 배치 버퍼에 모은 다음, 배치가
+ *          가득 차거나 일정 시간이 지나면 한 번에 고정 크기의 세그먼트 파일 끝에 추가합니다.
+ *          세그먼트 파일의 수가 최대치를 넘으면 가장 오래된 세그먼트를 삭제합니다. 또한 최근
+ *          로그를 RTC 메모리의 링 버퍼에도 기록하여, 와치독 리셋과 같이 배치를 플래시에 쓰지
+ *          못하고 재시작한 경우에도 다음 부팅 시 플래시 로그에 이어 붙입니다.
+ *
+ * @note Append()와 Sync()는 로그 태스크에서만 호출해야 하며, 생산자 태스크는 이 클래스에
+ *       접근하지 않습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <sys/_stdint.h>
+
+#include "Common/Status.h"
+#include "Common/Sync/Mutex.hpp"
+
+
+
+namespace muffin {
+
+    class FlashLog
+    {
+    public:
+        FlashLog();
+        virtual ~FlashLog() {}
+    public:
+        /**
+         * @brief 파일 시스템이 마운트된 다음 호출해야 하며, 이전 부팅의 RTC 링 버퍼에 남은
+         *        로그가 있으면 세그먼트 파일에 기록합니다.
+         */
+        Status Init();
+        bool IsInitialized() const;
+        uint32_t GetDropCount() const;
+    public:
+        void Append(const char* line);
+        /**
+         * @param isForced true이면 배치 버퍼의 크기나 경과 시간과 관계없이 플래시에 기록합니다.
+         */
+        void Sync(const bool isForced);
+    public:
+        /**
+         * @return std::pair<uint32_t, uint32_t> 가장 오래된 세그먼트와 가장 최근 세그먼트의 번호
+         */
+        std::pair<uint32_t, uint32_t> GetSegmentRange();
+        /**
+         * @brief 세그먼트 파일의 offset부터 최대 maxLength 바이트를 읽습니다.
+         * @return Status::Code::BAD_NOT_FOUND 세그먼트가 이미 삭제되었거나 존재하지 않는 경우
+         * @return Status::Code::BAD_NO_DATA offset이 세그먼트의 끝인 경우
+         */
+        Status Read(const uint32_t segment, const size_t offset, const size_t maxLength, std::string* output);
+    private:
+        std::string makeSegmentPath(const uint32_t index) const;
+        std::pair<bool, uint32_t> parseSegmentIndex(const char* name) const;
+        void captureRtcRing();
+        void appendRtcRing(const char* data, const size_t length);
+        void writeBatch();
+        void writeSegment(const char* data, const size_t length);
+        void openNextWriteSegment();
+    private:
+        static const size_t BATCH_SIZE = 1024;
+        const size_t   SEGMENT_SIZE         = 16 * 1024;
+        const uint8_t  MAX_SEGMENT_COUNT    = 4;
+        const uint32_t BATCH_TIMEOUT_MILLIS = 5 * 1000;
+    private:
+        Mutex mMutex;
+        bool mIsInitialized;
+        bool mIsRtcRingCaptured;
+        std::string mPreviousBoot;
+        char mBatch[BATCH_SIZE];
+        size_t mBatchLength;
+        uint32_t mBatchMillis;
+        uint32_t mHeadSegment;
+        uint32_t mTailSegment;
+        size_t mTailSize;
+        uint32_t mDropCount;
+    };
+
+
+    extern FlashLog flashLog;
+}
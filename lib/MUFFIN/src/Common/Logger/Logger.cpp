@@ -13,17 +13,254 @@
 
 
 
-#include <sstream>
+#include <assert.h>
+#include <ctype.h>
+#include <esp_system.h>
 #include <HardwareSerial.h>
+#include <string.h>
 
 #include "Common/Time/TimeUtils.h"
 #include "WelcomeMessage.h"
+#include "FlashLog.h"
 #include "Logger.h"
+#include "MqttLog.h"
 
 
 
 namespace muffin {
 
+	typedef enum class LogArgumentEnum
+		: uint8_t
+	{
+		NONE     = 0,
+		INT32    = 1,
+		INT64    = 2,
+		DOUBLE   = 3,
+		STRING   = 4,
+		POINTER  = 5
+	} log_arg_e;
+
+	typedef struct LogFormatSpecType
+	{
+		const char* Begin;
+		const char* End;
+		bool IsWidthFromArgument;
+		bool IsPrecisionFromArgument;
+		log_arg_e Argument;
+	} log_spec_t;
+
+	static const size_t MAX_STRING_ARGUMENT = 96;
+
+	/**
+	 * @brief '%'부터 변환 문자까지의 서식 지정자를 해석합니다. 기록과 출력 양쪽에서 같은 규칙으로
+	 *        인자를 읽고 쓰기 위해 사용합니다.
+	 */
+	static void parseSpec(const char* percent, log_spec_t* spec)
+	{
+		const char* cursor = percent + 1;
+		spec->Begin = percent;
+		spec->IsWidthFromArgument = false;
+		spec->IsPrecisionFromArgument = false;
+		spec->Argument = log_arg_e::NONE;
+
+		while (*cursor != '\0' && strchr("-+ #0", *cursor) != nullptr)
+		{
+			++cursor;
+		}
+
+		if (*cursor == '*')
+		{
+			spec->IsWidthFromArgument = true;
+			++cursor;
+		}
+		while (isdigit(static_cast<unsigned char>(*cursor)))
+		{
+			++cursor;
+		}
+
+		if (*cursor == '.')
+		{
+			++cursor;
+			if (*cursor == '*')
+			{
+				spec->IsPrecisionFromArgument = true;
+				++cursor;
+			}
+			while (isdigit(static_cast<unsigned char>(*cursor)))
+			{
+				++cursor;
+			}
+		}
+
+		uint8_t longCount = 0;
+		while (*cursor != '\0' && strchr("hlLjztq", *cursor) != nullptr)
+		{
+			if (*cursor == 'l')
+			{
+				++longCount;
+			}
+			else if (*cursor == 'j' || *cursor == 'q')
+			{
+				longCount = 2;
+			}
+			++cursor;
+		}
+
+		switch (*cursor)
+		{
+		case 'd':
+		case 'i':
+		case 'u':
+		case 'x':
+		case 'X':
+		case 'o':
+		case 'c':
+			spec->Argument = longCount < 2 ? log_arg_e::INT32 : log_arg_e::INT64;
+			break;
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+		case 'a':
+		case 'A':
+			spec->Argument = log_arg_e::DOUBLE;
+			break;
+		case 's':
+			spec->Argument = log_arg_e::STRING;
+			break;
+		case 'p':
+			spec->Argument = log_arg_e::POINTER;
+			break;
+		case '\0':
+			spec->End = cursor;
+			return;
+		default:
+			break;
+		}
+
+		spec->End = cursor + 1;
+	}
+
+	static size_t encodeArguments(const char* fmt, va_list args, uint8_t* output, const size_t capacity)
+	{
+		size_t length = 0;
+		log_spec_t spec;
+
+		for (const char* percent = strchr(fmt, '%'); percent != nullptr; percent = strchr(spec.End, '%'))
+		{
+			parseSpec(percent, &spec);
+
+			const size_t starBytes = (spec.IsWidthFromArgument ? sizeof(int32_t) : 0) + 
+									 (spec.IsPrecisionFromArgument ? sizeof(int32_t) : 0);
+			size_t valueBytes = 0;
+			switch (spec.Argument)
+			{
+			case log_arg_e::INT32:
+			case log_arg_e::POINTER:
+				valueBytes = sizeof(int32_t);
+				break;
+			case log_arg_e::INT64:
+			case log_arg_e::DOUBLE:
+				valueBytes = sizeof(int64_t);
+				break;
+			case log_arg_e::STRING:
+				valueBytes = sizeof(uint8_t);
+				break;
+			default:
+				break;
+			}
+
+			if (length + starBytes + valueBytes > capacity)
+			{
+				break;
+			}
+
+			for (uint8_t index = 0; index < (starBytes / sizeof(int32_t)); ++index)
+			{
+				const int32_t star = va_arg(args, int);
+				memcpy(output + length, &star, sizeof(star));
+				length += sizeof(star);
+			}
+
+			switch (spec.Argument)
+			{
+			case log_arg_e::INT32:
+			{
+				const int32_t value = va_arg(args, int);
+				memcpy(output + length, &value, sizeof(value));
+				length += sizeof(value);
+				break;
+			}
+			case log_arg_e::INT64:
+			{
+				const int64_t value = va_arg(args, long long);
+				memcpy(output + length, &value, sizeof(value));
+				length += sizeof(value);
+				break;
+			}
+			case log_arg_e::DOUBLE:
+			{
+				const double value = va_arg(args, double);
+				memcpy(output + length, &value, sizeof(value));
+				length += sizeof(value);
+				break;
+			}
+			case log_arg_e::POINTER:
+			{
+				const uint32_t value = reinterpret_cast<uintptr_t>(va_arg(args, void*));
+				memcpy(output + length, &value, sizeof(value));
+				length += sizeof(value);
+				break;
+			}
+			case log_arg_e::STRING:
+			{
+				const char* value = va_arg(args, const char*);
+				if (value == nullptr)
+				{
+					value = "(null)";
+				}
+
+				size_t stringLength = strnlen(value, MAX_STRING_ARGUMENT);
+				if (length + sizeof(uint8_t) + stringLength > capacity)
+				{
+					stringLength = capacity - length - sizeof(uint8_t);
+				}
+
+				output[length++] = static_cast<uint8_t>(stringLength);
+				memcpy(output + length, value, stringLength);
+				length += stringLength;
+				break;
+			}
+			default:
+				break;
+			}
+		}
+
+		return length;
+	}
+
+	Logger::Logger()
+		: xSemaphore(NULL)
+		, xTaskHandle(NULL)
+		, mIsReady(false)
+		, mDropCount(0)
+		, mReportedDropCount(0)
+	{
+		for (uint8_t core = 0; core < CORE_COUNT; ++core)
+		{
+			mRings[core] = nullptr;
+			portMUX_INITIALIZE(&mRingLocks[core]);
+		}
+
+		for (uint8_t module = 0; module < MODULE_COUNT; ++module)
+		{
+			mModuleLevels[module] = MODULE_LEVEL_UNSET;
+			mCaptureLevels[module].store(static_cast<uint8_t>(mLevel));
+		}
+	}
+
 	void Logger::Init()
 	{
 		if (Serial == false)
@@ -32,12 +269,73 @@ namespace muffin {
 			vTaskDelay(10 / portTICK_PERIOD_MS);
 			Serial.println("\033[0m");
 			Serial.println(F(welcomAsciiArt));
+		}
+
+		if (xSemaphore == NULL)
+		{
+			xSemaphore = xSemaphoreCreateMutex();
+		}
 
-			if (xSemaphore == NULL)
+		if (mIsReady.load() == true || xSemaphore == NULL)
+		{
+			return;
+		}
+
+		for (uint8_t core = 0; core < CORE_COUNT; ++core)
+		{
+			if (mRings[core] == nullptr)
 			{
-				xSemaphore = xSemaphoreCreateMutex();
+				mRings[core] = new(std::nothrow) SpscRingBuffer(RING_CAPACITY);
 			}
+
+			if (mRings[core] == nullptr || mRings[core]->Init() != Status::Code::GOOD)
+			{
+				Serial.println("FAILED TO ALLOCATE LOG RING BUFFER");
+				return;
+			}
+		}
+
+		BaseType_t ret = xTaskCreate(implLoggerTask,	// Function to be run inside of the task
+									 "implLoggerTask",	// The identifier of this task for men
+									 4 * 1024,			// Stack memory size to allocate
+									 this,				// Task parameters to be passed to the function
+									 1,					// Task Priority for scheduling
+									 &xTaskHandle);		// The identifier of this task for machines
+		if (ret != pdPASS)
+		{
+			Serial.println("FAILED TO START LOGGER TASK");
+			return;
 		}
+
+		esp_register_shutdown_handler(onShutdown);
+		mIsReady.store(true);
+	}
+
+	void Logger::Flush()
+	{
+		if (mIsReady.load() == false)
+		{
+			return;
+		}
+
+		if (xSemaphoreTake(xSemaphore, 1000 / portTICK_PERIOD_MS) != pdTRUE)
+		{
+			return;
+		}
+
+		while (drainRecord() == true)
+		{
+			;
+		}
+
+		Serial.flush();
+		flashLog.Sync(true);
+		xSemaphoreGive(xSemaphore);
+	}
+
+	uint32_t Logger::GetDropCount() const
+	{
+		return mDropCount.load();
 	}
 
 	bool Logger::GetFilePathVerbosity() const
@@ -58,6 +356,53 @@ namespace muffin {
 	void Logger::SetLevel(const log_level_e& level)
 	{
 		mLevel = level;
+		UpdateCaptureLevels();
+	}
+
+	void Logger::SetModuleLevel(const log_module_e module, const log_level_e level)
+	{
+		mModuleLevels[static_cast<uint8_t>(module)] = static_cast<uint8_t>(level);
+		UpdateCaptureLevels();
+	}
+
+	void Logger::ClearModuleLevel(const log_module_e module)
+	{
+		mModuleLevels[static_cast<uint8_t>(module)] = MODULE_LEVEL_UNSET;
+		UpdateCaptureLevels();
+	}
+
+	std::pair<bool, log_module_e> Logger::ToModule(const char* name) const
+	{
+		for (uint8_t module = 0; module < MODULE_COUNT; ++module)
+		{
+			if (strcmp(name, mModuleString[module]) == 0)
+			{
+				return std::make_pair(true, static_cast<log_module_e>(module));
+			}
+		}
+		return std::make_pair(false, log_module_e::GENERAL);
+	}
+
+	void Logger::UpdateCaptureLevels()
+	{
+		const bool isStreaming = mqttLog.IsEnabled();
+		const uint8_t streamLevel = static_cast<uint8_t>(mqttLog.GetLevel());
+
+		for (uint8_t module = 0; module < MODULE_COUNT; ++module)
+		{
+			uint8_t level = static_cast<uint8_t>(getLocalLevel(static_cast<log_module_e>(module)));
+			if (isStreaming == true && streamLevel > level)
+			{
+				level = streamLevel;
+			}
+			mCaptureLevels[module].store(level, std::memory_order_relaxed);
+		}
+	}
+
+	log_level_e Logger::getLocalLevel(const log_module_e module) const
+	{
+		const uint8_t level = mModuleLevels[static_cast<uint8_t>(module)];
+		return level == MODULE_LEVEL_UNSET ? mLevel : static_cast<log_level_e>(level);
 	}
 
     std::set<log_sink_e> Logger::GetSink() const
@@ -68,73 +413,333 @@ namespace muffin {
 	void Logger::SetSink(const std::set<log_sink_e>& sinkSet)
 	{
 		assert(sinkSet.size() > 0);
+		lockSinkSet();
 		mSinkSet = sinkSet;
+		unlockSinkSet();
 	}
 
 	void Logger::AddSinkElement(const log_sink_e sink)
 	{
+		lockSinkSet();
 		mSinkSet.insert(sink);
+		unlockSinkSet();
 	}
 
     void Logger::RemoveSinkElement(const log_sink_e sink)
     {
+		lockSinkSet();
         mSinkSet.erase(sink);
+		unlockSinkSet();
     }
 
-	void Logger::Log(const log_level_e level, const size_t counter, const char* file, const char* func, const size_t line, const char* fmt, ...)
+	void Logger::Log(const log_level_e level, const log_module_e module, const size_t counter, const char* file, const char* func, const size_t line, const char* fmt, ...)
 	{
-	    if (mLevel < level || mSinkSet.size() == 0)
+		/**
+		 * @note 레벨은 로그 구문에서 IsEnabled()로 이미 확인했습니다. 원격 로그 스트리밍이 더 상세한
+		 *       레벨을 요청한 경우에도 레코드를 남기며, 시리얼과 플래시 싱크는 출력할 때 다시 거릅니다.
+		 */
+	    if (mSinkSet.size() == 0 || mIsReady.load(std::memory_order_acquire) == false)
     	{
         	return ;
     	}
 
-		if (xSemaphoreTake(xSemaphore, 1000) != pdTRUE)
+		uint8_t record[sizeof(record_header_t) + MAX_ARGUMENT_BYTES];
+		record_header_t header;
+		header.TimestampMillis  = GetTimestampInMillis();
+		header.Format           = fmt;
+		header.File             = file;
+		header.Function         = func;
+		header.Line             = static_cast<uint16_t>(line);
+		header.Counter          = static_cast<uint16_t>(counter);
+		header.Level            = level;
+		header.Module           = module;
+		strncpy(header.TaskName, pcTaskGetTaskName(NULL), sizeof(header.TaskName) - 1);
+		header.TaskName[sizeof(header.TaskName) - 1] = '\0';
+
+		va_list args;
+		va_start(args, fmt);
+		header.ArgumentBytes = static_cast<uint16_t>(encodeArguments(fmt, args, record + sizeof(header), MAX_ARGUMENT_BYTES));
+		va_end(args);
+		memcpy(record, &header, sizeof(header));
+
+		/**
+		 * @note 같은 코어의 태스크끼리만 링 버퍼를 공유하므로 임계 구역은 다른 코어와 경합하지
+		 *       않으며, 레코드를 복사하는 동안에만 유지됩니다.
+		 */
+		const size_t recordSize = sizeof(header) + header.ArgumentBytes;
+		const uint8_t core = static_cast<uint8_t>(xPortGetCoreID());
+		SpscRingBuffer* ring = mRings[core];
+		bool isWritten = false;
+
+		portENTER_CRITICAL(&mRingLocks[core]);
+		if (ring->GetCapacity() - ring->GetAvailableBytes() >= recordSize)
 		{
+			ring->Write(record, recordSize);
+			isWritten = true;
+		}
+		portEXIT_CRITICAL(&mRingLocks[core]);
+
+		if (isWritten == false)
+		{
+			mDropCount.fetch_add(1, std::memory_order_relaxed);
 			return;
 		}
 
-		std::string filePath(file);
-		if (mIsFilePathVerbose == false)
+		xTaskNotifyGive(xTaskHandle);
+	}
+
+	void Logger::implLoggerTask(void* pvParameters)
+	{
+		Logger* instance = static_cast<Logger*>(pvParameters);
+
+		while (true)
 		{
-			filePath = filePath.find_last_of('/') == -1 ? 
-				filePath.c_str() : 
-				filePath.substr(filePath.find_last_of('/') + 1).c_str();
+			ulTaskNotifyTake(pdTRUE, 100 / portTICK_PERIOD_MS);
+
+			if (xSemaphoreTake(instance->xSemaphore, 1000 / portTICK_PERIOD_MS) != pdTRUE)
+			{
+				continue;
+			}
+
+			while (instance->drainRecord() == true)
+			{
+				;
+			}
+			flashLog.Sync(false);
+			mqttLog.Sync();
+			xSemaphoreGive(instance->xSemaphore);
+		}
+	}
+
+	void Logger::onShutdown()
+	{
+		logger.Flush();
+	}
+
+	bool Logger::drainRecord()
+	{
+		const uint32_t dropCount = mDropCount.load(std::memory_order_relaxed);
+		if (dropCount != mReportedDropCount)
+		{
+			snprintf(mLogBuffer, sizeof(mLogBuffer), "%s[%s][%s] %u LOG MESSAGES WERE DROPPED",
+				mColorString[static_cast<uint8_t>(log_level_e::LOG_LEVEL_WARNING)],
+				mLevelString[static_cast<uint8_t>(log_level_e::LOG_LEVEL_WARNING)],
+				GetDatetime().c_str(),
+				dropCount - mReportedDropCount);
+			writeToSink(log_level_e::LOG_LEVEL_WARNING, log_module_e::GENERAL, nullptr, mLogBuffer);
+			mReportedDropCount = dropCount;
+		}
+
+		/**
+		 * @note 코어별 링 버퍼에서 가장 오래된 레코드를 먼저 출력하여 시간 순서를 유지합니다.
+		 */
+		int8_t oldestCore = -1;
+		record_header_t oldest = {};
+		for (uint8_t core = 0; core < CORE_COUNT; ++core)
+		{
+			record_header_t header;
+			if (mRings[core]->Peek(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header))
+			{
+				continue;
+			}
+
+			if (oldestCore == -1 || header.TimestampMillis < oldest.TimestampMillis)
+			{
+				oldestCore = static_cast<int8_t>(core);
+				oldest = header;
+			}
 		}
 
+		if (oldestCore == -1)
+		{
+			return false;
+		}
+
+		uint8_t record[sizeof(record_header_t) + MAX_ARGUMENT_BYTES];
+		const size_t recordSize = sizeof(record_header_t) + oldest.ArgumentBytes;
+		mRings[oldestCore]->Read(record, recordSize);
+
+		formatRecord(oldest, record + sizeof(record_header_t));
+		writeToSink(oldest.Level, oldest.Module, oldest.File, mLogBuffer);
+		return true;
+	}
+
+	void Logger::formatRecord(const record_header_t& header, const uint8_t* arguments)
+	{
+		const char* filePath = header.File;
+		if (mIsFilePathVerbose == false && strrchr(header.File, '/') != nullptr)
+		{
+			filePath = strrchr(header.File, '/') + 1;
+		}
+
+		int length = snprintf(mLogBuffer, sizeof(mLogBuffer), "%s[%s][%s][%s][%s:%u][%s:%u] ",
+			mColorString[static_cast<uint8_t>(header.Level)],
+			mLevelString[static_cast<uint8_t>(header.Level)],
+			Convert2Datetime(static_cast<time_t>(header.TimestampMillis / 1000)).c_str(),
+			header.TaskName,
+			filePath, header.Line,
+			header.Function, header.Counter);
+
+		const uint8_t* cursor = arguments;
+		const uint8_t* const end = arguments + header.ArgumentBytes;
+		const char* literal = header.Format;
+		log_spec_t spec;
+
+		while (length >= 0 && static_cast<size_t>(length) < sizeof(mLogBuffer) - 1)
+		{
+			const char* percent = strchr(literal, '%');
+			const size_t literalLength = percent == nullptr ? strlen(literal) : static_cast<size_t>(percent - literal);
+			length += snprintf(mLogBuffer + length, sizeof(mLogBuffer) - length, "%.*s", static_cast<int>(literalLength), literal);
+			if (percent == nullptr || static_cast<size_t>(length) >= sizeof(mLogBuffer) - 1)
+			{
+				break;
+			}
+
+			parseSpec(percent, &spec);
+			literal = spec.End;
+
+			if (spec.Argument == log_arg_e::NONE)
+			{
+				const char* verbatim = *(percent + 1) == '%' ? "%" : percent;
+				const int verbatimLength = *(percent + 1) == '%' ? 1 : static_cast<int>(spec.End - percent);
+				length += snprintf(mLogBuffer + length, sizeof(mLogBuffer) - length, "%.*s", verbatimLength, verbatim);
+				continue;
+			}
+
+			const size_t starBytes = (spec.IsWidthFromArgument ? sizeof(int32_t) : 0) + 
+									 (spec.IsPrecisionFromArgument ? sizeof(int32_t) : 0);
+			const size_t valueBytes = spec.Argument == log_arg_e::INT64 || spec.Argument == log_arg_e::DOUBLE
+				? sizeof(int64_t)
+				: spec.Argument == log_arg_e::STRING ? sizeof(uint8_t) : sizeof(int32_t);
+			if (static_cast<size_t>(end - cursor) < starBytes + valueBytes)
+			{
+				// 인자가 잘린 경우에는 나머지 서식 문자열을 그대로 출력합니다.
+				length += snprintf(mLogBuffer + length, sizeof(mLogBuffer) - length, "%s", percent);
+				break;
+			}
+
+			char specText[32];
+			size_t specLength = 0;
+			for (const char* character = spec.Begin; character < spec.End && specLength < sizeof(specText) - 12; ++character)
+			{
+				if (*character != '*')
+				{
+					specText[specLength++] = *character;
+					continue;
+				}
+
+				int32_t star = 0;
+				memcpy(&star, cursor, sizeof(star));
+				cursor += sizeof(star);
+				specLength += snprintf(specText + specLength, sizeof(specText) - specLength, "%d", static_cast<int>(star));
+			}
+			specText[specLength] = '\0';
+
+			char* output = mLogBuffer + length;
+			const size_t remained = sizeof(mLogBuffer) - length;
+			switch (spec.Argument)
+			{
+			case log_arg_e::INT32:
+			{
+				int32_t value = 0;
+				memcpy(&value, cursor, sizeof(value));
+				cursor += sizeof(value);
+				length += snprintf(output, remained, specText, static_cast<int>(value));
+				break;
+			}
+			case log_arg_e::INT64:
+			{
+				int64_t value = 0;
+				memcpy(&value, cursor, sizeof(value));
+				cursor += sizeof(value);
+				length += snprintf(output, remained, specText, static_cast<long long>(value));
+				break;
+			}
+			case log_arg_e::DOUBLE:
+			{
+				double value = 0;
+				memcpy(&value, cursor, sizeof(value));
+				cursor += sizeof(value);
+				length += snprintf(output, remained, specText, value);
+				break;
+			}
+			case log_arg_e::POINTER:
+			{
+				uint32_t value = 0;
+				memcpy(&value, cursor, sizeof(value));
+				cursor += sizeof(value);
+				length += snprintf(output, remained, specText, reinterpret_cast<void*>(value));
+				break;
+			}
+			case log_arg_e::STRING:
+			{
+				char value[MAX_STRING_ARGUMENT + 1];
+				const size_t stringLength = *cursor++;
+				const size_t copied = stringLength < static_cast<size_t>(end - cursor) ? stringLength : static_cast<size_t>(end - cursor);
+				memcpy(value, cursor, copied);
+				value[copied] = '\0';
+				cursor += copied;
+				length += snprintf(output, remained, specText, value);
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+
+	void Logger::writeToSink(const log_level_e level, const log_module_e module, const char* file, const char* fullLog)
+	{
+		const bool isLocalLevel = level <= getLocalLevel(module);
+
 		// send the log message to sink set
 		for (const auto& sink : mSinkSet)
 		{
-			if (sink == log_sink_e::LOG_TO_SERIAL_MONITOR)
+			switch (sink)
 			{
+			case log_sink_e::LOG_TO_SERIAL_MONITOR:
             #if defined(ESP32)
-                // generate the log message using arg list
-                va_list args;
-                va_start(args, fmt);
-                int length = vsnprintf(nullptr, 0, fmt, args);
-                std::string message(length + 1, '\0');
-                vsnprintf(&message[0], length + 1, fmt, args);
-                va_end(args);
-		
-				// generate a metadata string for the log
-				std::stringstream metadata;
-				metadata <<  mColorString[static_cast<uint8_t>(level)]  <<
-					"["  <<  mLevelString[static_cast<uint8_t>(level)]  << "]"
-					"["  <<  GetDatetime()   	     					<< "]"
-					"["  <<  filePath << ":" << line 	 				<< "]"
-					"["  <<  func     << ":" << counter  				<< "] ";
-
-				// combine the log message with metadata
-				const std::string fullLog = metadata.str() + message;
-
-				// mush flush the txd buffer after writing
-				Serial.println(fullLog.c_str());
-				Serial.flush();
+				if (isLocalLevel == true)
+				{
+					Serial.println(fullLog);
+				}
             #endif
+				break;
+        #if defined(ESP32)
+			case log_sink_e::LOG_TO_SPIFFS:
+				if (isLocalLevel == true)
+				{
+					flashLog.Append(fullLog);
+				}
+				break;
+			case log_sink_e::LOG_TO_MQTT_BROKER:
+				mqttLog.Append(level, file, fullLog);
+				break;
+        #endif
+			default:
+				break;
 			}
 		}
+	}
 
-		xSemaphoreGive(xSemaphore);
+	void Logger::lockSinkSet()
+	{
+		/**
+		 * @note 로그 태스크가 싱크 목록을 순회하는 동안 목록이 변경되지 않도록 출력 뮤텍스를 사용합니다.
+		 */
+		if (xSemaphore != NULL)
+		{
+			xSemaphoreTake(xSemaphore, portMAX_DELAY);
+		}
+	}
+
+	void Logger::unlockSinkSet()
+	{
+		if (xSemaphore != NULL)
+		{
+			xSemaphoreGive(xSemaphore);
+		}
 	}
 
 	Logger logger;
-}
\ No newline at end of file
+}
@@ -7,7 +7,7 @@
  * @date 2024-12-24
  * @version 1.0.0
  * 
- * @todo 시리얼 모니터 외의 sink로 전송하는 기능 구현
+ * @todo microSD sink로 전송하는 기능 구현
  * @todo ATmega2560 칩셋 대상 기능 구현
  * 
  * @copyright Copyright Edgecross Inc. (c) 2023-2024
@@ -18,61 +18,83 @@
 
 #pragma once
 
+#include <atomic>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <freertos/task.h>
 #include <set>
 #include <stdarg.h>
 #include <sys/types.h>
 #include <sys/_stdint.h>
 #include <string>
+#include <utility>
 
+#include "Common/DataStructure/SpscRingBuffer.h"
 
 
-#define LOG_ERROR(_logger, fmt, ...)            \
-    _logger.Log(                                \
-        muffin::log_level_e::LOG_LEVEL_ERROR,   \
-        __COUNTER__,                            \
-        __FILE__,                               \
-        __FUNCTION__,                           \
-        __LINE__, fmt,                          \
-        ##__VA_ARGS__);
-
-#define LOG_WARNING(_logger, fmt, ...)          \
-    _logger.Log(                                \
-        muffin::log_level_e::LOG_LEVEL_WARNING, \
-        __COUNTER__,                            \
-        __FILE__,                               \
-        __FUNCTION__,                           \
-        __LINE__, fmt,                          \
-        ##__VA_ARGS__);
-
-#define LOG_INFO(_logger, fmt, ...)             \
-    _logger.Log(                                \
-        muffin::log_level_e::LOG_LEVEL_INFO,    \
-        __COUNTER__,                            \
-        __FILE__,                               \
-        __FUNCTION__,                           \
-        __LINE__, fmt,                          \
-        ##__VA_ARGS__);
-
-#if defined(DEBUG)
-#define LOG_DEBUG(_logger, fmt, ...)            \
-    _logger.Log(                                \
-        muffin::log_level_e::LOG_LEVEL_DEBUG,   \
-        __COUNTER__,                            \
-        __FILE__,                               \
-        __FUNCTION__,                           \
-        __LINE__, fmt,                          \
-        ##__VA_ARGS__);
-
-#define LOG_VERBOSE(_logger, fmt, ...)          \
-    _logger.Log(                                \
-        muffin::log_level_e::LOG_LEVEL_VERBOSE, \
-        __COUNTER__,                            \
-        __FILE__,                               \
-        __FUNCTION__,                           \
-        __LINE__, fmt,                          \
-        ##__VA_ARGS__);
+
+/**
+ * @brief 번역 단위(.cpp)의 첫 번째 #include보다 앞에 아래 매크로를 정의하면 해당 파일의 로그
+ *        모듈과 컴파일 타임 로그 레벨을 지정할 수 있습니다.
+ *
+ *            #define MUFFIN_LOG_MODULE   muffin::log_module_e::CRC32
+ *            #define MUFFIN_LOG_LEVEL    2
+ *
+ * @details MUFFIN_LOG_LEVEL보다 상세한 로그 구문은 컴파일 결과에서 제외됩니다. 남아 있는 구문은
+ *          모듈의 런타임 레벨을 원자적으로 읽어 비교한 다음에만 인자를 평가하고 Logger::Log()를
+ *          호출합니다. 정의하지 않은 경우 DEBUG 빌드는 VERBOSE(4), 그 외에는 INFO(2)입니다.
+ * @note ESP-IDF의 LOG_LOCAL_LEVEL과는 별개의 값입니다.
+ * @note 로그 태스크는 서식 문자열의 포인터를 보관했다가 나중에 서식화하므로 서식 문자열은 반드시
+ *       문자열 리터럴이어야 합니다. 런타임 문자열을 출력할 때는 LOG_ERROR(logger, "%s", str)와
+ *       같이 인자로 넘기며, 리터럴이 아닌 서식 문자열은 컴파일 오류가 됩니다.
+ */
+#if !defined(MUFFIN_LOG_MODULE)
+    #define MUFFIN_LOG_MODULE muffin::log_module_e::GENERAL
+#endif
+
+#if defined(DEBUG) || (defined(MUFFIN_LOG_LEVEL) && (MUFFIN_LOG_LEVEL >= 3))
+    #define MUFFIN_LOG_DEBUG_ENABLED
+#endif
+
+#if !defined(MUFFIN_LOG_LEVEL)
+    #if defined(DEBUG)
+        #define MUFFIN_LOG_LEVEL 4
+    #else
+        #define MUFFIN_LOG_LEVEL 2
+    #endif
+#endif
+
+#define MUFFIN_LOG(_logger, _level, fmt, ...)                                   \
+    do {                                                                        \
+        if ((static_cast<uint8_t>(_level) <= (MUFFIN_LOG_LEVEL)) &&             \
+            _logger.IsEnabled(MUFFIN_LOG_MODULE, _level))                       \
+        {                                                                       \
+            _logger.Log(                                                        \
+                _level,                                                         \
+                MUFFIN_LOG_MODULE,                                              \
+                __COUNTER__,                                                    \
+                __FILE__,                                                       \
+                __FUNCTION__,                                                   \
+                __LINE__, "" fmt,                                               \
+                ##__VA_ARGS__);                                                 \
+        }                                                                       \
+    } while (0);
+
+#define LOG_ERROR(_logger, fmt, ...)                                            \
+    MUFFIN_LOG(_logger, muffin::log_level_e::LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+
+#define LOG_WARNING(_logger, fmt, ...)                                          \
+    MUFFIN_LOG(_logger, muffin::log_level_e::LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)
+
+#define LOG_INFO(_logger, fmt, ...)                                             \
+    MUFFIN_LOG(_logger, muffin::log_level_e::LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+
+#if defined(MUFFIN_LOG_DEBUG_ENABLED)
+#define LOG_DEBUG(_logger, fmt, ...)                                            \
+    MUFFIN_LOG(_logger, muffin::log_level_e::LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+
+#define LOG_VERBOSE(_logger, fmt, ...)                                          \
+    MUFFIN_LOG(_logger, muffin::log_level_e::LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)
 #else
     #define LOG_DEBUG(_logger, fmt, ...)((void(0)))
     #define LOG_VERBOSE(_logger, fmt, ...)((void(0)))
@@ -91,6 +113,20 @@ namespace muffin {
         LOG_LEVEL_VERBOSE   = 4
     } log_level_e;
 
+    /**
+     * @brief 런타임에 로그 레벨을 따로 지정할 수 있는 모듈입니다. 모듈을 지정하지 않은 파일은 GENERAL입니다.
+     */
+    typedef enum class MuffinLogModuleEnum
+        : uint8_t
+    {
+        GENERAL     = 0,
+        VARIABLE    = 1,
+        MODBUS      = 2,
+        CRC32       = 3,
+        W5500       = 4,
+        CATM1       = 5
+    } log_module_e;
+
     typedef enum class MuffinLogSinkEnum
         : uint8_t
     {
@@ -109,26 +145,101 @@ namespace muffin {
     class Logger
     {
     public:
-        Logger() : xSemaphore(NULL) {}
+        Logger();
         virtual ~Logger() {}
     public:
         void Init();
+        /**
+         * @brief 링 버퍼에 남아 있는 로그를 모두 출력합니다. 재시작 직전과 같이 로그가 유실되면
+         *        안 되는 경우에만 호출해야 합니다.
+         */
+        void Flush();
+        uint32_t GetDropCount() const;
     public:
         bool GetFilePathVerbosity() const;
         void SetFilePathVerbosity(const bool isFilePathVerbose);
     public:
         log_level_e GetLevel() const;
         void SetLevel(const log_level_e& level);
+        /**
+         * @brief 모듈의 런타임 로그 레벨을 지정합니다. 컴파일 타임 레벨보다 상세한 로그는 출력되지 않습니다.
+         */
+        void SetModuleLevel(const log_module_e module, const log_level_e level);
+        /**
+         * @brief 모듈의 런타임 로그 레벨을 해제하여 전역 레벨을 따르게 합니다.
+         */
+        void ClearModuleLevel(const log_module_e module);
+        std::pair<bool, log_module_e> ToModule(const char* name) const;
+        /**
+         * @brief 로그 구문에서 인자를 평가하기 전에 호출하며, 모듈의 레벨과 원격 로그 스트리밍의
+         *        레벨 중 더 상세한 레벨까지 허용합니다.
+         */
+        bool IsEnabled(const log_module_e module, const log_level_e level) const
+        {
+            return static_cast<uint8_t>(level) <= mCaptureLevels[static_cast<uint8_t>(module)].load(std::memory_order_relaxed);
+        }
+        /**
+         * @brief 전역, 모듈, 원격 로그 스트리밍의 레벨이 변경되면 호출하여 IsEnabled()의 기준을 갱신합니다.
+         */
+        void UpdateCaptureLevels();
     public:
         std::set<log_sink_e> GetSink() const;
         void SetSink(const std::set<log_sink_e>& sinkSet);
         void AddSinkElement(const log_sink_e sink);
         void RemoveSinkElement(const log_sink_e sink);
     public:
-        void Log(const log_level_e level, const size_t counter, const char* file, const char* func, const size_t line, const char* fmt, ...);
+        /**
+         * @brief 서식 문자열의 포인터와 인자, 타임스탬프, 태스크 이름만 현재 코어의 링 버퍼에
+         *        기록하고 바로 반환합니다. 문자열 서식화와 출력은 로그 태스크에서 수행합니다.
+         * @note 링 버퍼가 가득 차면 로그를 버리고 유실 횟수를 증가시킵니다. 서식 문자열, 파일
+         *       이름, 함수 이름은 문자열 리터럴이어야 하며, "%s" 인자는 복사하여 저장합니다.
+         */
+        void Log(const log_level_e level, const log_module_e module, const size_t counter, const char* file, const char* func, const size_t line, const char* fmt, ...);
 
+    private:
+        typedef struct LogRecordHeaderType
+        {
+            uint64_t TimestampMillis;
+            const char* Format;
+            const char* File;
+            const char* Function;
+            uint16_t Line;
+            uint16_t Counter;
+            uint16_t ArgumentBytes;
+            log_level_e Level;
+            log_module_e Module;
+            char TaskName[9];
+        } record_header_t;
+    private:
+        static void implLoggerTask(void* pvParameters);
+        static void onShutdown();
+        bool drainRecord();
+        void formatRecord(const record_header_t& header, const uint8_t* arguments);
+        log_level_e getLocalLevel(const log_module_e module) const;
+        void writeToSink(const log_level_e level, const log_module_e module, const char* file, const char* fullLog);
+        void lockSinkSet();
+        void unlockSinkSet();
     private:
         SemaphoreHandle_t xSemaphore;
+        TaskHandle_t xTaskHandle;
+        static const uint8_t CORE_COUNT = portNUM_PROCESSORS;
+        static const uint8_t MODULE_COUNT = 6;
+        static const uint8_t MODULE_LEVEL_UNSET = 0xFF;
+    #if defined(MT11)
+        static const size_t RING_CAPACITY = 8 * 1024;
+    #else
+        static const size_t RING_CAPACITY = 2 * 1024;
+    #endif
+        static const size_t MAX_ARGUMENT_BYTES = 192;
+        static const size_t MAX_LOG_LENGTH = 512;
+        SpscRingBuffer* mRings[CORE_COUNT];
+        portMUX_TYPE mRingLocks[CORE_COUNT];
+        std::atomic<bool> mIsReady;
+        std::atomic<uint32_t> mDropCount;
+        uint32_t mReportedDropCount;
+        uint8_t mModuleLevels[MODULE_COUNT];
+        std::atomic<uint8_t> mCaptureLevels[MODULE_COUNT];
+        char mLogBuffer[MAX_LOG_LENGTH];
         static const uint32_t mBaudRate = 115200;
         bool mIsFilePathVerbose = false;
     #if defined(DEBUG)
@@ -154,6 +265,14 @@ namespace muffin {
             "DEBUG", 
             "VERBOSE"
         };
+        const char* mModuleString[MODULE_COUNT] = {
+            "GENERAL",
+            "VARIABLE",
+            "MODBUS",
+            "CRC32",
+            "W5500",
+            "CATM1"
+        };
         const char* mColorString[5] = {
             "\033[31m", 
             "\033[38;5;208m", 
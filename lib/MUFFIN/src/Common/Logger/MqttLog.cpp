@@ -0,0 +1,210 @@
+/**
+ * @file MqttLog.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 로그 메시지를 MQTT 브로커의 진단 토픽으로 스트리밍하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <string.h>
+
+#include "Common/Sync/LockGuard.hpp"
+#include "Common/Time/TimeUtils.h"
+#include "MqttLog.h"
+#include "Protocol/MQTT/CDO.h"
+
+
+
+namespace muffin {
+
+    MqttLog::MqttLog()
+        : mIsEnabled(false)
+        , mLevel(static_cast<uint8_t>(log_level_e::LOG_LEVEL_WARNING))
+        , mBatchLines(0)
+        , mBatchMillis(0)
+        , mBytesPerSecond(DEFAULT_BYTES_PER_SECOND)
+        , mTokens(BURST_BYTES)
+        , mLastRefillMillis(0)
+        , mSequence(0)
+        , mPendingDropCount(0)
+        , mDropCount(0)
+    {
+    }
+
+    void MqttLog::SetFilter(const bool isEnabled, const log_level_e level, const std::vector<std::string>& modules, const uint16_t bytesPerSecond)
+    {
+        {
+            LockGuard lock(mMutex);
+            mModules = modules;
+            mBytesPerSecond = bytesPerSecond == 0 ? DEFAULT_BYTES_PER_SECOND : bytesPerSecond;
+            mLevel.store(static_cast<uint8_t>(level));
+            mIsEnabled.store(isEnabled);
+
+            if (isEnabled == false)
+            {
+                mBatch.clear();
+                mBatch.shrink_to_fit();
+                mBatchLines = 0;
+            }
+        }
+
+        logger.UpdateCaptureLevels();
+    }
+
+    bool MqttLog::IsEnabled() const
+    {
+        return mIsEnabled.load();
+    }
+
+    log_level_e MqttLog::GetLevel() const
+    {
+        return static_cast<log_level_e>(mLevel.load());
+    }
+
+    uint32_t MqttLog::GetDropCount() const
+    {
+        return mDropCount.load();
+    }
+
+    void MqttLog::Append(const log_level_e level, const char* file, const char* line)
+    {
+        if (IsAccepted(level) == false)
+        {
+            return;
+        }
+
+        LockGuard lock(mMutex);
+        if (mIsEnabled.load() == false || isModuleAccepted(file) == false)
+        {
+            return;
+        }
+
+        if (line[0] == '\033')
+        {
+            const char* colorEnd = strchr(line, 'm');
+            line = colorEnd == nullptr ? line : colorEnd + 1;
+        }
+        const size_t length = strlen(line);
+
+        if (mBatch.size() + length + 1 > BATCH_SIZE)
+        {
+            publishBatch();
+        }
+
+        /**
+         * @note 전송 한도를 넘어 배치를 발행하지 못한 경우에는 오래된 배치를 버리고 최근 로그를 남깁니다.
+         */
+        if (mBatch.size() + length + 1 > BATCH_SIZE)
+        {
+            dropBatch();
+        }
+
+        if (mBatch.empty() == true)
+        {
+            mBatch.reserve(BATCH_SIZE);
+            mBatchMillis = millis();
+        }
+        mBatch.append(line, length);
+        mBatch.push_back('\n');
+        ++mBatchLines;
+    }
+
+    void MqttLog::Sync()
+    {
+        if (mIsEnabled.load(std::memory_order_relaxed) == false)
+        {
+            return;
+        }
+
+        LockGuard lock(mMutex);
+        if (mBatch.empty() == false && (millis() - mBatchMillis) >= BATCH_INTERVAL_MILLIS)
+        {
+            publishBatch();
+        }
+    }
+
+    bool MqttLog::isModuleAccepted(const char* file)
+    {
+        if (mModules.empty() == true || file == nullptr)
+        {
+            return true;
+        }
+
+        const char* name = strrchr(file, '/') == nullptr ? file : strrchr(file, '/') + 1;
+        const char* extension = strchr(name, '.');
+        const size_t length = extension == nullptr ? strlen(name) : static_cast<size_t>(extension - name);
+
+        for (const auto& module : mModules)
+        {
+            if (module.size() == length && strncmp(module.c_str(), name, length) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool MqttLog::tryConsume(const size_t bytes)
+    {
+        const uint32_t now = millis();
+        const uint64_t refilled = static_cast<uint64_t>(mTokens) +
+                                  static_cast<uint64_t>(now - mLastRefillMillis) * mBytesPerSecond / 1000;
+        mTokens = refilled > BURST_BYTES ? BURST_BYTES : static_cast<uint32_t>(refilled);
+        mLastRefillMillis = now;
+
+        if (mTokens < bytes)
+        {
+            return false;
+        }
+
+        mTokens -= bytes;
+        return true;
+    }
+
+    void MqttLog::publishBatch()
+    {
+        if (mBatch.empty() == true || tryConsume(mBatch.size()) == false)
+        {
+            return;
+        }
+
+        JsonDocument doc;
+        doc["ts"]   = GetTimestampInMillis();
+        doc["seq"]  = mSequence;
+        doc["drop"] = mPendingDropCount;
+        doc["log"]  = mBatch;
+
+        std::string payload;
+        serializeJson(doc, payload);
+        if (mqtt::cdo.PublishDiagnostic(mqtt::topic_e::LOG_STREAM, payload) != Status::Code::GOOD)
+        {
+            dropBatch();
+            return;
+        }
+
+        ++mSequence;
+        mPendingDropCount = 0;
+        mBatch.clear();
+        mBatchLines = 0;
+    }
+
+    void MqttLog::dropBatch()
+    {
+        mPendingDropCount += mBatchLines;
+        mDropCount.fetch_add(mBatchLines);
+        mBatch.clear();
+        mBatchLines = 0;
+    }
+
+
+    MqttLog mqttLog;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file MqttLog.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 로그 메시지를 MQTT 브로커의 진단 토픽으로 스트리밍하는 클래스를 선언합니다.
+ * @details 원격 명령으로 설정한 레벨과 모듈에 해당하는 로그만 배치 버퍼에 모은 다음, 일정
+ *          주기마다 하나의 메시지로 묶어 CDO의 진단 레인에 저장합니다. 초당 전송 바이트 수를
+ *          토큰 버킷으로 제한하며, 한도를 넘는 배치는 버리고 다음 배치에 유실된 줄 수를 알립니다.
+ *          모듈은 소스 파일의 확장자를 제외한 이름(예: "ModbusRTU")입니다.
+ *
+ * @note 설정은 RAM에만 보관하므로 재시작하면 스트리밍이 비활성화됩니다. Append()와 Sync()는
+ *       로그 태스크에서만 호출해야 합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <sys/_stdint.h>
+
+#include "Common/Sync/Mutex.hpp"
+#include "Logger.h"
+
+
+
+namespace muffin {
+
+    class MqttLog
+    {
+    public:
+        MqttLog();
+        virtual ~MqttLog() {}
+    public:
+        /**
+         * @param modules 스트리밍할 모듈의 목록으로, 비어 있으면 모든 모듈의 로그를 전송합니다.
+         * @param bytesPerSecond 초당 전송할 수 있는 최대 바이트 수로, 0이면 기본값을 사용합니다.
+         */
+        void SetFilter(const bool isEnabled, const log_level_e level, const std::vector<std::string>& modules, const uint16_t bytesPerSecond);
+        bool IsEnabled() const;
+        log_level_e GetLevel() const;
+        uint32_t GetDropCount() const;
+        /**
+         * @brief 로그를 기록하기 전에 호출하여 레벨만으로 스트리밍 대상인지를 판단합니다.
+         */
+        bool IsAccepted(const log_level_e level) const
+        {
+            return mIsEnabled.load(std::memory_order_relaxed) == true &&
+                   static_cast<uint8_t>(level) <= mLevel.load(std::memory_order_relaxed);
+        }
+    public:
+        void Append(const log_level_e level, const char* file, const char* line);
+        void Sync();
+    private:
+        bool isModuleAccepted(const char* file);
+        bool tryConsume(const size_t bytes);
+        void publishBatch();
+        void dropBatch();
+    private:
+        const size_t   BATCH_SIZE                = 1536;
+        const uint32_t BATCH_INTERVAL_MILLIS     = 10 * 1000;
+        const uint16_t DEFAULT_BYTES_PER_SECOND  = 256;
+        const uint32_t BURST_BYTES               = 4 * 1024;
+    private:
+        std::atomic<bool> mIsEnabled;
+        std::atomic<uint8_t> mLevel;
+        Mutex mMutex;
+        std::vector<std::string> mModules;
+        std::string mBatch;
+        uint32_t mBatchLines;
+        uint32_t mBatchMillis;
+        uint32_t mBytesPerSecond;
+        uint32_t mTokens;
+        uint32_t mLastRefillMillis;
+        uint32_t mSequence;
+        uint32_t mPendingDropCount;
+        std::atomic<uint32_t> mDropCount;
+    };
+
+
+    extern MqttLog mqttLog;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file HeapStats.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 서브시스템별 힙 메모리 사용량과 내부 RAM, PSRAM의 단편화 지표를 집계하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <esp_heap_caps.h>
+
+#include "HeapStats.h"
+
+
+
+namespace muffin {
+
+    HeapStats::HeapStats()
+    {
+        for (auto& tag : mTags)
+        {
+            tag.CurrentBytes.store(0, std::memory_order_relaxed);
+            tag.PeakBytes.store(0, std::memory_order_relaxed);
+            tag.Allocations.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void HeapStats::Allocate(const heap_tag_e tag, const uint32_t bytes)
+    {
+        heap_tag_t& heapTag = mTags[static_cast<uint8_t>(tag)];
+        heapTag.Allocations.fetch_add(1, std::memory_order_relaxed);
+        const uint32_t current = heapTag.CurrentBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+        uint32_t peak = heapTag.PeakBytes.load(std::memory_order_relaxed);
+        while (current > peak && heapTag.PeakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed) == false)
+        {
+        }
+    }
+
+    void HeapStats::Release(const heap_tag_e tag, const uint32_t bytes)
+    {
+        mTags[static_cast<uint8_t>(tag)].CurrentBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    uint32_t HeapStats::GetFreeBytes() const
+    {
+        return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    }
+
+    uint32_t HeapStats::GetConsumedBytes(const uint32_t freeBytes) const
+    {
+        const uint32_t currentFreeBytes = GetFreeBytes();
+        return freeBytes > currentFreeBytes ? freeBytes - currentFreeBytes : 0;
+    }
+
+    void HeapStats::Snapshot(JsonObject output)
+    {
+        JsonObject tags = output["tags"].to<JsonObject>();
+        for (uint8_t idx = 0; idx < TAG_COUNT; ++idx)
+        {
+            heap_tag_t& heapTag = mTags[idx];
+            const uint32_t current = heapTag.CurrentBytes.load(std::memory_order_relaxed);
+            const uint32_t peak = heapTag.PeakBytes.exchange(current, std::memory_order_relaxed);
+            const uint32_t allocations = heapTag.Allocations.exchange(0, std::memory_order_relaxed);
+            if (current == 0 && peak == 0 && allocations == 0)
+            {
+                continue;
+            }
+
+            JsonObject tag = tags[toString(static_cast<heap_tag_e>(idx))].to<JsonObject>();
+            tag["cur"]    = current;
+            tag["peak"]   = peak;
+            tag["allocs"] = allocations;
+        }
+
+        snapshotRegion(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, output["internal"].to<JsonObject>());
+        if (heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0)
+        {
+            snapshotRegion(MALLOC_CAP_SPIRAM, output["psram"].to<JsonObject>());
+        }
+    }
+
+    void HeapStats::snapshotRegion(const uint32_t caps, JsonObject output) const
+    {
+        multi_heap_info_t info;
+        heap_caps_get_info(&info, caps);
+
+        output["free"]    = info.total_free_bytes;
+        output["largest"] = info.largest_free_block;
+        output["minFree"] = info.minimum_free_bytes;
+
+        /**
+         * @note 단편화 지수는 여유 공간 중 가장 큰 연속 블록에 속하지 않는 비율을 백분율로
+         *       나타냅니다. 값이 클수록 여유 공간이 충분해도 큰 버퍼를 할당하지 못할 수 있습니다.
+         */
+        output["frag"] = info.total_free_bytes == 0 ? 0 : 100 - static_cast<uint32_t>(static_cast<uint64_t>(info.largest_free_block) * 100 / info.total_free_bytes);
+    }
+
+    const char* HeapStats::toString(const heap_tag_e tag) const
+    {
+        switch (tag)
+        {
+        case heap_tag_e::UNTAGGED:
+            return "untagged";
+        case heap_tag_e::JARVIS_CONFIG:
+            return "jarvisConfig";
+        case heap_tag_e::NODE_STORE:
+            return "nodeStore";
+        case heap_tag_e::CDO_MESSAGE:
+            return "cdoMessage";
+        case heap_tag_e::AAS_CONTAINER:
+            return "aasContainer";
+        case heap_tag_e::ETHERNET_IP:
+            return "ethernetIp";
+        case heap_tag_e::OTA_BUFFER:
+            return "otaBuffer";
+        default:
+            return "unknown";
+        }
+    }
+
+
+    HeapStats heapStats;
+}
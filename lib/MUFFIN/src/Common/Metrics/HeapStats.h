@@ -0,0 +1,84 @@
+/**
+ * @file HeapStats.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 서브시스템별 힙 메모리 사용량과 내부 RAM, PSRAM의 단편화 지표를 집계하는 클래스를 선언합니다.
+ * @details 서브시스템마다 태그를 부여하고 현재 사용량, 최대 사용량, 할당 횟수를 집계합니다.
+ *          PSRAM 컨테이너는 태그를 지정한 psram::Allocator가 할당과 해제를 직접 기록하며,
+ *          그 밖의 서브시스템은 설정을 적용하거나 버퍼를 만드는 지점에서 소비한 바이트 수를
+ *          기록합니다. 생성 과정 전체의 소비량은 GetFreeBytes()와 GetConsumedBytes()로
+ *          전후의 여유 힙 크기를 비교하여 구하므로, 같은 시점에 다른 태스크가 할당한 메모리가
+ *          포함될 수 있는 근사치입니다.
+ *
+ * @note 스냅샷은 할당 횟수를 0으로, 최대 사용량을 현재 사용량으로 초기화하므로 직전 스냅샷
+ *       이후 구간의 통계를 나타냅니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <ArduinoJson.h>
+#include <atomic>
+#include <sys/_stdint.h>
+
+
+
+namespace muffin {
+
+    typedef enum class HeapTagEnum
+        : uint8_t
+    {
+        UNTAGGED        = 0,
+        JARVIS_CONFIG   = 1,
+        NODE_STORE      = 2,
+        CDO_MESSAGE     = 3,
+        AAS_CONTAINER   = 4,
+        ETHERNET_IP     = 5,
+        OTA_BUFFER      = 6,
+        TOP             = 7
+    } heap_tag_e;
+
+    class HeapStats
+    {
+    public:
+        HeapStats();
+        virtual ~HeapStats() {}
+    public:
+        void Allocate(const heap_tag_e tag, const uint32_t bytes);
+        void Release(const heap_tag_e tag, const uint32_t bytes);
+    public:
+        /**
+         * @brief 내부 RAM과 PSRAM을 합한 바이트 단위 여유 힙 크기를 반환합니다.
+         */
+        uint32_t GetFreeBytes() const;
+        /**
+         * @param freeBytes 생성을 시작하기 전에 GetFreeBytes()로 읽은 여유 힙 크기
+         */
+        uint32_t GetConsumedBytes(const uint32_t freeBytes) const;
+        void Snapshot(JsonObject output);
+    private:
+        void snapshotRegion(const uint32_t caps, JsonObject output) const;
+        const char* toString(const heap_tag_e tag) const;
+    private:
+        static const uint8_t TAG_COUNT = static_cast<uint8_t>(heap_tag_e::TOP);
+    private:
+        typedef struct HeapTagType
+        {
+            std::atomic<uint32_t> CurrentBytes;
+            std::atomic<uint32_t> PeakBytes;
+            std::atomic<uint32_t> Allocations;
+        } heap_tag_t;
+    private:
+        heap_tag_t mTags[TAG_COUNT];
+    };
+
+
+    extern HeapStats heapStats;
+}
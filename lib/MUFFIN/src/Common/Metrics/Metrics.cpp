@@ -0,0 +1,260 @@
+/**
+ * @file Metrics.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 카운터, 게이지, 지연 시간 히스토그램을 보관하는 메트릭 레지스트리 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "Common/Time/TimeUtils.h"
+#include "HeapStats.h"
+#include "IM/Custom/MacAddress/MacAddress.h"
+#include "Metrics.h"
+#include "TaskStats.h"
+
+
+
+namespace muffin {
+
+    Histogram::Histogram()
+        : mSum(0)
+        , mMax(0)
+    {
+        for (auto& bucket : mBuckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void Histogram::Record(const uint32_t micros)
+    {
+        mBuckets[toBucket(micros)].fetch_add(1, std::memory_order_relaxed);
+        mSum.fetch_add(micros, std::memory_order_relaxed);
+
+        uint32_t max = mMax.load(std::memory_order_relaxed);
+        while (micros > max && mMax.compare_exchange_weak(max, micros, std::memory_order_relaxed) == false)
+        {
+        }
+    }
+
+    void Histogram::Snapshot(histogram_snapshot_t* snapshot)
+    {
+        uint32_t buckets[BUCKET_COUNT];
+        uint32_t count = 0;
+        for (uint8_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+        {
+            buckets[bucket] = mBuckets[bucket].exchange(0, std::memory_order_relaxed);
+            count += buckets[bucket];
+        }
+        const uint32_t sum = mSum.exchange(0, std::memory_order_relaxed);
+        const uint32_t max = mMax.exchange(0, std::memory_order_relaxed);
+
+        snapshot->Count = count;
+        snapshot->Mean  = count == 0 ? 0 : sum / count;
+        snapshot->Max   = max;
+
+        const uint8_t percentiles[3] = { 50, 95, 99 };
+        uint32_t* outputs[3] = { &snapshot->P50, &snapshot->P95, &snapshot->P99 };
+        for (uint8_t idx = 0; idx < 3; ++idx)
+        {
+            const uint32_t rank = (static_cast<uint64_t>(count) * percentiles[idx] + 99) / 100;
+            uint32_t cumulative = 0;
+            *outputs[idx] = 0;
+
+            for (uint8_t bucket = 0; bucket < BUCKET_COUNT && rank > 0; ++bucket)
+            {
+                cumulative += buckets[bucket];
+                if (cumulative >= rank)
+                {
+                    /**
+                     * @note 버킷의 상한을 보고하되, 기록된 최댓값보다 크게 보고하지 않습니다.
+                     *       범위를 벗어난 값을 모으는 마지막 버킷은 최댓값으로 보고합니다.
+                     */
+                    const uint32_t upperBound = bucket == (BUCKET_COUNT - 1) ? max : toUpperBound(bucket);
+                    *outputs[idx] = upperBound < max ? upperBound : max;
+                    break;
+                }
+            }
+        }
+    }
+
+    uint8_t Histogram::toBucket(const uint32_t micros) const
+    {
+        if (micros < SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint8_t>(micros);
+        }
+
+        const uint8_t exponent = 31 - __builtin_clz(micros);
+        if (exponent > MAX_EXPONENT)
+        {
+            return BUCKET_COUNT - 1;
+        }
+
+        const uint8_t subBucket = (micros >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+        return SUB_BUCKET_COUNT * (exponent - SUB_BUCKET_BITS + 1) + subBucket;
+    }
+
+    uint32_t Histogram::toUpperBound(const uint8_t bucket) const
+    {
+        if (bucket < SUB_BUCKET_COUNT)
+        {
+            return bucket;
+        }
+
+        const uint8_t exponent  = bucket / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+        const uint8_t subBucket = bucket % SUB_BUCKET_COUNT;
+        const uint32_t width = 1UL << (exponent - SUB_BUCKET_BITS);
+        return (SUB_BUCKET_COUNT + subBucket) * width + width - 1;
+    }
+
+    Metrics::Metrics()
+        : mSnapshotMillis(0)
+    {
+        for (auto& counter : mCounters)
+        {
+            counter.store(0, std::memory_order_relaxed);
+        }
+
+        for (uint8_t gauge = 0; gauge < GAUGE_COUNT; ++gauge)
+        {
+            mGauges[gauge].store(0, std::memory_order_relaxed);
+            mGaugePeaks[gauge].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void Metrics::Increment(const counter_e counter, const uint32_t delta)
+    {
+        mCounters[static_cast<uint8_t>(counter)].fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    void Metrics::SetGauge(const gauge_e gauge, const int32_t value)
+    {
+        const uint8_t index = static_cast<uint8_t>(gauge);
+        mGauges[index].store(value, std::memory_order_relaxed);
+
+        int32_t peak = mGaugePeaks[index].load(std::memory_order_relaxed);
+        while (value > peak && mGaugePeaks[index].compare_exchange_weak(peak, value, std::memory_order_relaxed) == false)
+        {
+        }
+    }
+
+    void Metrics::Record(const histogram_e histogram, const uint32_t micros)
+    {
+        mHistograms[static_cast<uint8_t>(histogram)].Record(micros);
+    }
+
+    std::string Metrics::ToStringSnapshot()
+    {
+        const uint32_t nowMillis = millis();
+
+        JsonDocument doc;
+        doc["mac"] = macAddress.GetEthernet();
+        doc["ts"]  = GetTimestampInMillis();
+        doc["itv"] = nowMillis - mSnapshotMillis;
+        mSnapshotMillis = nowMillis;
+
+        JsonObject counters = doc["counters"].to<JsonObject>();
+        for (uint8_t idx = 0; idx < COUNTER_COUNT; ++idx)
+        {
+            counters[toString(static_cast<counter_e>(idx))] = mCounters[idx].exchange(0, std::memory_order_relaxed);
+        }
+
+        JsonObject gauges = doc["gauges"].to<JsonObject>();
+        for (uint8_t idx = 0; idx < GAUGE_COUNT; ++idx)
+        {
+            const int32_t value = mGauges[idx].load(std::memory_order_relaxed);
+            JsonObject gauge = gauges[toString(static_cast<gauge_e>(idx))].to<JsonObject>();
+            gauge["cur"]  = value;
+            gauge["peak"] = mGaugePeaks[idx].exchange(value, std::memory_order_relaxed);
+        }
+
+        JsonObject histograms = doc["histograms"].to<JsonObject>();
+        for (uint8_t idx = 0; idx < HISTOGRAM_COUNT; ++idx)
+        {
+            histogram_snapshot_t snapshot;
+            mHistograms[idx].Snapshot(&snapshot);
+            if (snapshot.Count == 0)
+            {
+                continue;
+            }
+
+            JsonObject histogram = histograms[toString(static_cast<histogram_e>(idx))].to<JsonObject>();
+            histogram["n"]    = snapshot.Count;
+            histogram["mean"] = snapshot.Mean;
+            histogram["p50"]  = snapshot.P50;
+            histogram["p95"]  = snapshot.P95;
+            histogram["p99"]  = snapshot.P99;
+            histogram["max"]  = snapshot.Max;
+        }
+
+        taskStats.Snapshot(doc["tasks"].to<JsonObject>());
+        heapStats.Snapshot(doc["heap"].to<JsonObject>());
+
+        std::string payload;
+        serializeJson(doc, payload);
+        return payload;
+    }
+
+    const char* Metrics::toString(const counter_e counter) const
+    {
+        switch (counter)
+        {
+        case counter_e::MODBUS_POLL_FAILURE:
+            return "modbusPollFailure";
+        case counter_e::MQTT_PUBLISH_SUCCESS:
+            return "mqttPublishSuccess";
+        case counter_e::MQTT_PUBLISH_FAILURE:
+            return "mqttPublishFailure";
+        default:
+            return "unknown";
+        }
+    }
+
+    const char* Metrics::toString(const gauge_e gauge) const
+    {
+        switch (gauge)
+        {
+        case gauge_e::CDO_PRIORITY_DEPTH:
+            return "cdoPriorityDepth";
+        case gauge_e::CDO_BULK_DEPTH:
+            return "cdoBulkDepth";
+        default:
+            return "unknown";
+        }
+    }
+
+    const char* Metrics::toString(const histogram_e histogram) const
+    {
+        switch (histogram)
+        {
+        case histogram_e::MODBUS_RTU_POLL_CYCLE:
+            return "modbusRtuPollCycle";
+        case histogram_e::MODBUS_TCP_POLL_CYCLE:
+            return "modbusTcpPollCycle";
+        case histogram_e::MELSEC_POLL_CYCLE:
+            return "melsecPollCycle";
+        case histogram_e::ETHERNET_IP_POLL_CYCLE:
+            return "ethernetIpPollCycle";
+        case histogram_e::MQTT_PUBLISH:
+            return "mqttPublish";
+        case histogram_e::AAS_REQUEST:
+            return "aasRequest";
+        default:
+            return "unknown";
+        }
+    }
+
+
+    Metrics metrics;
+}
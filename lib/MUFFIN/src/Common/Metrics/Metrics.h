@@ -0,0 +1,129 @@
+/**
+ * @file Metrics.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 카운터, 게이지, 지연 시간 히스토그램을 보관하는 메트릭 레지스트리 클래스를 선언합니다.
+ * @details 모든 메트릭은 열거형으로 미리 정의한 고정 슬롯에 저장하며, 기록할 때 잠금이나
+ *          동적 메모리 할당 없이 원자적 연산만 사용하므로 수집 태스크의 주기 안에서 호출해도
+ *          됩니다. 히스토그램은 마이크로초 값을 2의 거듭제곱 구간마다 4개의 선형 구간으로
+ *          나누는 로그-선형 버킷에 집계하며, 백분위수의 상대 오차는 25% 이내입니다.
+ *
+ * @note 스냅샷은 값을 읽으면서 0으로 초기화하므로 직전 스냅샷 이후 구간의 통계를 나타냅니다.
+ *       스냅샷 도중에 기록된 값은 다음 구간에 포함될 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <sys/_stdint.h>
+
+
+
+namespace muffin {
+
+    typedef enum class MetricsCounterEnum
+        : uint8_t
+    {
+        MODBUS_POLL_FAILURE     = 0,
+        MQTT_PUBLISH_SUCCESS    = 1,
+        MQTT_PUBLISH_FAILURE    = 2,
+        TOP                     = 3
+    } counter_e;
+
+    typedef enum class MetricsGaugeEnum
+        : uint8_t
+    {
+        CDO_PRIORITY_DEPTH  = 0,
+        CDO_BULK_DEPTH      = 1,
+        TOP                 = 2
+    } gauge_e;
+
+    typedef enum class MetricsHistogramEnum
+        : uint8_t
+    {
+        MODBUS_RTU_POLL_CYCLE   = 0,
+        MODBUS_TCP_POLL_CYCLE   = 1,
+        MELSEC_POLL_CYCLE       = 2,
+        ETHERNET_IP_POLL_CYCLE  = 3,
+        MQTT_PUBLISH            = 4,
+        AAS_REQUEST             = 5,
+        TOP                     = 6
+    } histogram_e;
+
+    typedef struct HistogramSnapshotType
+    {
+        uint32_t Count;
+        uint32_t Mean;
+        uint32_t P50;
+        uint32_t P95;
+        uint32_t P99;
+        uint32_t Max;
+    } histogram_snapshot_t;
+
+    class Histogram
+    {
+    public:
+        Histogram();
+        virtual ~Histogram() {}
+    public:
+        void Record(const uint32_t micros);
+        void Snapshot(histogram_snapshot_t* snapshot);
+    private:
+        uint8_t toBucket(const uint32_t micros) const;
+        uint32_t toUpperBound(const uint8_t bucket) const;
+    private:
+        static const uint8_t SUB_BUCKET_BITS  = 2;
+        static const uint8_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+        static const uint8_t MAX_EXPONENT     = 26;
+        static const uint8_t BUCKET_COUNT     = SUB_BUCKET_COUNT * (MAX_EXPONENT - SUB_BUCKET_BITS + 2);
+    private:
+        std::atomic<uint32_t> mBuckets[BUCKET_COUNT];
+        std::atomic<uint32_t> mSum;
+        std::atomic<uint32_t> mMax;
+    };
+
+    class Metrics
+    {
+    public:
+        Metrics();
+        virtual ~Metrics() {}
+    public:
+        void Increment(const counter_e counter, const uint32_t delta = 1);
+        /**
+         * @brief 게이지의 현재 값을 설정하며, 직전 스냅샷 이후의 최댓값도 함께 갱신합니다.
+         */
+        void SetGauge(const gauge_e gauge, const int32_t value);
+        void Record(const histogram_e histogram, const uint32_t micros);
+    public:
+        /**
+         * @brief 모든 메트릭과 태스크, 힙 통계의 스냅샷을 JSON 문자열로 반환하고 누적 값을 초기화합니다.
+         */
+        std::string ToStringSnapshot();
+    private:
+        const char* toString(const counter_e counter) const;
+        const char* toString(const gauge_e gauge) const;
+        const char* toString(const histogram_e histogram) const;
+    private:
+        static const uint8_t COUNTER_COUNT   = static_cast<uint8_t>(counter_e::TOP);
+        static const uint8_t GAUGE_COUNT     = static_cast<uint8_t>(gauge_e::TOP);
+        static const uint8_t HISTOGRAM_COUNT = static_cast<uint8_t>(histogram_e::TOP);
+    private:
+        std::atomic<uint32_t> mCounters[COUNTER_COUNT];
+        std::atomic<int32_t> mGauges[GAUGE_COUNT];
+        std::atomic<int32_t> mGaugePeaks[GAUGE_COUNT];
+        Histogram mHistograms[HISTOGRAM_COUNT];
+        uint32_t mSnapshotMillis;
+    };
+
+
+    extern Metrics metrics;
+}
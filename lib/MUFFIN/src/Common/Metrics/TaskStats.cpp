@@ -0,0 +1,251 @@
+/**
+ * @file TaskStats.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 태스크별 CPU 점유율과 주기 태스크의 스케줄링 지연을 집계하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+#include <esp_freertos_hooks.h>
+#include <string.h>
+
+#include "Common/Trace/Tracer.h"
+#include "TaskStats.h"
+
+
+
+namespace muffin {
+
+    static void IRAM_ATTR sampleCore0()
+    {
+        taskStats.Sample(0);
+    }
+
+#if !defined(CONFIG_FREERTOS_UNICORE)
+    static void IRAM_ATTR sampleCore1()
+    {
+        taskStats.Sample(1);
+    }
+#endif
+
+    TaskStats::TaskStats()
+        : mIsInitialized(false)
+        , mSampleCount(0)
+        , mOverflowSamples(0)
+    {
+        portMUX_INITIALIZE(&mSampleLock);
+        memset(mSamples, 0, sizeof(mSamples));
+        for (uint8_t core = 0; core < CORE_COUNT; ++core)
+        {
+            mTicks[core] = 0;
+            mLastHandles[core] = NULL;
+        }
+
+        for (auto& periodicTask : mPeriodicTasks)
+        {
+            periodicTask.Activations.store(0, std::memory_order_relaxed);
+            periodicTask.DeadlineMisses.store(0, std::memory_order_relaxed);
+            periodicTask.LatenessSum.store(0, std::memory_order_relaxed);
+            periodicTask.LatenessMax.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    Status TaskStats::Init()
+    {
+        if (mIsInitialized == true)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        if (esp_register_freertos_tick_hook_for_cpu(sampleCore0, 0) != ESP_OK)
+        {
+            return Status(Status::Code::BAD_OUT_OF_MEMORY);
+        }
+
+    #if !defined(CONFIG_FREERTOS_UNICORE)
+        if (esp_register_freertos_tick_hook_for_cpu(sampleCore1, 1) != ESP_OK)
+        {
+            esp_deregister_freertos_tick_hook_for_cpu(sampleCore0, 0);
+            return Status(Status::Code::BAD_OUT_OF_MEMORY);
+        }
+    #endif
+
+        mIsInitialized = true;
+        return Status(Status::Code::GOOD);
+    }
+
+    void TaskStats::RecordActivation(const task_name_e task, const uint32_t latenessMicros)
+    {
+        periodic_task_t& periodicTask = mPeriodicTasks[static_cast<uint8_t>(task)];
+        periodicTask.Activations.fetch_add(1, std::memory_order_relaxed);
+        periodicTask.LatenessSum.fetch_add(latenessMicros, std::memory_order_relaxed);
+
+        uint32_t max = periodicTask.LatenessMax.load(std::memory_order_relaxed);
+        while (latenessMicros > max && periodicTask.LatenessMax.compare_exchange_weak(max, latenessMicros, std::memory_order_relaxed) == false)
+        {
+        }
+    }
+
+    void TaskStats::RecordDeadlineMiss(const task_name_e task)
+    {
+        mPeriodicTasks[static_cast<uint8_t>(task)].DeadlineMisses.fetch_add(1, std::memory_order_relaxed);
+        tracer.Fault(trace_event_e::DEADLINE_MISS);
+    }
+
+    void TaskStats::Delay(const task_name_e task, const uint32_t delayMillis)
+    {
+        const uint32_t startMicros = micros();
+        vTaskDelay(delayMillis / portTICK_PERIOD_MS);
+        const uint32_t elapsedMicros = micros() - startMicros;
+        const uint32_t delayMicros = delayMillis * 1000;
+
+        /**
+         * @note 틱 주기보다 짧은 오차는 vTaskDelay()의 해상도에 의한 것이므로 지연으로 보지 않습니다.
+         */
+        const uint32_t tickMicros = portTICK_PERIOD_MS * 1000;
+        const uint32_t latenessMicros = elapsedMicros > (delayMicros + tickMicros) ? elapsedMicros - delayMicros - tickMicros : 0;
+        RecordActivation(task, latenessMicros);
+    }
+
+    void IRAM_ATTR TaskStats::Sample(const uint8_t coreID)
+    {
+        /**
+         * @note 틱 인터럽트에서 호출되므로 IRAM에 배치된 FreeRTOS 함수만 사용하며, 두 코어의
+         *       틱 훅이 표본 테이블을 동시에 갱신하지 않도록 스핀락으로 보호합니다.
+         */
+        TaskHandle_t handle = xTaskGetCurrentTaskHandleForCPU(coreID);
+
+        portENTER_CRITICAL_ISR(&mSampleLock);
+        ++mTicks[coreID];
+
+        uint8_t idx = 0;
+        while (idx < mSampleCount && mSamples[idx].Handle != handle)
+        {
+            ++idx;
+        }
+
+        if (idx == mSampleCount)
+        {
+            if (mSampleCount == MAX_ENTRIES)
+            {
+                ++mOverflowSamples;
+                mLastHandles[coreID] = handle;
+                portEXIT_CRITICAL_ISR(&mSampleLock);
+                return;
+            }
+
+            const char* name = pcTaskGetName(handle);
+            uint8_t length = 0;
+            while (length < (configMAX_TASK_NAME_LEN - 1) && name[length] != '\0')
+            {
+                mSamples[idx].Name[length] = name[length];
+                ++length;
+            }
+            mSamples[idx].Name[length] = '\0';
+            mSamples[idx].Handle = handle;
+            ++mSampleCount;
+        }
+
+        ++mSamples[idx].Samples[coreID];
+        if (mLastHandles[coreID] != handle)
+        {
+            ++mSamples[idx].Switches;
+            mLastHandles[coreID] = handle;
+        }
+        portEXIT_CRITICAL_ISR(&mSampleLock);
+    }
+
+    void TaskStats::Snapshot(JsonObject output)
+    {
+        task_sample_t samples[MAX_ENTRIES];
+        uint32_t ticks[CORE_COUNT];
+
+        /**
+         * @note 임계 구역을 짧게 유지하기 위해 표본 테이블을 복사하고 초기화한 다음 서식화합니다.
+         *       테이블에서 사라진 태스크가 삭제된 태스크의 핸들을 재사용하지 않도록 매번 비웁니다.
+         */
+        portENTER_CRITICAL(&mSampleLock);
+        const uint8_t sampleCount = mSampleCount;
+        const uint32_t overflowSamples = mOverflowSamples;
+        memcpy(samples, mSamples, sizeof(task_sample_t) * sampleCount);
+        memcpy(ticks, mTicks, sizeof(ticks));
+        memset(mSamples, 0, sizeof(mSamples));
+        memset(mTicks, 0, sizeof(mTicks));
+        mSampleCount = 0;
+        mOverflowSamples = 0;
+        portEXIT_CRITICAL(&mSampleLock);
+
+        JsonArray cpu = output["cpu"].to<JsonArray>();
+        for (uint8_t idx = 0; idx < sampleCount; ++idx)
+        {
+            JsonObject task = cpu.add<JsonObject>();
+            task["name"] = samples[idx].Name;
+            for (uint8_t core = 0; core < CORE_COUNT; ++core)
+            {
+                if (samples[idx].Samples[core] == 0 || ticks[core] == 0)
+                {
+                    continue;
+                }
+
+                // 코어별 점유율을 0.1% 단위로 보고합니다.
+                const char* key = core == 0 ? "core0" : "core1";
+                task[key] = static_cast<uint32_t>(static_cast<uint64_t>(samples[idx].Samples[core]) * 1000 / ticks[core]) / 10.0f;
+            }
+            task["sw"] = samples[idx].Switches;
+        }
+        output["overflow"] = overflowSamples;
+
+        JsonArray periodic = output["periodic"].to<JsonArray>();
+        for (uint8_t idx = 0; idx < TASK_COUNT; ++idx)
+        {
+            periodic_task_t& periodicTask = mPeriodicTasks[idx];
+            const uint32_t activations = periodicTask.Activations.exchange(0, std::memory_order_relaxed);
+            const uint32_t deadlineMisses = periodicTask.DeadlineMisses.exchange(0, std::memory_order_relaxed);
+            const uint32_t latenessSum = periodicTask.LatenessSum.exchange(0, std::memory_order_relaxed);
+            const uint32_t latenessMax = periodicTask.LatenessMax.exchange(0, std::memory_order_relaxed);
+            if (activations == 0 && deadlineMisses == 0)
+            {
+                continue;
+            }
+
+            JsonObject task = periodic.add<JsonObject>();
+            task["name"]     = toString(static_cast<task_name_e>(idx));
+            task["act"]      = activations;
+            task["miss"]     = deadlineMisses;
+            task["lateMean"] = activations == 0 ? 0 : latenessSum / activations;
+            task["lateMax"]  = latenessMax;
+        }
+    }
+
+    const char* TaskStats::toString(const task_name_e task) const
+    {
+        switch (task)
+        {
+        case task_name_e::MQTT_TASK:
+            return "MqttTask";
+        case task_name_e::PUBLISH_MSG_TASK:
+            return "PublishMSGTask";
+        case task_name_e::MODBUS_RTU_TASK:
+            return "ModbusRtuTask";
+        case task_name_e::MODBUS_TCP_TASK:
+            return "ModbusTcpTask";
+        case task_name_e::MELSEC_TASK:
+            return "MelsecTask";
+        case task_name_e::ETHERNET_IP_TASK:
+            return "EthernetIpTask";
+        default:
+            return "UnknownTask";
+        }
+    }
+
+
+    TaskStats taskStats;
+}
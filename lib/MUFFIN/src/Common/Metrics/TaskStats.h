@@ -0,0 +1,99 @@
+/**
+ * @file TaskStats.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 태스크별 CPU 점유율과 주기 태스크의 스케줄링 지연을 집계하는 클래스를 선언합니다.
+ * @details CPU 점유율은 코어마다 등록한 FreeRTOS 틱 훅에서 실행 중인 태스크를 표본 추출하여
+ *          계산합니다. 배포된 Arduino 프레임워크는 런타임 통계와 트레이스 훅이 비활성화된 채로
+ *          빌드되어 있으므로, 문맥 전환 횟수도 직전 틱과 다른 태스크가 실행 중이었던 횟수로
+ *          집계하며 실제 전환 횟수의 하한입니다. 주기 태스크는 깨어나야 할 시각 대비 지연
+ *          시간과 주기 안에 처리를 마치지 못한 횟수를 집계합니다.
+ *
+ * @note 스냅샷은 값을 읽으면서 초기화하므로 직전 스냅샷 이후 구간의 통계를 나타냅니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <ArduinoJson.h>
+#include <atomic>
+#include <esp_attr.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <sys/_stdint.h>
+
+#include "Common/Status.h"
+#include "IM/Custom/Constants.h"
+
+
+
+namespace muffin {
+
+    class TaskStats
+    {
+    public:
+        TaskStats();
+        virtual ~TaskStats() {}
+    public:
+        /**
+         * @brief 코어마다 틱 훅을 등록하여 CPU 점유율 표본 추출을 시작합니다.
+         */
+        Status Init();
+        /**
+         * @param latenessMicros 태스크가 깨어나야 할 시각보다 늦게 실행된 시간
+         */
+        void RecordActivation(const task_name_e task, const uint32_t latenessMicros);
+        /**
+         * @brief 태스크가 주기 안에 처리를 마치지 못했거나 발행 주기를 건너뛴 경우에 호출합니다.
+         */
+        void RecordDeadlineMiss(const task_name_e task);
+        /**
+         * @brief vTaskDelay()로 대기한 다음, 요청한 시간보다 늦게 깨어난 시간을 기록합니다.
+         */
+        void Delay(const task_name_e task, const uint32_t delayMillis);
+        void Snapshot(JsonObject output);
+    public:
+        void IRAM_ATTR Sample(const uint8_t coreID);
+    private:
+        const char* toString(const task_name_e task) const;
+    private:
+        static const uint8_t CORE_COUNT  = portNUM_PROCESSORS;
+        static const uint8_t MAX_ENTRIES = 24;
+        static const uint8_t TASK_COUNT  = static_cast<uint8_t>(task_name_e::ETHERNET_IP_TASK) + 1;
+    private:
+        typedef struct TaskSampleType
+        {
+            TaskHandle_t Handle;
+            char Name[configMAX_TASK_NAME_LEN];
+            uint32_t Samples[CORE_COUNT];
+            uint32_t Switches;
+        } task_sample_t;
+
+        typedef struct PeriodicTaskType
+        {
+            std::atomic<uint32_t> Activations;
+            std::atomic<uint32_t> DeadlineMisses;
+            std::atomic<uint32_t> LatenessSum;
+            std::atomic<uint32_t> LatenessMax;
+        } periodic_task_t;
+    private:
+        bool mIsInitialized;
+        portMUX_TYPE mSampleLock;
+        task_sample_t mSamples[MAX_ENTRIES];
+        uint8_t mSampleCount;
+        uint32_t mOverflowSamples;
+        uint32_t mTicks[CORE_COUNT];
+        TaskHandle_t mLastHandles[CORE_COUNT];
+        periodic_task_t mPeriodicTasks[TASK_COUNT];
+    };
+
+
+    extern TaskStats taskStats;
+}
@@ -27,6 +27,8 @@
 #include <vector>
 #include <esp_heap_caps.h>
 
+#include "Common/Metrics/HeapStats.h"
+
 
 
 namespace muffin { namespace psram {
@@ -55,13 +57,21 @@ namespace muffin { namespace psram {
         }
     };
 
-    template <class T>
+    /**
+     * @tparam Tag 할당량을 집계할 서브시스템의 태그
+     */
+    template <class T, heap_tag_e Tag = heap_tag_e::UNTAGGED>
     struct Allocator
     {
         typedef T value_type;
 
+        template <class U> struct rebind
+        {
+            typedef Allocator<U, Tag> other;
+        };
+
         Allocator() = default;
-        template <class U> constexpr Allocator(const Allocator<U>&) noexcept {}
+        template <class U> constexpr Allocator(const Allocator<U, Tag>&) noexcept {}
 
         T* allocate(std::size_t n)
         {
@@ -76,21 +86,23 @@ namespace muffin { namespace psram {
                 return nullptr;
             }
 
+            heapStats.Allocate(Tag, n * sizeof(T));
             return static_cast<T*>(p);
         }
 
-        void deallocate(T* p, std::size_t /*n*/) noexcept
+        void deallocate(T* p, std::size_t n) noexcept
         {
+            heapStats.Release(Tag, n * sizeof(T));
             psram::deallocate(p);
         }
     };
 
-    template <class T, class U> bool operator==(const Allocator<T>&, const Allocator<U>&)
+    template <class T, class U, heap_tag_e Tag> bool operator==(const Allocator<T, Tag>&, const Allocator<U, Tag>&)
     {
         return true;
     }
 
-    template <class T, class U> bool operator!=(const Allocator<T>&, const Allocator<U>&)
+    template <class T, class U, heap_tag_e Tag> bool operator!=(const Allocator<T, Tag>&, const Allocator<U, Tag>&)
     {
         return false;
     }
@@ -102,11 +114,11 @@ namespace muffin { namespace psram {
     template<typename T>
     using unique_ptr = std::unique_ptr<T, std::default_delete<T>>;
 
-    template<typename T>
-    using vector = std::vector<T, Allocator<T>>;
+    template<typename T, heap_tag_e Tag = heap_tag_e::UNTAGGED>
+    using vector = std::vector<T, Allocator<T, Tag>>;
 
-    template<typename Key, typename T, typename Compare = std::less<Key>> 
-    using map = std::map<Key, T, Compare, Allocator<std::pair<const Key, T>>>;
+    template<typename Key, typename T, typename Compare = std::less<Key>, heap_tag_e Tag = heap_tag_e::UNTAGGED> 
+    using map = std::map<Key, T, Compare, Allocator<std::pair<const Key, T>, Tag>>;
 
     
     // --- Helper function for creation ---
@@ -13,6 +13,8 @@
 
 
 
+#include <assert.h>
+
 #include "Status.h"
 
 
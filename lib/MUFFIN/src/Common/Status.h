@@ -281,6 +281,7 @@ namespace muffin {
 
     public:
         explicit Status(Code code) : mCode(code) {}
+        Status(const Status& obj) : mCode(obj.ToCode()) {}
         virtual ~Status() {}
         Status& operator=(const Status& obj)
         {
@@ -296,10 +297,10 @@ namespace muffin {
             mCode = obj;
             return *this;
         }
-        bool operator==(const Status& obj) { return mCode == obj.ToCode(); }
-        bool operator!=(const Status& obj) { return mCode != obj.ToCode(); }
-        bool operator==(const Code& obj)   { return mCode == obj; }
-        bool operator!=(const Code& obj)   { return mCode != obj; }
+        bool operator==(const Status& obj) const { return mCode == obj.ToCode(); }
+        bool operator!=(const Status& obj) const { return mCode != obj.ToCode(); }
+        bool operator==(const Code& obj) const   { return mCode == obj; }
+        bool operator!=(const Code& obj) const   { return mCode != obj; }
     public:
         const char* c_str() const;
         std::string ToString() const;
@@ -13,6 +13,8 @@
 
 
 
+#include <Arduino.h>
+
 #include "Common/Logger/Logger.h"
 #include "ScopedTimer.h"
 
@@ -37,4 +39,15 @@ namespace muffin {
             GetTimestampInMillis() - mStartMillis
         );
     }
+
+    ScopedLatencyTimer::ScopedLatencyTimer(const histogram_e histogram)
+        : mHistogram(histogram)
+        , mStartMicros(micros())
+    {
+    }
+
+    ScopedLatencyTimer::~ScopedLatencyTimer()
+    {
+        metrics.Record(mHistogram, micros() - mStartMicros);
+    }
 }
\ No newline at end of file
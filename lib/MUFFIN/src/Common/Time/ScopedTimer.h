@@ -17,6 +17,7 @@
 
 #include <string>
 
+#include "Common/Metrics/Metrics.h"
 #include "TimeUtils.h"
 
 
@@ -33,4 +34,17 @@ namespace muffin {
         const std::string mFunctionName;
         const uint64_t mStartMillis;
     };
+
+    /**
+     * @brief 수명 범위 동안의 경과 시간을 마이크로초 단위로 메트릭 히스토그램에 기록합니다.
+     */
+    class ScopedLatencyTimer
+    {
+    public:
+        explicit ScopedLatencyTimer(const histogram_e histogram);
+        virtual ~ScopedLatencyTimer();
+    private:
+        const histogram_e mHistogram;
+        const uint32_t mStartMicros;
+    };
 }
\ No newline at end of file
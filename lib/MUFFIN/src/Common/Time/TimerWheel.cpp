@@ -0,0 +1,229 @@
+/**
+ * @file TimerWheel.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 밀리초 단위의 계층형 타이머 휠 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <string.h>
+
+#include "Common/Assert.hpp"
+#include "TimerWheel.h"
+
+
+
+namespace muffin {
+
+    TimerWheel::TimerWheel()
+    {
+        Init(0);
+    }
+
+    void TimerWheel::Init(const uint64_t nowMillis)
+    {
+        mCurrentTick = nowMillis;
+        memset(mEntries, 0, sizeof(mEntries));
+        memset(mSlotHeads, INVALID_TIMER, sizeof(mSlotHeads));
+        memset(mOccupancy, 0, sizeof(mOccupancy));
+    }
+
+    bool TimerWheel::Schedule(const uint8_t timerID, const uint64_t expiryMillis)
+    {
+        if (timerID >= MAX_TIMER_COUNT)
+        {
+            ASSERT(false, "TIMER ID OUT OF RANGE: %u", timerID);
+            return false;
+        }
+
+        Cancel(timerID);
+        mEntries[timerID].Expiry = expiryMillis;
+        link(timerID);
+        return true;
+    }
+
+    void TimerWheel::Cancel(const uint8_t timerID)
+    {
+        if (timerID >= MAX_TIMER_COUNT || mEntries[timerID].IsScheduled == false)
+        {
+            return;
+        }
+
+        unlink(timerID);
+    }
+
+    bool TimerWheel::IsScheduled(const uint8_t timerID) const
+    {
+        return timerID < MAX_TIMER_COUNT && mEntries[timerID].IsScheduled;
+    }
+
+    uint64_t TimerWheel::RetrieveNextEventMillis() const
+    {
+        uint64_t nextTick = UINT64_MAX;
+
+        for (uint8_t level = 0; level < LEVEL_COUNT; ++level)
+        {
+            const uint64_t occupancy = mOccupancy[level];
+            if (occupancy == 0)
+            {
+                continue;
+            }
+
+            /**
+             * @note 레벨 L의 슬롯은 64^L 경계에서만 처리되므로 현재 틱 이후 첫 번째 경계부터
+             *       점유된 슬롯을 찾습니다.
+             */
+            const uint8_t shift = level * SLOT_BITS;
+            const uint64_t firstBlock = (mCurrentTick + ((static_cast<uint64_t>(1) << shift) - 1)) >> shift;
+            const uint8_t firstSlot = static_cast<uint8_t>(firstBlock & SLOT_MASK);
+            const uint64_t rotated = firstSlot == 0 ? occupancy : ((occupancy >> firstSlot) | (occupancy << (SLOT_COUNT - firstSlot)));
+            const uint64_t tick = (firstBlock + __builtin_ctzll(rotated)) << shift;
+
+            if (tick < nextTick)
+            {
+                nextTick = tick;
+            }
+        }
+
+        return nextTick;
+    }
+
+    void TimerWheel::Advance(const uint64_t nowMillis, std::vector<uint8_t>* expiredTimers)
+    {
+        ASSERT((expiredTimers != nullptr), "OUTPUT PARAMETER <std::vector<uint8_t>* expiredTimers> CANNOT BE A NULL POINTER");
+
+        while (true)
+        {
+            const uint64_t tick = RetrieveNextEventMillis();
+            if (tick == UINT64_MAX || tick > nowMillis)
+            {
+                break;
+            }
+
+            mCurrentTick = tick;
+            process(tick, expiredTimers);
+            mCurrentTick = tick + 1;
+        }
+
+        if (mCurrentTick <= nowMillis)
+        {
+            mCurrentTick = nowMillis + 1;
+        }
+    }
+
+    void TimerWheel::link(const uint8_t timerID)
+    {
+        entry_t& entry = mEntries[timerID];
+        const uint64_t expiry = entry.Expiry > mCurrentTick ? entry.Expiry : mCurrentTick;
+        const uint64_t delta  = expiry - mCurrentTick;
+
+        uint8_t level = 0;
+        while (level < LEVEL_COUNT - 1 && delta >= (static_cast<uint64_t>(1) << ((level + 1) * SLOT_BITS)))
+        {
+            ++level;
+        }
+
+        /**
+         * @note 최상위 레벨의 범위를 넘는 타이머는 마지막 슬롯에 두었다가 캐스케이드 시점에
+         *       남은 시간을 기준으로 다시 배치합니다.
+         */
+        const uint8_t shift = level * SLOT_BITS;
+        const uint64_t maxDelta = (static_cast<uint64_t>(1) << (LEVEL_COUNT * SLOT_BITS)) - 1;
+        const uint64_t placement = delta > maxDelta ? mCurrentTick + maxDelta : expiry;
+        const uint8_t slot = static_cast<uint8_t>((placement >> shift) & SLOT_MASK);
+
+        entry.Level       = level;
+        entry.Slot        = slot;
+        entry.Previous    = INVALID_TIMER;
+        entry.Next        = mSlotHeads[level][slot];
+        entry.IsScheduled = true;
+
+        if (entry.Next != INVALID_TIMER)
+        {
+            mEntries[entry.Next].Previous = timerID;
+        }
+        mSlotHeads[level][slot] = timerID;
+        mOccupancy[level] |= (static_cast<uint64_t>(1) << slot);
+    }
+
+    void TimerWheel::unlink(const uint8_t timerID)
+    {
+        entry_t& entry = mEntries[timerID];
+
+        if (entry.Previous != INVALID_TIMER)
+        {
+            mEntries[entry.Previous].Next = entry.Next;
+        }
+        else
+        {
+            mSlotHeads[entry.Level][entry.Slot] = entry.Next;
+        }
+
+        if (entry.Next != INVALID_TIMER)
+        {
+            mEntries[entry.Next].Previous = entry.Previous;
+        }
+
+        if (mSlotHeads[entry.Level][entry.Slot] == INVALID_TIMER)
+        {
+            mOccupancy[entry.Level] &= ~(static_cast<uint64_t>(1) << entry.Slot);
+        }
+
+        entry.IsScheduled = false;
+    }
+
+    void TimerWheel::cascade(const uint8_t level, const uint8_t slot)
+    {
+        uint8_t timerID = mSlotHeads[level][slot];
+        mSlotHeads[level][slot] = INVALID_TIMER;
+        mOccupancy[level] &= ~(static_cast<uint64_t>(1) << slot);
+
+        while (timerID != INVALID_TIMER)
+        {
+            const uint8_t next = mEntries[timerID].Next;
+            link(timerID);
+            timerID = next;
+        }
+    }
+
+    void TimerWheel::process(const uint64_t tick, std::vector<uint8_t>* expiredTimers)
+    {
+        for (uint8_t level = LEVEL_COUNT - 1; level > 0; --level)
+        {
+            const uint8_t shift = level * SLOT_BITS;
+            if ((tick & ((static_cast<uint64_t>(1) << shift) - 1)) == 0)
+            {
+                cascade(level, static_cast<uint8_t>((tick >> shift) & SLOT_MASK));
+            }
+        }
+
+        const uint8_t slot = static_cast<uint8_t>(tick & SLOT_MASK);
+        uint8_t timerID = mSlotHeads[0][slot];
+        mSlotHeads[0][slot] = INVALID_TIMER;
+        mOccupancy[0] &= ~(static_cast<uint64_t>(1) << slot);
+
+        while (timerID != INVALID_TIMER)
+        {
+            entry_t& entry = mEntries[timerID];
+            const uint8_t next = entry.Next;
+
+            if (entry.Expiry > tick)
+            {
+                link(timerID);
+            }
+            else
+            {
+                entry.IsScheduled = false;
+                expiredTimers->emplace_back(timerID);
+            }
+            timerID = next;
+        }
+    }
+}
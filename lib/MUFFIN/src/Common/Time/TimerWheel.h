@@ -0,0 +1,88 @@
+/**
+ * @file TimerWheel.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 밀리초 단위의 계층형 타이머 휠 클래스를 선언합니다.
+ * @details 레벨마다 64개의 슬롯을 두며, 레벨 L의 슬롯 하나는 64^L 밀리초를 표현합니다.
+ *          5개 레벨로 약 12일 이내의 만료 시각을 표현할 수 있습니다. 슬롯마다 점유 비트맵을
+ *          유지하므로 다음 만료 시각을 타이머 수와 무관하게 계산할 수 있으며, Advance() 함수는
+ *          비어있는 틱을 건너뛰고 처리가 필요한 틱에서만 슬롯을 처리합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @note 멀티 쓰레딩 환경에서 race condition이 발생할 수 있으므로 하나의 태스크에서만 사용해야 합니다.
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <sys/_stdint.h>
+#include <vector>
+
+
+
+namespace muffin {
+
+    class TimerWheel
+    {
+    public:
+        TimerWheel();
+        virtual ~TimerWheel() {}
+    public:
+        /**
+         * @brief 휠의 현재 시각을 설정합니다. 등록된 모든 타이머는 취소됩니다.
+         */
+        void Init(const uint64_t nowMillis);
+        /**
+         * @param timerID 0 이상 MAX_TIMER_COUNT 미만의 식별자로, 이미 등록된 경우 다시 예약합니다.
+         * @param expiryMillis 만료 시각으로, 현재 시각 이전이면 다음 Advance() 호출 시 만료됩니다.
+         */
+        bool Schedule(const uint8_t timerID, const uint64_t expiryMillis);
+        void Cancel(const uint8_t timerID);
+        bool IsScheduled(const uint8_t timerID) const;
+        /**
+         * @return UINT64_MAX 등록된 타이머가 없는 경우
+         */
+        uint64_t RetrieveNextEventMillis() const;
+        /**
+         * @brief 현재 시각까지 휠을 진행하며 만료된 타이머의 식별자를 만료 순서대로 추가합니다.
+         */
+        void Advance(const uint64_t nowMillis, std::vector<uint8_t>* expiredTimers);
+    public:
+        static const uint8_t MAX_TIMER_COUNT = 32;
+    private:
+        void link(const uint8_t timerID);
+        void unlink(const uint8_t timerID);
+        void cascade(const uint8_t level, const uint8_t slot);
+        void process(const uint64_t tick, std::vector<uint8_t>* expiredTimers);
+    private:
+        static const uint8_t LEVEL_COUNT   = 5;
+        static const uint8_t SLOT_BITS     = 6;
+        static const uint8_t SLOT_COUNT    = 1 << SLOT_BITS;
+        static const uint8_t SLOT_MASK     = SLOT_COUNT - 1;
+        static const uint8_t INVALID_TIMER = 0xFF;
+    private:
+        typedef struct TimerWheelEntryType
+        {
+            uint64_t Expiry;
+            uint8_t Previous;
+            uint8_t Next;
+            uint8_t Level;
+            uint8_t Slot;
+            bool IsScheduled;
+        } entry_t;
+    private:
+        /**
+         * @note mCurrentTick 이전의 모든 틱은 처리가 완료되었음을 의미합니다.
+         */
+        uint64_t mCurrentTick;
+        entry_t mEntries[MAX_TIMER_COUNT];
+        uint8_t mSlotHeads[LEVEL_COUNT][SLOT_COUNT];
+        uint64_t mOccupancy[LEVEL_COUNT];
+    };
+}
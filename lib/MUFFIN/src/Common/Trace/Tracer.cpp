@@ -0,0 +1,287 @@
+/**
+ * @file Tracer.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 태스크 간의 실행 순서를 분석하기 위한 바이너리 이벤트 추적 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+#include <HardwareSerial.h>
+#include <mbedtls/base64.h>
+#include <new>
+#include <string.h>
+
+#include "Common/Logger/Logger.h"
+#include "Tracer.h"
+
+#if defined(MT11)
+    #include "Common/PSRAM.hpp"
+#endif
+
+
+
+namespace muffin {
+
+    Tracer::Tracer()
+        : mIsRecording(false)
+        , mStopOnFault(false)
+        , mFaultEvent(trace_event_e::TOP)
+        , mHasFault(false)
+        , mRing(nullptr)
+        , mWritten(0)
+        , mTaskCount(0)
+    {
+        portMUX_INITIALIZE(&mLock);
+        memset(mTasks, 0, sizeof(mTasks));
+    }
+
+    Status Tracer::Start(const bool stopOnFault)
+    {
+        if (mRing == nullptr)
+        {
+        #if defined(MT11)
+            mRing = static_cast<trace_record_t*>(psram::allocate(sizeof(trace_record_t) * CAPACITY));
+        #else
+            mRing = new(std::nothrow) trace_record_t[CAPACITY];
+        #endif
+            if (mRing == nullptr)
+            {
+                LOG_ERROR(logger, "FAILED TO ALLOCATE MEMORY FOR TRACE BUFFER");
+                return Status(Status::Code::BAD_OUT_OF_MEMORY);
+            }
+        }
+
+        mIsRecording.store(false, std::memory_order_relaxed);
+        portENTER_CRITICAL(&mLock);
+        mWritten     = 0;
+        mTaskCount   = 0;
+        mHasFault    = false;
+        mFaultEvent  = trace_event_e::TOP;
+        mStopOnFault = stopOnFault;
+        portEXIT_CRITICAL(&mLock);
+
+        mIsRecording.store(true, std::memory_order_relaxed);
+        LOG_INFO(logger, "Started tracing, stop on fault: %s", stopOnFault ? "true" : "false");
+        return Status(Status::Code::GOOD);
+    }
+
+    void Tracer::Stop()
+    {
+        mIsRecording.store(false, std::memory_order_relaxed);
+    }
+
+    void Tracer::Fault(const trace_event_e event)
+    {
+        if (IsRecording() == false)
+        {
+            return;
+        }
+
+        record(event, trace_phase_e::INSTANT);
+        if (mStopOnFault == false)
+        {
+            return;
+        }
+
+        /**
+         * @note 다른 태스크가 같은 시점에 장애를 기록하더라도 처음 기록된 장애만 보고합니다.
+         */
+        portENTER_CRITICAL(&mLock);
+        if (mHasFault == false)
+        {
+            mHasFault   = true;
+            mFaultEvent = event;
+        }
+        portEXIT_CRITICAL(&mLock);
+        mIsRecording.store(false, std::memory_order_relaxed);
+    }
+
+    void Tracer::record(const trace_event_e event, const trace_phase_e phase)
+    {
+        const uint8_t core = static_cast<uint8_t>(xPortGetCoreID());
+        TaskHandle_t handle = xTaskGetCurrentTaskHandle();
+
+        portENTER_CRITICAL(&mLock);
+        /**
+         * @note 타임스탬프를 임계 구역 안에서 읽어 링 버퍼의 레코드가 시간 순서대로 저장되도록 합니다.
+         */
+        trace_record_t& traceRecord = mRing[mWritten % CAPACITY];
+        traceRecord.TimestampMicros = micros();
+        traceRecord.Event = static_cast<uint8_t>(event);
+        traceRecord.Phase = static_cast<uint8_t>(phase);
+        traceRecord.Core  = core;
+        traceRecord.Task  = resolveTask(handle);
+        ++mWritten;
+        portEXIT_CRITICAL(&mLock);
+    }
+
+    uint8_t Tracer::resolveTask(TaskHandle_t handle)
+    {
+        for (uint8_t idx = 0; idx < mTaskCount; ++idx)
+        {
+            if (mTasks[idx].Handle == handle)
+            {
+                return idx;
+            }
+        }
+
+        if (mTaskCount == MAX_TASKS)
+        {
+            return UNKNOWN_TASK;
+        }
+
+        const char* name = pcTaskGetName(handle);
+        strncpy(mTasks[mTaskCount].Name, name, configMAX_TASK_NAME_LEN - 1);
+        mTasks[mTaskCount].Name[configMAX_TASK_NAME_LEN - 1] = '\0';
+        mTasks[mTaskCount].Handle = handle;
+        return mTaskCount++;
+    }
+
+    uint32_t Tracer::countEvents() const
+    {
+        return mWritten < CAPACITY ? mWritten : CAPACITY;
+    }
+
+    void Tracer::writeHeader(JsonObject output) const
+    {
+        output["cap"]   = static_cast<uint32_t>(CAPACITY);
+        output["total"] = countEvents();
+        output["lost"]  = mWritten - countEvents();
+        output["fault"] = mHasFault ? toString(mFaultEvent) : "";
+
+        JsonArray tasks = output["tasks"].to<JsonArray>();
+        for (uint8_t idx = 0; idx < mTaskCount; ++idx)
+        {
+            tasks.add(mTasks[idx].Name);
+        }
+
+        JsonArray events = output["events"].to<JsonArray>();
+        for (uint8_t idx = 0; idx < static_cast<uint8_t>(trace_event_e::TOP); ++idx)
+        {
+            events.add(toString(static_cast<trace_event_e>(idx)));
+        }
+    }
+
+    std::string Tracer::encode(const uint32_t offset, const uint32_t count) const
+    {
+        /**
+         * @note 레코드는 타임스탬프(4), 이벤트(1), 단계(1), 코어(1), 태스크(1) 순서의
+         *       리틀 엔디언 8바이트로 직렬화합니다.
+         */
+        std::string binary;
+        binary.reserve(count * sizeof(trace_record_t));
+        const uint32_t oldest = mWritten - countEvents();
+
+        for (uint32_t idx = 0; idx < count; ++idx)
+        {
+            const trace_record_t& traceRecord = mRing[(oldest + offset + idx) % CAPACITY];
+            binary.push_back(static_cast<char>(traceRecord.TimestampMicros));
+            binary.push_back(static_cast<char>(traceRecord.TimestampMicros >> 8));
+            binary.push_back(static_cast<char>(traceRecord.TimestampMicros >> 16));
+            binary.push_back(static_cast<char>(traceRecord.TimestampMicros >> 24));
+            binary.push_back(static_cast<char>(traceRecord.Event));
+            binary.push_back(static_cast<char>(traceRecord.Phase));
+            binary.push_back(static_cast<char>(traceRecord.Core));
+            binary.push_back(static_cast<char>(traceRecord.Task));
+        }
+
+        size_t encodedLength = 0;
+        const unsigned char* source = reinterpret_cast<const unsigned char*>(binary.data());
+        mbedtls_base64_encode(nullptr, 0, &encodedLength, source, binary.size());
+
+        std::string encoded(encodedLength, '\0');
+        mbedtls_base64_encode(reinterpret_cast<unsigned char*>(&encoded[0]), encodedLength, &encodedLength, source, binary.size());
+        encoded.resize(encodedLength);
+        return encoded;
+    }
+
+    Status Tracer::Dump(const uint32_t offset, JsonObject output)
+    {
+        if (IsRecording() == true)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        const uint32_t total = countEvents();
+        if (offset == 0)
+        {
+            writeHeader(output);
+        }
+        output["ofs"] = offset;
+
+        if (offset >= total)
+        {
+            output["next"] = offset;
+            return Status(Status::Code::BAD_NO_DATA);
+        }
+
+        const uint32_t count = (total - offset) < CHUNK_EVENTS ? (total - offset) : CHUNK_EVENTS;
+        output["next"] = offset + count;
+        output["data"] = encode(offset, count);
+        return Status(Status::Code::GOOD);
+    }
+
+    Status Tracer::DumpToSerial()
+    {
+        if (IsRecording() == true)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        /**
+         * @note 변환 도구가 시리얼 로그에서 추적 데이터를 찾을 수 있도록 줄마다 접두어를 붙입니다.
+         */
+        JsonDocument header;
+        writeHeader(header.to<JsonObject>());
+        std::string serializedHeader;
+        serializeJson(header, serializedHeader);
+        Serial.printf("#TRACE %s\r\n", serializedHeader.c_str());
+
+        const uint32_t total = countEvents();
+        for (uint32_t offset = 0; offset < total; offset += CHUNK_EVENTS)
+        {
+            const uint32_t count = (total - offset) < CHUNK_EVENTS ? (total - offset) : CHUNK_EVENTS;
+            Serial.printf("#TRACE-DATA %s\r\n", encode(offset, count).c_str());
+        }
+        Serial.print("#TRACE-END\r\n");
+        return Status(Status::Code::GOOD);
+    }
+
+    const char* Tracer::toString(const trace_event_e event) const
+    {
+        switch (event)
+        {
+        case trace_event_e::MODBUS_RTU_LOCK_WAIT:
+            return "ModbusRtuLockWait";
+        case trace_event_e::MODBUS_RTU_LOCK:
+            return "ModbusRtuLock";
+        case trace_event_e::MODBUS_TCP_LOCK_WAIT:
+            return "ModbusTcpLockWait";
+        case trace_event_e::MODBUS_TCP_LOCK:
+            return "ModbusTcpLock";
+        case trace_event_e::NIC_LOCK_WAIT:
+            return "NicLockWait";
+        case trace_event_e::NIC_LOCK:
+            return "NicLock";
+        case trace_event_e::MQTT_PUBLISH:
+            return "MqttPublish";
+        case trace_event_e::LOCK_TIMEOUT:
+            return "LockTimeout";
+        case trace_event_e::DEADLINE_MISS:
+            return "DeadlineMiss";
+        default:
+            return "Unknown";
+        }
+    }
+
+
+    Tracer tracer;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file Tracer.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 태스크 간의 실행 순서를 분석하기 위한 바이너리 이벤트 추적 클래스를 선언합니다.
+ * @details 구간의 시작과 끝, 순간 이벤트를 실행한 태스크와 코어 정보와 함께 8바이트 레코드로
+ *          링 버퍼에 기록합니다. 링 버퍼는 처음 추적을 시작할 때 할당하며 MT11 모델에서는
+ *          PSRAM에 배치합니다. 추적은 원격 명령으로 시작하고 멈추며, 장애 발생 시 멈추도록
+ *          설정하면 주기 초과나 잠금 시간 초과가 발생한 시점까지의 이벤트를 보존합니다.
+ *          기록한 이벤트는 MQTT 또는 시리얼로 내보내며, tool/trace_to_chrome.py로 Chrome
+ *          trace_event 형식의 JSON 파일로 변환할 수 있습니다.
+ *
+ * @note 추적 중이 아닐 때의 이벤트 기록 비용은 원자적 변수를 한 번 읽는 것입니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <ArduinoJson.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <string>
+#include <sys/_stdint.h>
+
+#include "Common/Status.h"
+
+
+
+namespace muffin {
+
+    typedef enum class TraceEventEnum
+        : uint8_t
+    {
+        MODBUS_RTU_LOCK_WAIT    = 0,
+        MODBUS_RTU_LOCK         = 1,
+        MODBUS_TCP_LOCK_WAIT    = 2,
+        MODBUS_TCP_LOCK         = 3,
+        NIC_LOCK_WAIT           = 4,
+        NIC_LOCK                = 5,
+        MQTT_PUBLISH            = 6,
+        LOCK_TIMEOUT            = 7,
+        DEADLINE_MISS           = 8,
+        TOP                     = 9
+    } trace_event_e;
+
+    typedef enum class TracePhaseEnum
+        : uint8_t
+    {
+        BEGIN   = 'B',
+        END     = 'E',
+        INSTANT = 'i'
+    } trace_phase_e;
+
+    class Tracer
+    {
+    public:
+        Tracer();
+        virtual ~Tracer() {}
+    public:
+        /**
+         * @brief 링 버퍼를 비우고 추적을 시작합니다.
+         * @param stopOnFault 장애 이벤트가 기록되면 추적을 멈출지 여부
+         */
+        Status Start(const bool stopOnFault);
+        void Stop();
+        bool IsRecording() const { return mIsRecording.load(std::memory_order_relaxed); }
+    public:
+        void Begin(const trace_event_e event)
+        {
+            if (IsRecording() == true)
+            {
+                record(event, trace_phase_e::BEGIN);
+            }
+        }
+
+        void End(const trace_event_e event)
+        {
+            if (IsRecording() == true)
+            {
+                record(event, trace_phase_e::END);
+            }
+        }
+
+        void Instant(const trace_event_e event)
+        {
+            if (IsRecording() == true)
+            {
+                record(event, trace_phase_e::INSTANT);
+            }
+        }
+
+        /**
+         * @brief 장애 이벤트를 기록하며, 장애 시 멈추도록 설정되어 있으면 추적을 멈춥니다.
+         */
+        void Fault(const trace_event_e event);
+    public:
+        /**
+         * @brief 추적 상태와 함께 offset번째로 오래된 이벤트부터 최대 CHUNK_EVENTS개의 레코드를
+         *        Base64로 인코딩하여 output에 씁니다. 추적을 멈춘 상태에서만 읽을 수 있습니다.
+         */
+        Status Dump(const uint32_t offset, JsonObject output);
+        Status DumpToSerial();
+    private:
+        void record(const trace_event_e event, const trace_phase_e phase);
+        uint8_t resolveTask(TaskHandle_t handle);
+        void writeHeader(JsonObject output) const;
+        std::string encode(const uint32_t offset, const uint32_t count) const;
+        uint32_t countEvents() const;
+        const char* toString(const trace_event_e event) const;
+    public:
+        static const uint16_t CHUNK_EVENTS = 128;
+    private:
+    #if defined(MT11)
+        static const uint16_t CAPACITY = 8192;
+    #else
+        static const uint16_t CAPACITY = 1024;
+    #endif
+        static const uint8_t MAX_TASKS      = 32;
+        static const uint8_t UNKNOWN_TASK   = 0xFF;
+    private:
+        typedef struct TraceRecordType
+        {
+            uint32_t TimestampMicros;
+            uint8_t Event;
+            uint8_t Phase;
+            uint8_t Core;
+            uint8_t Task;
+        } trace_record_t;
+
+        typedef struct TraceTaskType
+        {
+            TaskHandle_t Handle;
+            char Name[configMAX_TASK_NAME_LEN];
+        } trace_task_t;
+    private:
+        std::atomic<bool> mIsRecording;
+        bool mStopOnFault;
+        trace_event_e mFaultEvent;
+        bool mHasFault;
+        portMUX_TYPE mLock;
+        trace_record_t* mRing;
+        uint32_t mWritten;
+        trace_task_t mTasks[MAX_TASKS];
+        uint8_t mTaskCount;
+    };
+
+
+    extern Tracer tracer;
+}
@@ -18,7 +18,9 @@
 #include <Preferences.h>
 
 #include "Common/Assert.hpp"
+#include "Common/Logger/FlashLog.h"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/TaskStats.h"
 #include "Common/Time/TimeUtils.h"
 #include "Common/Convert/ConvertClass.h"
 #include "Core.h"
@@ -39,6 +41,8 @@
 
 #include "Protocol/MQTT/CatMQTT/CatMQTT.h"
 #include "Protocol/MQTT/CDO.h"
+#include "Protocol/MQTT/OutboundLog.h"
+#include "Protocol/MQTT/PayloadCompressor.h"
 #include "Protocol/SPEAR/SPEAR.h"
 #include "Storage/ESP32FS/ESP32FS.h"
 #include "Task/JarvisTask.h"
@@ -299,6 +303,32 @@ namespace muffin {
         LOG_INFO(logger, "File system: %s", ret.c_str());
         replaceDeprecatedPaths();
 
+        ret = mqtt::outboundLog.Init();
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_WARNING(logger, "FAILED TO INIT OUTBOUND LOG: %s", ret.c_str());
+        }
+
+        ret = flashLog.Init();
+        if (ret == Status::Code::GOOD)
+        {
+            logger.AddSinkElement(log_sink_e::LOG_TO_SPIFFS);
+        }
+        else
+        {
+            LOG_WARNING(logger, "FAILED TO INIT FLASH LOG: %s", ret.c_str());
+        }
+
+        ret = taskStats.Init();
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_WARNING(logger, "FAILED TO INIT TASK STATISTICS: %s", ret.c_str());
+        }
+
+    #if defined(DEBUG)
+        mqtt::payloadCompressor.RunBenchmark();
+    #endif
+
         init_cfg_t initConfig;
         ret = readInitConfig(&initConfig);
         if (ret != Status::Code::GOOD)
@@ -884,6 +914,71 @@ namespace muffin {
             brokerInfo.SetPassword(mqtt["pw"].as<std::string>());
             brokerInfo.EnableSSL(mqtt["scheme"].as<uint8_t>() == 1 ? false : true);
             brokerInfo.EnableValidateCert(mqtt["checkCert"].as<bool>());
+
+            /**
+             * @note "compress" 키는 선택 사항이며, 페이로드를 압축하여 발행할 토픽 코드의 배열입니다.
+             */
+            if (mqtt["compress"].is<JsonArray>())
+            {
+                for (JsonVariant topicCode : mqtt["compress"].as<JsonArray>())
+                {
+                    if (topicCode.is<uint8_t>() == false)
+                    {
+                        LOG_WARNING(logger, "[MQTT BROKER URL] INVALID COMPRESSED TOPIC CODE");
+                        continue;
+                    }
+                    mqtt::payloadCompressor.Enable(static_cast<mqtt::topic_e>(topicCode.as<uint8_t>()));
+                }
+            }
+
+            /**
+             * @note "inflight" 키는 선택 사항이며, 0보다 크면 확인 응답을 기다릴 수 있는 최대 메시지
+             *       수를 지정하여 QoS 1로 발행합니다. LwIP와 CatM1 MQTT 클라이언트에 모두 적용됩니다.
+             */
+            if (mqtt["inflight"].is<uint8_t>())
+            {
+                brokerInfo.SetInflightWindow(mqtt["inflight"].as<uint8_t>());
+            }
+
+            /**
+             * @note "format" 키는 선택 사항이며, 수집 데이터의 페이로드 형식을 지정합니다.
+             *       0은 JSON, 1은 Sparkplug B이며 키가 없으면 JSON으로 발행합니다.
+             */
+            if (mqtt.containsKey("format"))
+            {
+                isValid &= mqtt["format"].isNull() == false;
+                isValid &= mqtt["format"].is<uint8_t>();
+                isValid &= mqtt["format"].as<uint8_t>() <= static_cast<uint8_t>(mqtt::payload_format_e::SPARKPLUG_B);
+
+                if (isValid != true)
+                {
+                    LOG_ERROR(logger,"[MQTT BROKER URL] INVALID PAYLOAD FORMAT");
+                    return Status(Status::Code::BAD_INVALID_ARGUMENT);
+                }
+
+                const mqtt::payload_format_e format = static_cast<mqtt::payload_format_e>(mqtt["format"].as<uint8_t>());
+                LOG_DEBUG(logger,"mqtt payload format: %s",format == mqtt::payload_format_e::SPARKPLUG_B ? "Sparkplug B" : "JSON");
+                brokerInfo.SetPayloadFormat(format);
+            }
+
+            /**
+             * @note "cleanSession" 키는 선택 사항이며, true이면 연결할 때마다 브로커의 세션을 새로
+             *       시작합니다. 키가 없으면 영구 세션으로 접속합니다.
+             */
+            if (mqtt.containsKey("cleanSession"))
+            {
+                isValid &= mqtt["cleanSession"].isNull() == false;
+                isValid &= mqtt["cleanSession"].is<bool>();
+
+                if (isValid != true)
+                {
+                    LOG_ERROR(logger,"[MQTT BROKER URL] INVALID CLEAN SESSION FLAG");
+                    return Status(Status::Code::BAD_INVALID_ARGUMENT);
+                }
+
+                LOG_DEBUG(logger,"mqtt clean session: %s",mqtt["cleanSession"].as<bool>() == true ? "Enabled" : "Disabled");
+                brokerInfo.SetCleanSession(mqtt["cleanSession"].as<bool>());
+            }
         }
 
         if (doc.containsKey("ntp"))
@@ -1036,7 +1131,7 @@ namespace muffin {
 
         const std::string payload =  deviceStatus.ToStringEvent();
         mqtt::Message message(mqtt::topic_e::JARVIS_STATUS, payload);
-        mqtt::cdo.Store(message);
+        mqtt::cdo.Store(std::move(message));
 
         if (output->ReconfigCode != static_cast<uint8_t>(reconfiguration_code_e::NONE))
         {
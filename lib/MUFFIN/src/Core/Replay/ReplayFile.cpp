@@ -0,0 +1,207 @@
+/**
+ * @file ReplayFile.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 트래픽 기록 파일의 형식과 드라이버별 재생 위치를 관리하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <string.h>
+
+#include "ReplayFile.h"
+
+
+
+namespace muffin {
+
+    ReplayFile::ReplayFile()
+        : mFileSize(0)
+        , mFrameCount(0)
+        , mDurationMillis(0)
+    {
+    }
+
+    Status ReplayFile::WriteHeader(File* file, const uint64_t startTimestamp)
+    {
+        file_header_t header;
+        memset(&header, 0, sizeof(file_header_t));
+        memcpy(header.Magic, "MRPL", sizeof(header.Magic));
+        header.Version = VERSION;
+        header.StartTimestamp = startTimestamp;
+
+        const size_t written = file->write(reinterpret_cast<const uint8_t*>(&header), sizeof(file_header_t));
+        if (written != sizeof(file_header_t))
+        {
+            return Status(Status::Code::BAD_DEVICE_FAILURE);
+        }
+        return Status(Status::Code::GOOD);
+    }
+
+    size_t ReplayFile::WriteFrame(File* file, const replay_source_e source, const uint32_t address, const uint16_t port,
+                                  const uint32_t offsetMillis, const std::string& payload)
+    {
+        frame_header_t frame;
+        memset(&frame, 0, sizeof(frame_header_t));
+        frame.OffsetMillis  = offsetMillis;
+        frame.Address       = address;
+        frame.Port          = port;
+        frame.Length        = static_cast<uint16_t>(payload.size());
+        frame.Source        = static_cast<uint8_t>(source);
+
+        size_t written = file->write(reinterpret_cast<const uint8_t*>(&frame), sizeof(frame_header_t));
+        written += file->write(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
+        return written;
+    }
+
+    uint64_t ReplayFile::MakeKey(const replay_source_e source, const uint32_t address, const uint16_t port)
+    {
+        return (static_cast<uint64_t>(source) << 48) | (static_cast<uint64_t>(port) << 32) | address;
+    }
+
+    Status ReplayFile::Inspect(File* file)
+    {
+        file_header_t header;
+        file->seek(0);
+        if (file->read(reinterpret_cast<uint8_t*>(&header), sizeof(file_header_t)) != sizeof(file_header_t) ||
+            memcmp(header.Magic, "MRPL", sizeof(header.Magic)) != 0 || header.Version != VERSION)
+        {
+            return Status(Status::Code::BAD_DATA_ENCODING_INVALID);
+        }
+
+        mCursors.clear();
+        mFileSize       = file->size();
+        mFrameCount     = 0;
+        mDurationMillis = 0;
+
+        uint32_t offset = sizeof(file_header_t);
+        frame_header_t frame;
+        while (file->read(reinterpret_cast<uint8_t*>(&frame), sizeof(frame_header_t)) == sizeof(frame_header_t))
+        {
+            const uint32_t next = offset + sizeof(frame_header_t) + frame.Length;
+            if (next > mFileSize)
+            {
+                break;
+            }
+
+            const uint64_t key = MakeKey(static_cast<replay_source_e>(frame.Source), frame.Address, frame.Port);
+            if (mCursors.find(key) == mCursors.end())
+            {
+                cursor_t cursor;
+                cursor.FirstOffset = offset;
+                cursor.Offset      = offset;
+                cursor.IsFinished  = false;
+                mCursors.emplace(key, cursor);
+            }
+
+            ++mFrameCount;
+            mDurationMillis = frame.OffsetMillis;
+            offset = next;
+            file->seek(offset);
+        }
+
+        if (mFrameCount == 0)
+        {
+            return Status(Status::Code::BAD_NO_DATA);
+        }
+        return Status(Status::Code::GOOD);
+    }
+
+    Status ReplayFile::ReadFrame(File* file, const uint64_t key, const uint64_t elapsedMillis, std::string* payload)
+    {
+        payload->clear();
+
+        auto it = mCursors.find(key);
+        if (it == mCursors.end())
+        {
+            return Status(Status::Code::BAD_NOT_FOUND);
+        }
+
+        cursor_t& cursor = it->second;
+        if (cursor.IsFinished == true)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        frame_header_t frame;
+        file->seek(cursor.Offset);
+        if (file->read(reinterpret_cast<uint8_t*>(&frame), sizeof(frame_header_t)) != sizeof(frame_header_t))
+        {
+            return Status(Status::Code::BAD_DECODING_ERROR);
+        }
+
+        if (frame.OffsetMillis > elapsedMillis)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        payload->resize(frame.Length);
+        if (file->read(reinterpret_cast<uint8_t*>(&(*payload)[0]), frame.Length) != frame.Length)
+        {
+            payload->clear();
+            return Status(Status::Code::BAD_DECODING_ERROR);
+        }
+
+        /**
+         * @note 같은 드라이버의 다음 프레임을 찾아 재생 위치를 옮깁니다.
+         */
+        uint32_t offset = cursor.Offset + sizeof(frame_header_t) + frame.Length;
+        cursor.IsFinished = true;
+        frame_header_t next;
+        while (offset < mFileSize && file->seek(offset) == true &&
+               file->read(reinterpret_cast<uint8_t*>(&next), sizeof(frame_header_t)) == sizeof(frame_header_t))
+        {
+            if ((offset + sizeof(frame_header_t) + next.Length) > mFileSize)
+            {
+                break;
+            }
+
+            if (MakeKey(static_cast<replay_source_e>(next.Source), next.Address, next.Port) == key)
+            {
+                cursor.IsFinished = false;
+                break;
+            }
+            offset += sizeof(frame_header_t) + next.Length;
+        }
+        cursor.Offset = offset;
+        return Status(Status::Code::GOOD);
+    }
+
+    bool ReplayFile::IsExhausted() const
+    {
+        for (const auto& pair : mCursors)
+        {
+            if (pair.second.IsFinished == false)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<uint64_t> ReplayFile::RetrieveChannelKeys() const
+    {
+        std::vector<uint64_t> keys;
+        keys.reserve(mCursors.size());
+        for (const auto& pair : mCursors)
+        {
+            keys.emplace_back(pair.first);
+        }
+        return keys;
+    }
+
+    void ReplayFile::Rewind()
+    {
+        for (auto& pair : mCursors)
+        {
+            pair.second.Offset     = pair.second.FirstOffset;
+            pair.second.IsFinished = false;
+        }
+    }
+}
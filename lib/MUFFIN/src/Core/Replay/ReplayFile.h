@@ -0,0 +1,117 @@
+/**
+ * @file ReplayFile.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 트래픽 기록 파일의 형식과 드라이버별 재생 위치를 관리하는 클래스를 선언합니다.
+ * @details 파일은 헤더(16) 다음에 프레임이 이어지며, 프레임은 frame_header_t(16)과
+ *          PolledDataTable::Encode()로 직렬화한 데이터로 구성됩니다. 모든 정수는 리틀
+ *          엔디언입니다. 드라이버는 프로토콜과 서버 주소(RTU는 포트 번호)로 구분하며, 드라이버마다
+ *          다음에 적용할 프레임의 위치를 따로 관리합니다. 파일 입출력은 File 객체로만 수행하므로
+ *          호스트에서도 같은 코드로 기록 파일을 재생할 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <sys/_stdint.h>
+#include <vector>
+
+#include "Common/Status.h"
+#include "Storage/ESP32FS/ESP32FS.h"
+
+
+
+namespace muffin {
+
+    typedef enum class ReplaySourceEnum
+        : uint8_t
+    {
+        MODBUS_RTU  = 0,
+        MODBUS_TCP  = 1,
+        MELSEC      = 2
+    } replay_source_e;
+
+    class ReplayFile
+    {
+    public:
+        ReplayFile();
+        virtual ~ReplayFile() {}
+    public:
+        static Status WriteHeader(File* file, const uint64_t startTimestamp);
+        /**
+         * @return 기록한 바이트 수
+         */
+        static size_t WriteFrame(File* file, const replay_source_e source, const uint32_t address, const uint16_t port,
+                                 const uint32_t offsetMillis, const std::string& payload);
+        static uint64_t MakeKey(const replay_source_e source, const uint32_t address, const uint16_t port);
+    public:
+        /**
+         * @brief 파일의 헤더를 확인하고 드라이버별 재생 위치를 첫 프레임으로 설정합니다.
+         * @note 기록 중에 전원이 꺼져 마지막 프레임이 잘렸을 수 있으므로 온전한 프레임까지만 재생합니다.
+         * @return BAD_DATA_ENCODING_INVALID 기록 파일이 아니거나 버전이 다른 경우
+         * @return BAD_NO_DATA 온전한 프레임이 없는 경우
+         */
+        Status Inspect(File* file);
+        /**
+         * @brief 드라이버의 다음 프레임이 재생 시각이 되었으면 데이터를 읽고 재생 위치를 옮깁니다.
+         * @param elapsedMillis 재생을 시작한 다음 배속을 적용하여 흐른 시간으로, UINT64_MAX이면
+         *        기록 시각과 관계없이 다음 프레임을 읽습니다.
+         * @return GOOD 재생 시각이 되지 않았거나 모든 프레임을 읽었으면 payload를 비웁니다.
+         * @return BAD_NOT_FOUND 기록 파일에 없는 드라이버인 경우
+         */
+        Status ReadFrame(File* file, const uint64_t key, const uint64_t elapsedMillis, std::string* payload);
+        bool IsExhausted() const;
+        void Rewind();
+    public:
+        uint32_t GetFrameCount() const { return mFrameCount; }
+        uint32_t GetDurationMillis() const { return mDurationMillis; }
+        size_t GetChannelCount() const { return mCursors.size(); }
+        std::vector<uint64_t> RetrieveChannelKeys() const;
+    public:
+        static const size_t FILE_HEADER_SIZE  = 16;
+        static const size_t FRAME_HEADER_SIZE = 16;
+    private:
+        typedef struct ReplayFileHeaderType
+        {
+            char Magic[4];
+            uint8_t Version;
+            uint8_t Reserved[3];
+            uint64_t StartTimestamp;
+        } file_header_t;
+
+        typedef struct ReplayFrameHeaderType
+        {
+            uint32_t OffsetMillis;
+            uint32_t Address;
+            uint16_t Port;
+            uint16_t Length;
+            uint8_t Source;
+            uint8_t Reserved[3];
+        } frame_header_t;
+        static_assert(sizeof(file_header_t) == FILE_HEADER_SIZE, "FILE HEADER LAYOUT MUST MATCH THE STORED FORMAT");
+        static_assert(sizeof(frame_header_t) == FRAME_HEADER_SIZE, "FRAME HEADER LAYOUT MUST MATCH THE STORED FORMAT");
+
+        typedef struct ReplayCursorType
+        {
+            uint32_t FirstOffset;
+            uint32_t Offset;
+            bool IsFinished;
+        } cursor_t;
+    private:
+        static const uint8_t VERSION = 1;
+    private:
+        uint32_t mFileSize;
+        uint32_t mFrameCount;
+        uint32_t mDurationMillis;
+        std::map<uint64_t, cursor_t> mCursors;
+    };
+}
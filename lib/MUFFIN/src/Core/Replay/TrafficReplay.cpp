@@ -0,0 +1,469 @@
+/**
+ * @file TrafficReplay.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 설비로부터 수집한 데이터를 기록하고 실제 수집 파이프라인으로 재생하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+#include <mbedtls/base64.h>
+#include <string.h>
+
+#include "Common/Logger/Logger.h"
+#include "Common/Sync/LockGuard.hpp"
+#include "Common/Time/TimeUtils.h"
+#include "Storage/ESP32FS/ESP32FS.h"
+#include "TrafficReplay.h"
+
+
+
+namespace muffin {
+
+    const char* TrafficReplay::FILE_PATH = "/replay.bin";
+
+    TrafficReplay::TrafficReplay()
+        : mMode(replay_mode_e::IDLE)
+        , mStartMillis(0)
+        , mReportMillis(0)
+        , mFileSize(0)
+        , mCapacity(0)
+        , mFrameCount(0)
+        , mDurationMillis(0)
+        , mSpeed(1)
+        , mIsLooping(false)
+        , mIsFinished(false)
+        , mLoopCount(0)
+        , mInjectedFrames(0)
+        , mPublishedMessages(0)
+        , mPublishedBytes(0)
+        , mPendingMicros(0)
+    {
+    }
+
+    Status TrafficReplay::StartRecording()
+    {
+        LockGuard lock(mMutex);
+        if (mMode.load(std::memory_order_relaxed) != replay_mode_e::IDLE)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        File file = esp32FS.Open(FILE_PATH, "w", true);
+        if (!file)
+        {
+            LOG_ERROR(logger, "FAILED TO CREATE REPLAY FILE");
+            return Status(Status::Code::BAD_DEVICE_FAILURE);
+        }
+
+        const Status ret = ReplayFile::WriteHeader(&file, GetTimestampInMillis());
+        file.close();
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "FAILED TO WRITE REPLAY FILE HEADER");
+            return ret;
+        }
+
+        /**
+         * @note 다른 서비스가 사용할 공간을 남겨 두기 위해 기록 파일의 크기를 파일 시스템의
+         *       여유 공간에서 MIN_FREE_BYTES를 뺀 크기와 MAX_FILE_SIZE 중 작은 값으로 제한합니다.
+         */
+        const size_t freeBytes = esp32FS.GetTotalBytes() - esp32FS.GetUsedBytes();
+        const uint32_t available = freeBytes > MIN_FREE_BYTES ? static_cast<uint32_t>(freeBytes) - MIN_FREE_BYTES : 0;
+        mCapacity       = available < MAX_FILE_SIZE ? available : static_cast<uint32_t>(MAX_FILE_SIZE);
+        mFileSize       = ReplayFile::FILE_HEADER_SIZE;
+        mFrameCount     = 0;
+        mDurationMillis = 0;
+        mStartMillis    = millis();
+
+        mMode.store(replay_mode_e::RECORDING, std::memory_order_relaxed);
+        LOG_INFO(logger, "Started recording traffic, capacity: %u Bytes", mCapacity);
+        return Status(Status::Code::GOOD);
+    }
+
+    Status TrafficReplay::StartReplay(const uint8_t speed, const bool isLooping)
+    {
+        LockGuard lock(mMutex);
+        if (mMode.load(std::memory_order_relaxed) != replay_mode_e::IDLE)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        File file = esp32FS.Open(FILE_PATH, "r", false);
+        if (!file)
+        {
+            return Status(Status::Code::BAD_NOT_FOUND);
+        }
+
+        mFileSize = file.size();
+        Status ret = mReplayFile.Inspect(&file);
+        file.close();
+        if (ret != Status::Code::GOOD)
+        {
+            if (ret == Status::Code::BAD_DATA_ENCODING_INVALID)
+            {
+                LOG_ERROR(logger, "INVALID REPLAY FILE HEADER");
+            }
+            return ret;
+        }
+        mFrameCount     = mReplayFile.GetFrameCount();
+        mDurationMillis = mReplayFile.GetDurationMillis();
+
+        mSpeed       = speed;
+        mIsLooping   = isLooping;
+        mIsFinished  = false;
+        mLoopCount   = 0;
+        mInjectedFrames.store(0, std::memory_order_relaxed);
+        mPublishedMessages.store(0, std::memory_order_relaxed);
+        mPublishedBytes.store(0, std::memory_order_relaxed);
+        mPendingMicros.store(0, std::memory_order_relaxed);
+
+        /**
+         * @note 이전 재생에서 남은 통계를 비웁니다.
+         */
+        histogram_snapshot_t snapshot;
+        mLatency.Snapshot(&snapshot);
+        for (auto& stage : mStages)
+        {
+            stage.Snapshot(&snapshot);
+        }
+
+        mStartMillis  = millis();
+        mReportMillis = mStartMillis;
+        mMode.store(replay_mode_e::REPLAYING, std::memory_order_relaxed);
+        LOG_INFO(logger, "Started replaying %u frames from %u channels, speed: %u, loop: %s",
+            mFrameCount, static_cast<uint32_t>(mReplayFile.GetChannelCount()), speed, isLooping ? "true" : "false");
+        return Status(Status::Code::GOOD);
+    }
+
+    void TrafficReplay::Stop()
+    {
+        LockGuard lock(mMutex);
+        const replay_mode_e mode = mMode.exchange(replay_mode_e::IDLE, std::memory_order_relaxed);
+        if (mode == replay_mode_e::RECORDING)
+        {
+            LOG_INFO(logger, "Stopped recording: %u frames, %u Bytes", mFrameCount, mFileSize);
+        }
+        else if (mode == replay_mode_e::REPLAYING)
+        {
+            LOG_INFO(logger, "Stopped replaying: %u frames injected", mInjectedFrames.load(std::memory_order_relaxed));
+        }
+    }
+
+    void TrafficReplay::Record(const replay_source_e source, const uint32_t address, const uint16_t port, const modbus::PolledDataTable& table)
+    {
+        if (IsRecording() == false)
+        {
+            return;
+        }
+
+        std::string payload;
+        table.Encode(&payload);
+        if (payload.empty() == true || payload.size() > UINT16_MAX)
+        {
+            return;
+        }
+
+        LockGuard lock(mMutex);
+        if (IsRecording() == false)
+        {
+            return;
+        }
+
+        const uint32_t frameSize = ReplayFile::FRAME_HEADER_SIZE + payload.size();
+        if ((mFileSize + frameSize) > mCapacity)
+        {
+            mMode.store(replay_mode_e::IDLE, std::memory_order_relaxed);
+            LOG_WARNING(logger, "Stopped recording since the file is full: %u frames, %u Bytes", mFrameCount, mFileSize);
+            return;
+        }
+
+        File file = esp32FS.Open(FILE_PATH, "a", false);
+        if (!file)
+        {
+            mMode.store(replay_mode_e::IDLE, std::memory_order_relaxed);
+            LOG_ERROR(logger, "FAILED TO OPEN REPLAY FILE");
+            return;
+        }
+
+        const uint32_t offsetMillis = millis() - mStartMillis;
+        const size_t written = ReplayFile::WriteFrame(&file, source, address, port, offsetMillis, payload);
+        file.close();
+        if (written != frameSize)
+        {
+            mMode.store(replay_mode_e::IDLE, std::memory_order_relaxed);
+            LOG_ERROR(logger, "FAILED TO WRITE REPLAY FRAME");
+            return;
+        }
+
+        mFileSize += frameSize;
+        mDurationMillis = offsetMillis;
+        ++mFrameCount;
+    }
+
+    Status TrafficReplay::Inject(const replay_source_e source, const uint32_t address, const uint16_t port, modbus::PolledDataTable* table)
+    {
+        LockGuard lock(mMutex);
+        if (IsReplaying() == false)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        File file = esp32FS.Open(FILE_PATH, "r", false);
+        if (!file)
+        {
+            return Status(Status::Code::BAD_DEVICE_FAILURE);
+        }
+
+        const uint64_t elapsedMillis = mSpeed == 0
+            ? UINT64_MAX
+            : static_cast<uint64_t>(millis() - mStartMillis) * mSpeed;
+
+        std::string payload;
+        Status ret = mReplayFile.ReadFrame(&file, ReplayFile::MakeKey(source, address, port), elapsedMillis, &payload);
+        file.close();
+        if (ret != Status::Code::GOOD || payload.empty() == true)
+        {
+            return ret;
+        }
+
+        ret = table->Decode(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "FAILED TO DECODE REPLAY FRAME: %s", ret.c_str());
+            return ret;
+        }
+
+        mPendingMicros.store(micros(), std::memory_order_relaxed);
+        mInjectedFrames.fetch_add(1, std::memory_order_relaxed);
+        finishIfExhausted();
+        return Status(Status::Code::GOOD);
+    }
+
+    void TrafficReplay::finishIfExhausted()
+    {
+        if (mReplayFile.IsExhausted() == false)
+        {
+            return;
+        }
+
+        if (mIsLooping == false)
+        {
+            /**
+             * @note 재생을 마쳐도 마지막 값으로 발행한 결과를 보고할 수 있도록 재생 상태를 유지합니다.
+             */
+            mIsFinished = true;
+            return;
+        }
+
+        mReplayFile.Rewind();
+        mStartMillis = millis();
+        ++mLoopCount;
+    }
+
+    void TrafficReplay::RecordPublish(const mqtt::topic_e topic, const size_t bytes)
+    {
+        if (IsReplaying() == false)
+        {
+            return;
+        }
+
+        switch (topic)
+        {
+        case mqtt::topic_e::DAQ_INPUT:
+        case mqtt::topic_e::DAQ_OUTPUT:
+        case mqtt::topic_e::DAQ_PARAM:
+        case mqtt::topic_e::SPARKPLUG_NDATA:
+        case mqtt::topic_e::AAS_OPERATIONALDATA_RTM:
+        case mqtt::topic_e::AAS_OPERATIONALDATA_JP:
+            break;
+        default:
+            return;
+        }
+
+        mPublishedMessages.fetch_add(1, std::memory_order_relaxed);
+        mPublishedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+        /**
+         * @note 프레임을 적용한 다음 처음 발행한 데이터 메시지까지의 시간만 종단 간 지연 시간으로 기록합니다.
+         */
+        const uint32_t pendingMicros = mPendingMicros.exchange(0, std::memory_order_relaxed);
+        if (pendingMicros != 0)
+        {
+            mLatency.Record(micros() - pendingMicros);
+        }
+    }
+
+    void TrafficReplay::Report(JsonObject output)
+    {
+        LockGuard lock(mMutex);
+        const replay_mode_e mode = mMode.load(std::memory_order_relaxed);
+        output["mode"]   = mode == replay_mode_e::RECORDING ? "record" : mode == replay_mode_e::REPLAYING ? "replay" : "idle";
+        output["size"]   = mFileSize;
+        output["frames"] = mFrameCount;
+        output["dur"]    = mDurationMillis;
+
+        if (mode != replay_mode_e::REPLAYING)
+        {
+            return;
+        }
+
+        const uint32_t now = millis();
+        const uint32_t intervalMillis = now - mReportMillis;
+        mReportMillis = now;
+
+        output["injected"] = mInjectedFrames.load(std::memory_order_relaxed);
+        output["loops"]    = mLoopCount;
+        output["done"]     = mIsFinished;
+        output["elapsed"]  = intervalMillis;
+        output["pubMsgs"]  = mPublishedMessages.exchange(0, std::memory_order_relaxed);
+        output["pubBytes"] = mPublishedBytes.exchange(0, std::memory_order_relaxed);
+        writeHistogram(&mLatency, output["e2e"].to<JsonObject>());
+
+        JsonObject stages = output["stages"].to<JsonObject>();
+        for (uint8_t idx = 0; idx < STAGE_COUNT; ++idx)
+        {
+            JsonObject stage = stages[toString(static_cast<replay_stage_e>(idx))].to<JsonObject>();
+            histogram_snapshot_t snapshot;
+            mStages[idx].Snapshot(&snapshot);
+
+            /**
+             * @note 단계별 점유율은 구간 동안 해당 단계를 실행한 시간의 합을 구간의 길이로 나눈
+             *       백분율입니다. 여러 태스크가 같은 단계를 실행하면 100을 넘을 수 있습니다.
+             */
+            const uint64_t busyMicros = static_cast<uint64_t>(snapshot.Mean) * snapshot.Count;
+            stage["n"]    = snapshot.Count;
+            stage["mean"] = snapshot.Mean;
+            stage["p95"]  = snapshot.P95;
+            stage["max"]  = snapshot.Max;
+            stage["busy"] = static_cast<uint32_t>(busyMicros / 1000);
+            stage["cpu"]  = intervalMillis == 0 ? 0 : static_cast<uint32_t>(busyMicros / 10 / intervalMillis);
+        }
+    }
+
+    void TrafficReplay::writeHistogram(Histogram* histogram, JsonObject output) const
+    {
+        histogram_snapshot_t snapshot;
+        histogram->Snapshot(&snapshot);
+        output["n"]    = snapshot.Count;
+        output["mean"] = snapshot.Mean;
+        output["p50"]  = snapshot.P50;
+        output["p95"]  = snapshot.P95;
+        output["p99"]  = snapshot.P99;
+        output["max"]  = snapshot.Max;
+    }
+
+    Status TrafficReplay::Dump(const uint32_t offset, JsonObject output)
+    {
+        LockGuard lock(mMutex);
+        if (IsRecording() == true)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        File file = esp32FS.Open(FILE_PATH, "r", false);
+        if (!file)
+        {
+            return Status(Status::Code::BAD_NOT_FOUND);
+        }
+
+        const uint32_t size = file.size();
+        output["size"] = size;
+        output["ofs"]  = offset;
+        if (offset >= size)
+        {
+            file.close();
+            output["next"] = offset;
+            return Status(Status::Code::BAD_NO_DATA);
+        }
+
+        const uint32_t count = (size - offset) < CHUNK_SIZE ? (size - offset) : static_cast<uint32_t>(CHUNK_SIZE);
+        std::string binary(count, '\0');
+        file.seek(offset);
+        const size_t length = file.read(reinterpret_cast<uint8_t*>(&binary[0]), count);
+        file.close();
+
+        size_t encodedLength = 0;
+        const unsigned char* source = reinterpret_cast<const unsigned char*>(binary.data());
+        mbedtls_base64_encode(nullptr, 0, &encodedLength, source, length);
+
+        std::string encoded(encodedLength, '\0');
+        mbedtls_base64_encode(reinterpret_cast<unsigned char*>(&encoded[0]), encodedLength, &encodedLength, source, length);
+        encoded.resize(encodedLength);
+
+        output["next"] = offset + length;
+        output["data"] = encoded;
+        return Status(Status::Code::GOOD);
+    }
+
+    Status TrafficReplay::Load(const uint32_t offset, const char* data)
+    {
+        LockGuard lock(mMutex);
+        if (mMode.load(std::memory_order_relaxed) != replay_mode_e::IDLE)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        const size_t dataLength = strlen(data);
+        size_t decodedLength = 0;
+        mbedtls_base64_decode(nullptr, 0, &decodedLength, reinterpret_cast<const unsigned char*>(data), dataLength);
+
+        std::string decoded(decodedLength, '\0');
+        if (decodedLength == 0 || mbedtls_base64_decode(reinterpret_cast<unsigned char*>(&decoded[0]), decodedLength,
+            &decodedLength, reinterpret_cast<const unsigned char*>(data), dataLength) != 0)
+        {
+            return Status(Status::Code::BAD_DECODING_ERROR);
+        }
+
+        /**
+         * @note 조각이 빠지거나 중복되지 않도록 현재 파일의 끝에 이어지는 조각만 받습니다.
+         */
+        File file = esp32FS.Open(FILE_PATH, offset == 0 ? "w" : "a", true);
+        if (!file)
+        {
+            return Status(Status::Code::BAD_DEVICE_FAILURE);
+        }
+
+        if (file.size() != offset || (offset + decodedLength) > MAX_FILE_SIZE)
+        {
+            file.close();
+            return Status(Status::Code::BAD_OUT_OF_RANGE);
+        }
+
+        const size_t written = file.write(reinterpret_cast<const uint8_t*>(decoded.data()), decodedLength);
+        mFileSize = file.size();
+        file.close();
+        if (written != decodedLength)
+        {
+            return Status(Status::Code::BAD_DEVICE_FAILURE);
+        }
+        return Status(Status::Code::GOOD);
+    }
+
+    const char* TrafficReplay::toString(const replay_stage_e stage) const
+    {
+        switch (stage)
+        {
+        case replay_stage_e::POLL:
+            return "poll";
+        case replay_stage_e::VARIABLE:
+            return "variable";
+        case replay_stage_e::PUBLISH_BUILD:
+            return "publish";
+        case replay_stage_e::MQTT_DELIVER:
+            return "deliver";
+        default:
+            return "unknown";
+        }
+    }
+
+
+    TrafficReplay trafficReplay;
+}
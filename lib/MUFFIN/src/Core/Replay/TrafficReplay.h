@@ -0,0 +1,153 @@
+/**
+ * @file TrafficReplay.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 설비로부터 수집한 데이터를 기록하고 실제 수집 파이프라인으로 재생하는 클래스를 선언합니다.
+ * @details 기록 중에는 Modbus RTU, Modbus TCP, Melsec 드라이버가 폴링을 마칠 때마다 수집 데이터
+ *          테이블을 직렬화하여 수집 시각과 함께 LittleFS의 파일에 프레임으로 추가합니다. 재생
+ *          중에는 드라이버가 전송 계층을 사용하지 않고 같은 드라이버의 프레임을 기록된 시각에
+ *          맞추어 수집 데이터 테이블에 적용하므로, 이후의 노드 갱신, 발행 태스크, CDO, MQTT 발행은
+ *          실제 설비가 없어도 그대로 동작합니다. 드라이버는 프로토콜과 서버 주소(RTU는 포트
+ *          번호)로 구분하므로 같은 설정을 적용한 장치에서 재생해야 합니다.
+ *
+ *          재생 중에는 프레임을 적용한 시점부터 다음 데이터 메시지를 발행하기까지의 지연 시간,
+ *          발행한 바이트 수, 단계별 처리 시간을 집계합니다. 기록 파일은 MQTT로 나누어 내보내거나
+ *          불러올 수 있으며, tool/replay_file.py로 합치거나 나누고 내용을 확인할 수 있습니다.
+ *
+ * @note 기록 파일의 형식은 ReplayFile.h에 정의되어 있으며, bench의 --replay 옵션으로 호스트에서도
+ *       같은 코드로 재생할 수 있습니다.
+ * @note 보고서의 통계는 직전 보고 이후 구간의 값입니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <ArduinoJson.h>
+#include <atomic>
+#include <string>
+#include <sys/_stdint.h>
+
+#include "Common/Metrics/Metrics.h"
+#include "Common/Status.h"
+#include "Common/Sync/Mutex.hpp"
+#include "Core/Replay/ReplayFile.h"
+#include "Protocol/Modbus/Include/PolledDataTable.h"
+#include "Protocol/MQTT/Include/TypeDefinitions.h"
+
+
+
+namespace muffin {
+
+    typedef enum class ReplayStageEnum
+        : uint8_t
+    {
+        POLL            = 0,
+        VARIABLE        = 1,
+        PUBLISH_BUILD   = 2,
+        MQTT_DELIVER    = 3,
+        TOP             = 4
+    } replay_stage_e;
+
+    typedef enum class ReplayModeEnum
+        : uint8_t
+    {
+        IDLE        = 0,
+        RECORDING   = 1,
+        REPLAYING   = 2
+    } replay_mode_e;
+
+    class TrafficReplay
+    {
+    public:
+        TrafficReplay();
+        virtual ~TrafficReplay() {}
+    public:
+        /**
+         * @brief 기존 기록 파일을 지우고 새로 기록을 시작합니다.
+         */
+        Status StartRecording();
+        /**
+         * @param speed 재생 배속이며, 0이면 기록 시각과 관계없이 폴링할 때마다 다음 프레임을 적용합니다.
+         * @param isLooping 모든 프레임을 적용한 다음 처음부터 다시 재생할지 여부
+         */
+        Status StartReplay(const uint8_t speed, const bool isLooping);
+        /**
+         * @brief 기록 또는 재생을 멈추며, 재생을 멈추면 드라이버는 다시 설비를 폴링합니다.
+         */
+        void Stop();
+        bool IsRecording() const { return mMode.load(std::memory_order_relaxed) == replay_mode_e::RECORDING; }
+        bool IsReplaying() const { return mMode.load(std::memory_order_relaxed) == replay_mode_e::REPLAYING; }
+    public:
+        /**
+         * @brief 기록 중이면 드라이버의 수집 데이터 테이블을 프레임으로 기록합니다.
+         * @param address 서버의 IPv4 주소 또는 RTU 포트 번호
+         */
+        void Record(const replay_source_e source, const uint32_t address, const uint16_t port, const modbus::PolledDataTable& table);
+        /**
+         * @brief 재생 시각이 된 드라이버의 다음 프레임을 수집 데이터 테이블에 적용합니다.
+         * @note 재생 시각이 되지 않았거나 프레임을 모두 적용한 경우에는 테이블을 바꾸지 않습니다.
+         */
+        Status Inject(const replay_source_e source, const uint32_t address, const uint16_t port, modbus::PolledDataTable* table);
+        void RecordStage(const replay_stage_e stage, const uint32_t micros)
+        {
+            if (IsReplaying() == true)
+            {
+                mStages[static_cast<uint8_t>(stage)].Record(micros);
+            }
+        }
+        void RecordPublish(const mqtt::topic_e topic, const size_t bytes);
+    public:
+        void Report(JsonObject output);
+        /**
+         * @brief 기록 파일의 offset 위치부터 최대 CHUNK_SIZE 바이트를 Base64로 인코딩하여 output에 씁니다.
+         */
+        Status Dump(const uint32_t offset, JsonObject output);
+        /**
+         * @brief Base64로 인코딩한 기록 파일의 일부를 offset 위치에 씁니다. offset이 0이면 기존
+         *        파일을 지우며, 그 밖에는 현재 파일 크기와 같아야 합니다.
+         */
+        Status Load(const uint32_t offset, const char* data);
+    public:
+        static const uint16_t CHUNK_SIZE = 768;
+    private:
+        void finishIfExhausted();
+        void writeHistogram(Histogram* histogram, JsonObject output) const;
+        const char* toString(const replay_stage_e stage) const;
+    private:
+        static const uint32_t MAX_FILE_SIZE     = 256 * 1024;
+        static const uint32_t MIN_FREE_BYTES    = 32 * 1024;
+        static const uint8_t  STAGE_COUNT       = static_cast<uint8_t>(replay_stage_e::TOP);
+        static const char*    FILE_PATH;
+    private:
+        std::atomic<replay_mode_e> mMode;
+        Mutex mMutex;
+        uint32_t mStartMillis;
+        uint32_t mReportMillis;
+        uint32_t mFileSize;
+        uint32_t mCapacity;
+        uint32_t mFrameCount;
+        uint32_t mDurationMillis;
+        uint8_t mSpeed;
+        bool mIsLooping;
+        bool mIsFinished;
+        uint32_t mLoopCount;
+        ReplayFile mReplayFile;
+    private:
+        std::atomic<uint32_t> mInjectedFrames;
+        std::atomic<uint32_t> mPublishedMessages;
+        std::atomic<uint32_t> mPublishedBytes;
+        std::atomic<uint32_t> mPendingMicros;
+        Histogram mLatency;
+        Histogram mStages[STAGE_COUNT];
+    };
+
+
+    extern TrafficReplay trafficReplay;
+}
@@ -21,6 +21,8 @@
 #include "Common/Assert.hpp"
 #include "Common/Status.h"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/Metrics.h"
+#include "Common/Metrics/TaskStats.h"
 #include "Common/Time/TimeUtils.h"
 
 #include "IM/Custom/Device/DeviceStatus.h"
@@ -57,6 +59,7 @@ namespace muffin {
 
             
             
+            const uint32_t cycleStartMicros = micros();
             for(auto& EthernetIp : EthernetIpVector)
             {
                 if (xSemaphoreTake(xSemaphoreEthernetIP, 2000)  != pdTRUE)
@@ -92,8 +95,15 @@ namespace muffin {
             }
             
 
-            g_DaqTaskSetFlag.set(static_cast<uint8_t>(set_task_flag_e::ETHERNET_IP_TASK));
-            vTaskDelay(s_PollingIntervalInMillis / portTICK_PERIOD_MS);
+            const uint32_t cycleMicros = micros() - cycleStartMicros;
+            metrics.Record(histogram_e::ETHERNET_IP_POLL_CYCLE, cycleMicros);
+            if (cycleMicros > s_PollingIntervalInMillis * 1000)
+            {
+                taskStats.RecordDeadlineMiss(task_name_e::ETHERNET_IP_TASK);
+            }
+
+            NotifyDaqPolled(set_task_flag_e::ETHERNET_IP_TASK);
+            taskStats.Delay(task_name_e::ETHERNET_IP_TASK, s_PollingIntervalInMillis);
         }
     }
 
@@ -59,6 +59,7 @@
 
 
 
+#include "ServiceSets/MqttServiceSet/MqttTaskService.h"
 #include "ServiceSets/NetworkServiceSet/InitializeNetworkService.h"
 
 muffin::mqtt::IMQTT* mqttClient = nullptr;
@@ -76,6 +77,8 @@ namespace muffin {
      */
     void ApplyJarvisTask()
     {
+        InvalidateRemoteWriteTable();
+
         for (auto& pair : *jarvis)
         {
             const jvs::cfg_key_e key = pair.first;
@@ -17,10 +17,13 @@
 #include <freertos/task.h>
 
 #include "Core/Core.h"
+#include "Core/Replay/TrafficReplay.h"
 #include "Core/Task/PubTask.h"
 #include "Common/Assert.hpp"
 #include "Common/Status.h"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/Metrics.h"
+#include "Common/Metrics/TaskStats.h"
 #include "Common/Time/TimeUtils.h"
 
 #include "IM/Custom/Device/DeviceStatus.h"
@@ -54,6 +57,7 @@ namespace muffin
                 continue;
             }
 
+            const uint32_t cycleStartMicros = micros();
             for(auto& melsec : MelsecVector)
             {
                 if (xSemaphoreTake(xSemaphoreMelsec, 2000)  != pdTRUE)
@@ -62,7 +66,11 @@ namespace muffin
                     continue;
                 }
 
-                if (!melsec.mMelsecClient->Connected())
+                /**
+                 * @note 기록한 데이터를 재생하는 중에는 서버에 연결하지 않습니다.
+                 */
+                const bool isReplaying = trafficReplay.IsReplaying();
+                if (isReplaying == false && !melsec.mMelsecClient->Connected())
                 {
                     if (!melsec.Connect())
                     {
@@ -81,12 +89,22 @@ namespace muffin
                     LOG_ERROR(logger, "FAILED TO POLL DATA: %s", ret.c_str());
                 }
 
-                melsec.mMelsecClient->Close();
+                if (isReplaying == false)
+                {
+                    melsec.mMelsecClient->Close();
+                }
                 xSemaphoreGive(xSemaphoreMelsec);
             }
 
-            g_DaqTaskSetFlag.set(static_cast<uint8_t>(set_task_flag_e::MELSEC_TASK));
-            vTaskDelay(s_PollingIntervalInMillis / portTICK_PERIOD_MS);
+            const uint32_t cycleMicros = micros() - cycleStartMicros;
+            metrics.Record(histogram_e::MELSEC_POLL_CYCLE, cycleMicros);
+            if (cycleMicros > s_PollingIntervalInMillis * 1000)
+            {
+                taskStats.RecordDeadlineMiss(task_name_e::MELSEC_TASK);
+            }
+
+            NotifyDaqPolled(set_task_flag_e::MELSEC_TASK);
+            taskStats.Delay(task_name_e::MELSEC_TASK, s_PollingIntervalInMillis);
         }
     }
 
@@ -17,11 +17,15 @@
 #include <freertos/task.h>
 
 #include "Core/Core.h"
+#include "Core/Replay/TrafficReplay.h"
 #include "Core/Task/PubTask.h"
 #include "Common/Assert.hpp"
 #include "Common/Status.h"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/Metrics.h"
+#include "Common/Metrics/TaskStats.h"
 #include "Common/Time/TimeUtils.h"
+#include "Common/Trace/Tracer.h"
 
 #include "Protocol/Modbus/ModbusRTU.h"
 #include "Protocol/Modbus/ModbusTCP.h"
@@ -63,6 +67,7 @@ namespace muffin {
                 continue;
             }
             
+            const uint32_t cycleStartMicros = micros();
             for(auto& modbusRTU : ModbusRtuVector)
             {
 
@@ -70,19 +75,28 @@ namespace muffin {
                 Status ret = modbusRTU.Poll();
                 if (ret != Status::Code::GOOD)
                 {
+                    metrics.Increment(counter_e::MODBUS_POLL_FAILURE);
                     LOG_ERROR(logger, "FAILED TO POLL DATA: %s", ret.c_str());
                 }
             #else
                 Status ret = modbusRTU.PollTemp();
                 if (ret != Status::Code::GOOD)
                 {
+                    metrics.Increment(counter_e::MODBUS_POLL_FAILURE);
                     LOG_ERROR(logger, "FAILED TO POLL DATA: %s", ret.c_str());
                 }
             #endif
             }
 
-            g_DaqTaskSetFlag.set(static_cast<uint8_t>(set_task_flag_e::MODBUS_RTU_TASK));
-            vTaskDelay(s_PollingIntervalInMillis / portTICK_PERIOD_MS);
+            const uint32_t cycleMicros = micros() - cycleStartMicros;
+            metrics.Record(histogram_e::MODBUS_RTU_POLL_CYCLE, cycleMicros);
+            if (cycleMicros > s_PollingIntervalInMillis * 1000)
+            {
+                taskStats.RecordDeadlineMiss(task_name_e::MODBUS_RTU_TASK);
+            }
+
+            NotifyDaqPolled(set_task_flag_e::MODBUS_RTU_TASK);
+            taskStats.Delay(task_name_e::MODBUS_RTU_TASK, s_PollingIntervalInMillis);
         }
     }
 
@@ -183,20 +197,30 @@ namespace muffin {
                 continue;
             }
             
+            const uint32_t cycleStartMicros = micros();
             for(auto& modbusTCP : ModbusTcpVector)
             {
+                tracer.Begin(trace_event_e::MODBUS_TCP_LOCK_WAIT);
                 if (xSemaphoreTake(xSemaphoreModbusTCP, 2000)  != pdTRUE)
                 {
+                    tracer.End(trace_event_e::MODBUS_TCP_LOCK_WAIT);
+                    tracer.Fault(trace_event_e::LOCK_TIMEOUT);
                     LOG_WARNING(logger, "[MODBUS TCP] THE READ MODULE IS BUSY. TRY LATER.");
                     continue;
                 }
+                tracer.End(trace_event_e::MODBUS_TCP_LOCK_WAIT);
+                tracer.Begin(trace_event_e::MODBUS_TCP_LOCK);
 
-                if (!modbusTCP.mModbusTCPClient->connected()) 
+                /**
+                 * @note 기록한 데이터를 재생하는 중에는 서버에 연결하지 않습니다.
+                 */
+                if (trafficReplay.IsReplaying() == false && !modbusTCP.mModbusTCPClient->connected()) 
                 {
                     if (modbusTCP.mModbusTCPClient->begin(modbusTCP.GetServerIP(), modbusTCP.GetServerPort()) != 1) 
                     {
                         LOG_ERROR(logger,"Modbus TCP Client failed to connect!, serverIP : %s, serverPort: %d", modbusTCP.GetServerIP().toString().c_str(), modbusTCP.GetServerPort());
                         modbusTCP.SetTimeoutError();
+                        tracer.End(trace_event_e::MODBUS_TCP_LOCK);
                         xSemaphoreGive(xSemaphoreModbusTCP);
                         continue;
                     } 
@@ -209,47 +233,71 @@ namespace muffin {
                 Status ret = modbusTCP.Poll();
                 if (ret != Status::Code::GOOD)
                 {
+                    metrics.Increment(counter_e::MODBUS_POLL_FAILURE);
                     LOG_ERROR(logger, "FAILED TO POLL DATA: %s", ret.c_str());
                 }
 
+                tracer.End(trace_event_e::MODBUS_TCP_LOCK);
                 xSemaphoreGive(xSemaphoreModbusTCP);
 
             }
         #if defined(MT11)
             for(auto& modbusTCP : ModbusTcpVectorDynamic)
             {
+                tracer.Begin(trace_event_e::MODBUS_TCP_LOCK_WAIT);
                 if (xSemaphoreTake(xSemaphoreModbusTCP, 2000)  != pdTRUE)
                 {
+                    tracer.End(trace_event_e::MODBUS_TCP_LOCK_WAIT);
+                    tracer.Fault(trace_event_e::LOCK_TIMEOUT);
                     LOG_WARNING(logger, "[MODBUS TCP] THE READ MODULE IS BUSY. TRY LATER.");
                     continue;
                 }
+                tracer.End(trace_event_e::MODBUS_TCP_LOCK_WAIT);
+                tracer.Begin(trace_event_e::MODBUS_TCP_LOCK);
 
-                if (modbusTCP.mModbusTCPClient->begin(modbusTCP.GetServerIP(), modbusTCP.GetServerPort()) != 1) 
-                {
-                    LOG_ERROR(logger,"Modbus TCP Client failed to connect!, serverIP : %s, serverPort: %d", modbusTCP.GetServerIP().toString().c_str(), modbusTCP.GetServerPort());
-                    modbusTCP.SetTimeoutError();
-                    
-                    xSemaphoreGive(xSemaphoreModbusTCP);
-                    continue;
-                }
-                else
+                const bool isReplaying = trafficReplay.IsReplaying();
+                if (isReplaying == false)
                 {
-                    LOG_DEBUG(logger,"Modbus TCP Client connected");
+                    if (modbusTCP.mModbusTCPClient->begin(modbusTCP.GetServerIP(), modbusTCP.GetServerPort()) != 1) 
+                    {
+                        LOG_ERROR(logger,"Modbus TCP Client failed to connect!, serverIP : %s, serverPort: %d", modbusTCP.GetServerIP().toString().c_str(), modbusTCP.GetServerPort());
+                        modbusTCP.SetTimeoutError();
+                        
+                        tracer.End(trace_event_e::MODBUS_TCP_LOCK);
+                        xSemaphoreGive(xSemaphoreModbusTCP);
+                        continue;
+                    }
+                    else
+                    {
+                        LOG_DEBUG(logger,"Modbus TCP Client connected");
+                    }
                 }
 
                 Status ret = modbusTCP.Poll();
                 if (ret != Status::Code::GOOD)
                 {
+                    metrics.Increment(counter_e::MODBUS_POLL_FAILURE);
                     LOG_ERROR(logger, "FAILED TO POLL DATA: %s", ret.c_str());
                 }
 
-                modbusTCP.mModbusTCPClient->end();
+                if (isReplaying == false)
+                {
+                    modbusTCP.mModbusTCPClient->end();
+                }
                 
+                tracer.End(trace_event_e::MODBUS_TCP_LOCK);
                 xSemaphoreGive(xSemaphoreModbusTCP);
             }
         #endif
-            g_DaqTaskSetFlag.set(static_cast<uint8_t>(set_task_flag_e::MODBUS_TCP_TASK));
-            vTaskDelay(s_PollingIntervalInMillis / portTICK_PERIOD_MS);   
+            const uint32_t cycleMicros = micros() - cycleStartMicros;
+            metrics.Record(histogram_e::MODBUS_TCP_POLL_CYCLE, cycleMicros);
+            if (cycleMicros > s_PollingIntervalInMillis * 1000)
+            {
+                taskStats.RecordDeadlineMiss(task_name_e::MODBUS_TCP_TASK);
+            }
+
+            NotifyDaqPolled(set_task_flag_e::MODBUS_TCP_TASK);
+            taskStats.Delay(task_name_e::MODBUS_TCP_TASK, s_PollingIntervalInMillis);
         }
     }
 
@@ -18,29 +18,53 @@
 #include "esp_heap_caps.h"
 #include <esp32-hal.h>
 
+#include "DataFormat/JSON/DaqBatchWriter.h"
 #include "DataFormat/JSON/JSON.h"
+#include "DataFormat/SparkplugB/SparkplugB.h"
+#include "Common/Time/TimerWheel.h"
 #include "Common/Time/TimeUtils.h"
 #include "Common/Assert.hpp"
 #include "Common/Status.h"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/TaskStats.h"
 #include "Common/PSRAM.hpp"
 #include "Core/Core.h"
+#include "Core/Replay/TrafficReplay.h"
 #include "JARVIS/Config/Operation/Operation.h"
 #include "PubTask.h"
 #include "Protocol/MQTT/CDO.h"
+#include "Protocol/MQTT/IMQTT.h"
+#include "Protocol/MQTT/OutboundLog.h"
+#include "Protocol/MQTT/Include/BrokerInfo.h"
 #include "IM/Node/Node.h"
 #include "IM/Node/NodeStore.h"
 #include "IM/Custom/Device/DeviceStatus.h"
 #include "IM/Custom/Constants.h"
+#include "ServiceSets/MqttServiceSet/StartMqttClientService.h"
 
 
 namespace muffin {
 
     TaskHandle_t xTaskMonitorHandle = NULL;
 
+    /**
+     * @note 마감 시각이 없더라도 태스크 상태 보고를 위해 주기적으로 깨어나는 최대 대기 시간입니다.
+     */
+    constexpr uint32_t MAX_WAIT_MILLIS = 1000;
+
     bitset<static_cast<uint8_t>(4)> g_DaqTaskEnableFlag;
     bitset<static_cast<uint8_t>(4)> g_DaqTaskSetFlag;
 
+    void NotifyDaqPolled(set_task_flag_e task)
+    {
+        g_DaqTaskSetFlag.set(static_cast<uint8_t>(task));
+
+        if (xTaskMonitorHandle != NULL)
+        {
+            xTaskNotify(xTaskMonitorHandle, (1UL << static_cast<uint8_t>(task)), eSetBits);
+        }
+    }
+
     bool WaitForFlagWithTimeout(set_task_flag_e task)
     {
         if (!g_DaqTaskEnableFlag.test(static_cast<uint8_t>(task))) 
@@ -57,6 +81,109 @@ namespace muffin {
     }
     
 
+    Status storeDaqBatch(DaqBatchWriter& writer, const mqtt::payload_format_e format)
+    {
+        if (format == mqtt::payload_format_e::SPARKPLUG_B)
+        {
+            LOG_DEBUG(logger, "Sparkplug NDATA: %u metrics", sparkplug.GetCount());
+            mqtt::Message message(mqtt::topic_e::SPARKPLUG_NDATA, sparkplug.Finish());
+            return mqtt::cdo.Store(std::move(message));
+        }
+
+        const size_t length = writer.Finish();
+        LOG_DEBUG(logger, "DAQ batch: %u nodes, %u Bytes", writer.GetCount(), length);
+
+        mqtt::Message message(mqtt::topic_e::DAQ_INPUT, std::string(writer.GetBuffer(), length));
+        return mqtt::cdo.Store(std::move(message));
+    }
+
+    void beginDaqBatch(DaqBatchWriter& writer, const mqtt::payload_format_e format, const uint64_t sourceTimestamp)
+    {
+        if (format == mqtt::payload_format_e::SPARKPLUG_B)
+        {
+            sparkplug.Begin(sourceTimestamp);
+        }
+        else
+        {
+            writer.Begin(sourceTimestamp);
+        }
+    }
+
+    bool isDaqBatchEmpty(DaqBatchWriter& writer, const mqtt::payload_format_e format)
+    {
+        return format == mqtt::payload_format_e::SPARKPLUG_B ? sparkplug.IsEmpty() : writer.IsEmpty();
+    }
+
+    /**
+     * @return GOOD이 아닌 경우 가득 찬 배치를 CDO에 저장하지 못했거나 데이터를 배치에 추가하지 못한 경우
+     */
+    Status appendDaqDatum(DaqBatchWriter& writer, const mqtt::payload_format_e format, const json_datum_t& datum, const uint64_t sourceTimestamp)
+    {
+        auto append = [&]()
+        {
+            return format == mqtt::payload_format_e::SPARKPLUG_B ? sparkplug.Append(datum) : writer.Append(datum);
+        };
+
+        if (append() == true)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        Status ret(Status::Code::GOOD);
+        if (isDaqBatchEmpty(writer, format) == false)
+        {
+            ret = storeDaqBatch(writer, format);
+            beginDaqBatch(writer, format, sourceTimestamp);
+            if (append() == true)
+            {
+                return ret;
+            }
+        }
+
+        LOG_ERROR(logger, "NODE DATA EXCEEDS THE MAXIMUM PAYLOAD SIZE: %s", datum.NodeID);
+        return Status(Status::Code::BAD_ENCODING_LIMITS_EXCEEDED);
+    }
+
+    template <typename IntervalMap, typename NodeVector>
+    void publishSparkplugBirth(const IntervalMap& intervalNodeMap, const NodeVector& eventNodeVector, const uint64_t sourceTimestamp)
+    {
+        std::vector<json_datum_t> metrics;
+
+        auto collect = [&](im::Node* node)
+        {
+            if (node->GetTopic() == mqtt::topic_e::ALARM ||
+                node->GetTopic() == mqtt::topic_e::ERROR ||
+                node->GetTopic() == mqtt::topic_e::DAQ_PARAM)
+            {
+                return;
+            }
+
+            std::pair<bool, json_datum_t> ret = node->VariableNode.CreateDaqStruct();
+            if (ret.first != true)
+            {
+                ret.second.Value = "MFM_NULL";
+            }
+            metrics.emplace_back(std::move(ret.second));
+        };
+
+        for (const auto& pair : intervalNodeMap)
+        {
+            for (auto& node : pair.second)
+            {
+                collect(node);
+            }
+        }
+
+        for (auto& node : eventNodeVector)
+        {
+            collect(node);
+        }
+
+        mqtt::Message message(mqtt::topic_e::SPARKPLUG_NBIRTH, sparkplug.EncodeBirth(metrics, sourceTimestamp));
+        mqtt::cdo.Store(std::move(message));
+        LOG_INFO(logger, "Sparkplug NBIRTH with %u metrics", metrics.size());
+    }
+
     void MSGTask(void* pvParameter)
     {
         const size_t batchSize = 4 * 1024;
@@ -87,6 +214,7 @@ namespace muffin {
             return;
         }
         memset(batchPayload, 0, batchSize);
+        DaqBatchWriter batchWriter(batchPayload, batchSize);
         
         im::NodeStore& nodeStore = im::NodeStore::GetInstance();
         uint16_t defaultInterval = jvs::config::operation.GetIntervalServer().second;
@@ -112,14 +240,42 @@ namespace muffin {
     
         uint32_t statusReportMillis = millis(); 
         bool initFlag = true;
-        std::map<uint16_t, uint64_t> TimeTrackerMap;
+        TimerWheel timerWheel;
+        std::vector<uint16_t> timerIntervals;
+        std::vector<uint64_t> timerDeadlines;
+        std::vector<uint8_t> expiredTimers;
+        std::map<uint16_t, uint16_t> KeyframeCounterMap;
+        std::map<uint16_t, std::vector<uint32_t>> PublishedVersionMap;
+        bool isResyncRequired = false;
+        bool isPublishDeferred = false;
+        uint32_t droppedSegmentCount = mqtt::outboundLog.GetDroppedSegmentCount();
         
         bool isFirstIntervalLoop = true;
         uint64_t baseIntervalTimestamp = 0;
 
         while (true)
         {
-            vTaskDelay(10 / portTICK_PERIOD_MS);
+            /**
+             * @note 다음 발행 주기의 마감 시각까지 대기하며, 그 전에 수집 태스크가 새로운 데이터를
+             *       수집했음을 알리면 즉시 깨어납니다.
+             */
+            uint32_t waitMillis = MAX_WAIT_MILLIS;
+            if (isFirstIntervalLoop == false)
+            {
+                const uint64_t nextEventMillis = timerWheel.RetrieveNextEventMillis();
+                const uint64_t nowMillis = GetTimestampInMillis();
+                if (nextEventMillis <= nowMillis)
+                {
+                    waitMillis = 0;
+                }
+                else if (nextEventMillis - nowMillis < MAX_WAIT_MILLIS)
+                {
+                    waitMillis = static_cast<uint32_t>(nextEventMillis - nowMillis);
+                }
+            }
+
+            uint32_t notifiedBits = 0;
+            xTaskNotifyWait(0, UINT32_MAX, &notifiedBits, pdMS_TO_TICKS(waitMillis));
             // uint32_t StartMillis = millis();
 
             bool isSuccessPolling = true;
@@ -173,15 +329,19 @@ namespace muffin {
                 }
             }
 
-        #if defined(MT11)
-            psram::vector<json_datum_t> nodeVector;
-            psram::vector<json_datum_t> nodeArrayVector;
-        #else
-            std::vector<json_datum_t> nodeVector;
-            std::vector<json_datum_t> nodeArrayVector;
-        #endif
-            nodeVector.reserve(nodeStore.GetCyclicalNode().size() + eventNodeVector.size());
-            nodeArrayVector.reserve(nodeStore.GetArrayNodeCount());
+            const uint32_t buildStartMicros = micros();
+            const mqtt::payload_format_e payloadFormat = brokerInfo.GetPayloadFormat();
+            if (mqttClient != nullptr)
+            {
+                batchWriter.SetCapacity(mqttClient->GetMaxPayloadSize(mqtt::topic_e::DAQ_INPUT));
+                sparkplug.SetCapacity(mqttClient->GetMaxPayloadSize(mqtt::topic_e::SPARKPLUG_NDATA));
+            }
+
+            if (payloadFormat == mqtt::payload_format_e::SPARKPLUG_B && sparkplug.IsBirthRequired() == true)
+            {
+                publishSparkplugBirth(IntervalNodeMap, eventNodeVector, sourceTimestamp);
+            }
+            beginDaqBatch(batchWriter, payloadFormat, sourceTimestamp);
 
             if (isSuccessPolling)
             {
@@ -211,19 +371,11 @@ namespace muffin {
                         char payload[size] = {'\0'};
                         json.Serialize(ret.second, size, payload);
                         mqtt::Message message(ret.second.Topic, payload);
-                        mqtt::cdo.Store(message);
+                        mqtt::cdo.Store(std::move(message));
                     }
                     else
                     {
-                        if (node->IsArrayNode() == true)
-                        {
-                            nodeArrayVector.emplace_back(ret.second);
-                        }
-                        else
-                        {
-                            nodeVector.emplace_back(ret.second);
-                        }
-                        
+                        appendDaqDatum(batchWriter, payloadFormat, ret.second, sourceTimestamp);
                     }
                 }
             }
@@ -232,105 +384,148 @@ namespace muffin {
 
             if (isFirstIntervalLoop) 
             {
+                // 첫 루프에서는 모든 interval의 타임스탬프를 동일 기준으로 설정
                 baseIntervalTimestamp = now;
                 isFirstIntervalLoop = false;
-            }
 
-            for (const auto& pair : IntervalNodeMap) 
-            {
-                uint16_t interval = pair.first;
-                const auto& nodeVec = pair.second;
-                uint64_t intervalMillis = static_cast<uint64_t>(interval) * SECOND_IN_MILLIS;
-
-                // 첫 루프에서는 모든 interval의 타임스탬프를 동일 기준으로 설정
-                if (TimeTrackerMap.find(interval) == TimeTrackerMap.end()) 
+                timerWheel.Init(baseIntervalTimestamp);
+                for (const auto& pair : IntervalNodeMap)
                 {
-                    TimeTrackerMap[interval] = baseIntervalTimestamp;
-                }
-
-                if ((int64_t)(now - TimeTrackerMap[interval]) >= 0)
-                {
-                    TimeTrackerMap[interval] = baseIntervalTimestamp + (((now - baseIntervalTimestamp) / intervalMillis) + 1) * intervalMillis;
-
-                    LOG_DEBUG(logger, "Interval: %u, Node Count: %u", interval, nodeVec.size());
-                    LOG_DEBUG(logger, "TimeTrackerMap[%u]: %llu", interval, TimeTrackerMap[interval]);
-
-                    for (auto& node : nodeVec) 
+                    if (timerIntervals.size() == TimerWheel::MAX_TIMER_COUNT)
                     {
-                        std::pair<bool, json_datum_t> ret = node->VariableNode.CreateDaqStruct();
-                        if (ret.first != true) 
-                        {
-                            ret.second.Value = "MFM_NULL";
-                        }
-
-                        if (node->IsArrayNode() == true) 
-                        {
-                            nodeArrayVector.emplace_back(ret.second);
-                        } 
-                        else 
-                        {
-                            nodeVector.emplace_back(ret.second);
-                        }
+                        LOG_ERROR(logger, "TOO MANY PUBLISH INTERVALS: %u IS IGNORED", pair.first);
+                        continue;
                     }
+
+                    timerWheel.Schedule(static_cast<uint8_t>(timerIntervals.size()), baseIntervalTimestamp);
+                    timerIntervals.emplace_back(pair.first);
+                    timerDeadlines.emplace_back(baseIntervalTimestamp);
                 }
             }
 
-            if (!nodeVector.empty())
+            expiredTimers.clear();
+            timerWheel.Advance(now, &expiredTimers);
+
+            /**
+             * @note CDO 사용량이 높은 수위를 넘으면 주기 데이터를 배치에 추가하지 않습니다. 발행한 버전을
+             *       갱신하지 않으므로 미루는 동안 바뀐 노드는 수위가 내려간 뒤 최신 값 하나로 병합되어
+             *       발행됩니다. 알람과 같은 우선순위 메시지는 영향을 받지 않습니다.
+             */
+            const bool isBackpressured = mqtt::cdo.GetPressure() != mqtt::pressure_e::NORMAL;
+            if (isBackpressured != isPublishDeferred && expiredTimers.empty() == false)
             {
-                JSON json;
-                const size_t TESTSIZE = 150;
-                LOG_DEBUG(logger,"nodeVector.size() : %u",nodeVector.size());
-                for (size_t i = 0; i < nodeVector.size(); i += TESTSIZE) 
+                isPublishDeferred = isBackpressured;
+                if (isPublishDeferred == true)
+                {
+                    LOG_WARNING(logger, "CDO IS UNDER PRESSURE: DEFERRING INTERVAL DATA");
+                }
+                else
                 {
-                    memset(batchPayload, 0, batchSize);
-                    size_t end = std::min(i + TESTSIZE, nodeVector.size());
-                    std::vector<json_datum_t> batch(nodeVector.begin() + i, nodeVector.begin() + end);
-                    json.Serialize(batch, batchSize, sourceTimestamp, batchPayload);
-                    mqtt::Message message(mqtt::topic_e::DAQ_INPUT, batchPayload);
-                    mqtt::cdo.Store(message);
+                    LOG_INFO(logger, "CDO pressure relieved: resuming interval data");
                 }
             }
-            
 
-            if (!nodeArrayVector.empty())
+            /**
+             * @note 플래시 기록이 가득 차 세그먼트를 버렸다면 CDO에 전달한 배치도 유실되었을 수
+             *       있으므로 모든 발행 주기의 다음 발행을 키프레임으로 만듭니다.
+             */
+            const uint32_t currentDroppedSegmentCount = mqtt::outboundLog.GetDroppedSegmentCount();
+            if (currentDroppedSegmentCount != droppedSegmentCount)
+            {
+                LOG_WARNING(logger, "OUTBOUND LOG DROPPED MESSAGES: NEXT INTERVAL WILL BE A KEYFRAME");
+                droppedSegmentCount = currentDroppedSegmentCount;
+                KeyframeCounterMap.clear();
+            }
+
+            for (const auto& timerID : expiredTimers)
             {
-                JSON json;
-                const size_t MAX_ARRAY_TOTAL = 150;
-                LOG_DEBUG(logger, "nodeArrayVector.size() : %u", nodeArrayVector.size());
+                const uint16_t interval = timerIntervals[timerID];
+                const auto& nodeVec = IntervalNodeMap[interval];
+                const uint64_t intervalMillis = static_cast<uint64_t>(interval) * SECOND_IN_MILLIS;
+                const uint64_t nextDeadline = baseIntervalTimestamp + (((now - baseIntervalTimestamp) / intervalMillis) + 1) * intervalMillis;
+                timerWheel.Schedule(timerID, nextDeadline);
+
+                /**
+                 * @note 마감 시각보다 한 주기 이상 늦게 처리한 경우에는 발행 주기를 건너뛴 것으로 봅니다.
+                 */
+                const uint64_t latenessMillis = now - timerDeadlines[timerID];
+                taskStats.RecordActivation(task_name_e::PUBLISH_MSG_TASK, static_cast<uint32_t>(latenessMillis * 1000));
+                if (latenessMillis >= intervalMillis)
+                {
+                    taskStats.RecordDeadlineMiss(task_name_e::PUBLISH_MSG_TASK);
+                }
+                timerDeadlines[timerID] = nextDeadline;
+
+                LOG_DEBUG(logger, "Interval: %u, Node Count: %u", interval, nodeVec.size());
+                LOG_DEBUG(logger, "Next deadline[%u]: %llu", interval, nextDeadline);
+
+                if (isBackpressured == true)
+                {
+                    continue;
+                }
+
+                /**
+                 * @note 델타 모드에서는 마지막으로 CDO에 전달한 이후 버전이 바뀐 노드만 발행하며,
+                 *       수신 측의 재동기화를 위해 키프레임 주기마다 전체 노드를 발행합니다.
+                 *       버전은 배치에 추가할 때 발행한 것으로 기록하고 브로커의 확인 응답과는 연결하지
+                 *       않습니다. CDO 저장에 실패하거나 플래시 기록이 세그먼트를 버린 경우에는 다음
+                 *       주기를 키프레임으로 만들고, 그 밖에 전송 중 유실된 값은 키프레임에서 복구합니다.
+                 *       키프레임 주기는 operation의 "intvKey"와 "intvKeyCust"로 설정합니다.
+                 */
+                const uint16_t keyframeInterval = jvs::config::operation.GetKeyframeInterval(interval).second;
+                uint16_t& keyframeCounter = KeyframeCounterMap[interval];
+                std::vector<uint32_t>& publishedVersions = PublishedVersionMap[interval];
+                if (publishedVersions.size() != nodeVec.size())
+                {
+                    publishedVersions.assign(nodeVec.size(), 0);
+                    keyframeCounter = 0;
+                }
 
-                std::vector<json_datum_t> currentBatch;
-                size_t currentArraySum = 0;
+                const bool isKeyframe = (keyframeInterval == 0) || (keyframeCounter == 0);
+                keyframeCounter = (keyframeInterval == 0) ? 0 : (keyframeCounter + 1) % keyframeInterval;
 
-                for (const auto& node : nodeArrayVector)
+                for (size_t i = 0; i < nodeVec.size(); ++i)
                 {
-                    size_t arraySize = node.ArrayValue.size();
+                    im::Node* node = nodeVec[i];
+                    const uint32_t version = node->VariableNode.RetrieveVersion();
+                    if (isKeyframe == false && publishedVersions[i] == version)
+                    {
+                        continue;
+                    }
 
-                    if (currentArraySum + arraySize > MAX_ARRAY_TOTAL)
+                    std::pair<bool, json_datum_t> ret = node->VariableNode.CreateDaqStruct();
+                    if (ret.first != true) 
                     {
-                        // 배치 전송
-                        memset(batchPayload, 0, batchSize);
-                        json.Serialize(currentBatch, batchSize, sourceTimestamp, batchPayload);
-                        mqtt::Message message(mqtt::topic_e::DAQ_INPUT, batchPayload);
-                        mqtt::cdo.Store(message);
-
-                        // 다음 배치를 위한 초기화
-                        currentBatch.clear();
-                        currentArraySum = 0;
+                        ret.second.Value = "MFM_NULL";
                     }
 
-                    currentBatch.emplace_back(node);
-                    currentArraySum += arraySize;
+                    const Status retAppend = appendDaqDatum(batchWriter, payloadFormat, ret.second, sourceTimestamp);
+                    if (retAppend == Status::Code::GOOD)
+                    {
+                        publishedVersions[i] = version;
+                    }
+                    else if (retAppend != Status::Code::BAD_ENCODING_LIMITS_EXCEEDED)
+                    {
+                        isResyncRequired = true;
+                    }
                 }
+            }
 
-                // 남은 마지막 배치 처리
-                if (!currentBatch.empty())
+            if (isDaqBatchEmpty(batchWriter, payloadFormat) == false)
+            {
+                if (storeDaqBatch(batchWriter, payloadFormat) != Status::Code::GOOD)
                 {
-                    memset(batchPayload, 0, batchSize);
-                    json.Serialize(currentBatch, batchSize, sourceTimestamp, batchPayload);
-                    mqtt::Message message(mqtt::topic_e::DAQ_INPUT, batchPayload);
-                    mqtt::cdo.Store(message);
-                }           
+                    isResyncRequired = true;
+                }
+            }
+
+            if (isResyncRequired == true)
+            {
+                LOG_WARNING(logger, "FAILED TO STORE DAQ BATCH: NEXT INTERVAL WILL BE A KEYFRAME");
+                KeyframeCounterMap.clear();
+                isResyncRequired = false;
             }
+            trafficReplay.RecordStage(replay_stage_e::PUBLISH_BUILD, micros() - buildStartMicros);
             
             // LOG_DEBUG(logger, "[MSGTask] Loop Time: %lu ms", millis() - StartMillis);
         }
@@ -33,6 +33,10 @@ namespace muffin {
     extern bitset<static_cast<uint8_t>(4)> g_DaqTaskEnableFlag;
     extern bitset<static_cast<uint8_t>(4)> g_DaqTaskSetFlag;
 
+    /**
+     * @brief 수집 태스크가 한 주기의 수집을 마친 후 호출하여 발행 태스크를 깨웁니다.
+     */
+    void NotifyDaqPolled(set_task_flag_e task);
     void StartTaskMSG();
     void StopMSGTask();
     bool WaitForFlagWithTimeout(set_task_flag_e task);
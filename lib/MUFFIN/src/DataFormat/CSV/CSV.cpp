@@ -36,12 +36,12 @@ namespace muffin {
         Status ret = parse(input, COLUMN_COUNT, COLUMN_WIDTH, reinterpret_cast<char**>(buffer));
         if (ret == Status::Code::BAD_NO_DATA)
         {
-            LOG_ERROR(logger, ret.c_str());
+            LOG_ERROR(logger, "%s", ret.c_str());
             return ret;
         }
         else if (ret == Status::Code::UNCERTAIN_DATA_SUBNORMAL)
         {
-            LOG_WARNING(logger, ret.c_str());
+            LOG_WARNING(logger, "%s", ret.c_str());
         }
         
         output->PanicResetCount   = Convert.ToInt8(buffer[0]);
@@ -55,7 +55,7 @@ namespace muffin {
             (output->ReconfigCode    < -1 && 5 < output->ReconfigCode))
         {
             ret = Status::Code::BAD_DATA_LOST;
-            LOG_ERROR(logger, ret.c_str());
+            LOG_ERROR(logger, "%s", ret.c_str());
             return ret;
         }
         
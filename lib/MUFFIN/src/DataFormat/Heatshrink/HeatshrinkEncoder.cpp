@@ -0,0 +1,215 @@
+/**
+ * @file HeatshrinkEncoder.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief heatshrink 비트스트림 형식으로 LZSS 압축을 수행하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <new>
+#include <string.h>
+
+#include "Common/Assert.hpp"
+#include "HeatshrinkEncoder.h"
+
+#if defined(MT11)
+    #include "Common/PSRAM.hpp"
+#endif
+
+
+
+namespace muffin {
+
+    HeatshrinkEncoder::HeatshrinkEncoder()
+        : mHead(nullptr)
+        , mPrevious(nullptr)
+        , mBitBuffer(0)
+        , mBitCount(0)
+    {
+    #if defined(MT11)
+        mHead     = static_cast<uint32_t*>(psram::allocate(sizeof(uint32_t) * HASH_SIZE));
+        mPrevious = static_cast<uint16_t*>(psram::allocate(sizeof(uint16_t) * WINDOW_SIZE));
+    #else
+        mHead     = new(std::nothrow) uint32_t[HASH_SIZE];
+        mPrevious = new(std::nothrow) uint16_t[WINDOW_SIZE];
+    #endif
+    }
+
+    HeatshrinkEncoder::~HeatshrinkEncoder()
+    {
+    #if defined(MT11)
+        psram::deallocate(mPrevious);
+        psram::deallocate(mHead);
+    #else
+        delete[] mPrevious;
+        delete[] mHead;
+    #endif
+    }
+
+    bool HeatshrinkEncoder::IsInitialized() const
+    {
+        return mHead != nullptr && mPrevious != nullptr;
+    }
+
+    uint8_t HeatshrinkEncoder::GetWindowBits() const
+    {
+        return WINDOW_BITS;
+    }
+
+    uint8_t HeatshrinkEncoder::GetLookaheadBits() const
+    {
+        return LOOKAHEAD_BITS;
+    }
+
+    bool HeatshrinkEncoder::Encode(const uint8_t* input, const size_t length, std::string* output)
+    {
+        ASSERT((input != nullptr), "INPUT PARAMETER <const uint8_t* input> CANNOT BE A NULL POINTER");
+        ASSERT((output != nullptr), "OUTPUT PARAMETER <std::string* output> CANNOT BE A NULL POINTER");
+
+        if (IsInitialized() == false)
+        {
+            return false;
+        }
+
+        output->clear();
+        output->reserve(length);
+        memset(mHead, 0, sizeof(uint32_t) * HASH_SIZE);
+        memset(mPrevious, 0, sizeof(uint16_t) * WINDOW_SIZE);
+        mBitBuffer = 0;
+        mBitCount  = 0;
+
+        /**
+         * @note 역참조 토큰의 비트 수보다 짧은 일치는 리터럴로 보내는 편이 작으므로
+         *       heatshrink 인코더와 동일한 손익분기점을 사용합니다.
+         */
+        const size_t breakEven = (1 + WINDOW_BITS + LOOKAHEAD_BITS) / 8;
+
+        size_t position = 0;
+        while (position < length)
+        {
+            size_t bestLength   = 0;
+            size_t bestDistance = 0;
+
+            if (position + MIN_MATCH_LENGTH <= length)
+            {
+                const size_t maxLength = (length - position) < LOOKAHEAD_SIZE ? (length - position) : LOOKAHEAD_SIZE;
+                uint32_t candidate = mHead[hash(input + position)];
+
+                for (uint8_t depth = 0; candidate != 0 && depth < MAX_CHAIN_DEPTH; ++depth)
+                {
+                    const size_t matchPosition = candidate - 1;
+                    const size_t distance = position - matchPosition;
+                    if (distance > WINDOW_SIZE)
+                    {
+                        break;
+                    }
+
+                    size_t matchLength = 0;
+                    while (matchLength < maxLength && input[matchPosition + matchLength] == input[position + matchLength])
+                    {
+                        ++matchLength;
+                    }
+
+                    if (matchLength > bestLength)
+                    {
+                        bestLength   = matchLength;
+                        bestDistance = distance;
+                        if (matchLength == maxLength)
+                        {
+                            break;
+                        }
+                    }
+
+                    const uint16_t previous = mPrevious[matchPosition & (WINDOW_SIZE - 1)];
+                    if (previous == 0 || previous > matchPosition)
+                    {
+                        break;
+                    }
+                    candidate = static_cast<uint32_t>(matchPosition - previous + 1);
+                }
+            }
+
+            if (bestLength > breakEven)
+            {
+                writeBits(1, 0x00, output);
+                writeBits(WINDOW_BITS, static_cast<uint32_t>(bestDistance - 1), output);
+                writeBits(LOOKAHEAD_BITS, static_cast<uint32_t>(bestLength - 1), output);
+
+                for (size_t i = 0; i < bestLength; ++i)
+                {
+                    insert(input, length, position + i);
+                }
+                position += bestLength;
+            }
+            else
+            {
+                writeBits(1, 0x01, output);
+                writeBits(8, input[position], output);
+                insert(input, length, position);
+                ++position;
+            }
+
+            if (output->size() >= length)
+            {
+                return false;
+            }
+        }
+
+        flushBits(output);
+        return output->size() < length;
+    }
+
+    uint32_t HeatshrinkEncoder::hash(const uint8_t* data) const
+    {
+        const uint32_t key = (static_cast<uint32_t>(data[0]) << 16) | (static_cast<uint32_t>(data[1]) << 8) | data[2];
+        return (key * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    void HeatshrinkEncoder::insert(const uint8_t* input, const size_t length, const size_t position)
+    {
+        if (position + MIN_MATCH_LENGTH > length)
+        {
+            return;
+        }
+
+        const uint32_t key = hash(input + position);
+        const uint32_t head = mHead[key];
+        const size_t distance = head == 0 ? 0 : position - (head - 1);
+
+        mPrevious[position & (WINDOW_SIZE - 1)] = distance < WINDOW_SIZE ? static_cast<uint16_t>(distance) : 0;
+        mHead[key] = static_cast<uint32_t>(position + 1);
+    }
+
+    void HeatshrinkEncoder::writeBits(const uint8_t count, const uint32_t bits, std::string* output)
+    {
+        for (int8_t i = count - 1; i >= 0; --i)
+        {
+            mBitBuffer = static_cast<uint8_t>((mBitBuffer << 1) | ((bits >> i) & 0x01));
+            if (++mBitCount == 8)
+            {
+                output->push_back(static_cast<char>(mBitBuffer));
+                mBitBuffer = 0;
+                mBitCount  = 0;
+            }
+        }
+    }
+
+    void HeatshrinkEncoder::flushBits(std::string* output)
+    {
+        if (mBitCount == 0)
+        {
+            return;
+        }
+
+        output->push_back(static_cast<char>(mBitBuffer << (8 - mBitCount)));
+        mBitBuffer = 0;
+        mBitCount  = 0;
+    }
+}
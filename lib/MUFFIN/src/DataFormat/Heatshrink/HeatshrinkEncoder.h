@@ -0,0 +1,66 @@
+/**
+ * @file HeatshrinkEncoder.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief heatshrink 비트스트림 형식으로 LZSS 압축을 수행하는 클래스를 선언합니다.
+ * @details 탐색에 사용하는 해시 테이블은 생성 시점에 한 번만 할당하며, 압축 중에는 출력 버퍼 외에
+ *          추가로 메모리를 할당하지 않습니다. 출력은 동일한 윈도우 및 룩어헤드 크기로 설정한
+ *          heatshrink 디코더(heatshrink_decoder, Python heatshrink2 등)로 복원할 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <string>
+#include <sys/_stdint.h>
+
+
+
+namespace muffin {
+
+    class HeatshrinkEncoder
+    {
+    public:
+        HeatshrinkEncoder();
+        virtual ~HeatshrinkEncoder();
+    public:
+        bool IsInitialized() const;
+        uint8_t GetWindowBits() const;
+        uint8_t GetLookaheadBits() const;
+    public:
+        /**
+         * @return false 압축 결과가 원본보다 작지 않아 압축의 이점이 없는 경우
+         */
+        bool Encode(const uint8_t* input, const size_t length, std::string* output);
+    private:
+        uint32_t hash(const uint8_t* data) const;
+        void insert(const uint8_t* input, const size_t length, const size_t position);
+        void writeBits(const uint8_t count, const uint32_t bits, std::string* output);
+        void flushBits(std::string* output);
+    private:
+        const uint8_t  WINDOW_BITS       = 10;
+        const uint8_t  LOOKAHEAD_BITS    = 5;
+        const uint8_t  HASH_BITS         = 9;
+        const uint8_t  MAX_CHAIN_DEPTH   = 16;
+        const uint8_t  MIN_MATCH_LENGTH  = 3;
+        const size_t   WINDOW_SIZE       = static_cast<size_t>(1) << WINDOW_BITS;
+        const size_t   LOOKAHEAD_SIZE    = static_cast<size_t>(1) << LOOKAHEAD_BITS;
+        const size_t   HASH_SIZE         = static_cast<size_t>(1) << HASH_BITS;
+    private:
+        /**
+         * @note mHead에는 해시별로 가장 최근 위치에 1을 더한 값을, mPrevious에는 같은 해시를 갖는
+         *       직전 위치까지의 거리를 저장합니다. 값이 0이면 후보가 없음을 의미합니다.
+         */
+        uint32_t* mHead;
+        uint16_t* mPrevious;
+        uint8_t mBitBuffer;
+        uint8_t mBitCount;
+    };
+}
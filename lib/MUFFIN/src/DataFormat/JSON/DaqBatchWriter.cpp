@@ -0,0 +1,252 @@
+/**
+ * @file DaqBatchWriter.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 주기 데이터 배치를 JSON 형식으로 출력 버퍼에 직접 기록하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+#include "Common/Assert.hpp"
+#include "DaqBatchWriter.h"
+#include "IM/Custom/MacAddress/MacAddress.h"
+
+
+
+namespace muffin {
+
+    DaqBatchWriter::DaqBatchWriter(char* output, const size_t bufferSize)
+        : mOutput(output)
+        , mBufferSize(bufferSize)
+        , mCapacity(bufferSize)
+        , mLength(0)
+        , mCount(0)
+    {
+        ASSERT((output != nullptr), "OUTPUT BUFFER CANNOT BE A NULL POINTER");
+        ASSERT((bufferSize >= UINT8_MAX), "OUTPUT BUFFER MUST BE GREATER THAN UINT8 MAX");
+    }
+
+    void DaqBatchWriter::SetCapacity(const size_t capacity)
+    {
+        ASSERT((capacity >= UINT8_MAX), "BATCH CAPACITY MUST BE GREATER THAN UINT8 MAX");
+        mCapacity = std::min(capacity, mBufferSize);
+    }
+
+    size_t DaqBatchWriter::GetCapacity() const
+    {
+        return mCapacity;
+    }
+
+    void DaqBatchWriter::Begin(const uint64_t sourceTimestamp)
+    {
+        mCount = 0;
+        mIdSection.clear();
+        mIdSection.reserve(mCapacity / 4);
+
+        const int length = snprintf(mOutput, mCapacity, "{\"mv\":\"%s\",\"tp\":1,\"ts\":%llu,\"mac\":",
+            ESP32_FW_VERSION, static_cast<unsigned long long>(sourceTimestamp));
+        mLength  = static_cast<size_t>(length);
+        mLength += writeString(mOutput + mLength, macAddress.GetEthernet());
+        mLength += writeRaw(mOutput + mLength, ",\"val\":[");
+    }
+
+    bool DaqBatchWriter::Append(const json_datum_t& datum)
+    {
+        char nodeID[sizeof(datum.NodeID) + 1] = {'\0'};
+        memcpy(nodeID, datum.NodeID, sizeof(datum.NodeID));
+
+        const size_t separator  = mCount > 0 ? 1 : 0;
+        const size_t valueSize  = measureValue(datum);
+        const size_t idSize     = measureString(nodeID);
+        const size_t tailSize   = strlen(ID_SECTION_HEAD) + mIdSection.size() + separator + idSize + strlen(BATCH_TAIL) + 1;
+
+        if (mLength + separator + valueSize + tailSize > mCapacity)
+        {
+            return false;
+        }
+
+        if (separator == 1)
+        {
+            mOutput[mLength++] = ',';
+            mIdSection.push_back(',');
+        }
+        mLength += writeValue(mOutput + mLength, datum);
+
+        const size_t offset = mIdSection.size();
+        mIdSection.resize(offset + idSize + 1);
+        writeString(&mIdSection[offset], nodeID);
+        mIdSection.resize(offset + idSize);
+
+        ++mCount;
+        return true;
+    }
+
+    size_t DaqBatchWriter::Finish()
+    {
+        mLength += writeRaw(mOutput + mLength, ID_SECTION_HEAD);
+        memcpy(mOutput + mLength, mIdSection.data(), mIdSection.size());
+        mLength += mIdSection.size();
+        mLength += writeRaw(mOutput + mLength, BATCH_TAIL);
+        mOutput[mLength] = '\0';
+
+        ASSERT((mLength < mCapacity), "BATCH EXCEEDED THE CAPACITY: %u/%u", mLength, mCapacity);
+        return mLength;
+    }
+
+    size_t DaqBatchWriter::GetCount() const
+    {
+        return mCount;
+    }
+
+    bool DaqBatchWriter::IsEmpty() const
+    {
+        return mCount == 0;
+    }
+
+    const char* DaqBatchWriter::GetBuffer() const
+    {
+        return mOutput;
+    }
+
+    size_t DaqBatchWriter::measureString(const char* str) const
+    {
+        size_t size = 2;
+        for (const char* ch = str; *ch != '\0'; ++ch)
+        {
+            switch (*ch)
+            {
+            case '"':
+            case '\\':
+            case '\b':
+            case '\f':
+            case '\n':
+            case '\r':
+            case '\t':
+                size += 2;
+                break;
+            default:
+                size += static_cast<uint8_t>(*ch) < 0x20 ? 6 : 1;
+                break;
+            }
+        }
+        return size;
+    }
+
+    size_t DaqBatchWriter::measureValue(const json_datum_t& datum) const
+    {
+        if (datum.Value == NULL_VALUE)
+        {
+            return strlen("null");
+        }
+
+        if (datum.isArray == false)
+        {
+            return measureString(datum.Value.c_str());
+        }
+
+        size_t size = 2;
+        for (const auto& value : datum.ArrayValue)
+        {
+            size += measureString(value.c_str()) + 1;
+        }
+        return datum.ArrayValue.empty() ? size : size - 1;
+    }
+
+    size_t DaqBatchWriter::writeRaw(char* dst, const char* src) const
+    {
+        const size_t length = strlen(src);
+        memcpy(dst, src, length);
+        return length;
+    }
+
+    size_t DaqBatchWriter::writeString(char* dst, const char* str) const
+    {
+        size_t length = 0;
+        dst[length++] = '"';
+
+        for (const char* ch = str; *ch != '\0'; ++ch)
+        {
+            switch (*ch)
+            {
+            case '"':
+                dst[length++] = '\\';
+                dst[length++] = '"';
+                break;
+            case '\\':
+                dst[length++] = '\\';
+                dst[length++] = '\\';
+                break;
+            case '\b':
+                dst[length++] = '\\';
+                dst[length++] = 'b';
+                break;
+            case '\f':
+                dst[length++] = '\\';
+                dst[length++] = 'f';
+                break;
+            case '\n':
+                dst[length++] = '\\';
+                dst[length++] = 'n';
+                break;
+            case '\r':
+                dst[length++] = '\\';
+                dst[length++] = 'r';
+                break;
+            case '\t':
+                dst[length++] = '\\';
+                dst[length++] = 't';
+                break;
+            default:
+                if (static_cast<uint8_t>(*ch) < 0x20)
+                {
+                    snprintf(dst + length, 7, "\\u%04x", static_cast<uint8_t>(*ch));
+                    length += 6;
+                }
+                else
+                {
+                    dst[length++] = *ch;
+                }
+                break;
+            }
+        }
+
+        dst[length++] = '"';
+        return length;
+    }
+
+    size_t DaqBatchWriter::writeValue(char* dst, const json_datum_t& datum) const
+    {
+        if (datum.Value == NULL_VALUE)
+        {
+            return writeRaw(dst, "null");
+        }
+
+        if (datum.isArray == false)
+        {
+            return writeString(dst, datum.Value.c_str());
+        }
+
+        size_t length = 0;
+        dst[length++] = '[';
+        for (auto it = datum.ArrayValue.begin(); it != datum.ArrayValue.end(); ++it)
+        {
+            if (it != datum.ArrayValue.begin())
+            {
+                dst[length++] = ',';
+            }
+            length += writeString(dst + length, it->c_str());
+        }
+        dst[length++] = ']';
+        return length;
+    }
+}
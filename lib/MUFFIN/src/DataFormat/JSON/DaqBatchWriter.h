@@ -0,0 +1,69 @@
+/**
+ * @file DaqBatchWriter.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 주기 데이터 배치를 JSON 형식으로 출력 버퍼에 직접 기록하는 클래스를 선언합니다.
+ * @details 중간 JsonDocument를 생성하지 않고 데이터를 추가할 때마다 필요한 바이트 수를 계산하여
+ *          전송 계층의 최대 페이로드 크기를 넘기 직전에 배치를 자릅니다. 출력 형식은
+ *          JSON::Serialize(const std::vector<json_datum_t>&, ...) 함수와 동일한 스키마를 따릅니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <string>
+#include <sys/_stdint.h>
+
+#include "JSON.h"
+
+
+
+namespace muffin {
+
+    class DaqBatchWriter
+    {
+    public:
+        DaqBatchWriter(char* output, const size_t bufferSize);
+        virtual ~DaqBatchWriter() {}
+    public:
+        /**
+         * @brief 배치의 최대 크기를 설정합니다. 출력 버퍼의 크기보다 클 수 없습니다.
+         */
+        void SetCapacity(const size_t capacity);
+        size_t GetCapacity() const;
+    public:
+        void Begin(const uint64_t sourceTimestamp);
+        /**
+         * @return false 남은 공간이 부족하여 데이터를 추가하지 않은 경우
+         */
+        bool Append(const json_datum_t& datum);
+        size_t Finish();
+        size_t GetCount() const;
+        bool IsEmpty() const;
+        const char* GetBuffer() const;
+    private:
+        size_t measureString(const char* str) const;
+        size_t measureValue(const json_datum_t& datum) const;
+        size_t writeRaw(char* dst, const char* src) const;
+        size_t writeString(char* dst, const char* str) const;
+        size_t writeValue(char* dst, const json_datum_t& datum) const;
+    private:
+        const char* NULL_VALUE      = "MFM_NULL";
+        const char* ID_SECTION_HEAD = "],\"id\":[";
+        const char* BATCH_TAIL      = "]}";
+    private:
+        char* mOutput;
+        const size_t mBufferSize;
+        size_t mCapacity;
+        size_t mLength;
+        size_t mCount;
+        std::string mIdSection;
+    };
+}
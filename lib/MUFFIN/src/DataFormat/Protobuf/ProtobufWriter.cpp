@@ -0,0 +1,94 @@
+/**
+ * @file ProtobufWriter.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief Protocol Buffers 와이어 포맷 인코딩을 수행하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <string.h>
+
+#include "Common/Assert.hpp"
+#include "ProtobufWriter.h"
+
+
+
+namespace muffin {
+
+    ProtobufWriter::ProtobufWriter(std::string* output)
+        : mOutput(output)
+    {
+        ASSERT((output != nullptr), "OUTPUT PARAMETER <std::string* output> CANNOT BE A NULL POINTER");
+    }
+
+    void ProtobufWriter::WriteTag(const uint32_t field, const wire_type_e type)
+    {
+        WriteVarint((static_cast<uint64_t>(field) << 3) | static_cast<uint8_t>(type));
+    }
+
+    void ProtobufWriter::WriteVarint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            mOutput->push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        mOutput->push_back(static_cast<char>(value));
+    }
+
+    void ProtobufWriter::WriteUInt64(const uint32_t field, const uint64_t value)
+    {
+        WriteTag(field, wire_type_e::VARINT);
+        WriteVarint(value);
+    }
+
+    void ProtobufWriter::WriteBool(const uint32_t field, const bool value)
+    {
+        WriteTag(field, wire_type_e::VARINT);
+        mOutput->push_back(value ? 0x01 : 0x00);
+    }
+
+    void ProtobufWriter::WriteDouble(const uint32_t field, const double value)
+    {
+        static_assert(sizeof(double) == sizeof(uint64_t), "DOUBLE MUST BE 64 BITS");
+
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+
+        WriteTag(field, wire_type_e::FIXED64);
+        for (uint8_t i = 0; i < sizeof(bits); ++i)
+        {
+            mOutput->push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void ProtobufWriter::WriteBytes(const uint32_t field, const char* data, const size_t length)
+    {
+        WriteTag(field, wire_type_e::LENGTH_DELIMITED);
+        WriteVarint(length);
+        mOutput->append(data, length);
+    }
+
+    void ProtobufWriter::WriteString(const uint32_t field, const std::string& value)
+    {
+        WriteBytes(field, value.data(), value.length());
+    }
+
+    size_t ProtobufWriter::MeasureVarint(uint64_t value)
+    {
+        size_t size = 1;
+        while (value >= 0x80)
+        {
+            value >>= 7;
+            ++size;
+        }
+        return size;
+    }
+}
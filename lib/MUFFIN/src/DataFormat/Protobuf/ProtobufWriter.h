@@ -0,0 +1,54 @@
+/**
+ * @file ProtobufWriter.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief Protocol Buffers 와이어 포맷 인코딩을 수행하는 클래스를 선언합니다.
+ * @details 스키마 컴파일러 없이 필드 번호와 와이어 타입을 직접 지정하여 인코딩합니다.
+ *          생성되는 바이트열은 nanopb 및 protoc로 생성한 디코더와 호환됩니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <string>
+#include <sys/_stdint.h>
+
+
+
+namespace muffin {
+
+    typedef enum class ProtobufWireTypeEnum
+        : uint8_t
+    {
+        VARINT            = 0,
+        FIXED64           = 1,
+        LENGTH_DELIMITED  = 2,
+        FIXED32           = 5
+    } wire_type_e;
+
+    class ProtobufWriter
+    {
+    public:
+        explicit ProtobufWriter(std::string* output);
+        virtual ~ProtobufWriter() {}
+    public:
+        void WriteTag(const uint32_t field, const wire_type_e type);
+        void WriteVarint(const uint64_t value);
+        void WriteUInt64(const uint32_t field, const uint64_t value);
+        void WriteBool(const uint32_t field, const bool value);
+        void WriteDouble(const uint32_t field, const double value);
+        void WriteBytes(const uint32_t field, const char* data, const size_t length);
+        void WriteString(const uint32_t field, const std::string& value);
+    public:
+        static size_t MeasureVarint(uint64_t value);
+    private:
+        std::string* mOutput;
+    };
+}
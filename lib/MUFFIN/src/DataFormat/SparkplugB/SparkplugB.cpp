@@ -0,0 +1,297 @@
+/**
+ * @file SparkplugB.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief Sparkplug B 페이로드 인코딩을 수행하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Common/Assert.hpp"
+#include "DataFormat/Protobuf/ProtobufWriter.h"
+#include "SparkplugB.h"
+
+
+
+namespace muffin {
+
+    /**
+     * @note Sparkplug B Payload 및 Metric 메시지의 필드 번호입니다.
+     */
+    namespace field {
+        constexpr uint32_t PAYLOAD_TIMESTAMP     = 1;
+        constexpr uint32_t PAYLOAD_METRICS       = 2;
+        constexpr uint32_t PAYLOAD_SEQ           = 3;
+
+        constexpr uint32_t METRIC_NAME           = 1;
+        constexpr uint32_t METRIC_ALIAS          = 2;
+        constexpr uint32_t METRIC_DATATYPE       = 4;
+        constexpr uint32_t METRIC_IS_NULL        = 7;
+        constexpr uint32_t METRIC_LONG_VALUE     = 11;
+        constexpr uint32_t METRIC_DOUBLE_VALUE   = 13;
+        constexpr uint32_t METRIC_BOOLEAN_VALUE  = 14;
+        constexpr uint32_t METRIC_STRING_VALUE   = 15;
+        constexpr uint32_t METRIC_BYTES_VALUE    = 16;
+    }
+
+
+    SparkplugB::SparkplugB()
+        : mNextAlias(1)
+        , mSequence(0)
+        , mBirthDeathSequence(0)
+        , mHasBorn(false)
+        , mIsBirthRequired(true)
+        , mCapacity(4 * 1024)
+        , mCount(0)
+    {
+    }
+
+    void SparkplugB::RequestBirth()
+    {
+        mIsBirthRequired.store(true);
+    }
+
+    bool SparkplugB::IsBirthRequired() const
+    {
+        return mIsBirthRequired.load();
+    }
+
+    void SparkplugB::SetCapacity(const size_t capacity)
+    {
+        ASSERT((capacity >= UINT8_MAX), "PAYLOAD CAPACITY MUST BE GREATER THAN UINT8 MAX");
+        mCapacity = capacity;
+    }
+
+    std::string SparkplugB::EncodeBirth(const std::vector<json_datum_t>& metrics, const uint64_t timestamp)
+    {
+        if (mHasBorn == true)
+        {
+            ++mBirthDeathSequence;
+        }
+
+        std::string payload;
+        ProtobufWriter writer(&payload);
+        writer.WriteUInt64(field::PAYLOAD_TIMESTAMP, timestamp);
+
+        encodeBirthDeathSequence(&mMetric);
+        writer.WriteString(field::PAYLOAD_METRICS, mMetric);
+
+        for (const auto& datum : metrics)
+        {
+            mMetric.clear();
+            alias_t& alias = resolveAlias(datum.NodeID);
+            alias.IsAnnounced = false;
+            encodeMetric(datum, true, &mMetric);
+            alias.IsAnnounced = true;
+            writer.WriteString(field::PAYLOAD_METRICS, mMetric);
+        }
+
+        writer.WriteUInt64(field::PAYLOAD_SEQ, 0);
+        mSequence = 1;
+        mHasBorn  = true;
+        mIsBirthRequired.store(false);
+
+        return payload;
+    }
+
+    std::string SparkplugB::EncodeDeath()
+    {
+        std::string payload;
+        std::string metric;
+        ProtobufWriter writer(&payload);
+
+        encodeBirthDeathSequence(&metric);
+        writer.WriteString(field::PAYLOAD_METRICS, metric);
+        return payload;
+    }
+
+    void SparkplugB::Begin(const uint64_t timestamp)
+    {
+        mCount = 0;
+        mPayload.clear();
+        mPayload.reserve(mCapacity);
+
+        ProtobufWriter writer(&mPayload);
+        writer.WriteUInt64(field::PAYLOAD_TIMESTAMP, timestamp);
+    }
+
+    bool SparkplugB::Append(const json_datum_t& datum)
+    {
+        mMetric.clear();
+        encodeMetric(datum, false, &mMetric);
+
+        const size_t metricSize = 1 + ProtobufWriter::MeasureVarint(mMetric.size()) + mMetric.size();
+        const size_t seqSize    = 1 + ProtobufWriter::MeasureVarint(UINT8_MAX);
+        if (mPayload.size() + metricSize + seqSize > mCapacity)
+        {
+            return false;
+        }
+
+        ProtobufWriter writer(&mPayload);
+        writer.WriteString(field::PAYLOAD_METRICS, mMetric);
+        ++mCount;
+        return true;
+    }
+
+    std::string SparkplugB::Finish()
+    {
+        ProtobufWriter writer(&mPayload);
+        writer.WriteUInt64(field::PAYLOAD_SEQ, mSequence++);
+        return mPayload;
+    }
+
+    size_t SparkplugB::GetCount() const
+    {
+        return mCount;
+    }
+
+    bool SparkplugB::IsEmpty() const
+    {
+        return mCount == 0;
+    }
+
+    SparkplugB::alias_t& SparkplugB::resolveAlias(const char* nodeID)
+    {
+        const std::string key(nodeID, strnlen(nodeID, sizeof(json_datum_t::NodeID)));
+
+        auto it = mAliases.find(key);
+        if (it == mAliases.end())
+        {
+            alias_t alias;
+            alias.Alias       = mNextAlias++;
+            alias.IsAnnounced = false;
+            alias.DataType    = sp_datatype_e::STRING;
+            it = mAliases.emplace(key, alias).first;
+        }
+
+        return it->second;
+    }
+
+    void SparkplugB::encodeMetric(const json_datum_t& datum, const bool hasName, std::string* output)
+    {
+        alias_t& alias = resolveAlias(datum.NodeID);
+        ProtobufWriter writer(output);
+
+        /**
+         * @note NBIRTH 메시지로 알리지 않은 메트릭은 호스트가 별칭을 해석할 수 없으므로
+         *       이름을 함께 전송합니다.
+         */
+        if (hasName == true || alias.IsAnnounced == false)
+        {
+            writer.WriteString(field::METRIC_NAME, std::string(datum.NodeID, strnlen(datum.NodeID, sizeof(datum.NodeID))));
+        }
+        writer.WriteUInt64(field::METRIC_ALIAS, alias.Alias);
+
+        if (datum.Value == NULL_VALUE)
+        {
+            if (hasName == true)
+            {
+                writer.WriteUInt64(field::METRIC_DATATYPE, static_cast<uint8_t>(alias.DataType));
+            }
+            writer.WriteBool(field::METRIC_IS_NULL, true);
+            return;
+        }
+
+        int64_t integer = 0;
+        double real = 0.0;
+        const sp_datatype_e dataType = datum.isArray ? sp_datatype_e::STRING_ARRAY : inferDataType(datum.Value, &integer, &real);
+
+        if (hasName == true || alias.IsAnnounced == false || dataType != alias.DataType)
+        {
+            writer.WriteUInt64(field::METRIC_DATATYPE, static_cast<uint8_t>(dataType));
+        }
+        alias.DataType = dataType;
+
+        switch (dataType)
+        {
+        case sp_datatype_e::INT64:
+            writer.WriteUInt64(field::METRIC_LONG_VALUE, static_cast<uint64_t>(integer));
+            break;
+        case sp_datatype_e::DOUBLE:
+            writer.WriteDouble(field::METRIC_DOUBLE_VALUE, real);
+            break;
+        case sp_datatype_e::BOOLEAN:
+            writer.WriteBool(field::METRIC_BOOLEAN_VALUE, datum.Value == "true");
+            break;
+        case sp_datatype_e::STRING_ARRAY:
+        {
+            std::string bytes;
+            for (const auto& value : datum.ArrayValue)
+            {
+                bytes.append(value);
+                bytes.push_back('\0');
+            }
+            writer.WriteBytes(field::METRIC_BYTES_VALUE, bytes.data(), bytes.size());
+            break;
+        }
+        default:
+            writer.WriteString(field::METRIC_STRING_VALUE, datum.Value);
+            break;
+        }
+    }
+
+    void SparkplugB::encodeBirthDeathSequence(std::string* output)
+    {
+        output->clear();
+        ProtobufWriter writer(output);
+        writer.WriteString(field::METRIC_NAME, BDSEQ_NAME);
+        writer.WriteUInt64(field::METRIC_DATATYPE, static_cast<uint8_t>(sp_datatype_e::UINT64));
+        writer.WriteUInt64(field::METRIC_LONG_VALUE, mBirthDeathSequence);
+    }
+
+    sp_datatype_e SparkplugB::inferDataType(const std::string& value, int64_t* integer, double* real) const
+    {
+        if (value == "true" || value == "false")
+        {
+            return sp_datatype_e::BOOLEAN;
+        }
+
+        const char* begin = value.c_str();
+        const char* digits = (*begin == '-' || *begin == '+') ? begin + 1 : begin;
+        if (*digits == '\0')
+        {
+            return sp_datatype_e::STRING;
+        }
+
+        /**
+         * @note "007"과 같이 0으로 시작하는 식별 코드는 숫자로 변환하면 원래 값을
+         *       복원할 수 없으므로 문자열로 취급합니다.
+         */
+        if (digits[0] == '0' && digits[1] != '\0' && digits[1] != '.')
+        {
+            return sp_datatype_e::STRING;
+        }
+
+        char* end = nullptr;
+        errno = 0;
+        const long long parsedInteger = strtoll(begin, &end, 10);
+        if (errno == 0 && *end == '\0')
+        {
+            *integer = static_cast<int64_t>(parsedInteger);
+            return sp_datatype_e::INT64;
+        }
+
+        errno = 0;
+        const double parsedReal = strtod(begin, &end);
+        if (errno == 0 && *end == '\0')
+        {
+            *real = parsedReal;
+            return sp_datatype_e::DOUBLE;
+        }
+
+        return sp_datatype_e::STRING;
+    }
+
+
+    SparkplugB sparkplug;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file SparkplugB.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief Sparkplug B 페이로드 인코딩을 수행하는 클래스를 선언합니다.
+ * @details 노드 식별자마다 정수형 별칭(alias)을 부여하고, NBIRTH 메시지에서만 이름과 별칭을
+ *          함께 전송합니다. 이후 NDATA 메시지에는 별칭과 값만 포함되며, 개별 메트릭의 타임스탬프는
+ *          생략되어 페이로드의 타임스탬프를 따릅니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <sys/_stdint.h>
+#include <vector>
+
+#include "DataFormat/JSON/JSON.h"
+
+
+
+namespace muffin {
+
+    typedef enum class SparkplugDataTypeEnum
+        : uint8_t
+    {
+        INT64         = 4,
+        UINT64        = 8,
+        DOUBLE        = 10,
+        BOOLEAN       = 11,
+        STRING        = 12,
+        STRING_ARRAY  = 34
+    } sp_datatype_e;
+
+    class SparkplugB
+    {
+    public:
+        SparkplugB();
+        virtual ~SparkplugB() {}
+    public:
+        /**
+         * @brief 브로커와 새로 연결된 경우 호출하여 다음 발행 주기에 NBIRTH 메시지를 전송하도록 합니다.
+         */
+        void RequestBirth();
+        bool IsBirthRequired() const;
+        void SetCapacity(const size_t capacity);
+    public:
+        std::string EncodeBirth(const std::vector<json_datum_t>& metrics, const uint64_t timestamp);
+        std::string EncodeDeath();
+    public:
+        void Begin(const uint64_t timestamp);
+        /**
+         * @return false 남은 공간이 부족하여 데이터를 추가하지 않은 경우
+         */
+        bool Append(const json_datum_t& datum);
+        std::string Finish();
+        size_t GetCount() const;
+        bool IsEmpty() const;
+    private:
+        typedef struct SparkplugAliasType
+        {
+            uint64_t Alias;
+            bool IsAnnounced;
+            sp_datatype_e DataType;
+        } alias_t;
+    private:
+        alias_t& resolveAlias(const char* nodeID);
+        void encodeMetric(const json_datum_t& datum, const bool hasName, std::string* output);
+        void encodeBirthDeathSequence(std::string* output);
+        sp_datatype_e inferDataType(const std::string& value, int64_t* integer, double* real) const;
+    private:
+        const char* NULL_VALUE = "MFM_NULL";
+        const char* BDSEQ_NAME = "bdSeq";
+    private:
+        std::map<std::string, alias_t> mAliases;
+        uint64_t mNextAlias;
+        uint8_t mSequence;
+        uint8_t mBirthDeathSequence;
+        bool mHasBorn;
+        std::atomic<bool> mIsBirthRequired;
+        size_t mCapacity;
+        size_t mCount;
+        std::string mPayload;
+        std::string mMetric;
+    };
+
+
+    extern SparkplugB sparkplug;
+}
@@ -250,7 +250,7 @@ namespace muffin { namespace aas {
             psram::string json = submodelSerializer.EncodeProperty(SM_ID_OPERATIONAL_DATA, "RealTimeMonitoring");
         
             mqtt::Message msg(mqtt::topic_e::AAS_OPERATIONALDATA_RTM, json.c_str());
-            mqtt::cdo.Store(msg);
+            mqtt::cdo.Store(std::move(msg));
         }
 
         static void handleJobProgress(const psram::string& idShort, const im::Node& node, SubmodelElementCollection& smc)
@@ -284,7 +284,7 @@ namespace muffin { namespace aas {
             psram::string json = submodelSerializer.EncodeProperty(SM_ID_OPERATIONAL_DATA, "JobProgress");
         
             mqtt::Message msg(mqtt::topic_e::AAS_OPERATIONALDATA_JP, json.c_str());
-            mqtt::cdo.Store(msg);
+            mqtt::cdo.Store(std::move(msg));
         }
 
         static void handleConfiguration(const psram::string& idShort, const im::Node& node, SubmodelElementCollection& smc)
@@ -318,7 +318,7 @@ namespace muffin { namespace aas {
             psram::string json = submodelSerializer.EncodeProperty(SM_ID_CONFIGURATION, "BasicConfiguration");
         
             mqtt::Message msg(mqtt::topic_e::AAS_CONFIGURATION, json.c_str());
-            mqtt::cdo.Store(msg);
+            mqtt::cdo.Store(std::move(msg));
         }
 
     public:
@@ -23,6 +23,7 @@
 
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/HeapStats.h"
 
 
 
@@ -76,8 +77,10 @@ namespace muffin { namespace aas {
         {
             JsonObject objectAssetAdministrationShell = arrayAssetAdministrationShells[idx].as<JsonObject>();
 
+            const uint32_t freeBytes = heapStats.GetFreeBytes();
             AssetAdministrationShellDeserializer deserializer;
             psram::unique_ptr<AssetAdministrationShell> aas = deserializer.Parse(objectAssetAdministrationShell);
+            heapStats.Allocate(heap_tag_e::AAS_CONTAINER, heapStats.GetConsumedBytes(freeBytes));
         #ifndef DEBUG
             구현 필요함 --> AssetAdministrationShell::SetCategory()
             구현 필요함 --> AssetAdministrationShell::SetDataSpecification()
@@ -102,8 +105,10 @@ namespace muffin { namespace aas {
         {
             JsonObject objectSubmodel = arraySubmodels[idx].as<JsonObject>();
 
+            const uint32_t freeBytes = heapStats.GetFreeBytes();
             SubmodelsDeserializer deserializer;
             psram::unique_ptr<Submodel> submodel = deserializer.Parse(objectSubmodel);
+            heapStats.Allocate(heap_tag_e::AAS_CONTAINER, heapStats.GetConsumedBytes(freeBytes));
         #ifndef DEBUG
             구현 필요함 --> AssetAdministrationShell::SetCategory()
             구현 필요함 --> AssetAdministrationShell::SetDataSpecification()
@@ -103,7 +103,7 @@ namespace muffin { namespace aas {
         }
 
     protected:
-        psram::vector<psram::unique_ptr<AssetAdministrationShell>> mVectorAAS;
-        psram::vector<psram::unique_ptr<Submodel>> mVectorSubmodel;
+        psram::vector<psram::unique_ptr<AssetAdministrationShell>, heap_tag_e::AAS_CONTAINER> mVectorAAS;
+        psram::vector<psram::unique_ptr<Submodel>, heap_tag_e::AAS_CONTAINER> mVectorSubmodel;
     };
 }}
\ No newline at end of file
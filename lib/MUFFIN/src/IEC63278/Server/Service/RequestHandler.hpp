@@ -20,6 +20,7 @@
 
 #include "Common/Base64/Base64.hpp"
 #include "Common/PSRAM.hpp"
+#include "Common/Time/ScopedTimer.h"
 
 
 
@@ -37,6 +38,7 @@ namespace muffin { namespace aas {
 
     void HandleGetAllAssetAdministrationShells()
     {
+        ScopedLatencyTimer probe(histogram_e::AAS_REQUEST);
         AssetAdministrationShellSerializer serializer;
         const psram::string payload = serializer.EncodeAll();
         server.send(200, "application/json", payload.c_str());
@@ -46,6 +48,7 @@ namespace muffin { namespace aas {
 
     void HandleGetAllSubmodels()
     {
+        ScopedLatencyTimer probe(histogram_e::AAS_REQUEST);
         SubmodelsSerializer serializer;
         const psram::string payload = serializer.EncodeAll();
         server.send(200, "application/json", payload.c_str());
@@ -84,6 +87,7 @@ namespace muffin { namespace aas {
 
     void HandleGetSubmodelElement()
     {
+        ScopedLatencyTimer probe(histogram_e::AAS_REQUEST);
         const psram::string uri = server.uri().c_str();
         psram::vector<psram::string> tokens = splitString(uri, '/');
 
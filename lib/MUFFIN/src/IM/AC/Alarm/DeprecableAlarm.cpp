@@ -702,8 +702,8 @@ namespace muffin {
         const mqtt::topic_e pushTopic = push.Topic;
         mqtt::Message pushMessage(pushTopic, payload);
 
-        mqtt::cdo.Store(AlarmMessage);
-        mqtt::cdo.Store(pushMessage);
+        mqtt::cdo.Store(std::move(AlarmMessage));
+        mqtt::cdo.Store(std::move(pushMessage));
 
         mVectorAlarmInfo.emplace_back(alarm);
     }
@@ -722,7 +722,7 @@ namespace muffin {
         json.Serialize(alarm, size, payload);
         const mqtt::topic_e topic = alarm.Topic;
         mqtt::Message message(topic, payload);
-        mqtt::cdo.Store(message);
+        mqtt::cdo.Store(std::move(message));
     }
 
     
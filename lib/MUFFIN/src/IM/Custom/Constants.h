@@ -41,6 +41,7 @@ namespace muffin {
      * @brief NVS 파티션 읽기/쓰기에 사용되는 상수를 정의
      */
     constexpr const char* NVS_NAMESPACE_INIT = "init";
+    constexpr const char* NVS_NAMESPACE_OUTBOUND = "outbound";
 
     /**
      * @todo Ver.1.3 미만 펌웨어가 없다면 아래의 상수는 삭제할 예정임
@@ -67,6 +68,11 @@ namespace muffin {
     constexpr const char* OTA_CHUNK_PATH_ESP32   = "/ota_chunk_esp32.csv";
     constexpr const char* OTA_CHUNK_PATH_MEGA    = "/ota_chunk_mega2560.csv";
     constexpr const char* LWIP_HTTP_PATH         = "/http_response";
+    constexpr const char* MQTT_OUTBOUND_PREFIX   = "mqtt_outbound_";
+    constexpr const char* LOG_SEGMENT_PREFIX     = "log_";
+
+    constexpr const char* SPARKPLUG_GROUP_ID     = "edgecross";
+    constexpr const char* COMPRESSED_TOPIC_SUFFIX = "/hs";
     
 
     typedef enum class TaskName
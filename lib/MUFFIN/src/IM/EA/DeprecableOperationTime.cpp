@@ -478,7 +478,7 @@ namespace muffin {
         json.Serialize(production, size, payload);
 
         mqtt::Message message(mqtt::topic_e::UPTIME, payload);
-        mqtt::cdo.Store(message);
+        mqtt::cdo.Store(std::move(message));
     }
 
     void OperationTime::publishOperationStatus()
@@ -495,7 +495,7 @@ namespace muffin {
         json.Serialize(status, size, payload);
 
         mqtt::Message message(mqtt::topic_e::OPERATION, payload);
-        mqtt::cdo.Store(message);
+        mqtt::cdo.Store(std::move(message));
     }
 
 
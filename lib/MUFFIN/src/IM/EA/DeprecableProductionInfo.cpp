@@ -307,7 +307,7 @@ namespace muffin {
         json.Serialize(production, size, payload);
 
         mqtt::Message message(mqtt::topic_e::FINISHEDGOODS, payload);
-        mqtt::cdo.Store(message);
+        mqtt::cdo.Store(std::move(message));
     }
 
 
@@ -15,6 +15,7 @@
 
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/HeapStats.h"
 #include "Core/MemoryPool/MemoryPool.h"
 #include "NodeStore.h"
 
@@ -64,6 +65,7 @@ namespace muffin { namespace im {
     }
 
     NodeStore::NodeStore()
+        : mNodeBytes(0)
     {
     }
 
@@ -77,10 +79,16 @@ namespace muffin { namespace im {
         {
             // uint32_t prev = ESP.getFreeHeap();
             LOG_DEBUG(logger, "Remained Heap: %u Bytes", ESP.getFreeHeap());
+            const uint32_t freeBytes = heapStats.GetFreeBytes();
             void* block = memoryPool.Allocate(28);
             Node* node = new(block) Node(cin);
 
             mMapNode.emplace(node->GetNodeID(), node);
+
+            // Node 개체는 메모리 풀의 블록에 생성되므로 여유 힙의 변화량에 블록 크기를 더합니다.
+            const uint32_t nodeBytes = heapStats.GetConsumedBytes(freeBytes) + sizeof(Node);
+            heapStats.Allocate(heap_tag_e::NODE_STORE, nodeBytes);
+            mNodeBytes += nodeBytes;
             
             LOG_DEBUG(logger, "size of Node Memory: %u Bytes", sizeof(Node));
             // LOG_DEBUG(logger, "Node Memory: %u Bytes", prev - ESP.getFreeHeap());
@@ -107,6 +115,8 @@ namespace muffin { namespace im {
     void NodeStore::Clear()
     {
         mMapNode.clear();
+        heapStats.Release(heap_tag_e::NODE_STORE, mNodeBytes);
+        mNodeBytes = 0;
     }
 
     std::pair<Status, Node*> NodeStore::GetNodeReference(const std::string& nodeID)
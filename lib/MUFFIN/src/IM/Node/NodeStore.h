@@ -64,5 +64,6 @@ namespace muffin { namespace im {
         std::pair<Status, Node*> GetNodeReference(const std::string& nodeID);
     private:
         std::map<std::string, Node*> mMapNode;
+        uint32_t mNodeBytes;
     };
 }}
\ No newline at end of file
@@ -14,6 +14,8 @@
 
 
 
+#define MUFFIN_LOG_MODULE   muffin::log_module_e::VARIABLE
+
 #include <cmath>
 #include <iomanip>
 #include <sstream>
@@ -31,7 +33,8 @@
 namespace muffin { namespace im {
 
     Variable::Variable(const jvs::config::Node* cin)
-        : mCIN(cin)
+        : mVersion(0)
+        , mCIN(cin)
     {
         if (mCIN->GetFormatString().first == Status::Code::GOOD)
         {
@@ -423,6 +426,7 @@ namespace muffin { namespace im {
         variableData.HasNewEvent = isEventOccured(variableData);
         variableData.IsEventType = variableData.HasNewEvent;
         mHasNewEvent = variableData.HasNewEvent;
+        updateVersion(variableData);
         
         try
         {
@@ -519,6 +523,7 @@ namespace muffin { namespace im {
         variableData.HasNewEvent = isEventOccured(variableData);
         variableData.IsEventType = variableData.HasNewEvent;
         mHasNewEvent = variableData.HasNewEvent;
+        updateVersion(variableData);
         try
         {
             mDataBuffer.emplace_back(variableData);
@@ -590,6 +595,85 @@ namespace muffin { namespace im {
         }
     }
     
+    void Variable::updateVersion(const var_data_t& variableData)
+    {
+        if (mDataBuffer.size() == 0 || isChanged(mDataBuffer.back(), variableData) == true)
+        {
+            ++mVersion;
+        }
+    }
+
+    bool Variable::isChanged(const var_data_t& lastestHistory, const var_data_t& variableData) const
+    {
+        if (lastestHistory.StatusCode != variableData.StatusCode)
+        {
+            return true;
+        }
+
+        if (variableData.StatusCode != Status::Code::GOOD)
+        {
+            return false;
+        }
+
+        if (lastestHistory.DataType != variableData.DataType)
+        {
+            return true;
+        }
+
+        if (variableData.DataType != jvs::dt_e::ARRAY)
+        {
+            return isSameValue(variableData.DataType, lastestHistory.Value, variableData.Value) == false;
+        }
+
+        if (lastestHistory.ArrayValue.size() != variableData.ArrayValue.size())
+        {
+            return true;
+        }
+
+        for (size_t i = 0; i < variableData.ArrayValue.size(); ++i)
+        {
+            if (isSameValue(variableData.ArrayDataType, lastestHistory.ArrayValue[i], variableData.ArrayValue[i]) == false)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Variable::isSameValue(const jvs::dt_e dataType, const var_value_u& lhs, const var_value_u& rhs) const
+    {
+        switch (dataType)
+        {
+        case jvs::dt_e::BOOLEAN:
+            return lhs.Boolean == rhs.Boolean;
+        case jvs::dt_e::INT8:
+            return lhs.Int8 == rhs.Int8;
+        case jvs::dt_e::UINT8:
+            return lhs.UInt8 == rhs.UInt8;
+        case jvs::dt_e::INT16:
+            return lhs.Int16 == rhs.Int16;
+        case jvs::dt_e::UINT16:
+            return lhs.UInt16 == rhs.UInt16;
+        case jvs::dt_e::INT32:
+            return lhs.Int32 == rhs.Int32;
+        case jvs::dt_e::UINT32:
+            return lhs.UInt32 == rhs.UInt32;
+        case jvs::dt_e::INT64:
+            return lhs.Int64 == rhs.Int64;
+        case jvs::dt_e::UINT64:
+            return lhs.UInt64 == rhs.UInt64;
+        case jvs::dt_e::FLOAT32:
+            return memcmp(&lhs.Float32, &rhs.Float32, sizeof(float)) == 0;
+        case jvs::dt_e::FLOAT64:
+            return memcmp(&lhs.Float64, &rhs.Float64, sizeof(double)) == 0;
+        case jvs::dt_e::STRING:
+            return lhs.String.Length == rhs.String.Length &&
+                   strncmp(lhs.String.Data, rhs.String.Data, sizeof(lhs.String.Data)) == 0;
+        default:
+            return false;
+        }
+    }
+
     void Variable::removeOldestHistory()
     {
         if (mDataBuffer.size() == MAX_HISTORY_SIZE)
@@ -1217,6 +1301,11 @@ namespace muffin { namespace im {
         return mDataBuffer.back();
     }
 
+    uint32_t Variable::RetrieveVersion() const
+    {
+        return mVersion.load();
+    }
+
     std::vector<var_data_t> Variable::RetrieveHistory(const size_t numberofHistory) const
     {
         ASSERT((numberofHistory < MAX_HISTORY_SIZE + 1), "CANNOT RETRIEVE MORE THAN THE MAXIMUM HITORY SIZE");
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <sys/_stdint.h>
 #include <vector>
 
@@ -58,6 +60,9 @@ namespace muffin { namespace im {
         void applyNumericScale(var_data_t& variableData);
         void applyNumericOffset(var_data_t& variableData);
         bool isEventOccured(var_data_t& variableData);
+        bool isChanged(const var_data_t& lastestHistory, const var_data_t& variableData) const;
+        bool isSameValue(const jvs::dt_e dataType, const var_value_u& lhs, const var_value_u& rhs) const;
+        void updateVersion(const var_data_t& variableData);
         string_t ToMuffinString(const std::string& stdString);
         std::string Float32ConvertToString(const float& data) const;
         std::string Float64ConvertToString(const double& data) const;
@@ -69,6 +74,11 @@ namespace muffin { namespace im {
         size_t RetrieveCount() const;
         var_data_t RetrieveData() const;
         std::vector<var_data_t> RetrieveHistory(const size_t numberOfHistory) const;
+        /**
+         * @brief 값 또는 상태 코드가 바뀔 때마다 1씩 증가하는 버전을 반환합니다.
+         * @details 발행 태스크는 마지막으로 발행한 버전과 비교하여 변경 여부를 O(1)로 판단합니다.
+         */
+        uint32_t RetrieveVersion() const;
 
     public:
         /* Convert Remote Control Request To Modbus Format */
@@ -90,6 +100,7 @@ namespace muffin { namespace im {
         // 이벤트 데이터 초기값 전송을 위한 변수입니다. 
         bool mInitEvent = true;
         jvs::dt_e mDataType;
+        std::atomic<uint32_t> mVersion;
     #if defined(MT11)
         psram::vector<var_data_t> mDataBuffer;
     #else
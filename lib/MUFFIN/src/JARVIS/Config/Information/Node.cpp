@@ -58,7 +58,7 @@ namespace muffin { namespace jvs { namespace config {
     bool Node::operator==(const Node& obj) const
     {
        return (
-            mNodeID                 == obj.mNodeID                  &&
+            strncmp(mNodeID, obj.mNodeID, sizeof(mNodeID)) == 0     &&
             mAddressType            == obj.mAddressType             &&
             mAddress.Numeric        == obj.mAddress.Numeric         &&
             mNodeArea               == obj.mNodeArea                &&
@@ -30,6 +30,8 @@ namespace muffin { namespace jvs { namespace config {
             mServerNIC          = obj.mServerNIC;
             mIntervalServer     = obj.mIntervalServer;
             mIntervalPolling    = obj.mIntervalPolling;
+            mKeyframeInterval   = obj.mKeyframeInterval;
+            mKeyframeIntervalCustom = obj.mKeyframeIntervalCustom;
         }
         return *this;
     }
@@ -41,7 +43,9 @@ namespace muffin { namespace jvs { namespace config {
             mFactoryReset    == obj.mFactoryReset     &&
             mServerNIC       == obj.mServerNIC        &&
             mIntervalServer  == obj.mIntervalServer   &&
-            mIntervalPolling == obj.mIntervalPolling
+            mIntervalPolling == obj.mIntervalPolling  &&
+            mKeyframeInterval == obj.mKeyframeInterval &&
+            mKeyframeIntervalCustom == obj.mKeyframeIntervalCustom
         );
     }
 
@@ -126,6 +130,18 @@ namespace muffin { namespace jvs { namespace config {
         mSetFlags.set(static_cast<uint8_t>(set_flag_e::DAQ_INTERVAL));
     }
 
+    void Operation::SetKeyframeInterval(const uint16_t intervalCount)
+    {
+        mKeyframeInterval = intervalCount;
+        mSetFlags.set(static_cast<uint8_t>(set_flag_e::KEYFRAME_INTERVAL));
+    }
+
+    void Operation::SetKeyframeIntervalCustom(const std::map<uint16_t, uint16_t> keyframeMap)
+    {
+        mKeyframeIntervalCustom = keyframeMap;
+        mSetFlags.set(static_cast<uint8_t>(set_flag_e::KEYFRAME_CUSTOM));
+    }
+
     std::pair<Status, bool> Operation::GetPlanExpired() const
     {
         if (mSetFlags.test(static_cast<uint8_t>(set_flag_e::SERVICE_PLAN)))
@@ -186,6 +202,32 @@ namespace muffin { namespace jvs { namespace config {
         }
     }
 
+    std::pair<Status, uint16_t> Operation::GetKeyframeInterval() const
+    {
+        if (mSetFlags.test(static_cast<uint8_t>(set_flag_e::KEYFRAME_INTERVAL)))
+        {
+            return std::make_pair(Status(Status::Code::GOOD), mKeyframeInterval);
+        }
+        else
+        {
+            return std::make_pair(Status(Status::Code::BAD), static_cast<uint16_t>(0));
+        }
+    }
+
+    std::pair<Status, uint16_t> Operation::GetKeyframeInterval(const uint16_t publishInterval) const
+    {
+        if (mSetFlags.test(static_cast<uint8_t>(set_flag_e::KEYFRAME_CUSTOM)))
+        {
+            auto it = mKeyframeIntervalCustom.find(publishInterval);
+            if (it != mKeyframeIntervalCustom.end())
+            {
+                return std::make_pair(Status(Status::Code::GOOD), it->second);
+            }
+        }
+
+        return GetKeyframeInterval();
+    }
+
 
     Operation operation;
 }}}
\ No newline at end of file
@@ -43,6 +43,13 @@ namespace muffin { namespace jvs { namespace config {
         void SetServerNIC(const snic_e snic);
         void SetIntervalServer(const uint16_t interval);
         void SetIntervalPolling(const uint16_t interval);
+        /**
+         * @brief 변경된 주기 데이터만 발행하는 델타 모드에서 전체 데이터를 발행할 주기 횟수를 설정합니다.
+         * @details 0으로 설정하면 델타 모드를 사용하지 않고 매 주기마다 전체 데이터를 발행합니다.
+         *          키는 발행 주기(초)이며, 맵에 없는 발행 주기는 기본값을 따릅니다.
+         */
+        void SetKeyframeInterval(const uint16_t intervalCount);
+        void SetKeyframeIntervalCustom(const std::map<uint16_t, uint16_t> keyframeMap);
     #if defined(MT11)
         void SetIntervalServerCustom(const psram::map<uint16_t, psram::vector<std::string>> intervalMap); 
         std::pair<Status, psram::map<uint16_t, psram::vector<std::string>>> GetIntervalServerCustom() const;   
@@ -56,6 +63,8 @@ namespace muffin { namespace jvs { namespace config {
         std::pair<Status, snic_e> GetServerNIC() const;
         std::pair<Status, uint16_t> GetIntervalServer() const;
         std::pair<Status, uint16_t> GetIntervalPolling() const;
+        std::pair<Status, uint16_t> GetKeyframeInterval() const;
+        std::pair<Status, uint16_t> GetKeyframeInterval(const uint16_t publishInterval) const;
     private:
         typedef enum class SetFlagEnum : uint8_t
         {
@@ -65,7 +74,9 @@ namespace muffin { namespace jvs { namespace config {
             PUB_INTERVAL        = 3,
             DAQ_INTERVAL        = 4,
             PUB_INTERVAL_CUSTOM = 5,
-            TOP                 = 6
+            KEYFRAME_INTERVAL   = 6,
+            KEYFRAME_CUSTOM     = 7,
+            TOP                 = 8
         } set_flag_e;
         bitset<static_cast<uint8_t>(set_flag_e::TOP)> mSetFlags;
     private:
@@ -74,6 +85,8 @@ namespace muffin { namespace jvs { namespace config {
         snic_e mServerNIC;
         uint16_t mIntervalServer;
         uint16_t mIntervalPolling;
+        uint16_t mKeyframeInterval;
+        std::map<uint16_t, uint16_t> mKeyframeIntervalCustom;
     #if defined(MT11)
         psram::map<uint16_t, psram::vector<std::string>> mIntervalServerCustom;
     #else
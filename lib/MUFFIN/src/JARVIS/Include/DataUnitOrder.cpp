@@ -130,7 +130,7 @@ namespace muffin { namespace jvs {
 
     std::pair<Status, ord_t> DataUnitOrder::Retrieve(const uint8_t index) const
     {
-        if ((index + 1) > mVectorOrder.size())
+        if (index >= mVectorOrder.size())
         {
             ord_t order;
             order.DataUnit   = data_unit_e::BYTE;
@@ -15,6 +15,7 @@
 
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/HeapStats.h"
 
 #include "Config/Information/Alarm.h"
 #include "Config/Information/Node.h"
@@ -37,13 +38,21 @@ namespace muffin {
 
     jvs::ValidationResult JARVIS::Validate(JsonDocument& json)
     {
+        const uint32_t freeBytes = heapStats.GetFreeBytes();
         jvs::Validator validator;
-        return validator.Inspect(json, &mMapCIN);
+        jvs::ValidationResult result = validator.Inspect(json, &mMapCIN);
+
+        const uint32_t consumedBytes = heapStats.GetConsumedBytes(freeBytes);
+        heapStats.Allocate(heap_tag_e::JARVIS_CONFIG, consumedBytes);
+        mConfigBytes += consumedBytes;
+        return result;
     }
 
     void JARVIS::Clear()
     {
         mMapCIN.clear();
+        heapStats.Release(heap_tag_e::JARVIS_CONFIG, mConfigBytes);
+        mConfigBytes = 0;
     }
     
     std::map<jvs::cfg_key_e, std::vector<jvs::config::Base*>>::iterator JARVIS::begin()
@@ -31,7 +31,7 @@ namespace muffin {
     class JARVIS
     {
     public:
-        JARVIS() {}
+        JARVIS() : mConfigBytes(0) {}
         virtual ~JARVIS() {}    
     public:
         jvs::ValidationResult Validate(JsonDocument& json);
@@ -44,6 +44,7 @@ namespace muffin {
     private:
         using vectorCIN = std::vector<jvs::config::Base*>;
         std::map<jvs::cfg_key_e, vectorCIN> mMapCIN; // CIN stands for "config instance"
+        uint32_t mConfigBytes;
     };
 
 
@@ -61,6 +61,18 @@ namespace muffin { namespace jvs {
             snprintf(buffer, sizeof(buffer), "INVALID INTERVAL CUSTOM");
             return std::make_pair(rsc, buffer);
         }
+
+        const auto retKeyframeInterval = convertToKeyframeInterval(json);
+        if (retKeyframeInterval.first != rsc_e::GOOD && retKeyframeInterval.first != rsc_e::GOOD_NO_DATA)
+        {
+            return std::make_pair(retKeyframeInterval.first, "INVALID OPERATION: KEYFRAME INTERVAL MUST BE AN UNSIGNED 16-BIT INTEGER");
+        }
+
+        const auto retKeyframeIntervalCustom = convertToKeyframeIntervalCustom(json);
+        if (retKeyframeIntervalCustom.first != rsc_e::GOOD && retKeyframeIntervalCustom.first != rsc_e::GOOD_NO_DATA)
+        {
+            return std::make_pair(retKeyframeIntervalCustom.first, "INVALID OPERATION: INVALID KEYFRAME INTERVAL CUSTOM");
+        }
         
         config::operation.SetPlanExpired(isExpired);
         config::operation.SetFactoryReset(hasFactoryReset);
@@ -68,6 +80,8 @@ namespace muffin { namespace jvs {
         config::operation.SetIntervalPolling(pollingInverval);
         config::operation.SetIntervalServer(publishInverval);
         config::operation.SetIntervalServerCustom(retPublishIntervalCustom.second);
+        config::operation.SetKeyframeInterval(retKeyframeInterval.second);
+        config::operation.SetKeyframeIntervalCustom(retKeyframeIntervalCustom.second);
 
         if (arrayCIN.size() > 1)
         {
@@ -150,6 +164,57 @@ namespace muffin { namespace jvs {
 
     
 
+    std::pair<rsc_e, uint16_t> OperationValidator::convertToKeyframeInterval(const JsonObject json)
+    {
+        if (json.containsKey("intvKey") == false || json["intvKey"].isNull() == true)
+        {
+            return std::make_pair(rsc_e::GOOD_NO_DATA, static_cast<uint16_t>(0));
+        }
+
+        if (json["intvKey"].is<uint16_t>() == false)
+        {
+            return std::make_pair(rsc_e::BAD_INVALID_FORMAT_CONFIG_INSTANCE, static_cast<uint16_t>(0));
+        }
+
+        return std::make_pair(rsc_e::GOOD, json["intvKey"].as<uint16_t>());
+    }
+
+    std::pair<rsc_e, std::map<uint16_t, uint16_t>> OperationValidator::convertToKeyframeIntervalCustom(const JsonObject json)
+    {
+        std::map<uint16_t, uint16_t> map;
+
+        if (json.containsKey("intvKeyCust") == false || json["intvKeyCust"].isNull() == true)
+        {
+            return std::make_pair(rsc_e::GOOD_NO_DATA, map);
+        }
+
+        if (json["intvKeyCust"].is<JsonObject>() == false)
+        {
+            return std::make_pair(rsc_e::BAD_INVALID_FORMAT_CONFIG_INSTANCE, map);
+        }
+
+        for (JsonPair intervalPair : json["intvKeyCust"].as<JsonObject>())
+        {
+            const char* intv = intervalPair.key().c_str();
+            char* endp = nullptr;
+            const unsigned long ul = strtoul(intv, &endp, 10);
+
+            if (endp == intv || *endp != '\0' || ul == 0 || ul > UINT16_MAX)
+            {
+                return std::make_pair(rsc_e::BAD_INVALID_FORMAT_CONFIG_INSTANCE, map);
+            }
+
+            if (intervalPair.value().is<uint16_t>() == false)
+            {
+                return std::make_pair(rsc_e::BAD_INVALID_FORMAT_CONFIG_INSTANCE, map);
+            }
+
+            map[static_cast<uint16_t>(ul)] = intervalPair.value().as<uint16_t>();
+        }
+
+        return std::make_pair(rsc_e::GOOD, map);
+    }
+
 #if defined(MT11)
 
     std::pair<rsc_e, psram::map<uint16_t, psram::vector<std::string>>> OperationValidator::convertToPublishIntervalCustom(const JsonObject json)
@@ -40,6 +40,8 @@ namespace muffin { namespace jvs {
         rsc_e validateMandatoryValues(const JsonObject json);
     private:
         std::pair<rsc_e, snic_e> convertToServerNIC(const char* snic);
+        std::pair<rsc_e, uint16_t> convertToKeyframeInterval(const JsonObject json);
+        std::pair<rsc_e, std::map<uint16_t, uint16_t>> convertToKeyframeIntervalCustom(const JsonObject json);
     #if defined(MT11)
         std::pair<rsc_e, psram::map<uint16_t, psram::vector<std::string>>> convertToPublishIntervalCustom(const JsonObject json);
     #else
@@ -87,7 +87,7 @@ namespace muffin { namespace jvs {
         const auto retNotUsedKeys = removeNotUsedKeys(container);
         if (retNotUsedKeys.first != rsc_e::GOOD)
         {
-            LOG_ERROR(logger, retNotUsedKeys.second.c_str());
+            LOG_ERROR(logger, "%s", retNotUsedKeys.second.c_str());
 
             result.SetRSC(retNotUsedKeys.first);
             result.SetDescription(retNotUsedKeys.second);
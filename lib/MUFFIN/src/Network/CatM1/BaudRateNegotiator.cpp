@@ -0,0 +1,131 @@
+/**
+ * @file BaudRateNegotiator.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief LTE Cat.M1 모듈과 ESP32 사이의 UART 통신 속도를 협상하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#define MUFFIN_LOG_MODULE   muffin::log_module_e::CATM1
+
+#include "BaudRateNegotiator.h"
+#include "Common/Logger/Logger.h"
+
+
+
+namespace muffin {
+
+    const uint32_t BaudRateNegotiator::CANDIDATES[CANDIDATE_COUNT] = { 921600, 460800, 230400 };
+
+    BaudRateNegotiator::BaudRateNegotiator(const link_t& link)
+        : mLink(link)
+        , mCeiling(UINT32_MAX)
+    {
+    }
+
+    std::pair<Status, uint32_t> BaudRateNegotiator::Negotiate(const uint32_t currentBaudRate, const uint32_t maxBaudRate)
+    {
+        for (const auto baudRate : CANDIDATES)
+        {
+            if (baudRate > maxBaudRate || baudRate > mCeiling)
+            {
+                continue;
+            }
+
+            if (baudRate <= currentBaudRate)
+            {
+                break;
+            }
+
+            const Status ret = change(currentBaudRate, baudRate);
+            if (ret == Status::Code::GOOD)
+            {
+                LOG_INFO(logger, "Negotiated baud rate: %u bps", baudRate);
+                return std::make_pair(ret, baudRate);
+            }
+            else if (ret == Status::Code::BAD_NOT_CONNECTED)
+            {
+                return std::make_pair(ret, currentBaudRate);
+            }
+        }
+
+        return std::make_pair(Status(Status::Code::BAD_NO_COMMUNICATION), currentBaudRate);
+    }
+
+    uint32_t BaudRateNegotiator::GetCeiling() const
+    {
+        return mCeiling;
+    }
+
+    Status BaudRateNegotiator::change(const uint32_t previous, const uint32_t baudRate)
+    {
+        /**
+         * @note 모뎀은 기존 속도로 "OK"를 응답한 다음에 새로운 속도로 전환합니다.
+         */
+        Status ret = mLink.SendCommand("AT+IPR=" + std::to_string(baudRate), COMMAND_TIMEOUT_MILLIS);
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_WARNING(logger, "MODEM REJECTED %u bps: %s", baudRate, ret.c_str());
+            return ret;
+        }
+
+        mLink.SetBaudRate(baudRate);
+        mLink.Delay(SWITCH_DELAY_MILLIS);
+
+        ret = verify();
+        if (ret == Status::Code::GOOD)
+        {
+            return ret;
+        }
+
+        /**
+         * @note 배선의 한계로 간헐적으로만 응답하는 속도는 모뎀을 재설정한 다음에도 다시 시도하지 않습니다.
+         */
+        mCeiling = baudRate - 1;
+        LOG_WARNING(logger, "FAILED TO VERIFY %u bps. FALLS BACK TO %u bps", baudRate, previous);
+        return rollBack(previous, baudRate);
+    }
+
+    Status BaudRateNegotiator::verify()
+    {
+        for (uint8_t i = 0; i < VERIFY_COUNT; ++i)
+        {
+            if (mLink.Probe() != Status::Code::GOOD)
+            {
+                return Status(Status::Code::BAD_NO_COMMUNICATION);
+            }
+        }
+        return Status(Status::Code::GOOD);
+    }
+
+    Status BaudRateNegotiator::rollBack(const uint32_t previous, const uint32_t baudRate)
+    {
+        /**
+         * @note 새로운 속도에서 보낸 명령이 모뎀에 전달되지 않았을 수 있으므로 이전 속도에서
+         *       응답할 때까지 다시 보냅니다.
+         */
+        for (uint8_t i = 0; i < MAX_ROLLBACK_COUNT; ++i)
+        {
+            mLink.SetBaudRate(baudRate);
+            mLink.Write("AT+IPR=" + std::to_string(previous));
+            mLink.Delay(SWITCH_DELAY_MILLIS);
+            mLink.SetBaudRate(previous);
+            mLink.Delay(SWITCH_DELAY_MILLIS);
+
+            if (mLink.Probe() == Status::Code::GOOD)
+            {
+                return Status(Status::Code::BAD_NO_COMMUNICATION);
+            }
+        }
+
+        LOG_ERROR(logger, "LOST THE MODEM WHILE FALLING BACK TO %u bps", previous);
+        return Status(Status::Code::BAD_NOT_CONNECTED);
+    }
+}
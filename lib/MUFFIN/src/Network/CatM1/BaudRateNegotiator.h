@@ -0,0 +1,87 @@
+/**
+ * @file BaudRateNegotiator.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief LTE Cat.M1 모듈과 ESP32 사이의 UART 통신 속도를 협상하는 클래스를 선언합니다.
+ * @details 후보 속도를 높은 순서대로 AT+IPR 명령으로 변경하고, 변경된 속도에서 모뎀이 연속으로
+ *          응답하는지 확인합니다. 확인에 실패한 속도는 다시 시도하지 않도록 상한을 낮추고, 모뎀을
+ *          이전 속도로 되돌린 다음 다음 후보로 내려갑니다. UART와 모뎀에 대한 접근은 link_t로
+ *          주입하므로 호스트에서도 검증할 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <sys/_stdint.h>
+#include <utility>
+
+#include "Common/Status.h"
+
+
+
+namespace muffin {
+
+    class BaudRateNegotiator
+    {
+    public:
+        typedef struct BaudRateLinkType
+        {
+            /**
+             * @brief 명령을 보내고 "OK" 또는 "ERROR" 응답을 기다립니다.
+             */
+            std::function<Status(const std::string&, const uint32_t)> SendCommand;
+            /**
+             * @brief 응답을 기다리지 않고 명령을 보냅니다.
+             */
+            std::function<void(const std::string&)> Write;
+            /**
+             * @brief ESP32 쪽 UART의 통신 속도만 변경합니다.
+             */
+            std::function<void(const uint32_t)> SetBaudRate;
+            /**
+             * @brief 현재 속도에서 "AT" 명령에 모뎀이 응답하는지 확인합니다.
+             */
+            std::function<Status()> Probe;
+            std::function<void(const uint32_t)> Delay;
+        } link_t;
+    public:
+        explicit BaudRateNegotiator(const link_t& link);
+        virtual ~BaudRateNegotiator() {}
+    public:
+        /**
+         * @param currentBaudRate 모뎀과 ESP32가 현재 사용하고 있는 통신 속도
+         * @param maxBaudRate 보드의 배선으로 사용할 수 있는 최대 통신 속도
+         * @return 협상을 마친 다음 양쪽이 사용하는 통신 속도로, 실패하면 currentBaudRate입니다.
+         * @return BAD_NO_COMMUNICATION 더 높은 속도로 변경하지 못한 경우
+         * @return BAD_NOT_CONNECTED 모뎀을 이전 속도로 되돌리지 못해 모뎀을 재설정해야 하는 경우
+         */
+        std::pair<Status, uint32_t> Negotiate(const uint32_t currentBaudRate, const uint32_t maxBaudRate);
+        /**
+         * @brief 확인에 실패한 속도보다 낮은 속도만 시도하도록 낮춘 상한으로, 초기값은 UINT32_MAX입니다.
+         */
+        uint32_t GetCeiling() const;
+    private:
+        Status change(const uint32_t previous, const uint32_t baudRate);
+        Status verify();
+        Status rollBack(const uint32_t previous, const uint32_t baudRate);
+    private:
+        static const uint8_t  CANDIDATE_COUNT       = 3;
+        static const uint32_t CANDIDATES[CANDIDATE_COUNT];
+        static const uint8_t  VERIFY_COUNT          = 3;
+        static const uint8_t  MAX_ROLLBACK_COUNT    = 5;
+        static const uint32_t SWITCH_DELAY_MILLIS   = 100;
+        static const uint32_t COMMAND_TIMEOUT_MILLIS = 300;
+    private:
+        link_t mLink;
+        uint32_t mCeiling;
+    };
+}
@@ -13,6 +13,8 @@
 
 
 
+#define MUFFIN_LOG_MODULE   muffin::log_module_e::CATM1
+
 #include <esp32-hal-gpio.h>
 #include <iomanip>
 #include <pins_arduino.h>
@@ -22,6 +24,7 @@
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
 #include "Common/Time/TimeUtils.h"
+#include "Common/Trace/Tracer.h"
 
 
 
@@ -29,13 +32,17 @@ namespace muffin {
 
     CatM1::state_e CatM1::mState = CatM1::state_e::NOT_INITIALIZED_YET;
     std::bitset<8> CatM1::mInitFlags;
-    std::bitset<6> CatM1::mConnFlags;
+    std::bitset<7> CatM1::mConnFlags;
     uint32_t CatM1::mLastInterruptMillis = 0;
 
 
     CatM1::CatM1()
         : xSemaphore(NULL)
         , mConfig(std::make_pair(false, jvs::config::CatM1()))
+        , mBaudRateNegotiator(makeBaudRateLink())
+    #if defined(CATM1_PPPOS)
+        , mPPPoS(mProcessor)
+    #endif
     {
         mInitFlags.reset();
         mConnFlags.reset();
@@ -127,6 +134,10 @@ namespace muffin {
             else
             {
                 LOG_WARNING(logger, "LTE Cat.M1 MODEM IS NOT AVAILABLE");
+                /**
+                 * @note 모뎀이 예기치 않게 재부팅되면 기본 통신 속도로 돌아가므로 기본 속도로 다시 시도합니다.
+                 */
+                restoreDefaultBaudRate();
             }
             
             if ((i + 1) == MAX_RETRY_COUNT)
@@ -138,6 +149,21 @@ namespace muffin {
             vTaskDelay(2 * SECOND_IN_MILLIS / portTICK_PERIOD_MS);
         }
 
+        if (mConnFlags.test(conn_flags_e::BAUD_NEGOTIATED) == false)
+        {
+            const Status ret = negotiateBaudRate();
+            if (ret == Status::Code::BAD_NOT_CONNECTED)
+            {
+                LOG_ERROR(logger, "RESET THE MODEM AFTER A FAILED BAUD RATE NEGOTIATION");
+                return Status(Status::Code::BAD_NO_COMMUNICATION);
+            }
+            else if (ret != Status::Code::GOOD)
+            {
+                LOG_WARNING(logger, "FAILED TO NEGOTIATE BAUD RATE. KEEPS %u bps", mProcessor.GetBaudRate());
+            }
+            mConnFlags.set(conn_flags_e::BAUD_NEGOTIATED);
+        }
+
         if (mConnFlags.test(conn_flags_e::PDP_CONFIGURED) == false &&
             configurePdpContext() != Status::Code::GOOD)
         {
@@ -193,6 +219,10 @@ namespace muffin {
 
         LOG_INFO(logger, "Disconnected the LTE Cat.M1 module");
         mState = state_e::CatM1_DISCONNECTED;
+    #if defined(CATM1_PPPOS)
+        abortDataMode();
+    #endif
+        restoreDefaultBaudRate();
 
         mInitFlags.reset(init_flags_e::APP_READY);
         mInitFlags.reset(init_flags_e::FUNCTIONS);
@@ -230,6 +260,12 @@ namespace muffin {
 
     IPAddress CatM1::GetIPv4() const
     {
+    #if defined(CATM1_PPPOS)
+        if (mProcessor.IsDataMode() == true)
+        {
+            return mPPPoS.GetIPv4();
+        }
+    #endif
         return IPAddress(0,0,0,0);
     }
 
@@ -319,14 +355,141 @@ namespace muffin {
     {
         mProcessor.StopUrcHandleTask(forOTA);
     }
+
+    bool CatM1::IsDataMode() const
+    {
+        return mProcessor.IsDataMode();
+    }
+
+#if defined(CATM1_PPPOS)
+    Status CatM1::StartDataMode()
+    {
+        if (mProcessor.IsDataMode() == true)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        if (mState != state_e::SUCCEDDED_TO_GET_IP)
+        {
+            LOG_ERROR(logger, "DATA MODE IS ONLY AVAILABLE AFTER GETTING IP ADDRESS");
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        const auto mutex = TakeMutex();
+        if (mutex.first != Status::Code::GOOD)
+        {
+            return mutex.first;
+        }
+
+        /**
+         * @note BG96은 AT+QIACT로 활성화한 컨텍스트에서 PPP 다이얼을 허용하지 않으므로
+         *       컨텍스트를 비활성화한 다음 같은 컨텍스트로 다이얼합니다.
+         */
+        sendCommand("AT+QIDEACT=1", 40 * 1000);
+        mConnFlags.reset(conn_flags_e::PDP_ACTIVATED);
+
+        Status ret = sendCommand("ATD*99***1#", 10 * 1000, "CONNECT");
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "FAILED TO ENTER DATA MODE: %s", ret.c_str());
+            mState = state_e::CatM1_DISCONNECTED;
+            ReleaseMutex();
+            return ret;
+        }
+
+        mProcessor.RegisterCallbackDataMode([this](const uint8_t* data, size_t length)
+        {
+            mPPPoS.Input(data, length);
+        });
+        mPPPoS.RegisterCallbackLinkDown(std::bind(&CatM1::onEventLinkDown, this));
+        mProcessor.SetDataMode(true);
+
+        ret = mPPPoS.Start(30 * 1000);
+        if (ret != Status::Code::GOOD)
+        {
+            /**
+             * @note 모듈이 데이터 모드에 남아 있어 AT 명령을 받을 수 없으므로 모니터링 태스크가
+             *       모듈을 재시작하도록 합니다.
+             */
+            abortDataMode();
+            mState = state_e::CatM1_DISCONNECTED;
+            ReleaseMutex();
+            return ret;
+        }
+
+        ReleaseMutex();
+        LOG_INFO(logger, "LTE Cat.M1 module has entered data mode");
+        return Status(Status::Code::GOOD);
+    }
+
+    Status CatM1::StopDataMode()
+    {
+        if (mProcessor.IsDataMode() == false)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        const auto mutex = TakeMutex();
+        if (mutex.first != Status::Code::GOOD)
+        {
+            return mutex.first;
+        }
+
+        /**
+         * @note LCP 종료가 끝나면 모듈이 "NO CARRIER"를 보내고 명령 모드로 돌아옵니다.
+         */
+        Status ret = mPPPoS.Stop(false);
+        mProcessor.SetDataMode(false);
+
+        vTaskDelay(1000 / portTICK_PERIOD_MS);
+        while (mProcessor.GetAvailableBytes() > 0)
+        {
+            mProcessor.Read();
+        }
+
+        if (ret != Status::Code::GOOD || sendCommand("AT", 3 * 1000) != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "FAILED TO RETURN TO COMMAND MODE");
+            mState = state_e::CatM1_DISCONNECTED;
+            ReleaseMutex();
+            return Status(Status::Code::BAD_NO_COMMUNICATION);
+        }
+
+        ReleaseMutex();
+        LOG_INFO(logger, "LTE Cat.M1 module has returned to command mode");
+        return Status(Status::Code::GOOD);
+    }
+
+    void CatM1::abortDataMode()
+    {
+        if (mProcessor.IsDataMode() == false)
+        {
+            return;
+        }
+
+        mPPPoS.Stop(true);
+        mProcessor.SetDataMode(false);
+    }
+
+    void CatM1::onEventLinkDown()
+    {
+        LOG_WARNING(logger, "PPP LINK HAS BEEN LOST");
+        mState = state_e::CatM1_DISCONNECTED;
+    }
+#endif
     
     std::pair<Status, size_t> CatM1::TakeMutex()
     {
+        tracer.Begin(trace_event_e::NIC_LOCK_WAIT);
         if (xSemaphoreTake(xSemaphore, 2000)  != pdTRUE)
         {
+            tracer.End(trace_event_e::NIC_LOCK_WAIT);
+            tracer.Fault(trace_event_e::LOCK_TIMEOUT);
             LOG_WARNING(logger, "FAILED TO TAKE MUTEX FOP LTE Cat.M1. TRY LATER.");
             return std::make_pair(Status(Status::Code::BAD_TOO_MANY_OPERATIONS), mMutexHandle);
         }
+        tracer.End(trace_event_e::NIC_LOCK_WAIT);
+        tracer.Begin(trace_event_e::NIC_LOCK);
 
         ++mMutexHandle;
         return std::make_pair(Status(Status::Code::GOOD), mMutexHandle);
@@ -334,6 +497,7 @@ namespace muffin {
 
     Status CatM1::ReleaseMutex()
     {
+        tracer.End(trace_event_e::NIC_LOCK);
         xSemaphoreGive(xSemaphore);
         return Status(Status::Code::GOOD);
     }
@@ -374,6 +538,16 @@ namespace muffin {
         return mProcessor.ReadBetweenPatterns(patternBegin, patternEnd);
     }
 
+    bool CatM1::WaitForRxD(const uint32_t timeoutMillis)
+    {
+        return mProcessor.WaitForRxD(timeoutMillis);
+    }
+
+    uint32_t CatM1::GetBaudRate() const
+    {
+        return mProcessor.GetBaudRate();
+    }
+
     Status CatM1::isModemAvailable()
     {
         const std::string command = "AT";
@@ -409,6 +583,115 @@ namespace muffin {
         return Status(Status::Code::BAD_NO_COMMUNICATION);
     }
 
+    /**
+     * @note 설정을 저장(AT&W)하지 않으므로 모뎀이 재부팅되면 기본 속도인 115,200bps로 돌아갑니다.
+     */
+    Status CatM1::negotiateBaudRate()
+    {
+        if (mProcessor.HasFlowControlPins() == true)
+        {
+            if (sendCommand("AT+IFC=2,2", 300) == Status::Code::GOOD)
+            {
+                mProcessor.SetFlowControl(true);
+            }
+            else
+            {
+                LOG_WARNING(logger, "FAILED TO ENABLE FLOW CONTROL OF THE MODEM");
+            }
+        }
+
+        const std::pair<Status, uint32_t> ret = mBaudRateNegotiator.Negotiate(
+            mProcessor.GetBaudRate(), static_cast<uint32_t>(mProcessor.GetMaxBaudRate()));
+
+        if (ret.first == Status::Code::BAD_NOT_CONNECTED)
+        {
+            /**
+             * @note 모뎀이 응답하지 않는 속도에 남아 있으므로 재설정하여 기본 속도로 되돌립니다.
+             */
+            resetModule();
+        }
+        return ret.first;
+    }
+
+    BaudRateNegotiator::link_t CatM1::makeBaudRateLink()
+    {
+        BaudRateNegotiator::link_t link;
+        link.SendCommand = [this](const std::string& command, const uint32_t timeoutMillis)
+        {
+            return sendCommand(command, timeoutMillis);
+        };
+        link.Write = [this](const std::string& command)
+        {
+            mProcessor.Write(command);
+        };
+        link.SetBaudRate = [this](const uint32_t baudRate)
+        {
+            mProcessor.SetBaudRate(static_cast<Processor::baudrate_e>(baudRate));
+        };
+        link.Probe = [this]()
+        {
+            return isModemAvailable();
+        };
+        link.Delay = [](const uint32_t delayMillis)
+        {
+            vTaskDelay(delayMillis / portTICK_PERIOD_MS);
+        };
+        return link;
+    }
+
+    void CatM1::restoreDefaultBaudRate()
+    {
+        if (mProcessor.GetBaudRate() != static_cast<uint32_t>(Processor::baudrate_e::BDR_115200))
+        {
+            mProcessor.SetBaudRate(Processor::baudrate_e::BDR_115200);
+        }
+
+        if (mProcessor.IsFlowControlEnabled() == true)
+        {
+            mProcessor.SetFlowControl(false);
+        }
+
+        mConnFlags.reset(conn_flags_e::BAUD_NEGOTIATED);
+    }
+
+    Status CatM1::sendCommand(const std::string& command, const uint32_t timeoutMillis, const std::string& expected)
+    {
+        const uint32_t startMillis = millis();
+        std::string rxd;
+
+        Status ret = mProcessor.Write(command);
+        if (ret == Status::Code::BAD_TOO_MANY_OPERATIONS)
+        {
+            LOG_WARNING(logger, "THE MODEM IS BUSY. TRY LATER");
+            return ret;
+        }
+
+        while (uint32_t(millis() - startMillis) < timeoutMillis)
+        {
+            while (mProcessor.GetAvailableBytes() > 0)
+            {
+                rxd += mProcessor.Read();
+            }
+
+            if (rxd.find(expected) != std::string::npos)
+            {
+                return Status(Status::Code::GOOD);
+            }
+            else if (rxd.find("ERROR") != std::string::npos || rxd.find("NO CARRIER") != std::string::npos)
+            {
+                return Status(Status::Code::BAD);
+            }
+
+            const uint32_t elapsedMillis = millis() - startMillis;
+            if (elapsedMillis < timeoutMillis)
+            {
+                mProcessor.WaitForRxD(timeoutMillis - elapsedMillis);
+            }
+        }
+
+        return Status(Status::Code::BAD_TIMEOUT);
+    }
+
     /**
      * @todo lexing, tokenizing 적용하여 판단하도록 로직 및 로거를 변경해야 함
      *       이를 위해 해외향지의 오퍼레이터 정보를 확인하는 것이 필요함
@@ -666,6 +949,10 @@ namespace muffin {
         }
 
         LOG_INFO(logger, "Reset LTE Cat.M1 module");
+    #if defined(CATM1_PPPOS)
+        abortDataMode();
+    #endif
+        restoreDefaultBaudRate();
         mInitFlags.reset(init_flags_e::APP_READY);
         mInitFlags.reset(init_flags_e::FUNCTIONS);
         mInitFlags.reset(init_flags_e::MODEM_BBP);
@@ -26,7 +26,11 @@
 #include <bitset>
 
 #include "JARVIS/Config/Network/CatM1.h"
+#include "Network/CatM1/BaudRateNegotiator.h"
 #include "Network/CatM1/Processor.h"
+#if defined(CATM1_PPPOS)
+    #include "Network/CatM1/PPPoS.h"
+#endif
 #include "Network/INetwork.h"
 #include "IM/Custom/Device/DeviceStatus.h"
 
@@ -74,7 +78,8 @@ namespace muffin {
             PDP_CONFIGURED    = 2,
             PDP_ACTIVATED     = 3,
             GOT_OPERATOR      = 4,
-            GOT_REGISTERED    = 5
+            GOT_REGISTERED    = 5,
+            BAUD_NEGOTIATED   = 6
         } conn_flags_e;
 
     public:
@@ -88,6 +93,18 @@ namespace muffin {
         state_e GetState() const;
         virtual Status SyncNTP() override;
         void KillUrcTask(bool forOTA);
+        /**
+         * @brief 모듈이 데이터 모드이면 AT 명령을 사용하는 기능(CatMQTT, CatHTTP, CatFS,
+         *        신호 품질 조회 등)은 사용할 수 없습니다.
+         */
+        bool IsDataMode() const;
+    #if defined(CATM1_PPPOS)
+        /**
+         * @brief 모듈을 데이터 모드로 전환하고 PPP 링크를 수립하여 lwIP 소켓을 사용할 수 있게 합니다.
+         */
+        Status StartDataMode();
+        Status StopDataMode();
+    #endif
     public:
         virtual std::pair<Status, size_t> TakeMutex() override;
         virtual Status ReleaseMutex() override;
@@ -95,11 +112,17 @@ namespace muffin {
         size_t GetAvailableBytes();
         int16_t Read();
         std::string ReadBetweenPatterns(const std::string& patternBegin, const std::string& patternEnd);
+        bool WaitForRxD(const uint32_t timeoutMillis);
+        uint32_t GetBaudRate() const;
         Status GetSignalQuality(catm1_report_t* _struct);
         Status GetICCID(std::string* _ICCID);
         Status GetIMEI(std::string* _IMEI);
     private:
         Status isModemAvailable();
+        Status negotiateBaudRate();
+        BaudRateNegotiator::link_t makeBaudRateLink();
+        void restoreDefaultBaudRate();
+        Status sendCommand(const std::string& command, const uint32_t timeoutMillis, const std::string& expected = "OK");
         Status checkOperator();
         Status checkRegistration();
         Status configurePdpContext();
@@ -107,6 +130,10 @@ namespace muffin {
         void getPdpContext();
     private:
         void resetModule();
+    #if defined(CATM1_PPPOS)
+        void abortDataMode();
+        void onEventLinkDown();
+    #endif
         void onEventRDY();
         void onEventCFUN();
         void onEventCPIN(const std::string& state);
@@ -126,9 +153,13 @@ namespace muffin {
         SemaphoreHandle_t xSemaphore;
         
         std::pair<bool, jvs::config::CatM1> mConfig;
+        BaudRateNegotiator mBaudRateNegotiator;
+    #if defined(CATM1_PPPOS)
+        PPPoS mPPPoS;
+    #endif
         static state_e mState;
         static std::bitset<8> mInitFlags;
-        static std::bitset<6> mConnFlags;
+        static std::bitset<7> mConnFlags;
     #if defined(MODLINK_L)
         const uint8_t mPinStatus = 19;
         const uint8_t mPinReset  = 21;
@@ -0,0 +1,212 @@
+/**
+ * @file PPPoS.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief LTE Cat.M1 모듈의 데이터 모드에서 lwIP PPP 인터페이스를 관리하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#if defined(CATM1_PPPOS)
+
+#include <string.h>
+
+#include "Common/Logger/Logger.h"
+#include "PPPoS.h"
+
+
+
+namespace muffin {
+
+    PPPoS::PPPoS(Processor& processor)
+        : mProcessor(processor)
+        , mPCB(nullptr)
+        , xLinkEvent(NULL)
+        , mIsConnected(false)
+        , mIsStopping(false)
+    {
+        memset(&mNetif, 0, sizeof(mNetif));
+    }
+
+    PPPoS::~PPPoS()
+    {
+        Stop(true);
+
+        if (xLinkEvent != NULL)
+        {
+            vSemaphoreDelete(xLinkEvent);
+            xLinkEvent = NULL;
+        }
+    }
+
+    Status PPPoS::Start(const uint32_t timeoutMillis)
+    {
+        if (mIsConnected == true)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        if (xLinkEvent == NULL)
+        {
+            xLinkEvent = xSemaphoreCreateBinary();
+            if (xLinkEvent == NULL)
+            {
+                LOG_ERROR(logger, "FAILED TO CREATE SEMAPHORE");
+                return Status(Status::Code::BAD_OUT_OF_MEMORY);
+            }
+        }
+
+        if (mPCB == nullptr)
+        {
+            mPCB = pppapi_pppos_create(&mNetif, output, onLinkStatus, this);
+            if (mPCB == nullptr)
+            {
+                LOG_ERROR(logger, "FAILED TO CREATE PPP CONTROL BLOCK");
+                return Status(Status::Code::BAD_OUT_OF_MEMORY);
+            }
+
+            ppp_set_usepeerdns(mPCB, 1);
+        }
+
+        xSemaphoreTake(xLinkEvent, 0);
+        mIsStopping = false;
+
+        /**
+         * @note 모듈이 "CONNECT"를 보낸 직후부터 LCP 협상을 시작하며, 처음 몇 개의 프레임이
+         *       모듈에 전달되지 못하더라도 LCP의 재전송 타이머에 의해 다시 전송됩니다.
+         */
+        if (pppapi_connect(mPCB, 0) != ERR_OK)
+        {
+            LOG_ERROR(logger, "FAILED TO START PPP NEGOTIATION");
+            return Status(Status::Code::BAD_UNEXPECTED_ERROR);
+        }
+
+        if (xSemaphoreTake(xLinkEvent, pdMS_TO_TICKS(timeoutMillis)) != pdTRUE || mIsConnected == false)
+        {
+            LOG_ERROR(logger, "FAILED TO ESTABLISH PPP LINK");
+            return Status(Status::Code::BAD_TIMEOUT);
+        }
+
+        pppapi_set_default(mPCB);
+        LOG_INFO(logger, "PPP link is up. IPv4: %s", GetIPv4().toString().c_str());
+        return Status(Status::Code::GOOD);
+    }
+
+    Status PPPoS::Stop(const bool isCarrierLost)
+    {
+        if (mPCB == nullptr)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        mIsStopping = true;
+        if (xLinkEvent != NULL)
+        {
+            xSemaphoreTake(xLinkEvent, 0);
+        }
+
+        /**
+         * @note 모듈이 이미 데이터 모드를 벗어났다면 LCP 종료 요청에 응답할 수 없으므로
+         *       협상 없이 링크를 닫습니다.
+         */
+        const bool isDead = mPCB->phase == PPP_PHASE_DEAD;
+        pppapi_close(mPCB, isCarrierLost ? 1 : 0);
+        if (isDead == false && xLinkEvent != NULL && xSemaphoreTake(xLinkEvent, pdMS_TO_TICKS(10 * 1000)) != pdTRUE)
+        {
+            LOG_WARNING(logger, "PPP LINK DID NOT TERMINATE IN TIME");
+        }
+
+        if (pppapi_free(mPCB) != ERR_OK)
+        {
+            LOG_ERROR(logger, "FAILED TO RELEASE PPP CONTROL BLOCK");
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        mPCB = nullptr;
+        mIsConnected = false;
+        LOG_INFO(logger, "PPP link is down");
+        return Status(Status::Code::GOOD);
+    }
+
+    void PPPoS::Input(const uint8_t* data, const size_t length)
+    {
+        if (mPCB == nullptr)
+        {
+            return;
+        }
+
+        pppos_input_tcpip(mPCB, const_cast<u8_t*>(data), static_cast<int>(length));
+    }
+
+    bool PPPoS::IsConnected() const
+    {
+        return mIsConnected;
+    }
+
+    IPAddress PPPoS::GetIPv4() const
+    {
+        if (mIsConnected == false)
+        {
+            return IPAddress(0,0,0,0);
+        }
+
+        return IPAddress(ip4_addr_get_u32(netif_ip4_addr(&mNetif)));
+    }
+
+    void PPPoS::RegisterCallbackLinkDown(const std::function<void()>& cb)
+    {
+        mCallbackLinkDown = cb;
+    }
+
+    u32_t PPPoS::output(ppp_pcb* pcb, u8_t* data, u32_t length, void* ctx)
+    {
+        (void)pcb;
+        PPPoS* ppp = static_cast<PPPoS*>(ctx);
+        return static_cast<u32_t>(ppp->mProcessor.WriteRaw(data, length));
+    }
+
+    void PPPoS::onLinkStatus(ppp_pcb* pcb, int errorCode, void* ctx)
+    {
+        (void)pcb;
+        PPPoS* ppp = static_cast<PPPoS*>(ctx);
+        const bool wasConnected = ppp->mIsConnected;
+
+        switch (errorCode)
+        {
+        case PPPERR_NONE:
+            ppp->mIsConnected = true;
+            break;
+        case PPPERR_USER:
+            ppp->mIsConnected = false;
+            break;
+        default:
+            LOG_WARNING(logger, "PPP LINK ERROR: %d", errorCode);
+            ppp->mIsConnected = false;
+            break;
+        }
+
+        if (ppp->xLinkEvent != NULL)
+        {
+            xSemaphoreGive(ppp->xLinkEvent);
+        }
+
+        /**
+         * @note 호출자가 요청하지 않은 링크 종료만 알리며, 콜백은 lwIP 태스크에서 실행됩니다.
+         */
+        if (wasConnected == true && ppp->mIsConnected == false && ppp->mIsStopping == false)
+        {
+            if (ppp->mCallbackLinkDown != nullptr)
+            {
+                ppp->mCallbackLinkDown();
+            }
+        }
+    }
+}
+
+#endif
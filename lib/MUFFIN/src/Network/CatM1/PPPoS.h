@@ -0,0 +1,85 @@
+/**
+ * @file PPPoS.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief LTE Cat.M1 모듈의 데이터 모드에서 lwIP PPP 인터페이스를 관리하는 클래스를 선언합니다.
+ * @details 모듈이 "CONNECT" 응답과 함께 데이터 모드로 전환되면 UART로 송수신되는 바이트를
+ *          lwIP의 PPPoS(PPP over Serial) 인터페이스와 연결합니다. PPP 링크가 수립되면 기본
+ *          네트워크 인터페이스로 설정되므로 LwipMQTT, LwipHTTP 클라이언트를 그대로 사용할
+ *          수 있습니다.
+ *
+ * @note 빌드 플래그 CATM1_PPPOS가 정의된 경우에만 사용할 수 있으며, lwIP의 PPP 기능
+ *       (CONFIG_LWIP_PPP_SUPPORT)이 활성화된 프레임워크가 필요합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#if defined(CATM1_PPPOS)
+
+#include <functional>
+#include <IPAddress.h>
+#include <sdkconfig.h>
+
+#if !defined(CONFIG_LWIP_PPP_SUPPORT) || !CONFIG_LWIP_PPP_SUPPORT
+    #error "CATM1_PPPOS REQUIRES CONFIG_LWIP_PPP_SUPPORT"
+#endif
+
+#if defined(MT11)
+    #error "CATM1_PPPOS IS NOT SUPPORTED ON MT11 WHOSE LwIP CLIENTS USE W5500 SOCKETS"
+#endif
+
+#include <netif/ppp/pppapi.h>
+#include <netif/ppp/pppos.h>
+
+#include "Common/Status.h"
+#include "Network/CatM1/Processor.h"
+
+
+
+namespace muffin {
+
+    class PPPoS
+    {
+    public:
+        explicit PPPoS(Processor& processor);
+        virtual ~PPPoS();
+    public:
+        /**
+         * @brief 모듈이 데이터 모드로 전환된 다음에 호출해야 하며, PPP 링크가 수립될 때까지 대기합니다.
+         */
+        Status Start(const uint32_t timeoutMillis);
+        /**
+         * @param isCarrierLost 모듈이 이미 데이터 모드를 벗어난 경우 true로, LCP 종료 협상을 생략합니다.
+         */
+        Status Stop(const bool isCarrierLost);
+        void Input(const uint8_t* data, const size_t length);
+        bool IsConnected() const;
+        IPAddress GetIPv4() const;
+    public:
+        /**
+         * @brief 수립된 PPP 링크가 끊어지면 lwIP 태스크에서 호출됩니다.
+         */
+        void RegisterCallbackLinkDown(const std::function<void()>& cb);
+    private:
+        static u32_t output(ppp_pcb* pcb, u8_t* data, u32_t length, void* ctx);
+        static void onLinkStatus(ppp_pcb* pcb, int errorCode, void* ctx);
+    private:
+        Processor& mProcessor;
+        ppp_pcb* mPCB;
+        struct netif mNetif;
+        SemaphoreHandle_t xLinkEvent;
+        volatile bool mIsConnected;
+        volatile bool mIsStopping;
+        std::function<void()> mCallbackLinkDown;
+    };
+}
+
+#endif
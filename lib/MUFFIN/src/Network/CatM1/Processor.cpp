@@ -13,6 +13,9 @@
 
 
 
+#include <algorithm>
+#include <stdio.h>
+
 #include "Common/Logger/Logger.h"
 #include "Common/Assert.hpp"
 #include "IM/Custom/Constants.h"
@@ -33,9 +36,10 @@ namespace muffin {
      * communication with the network.
      * @note The variables starts with URC codes, which stands for
      * unsolicited response code in the AT command context to inform
-     * notifications to the device asynchronously.
+     * notifications to the device asynchronously. Each pattern is matched
+     * against the start of a received line by the UrcParser.
      */
-    const std::string urcRDY("\r\nRDY\r\n");
+    const std::string urcRDY("RDY\r\n");
 
     /**
      * @brief URC code indicates all function of the ME is initialized.
@@ -47,7 +51,7 @@ namespace muffin {
      *   - 1: full functionality (default)
      *   - 4: tx and rx of the ME is disabled, a.k.a. flight mode
      */
-    const std::string urcCFUN("\r\n+CFUN: 1\r\n");
+    const std::string urcCFUN("+CFUN: 1\r\n");
 
     /**
      * @brief urc code indicates the PIN state of the terminal adapter(TA).
@@ -59,13 +63,13 @@ namespace muffin {
      *   - "SIM PIN": MT is waiting for (U)SIM PIN to be given 
      *   - "SIM PUK": MT is waiting for (U)SIM PUK to be given
      */
-    const std::string urcCPIN("\r\n+CPIN: ");
+    const std::string urcCPIN("+CPIN: ");
 
     /**
      * @brief urc code indicates the SMS functionality is initialized.
      * @details check the SMS functionality of the ME after urcRDY.
      */
-    const std::string urcQIND("\r\n+QIND: SMS DONE\r\n");
+    const std::string urcQIND("+QIND: SMS DONE\r\n");
 
     /**
      * @brief urc code indicates the LTE module has finished booting up.
@@ -75,7 +79,7 @@ namespace muffin {
      * application processor (AP) has finished booting up and is ready to 
      * execute user applications or firmware.
      */
-    const std::string urcAPPRDY("\r\nAPP RDY\r\n");
+    const std::string urcAPPRDY("APP RDY\r\n");
 
     /**
      * @brief urc code indicates received a message from the mqtt topic.
@@ -88,8 +92,22 @@ namespace muffin {
      *      - <topic>       The topic that received from MQTT server.
      *      - <payload>     The payload that relates to the topic name.
      */
-    const std::string urcQMTRECV("\r\n+QMTRECV: ");
+    const std::string urcQMTRECV("+QMTRECV: ");
+    const std::string urcQMTRECVEnd("}\"\r\n");
     const std::string urcQMTSTAT("+QMTSTAT");
+
+    /**
+     * @brief urc code indicates the result of a publish request.
+     * @details reported once the packet is sent for QoS 0, or once the broker
+     * has acknowledged it for QoS 1 and 2. the list below shows the urc
+     * parameters and their definitions.
+     * 
+     *      - <socket>      MQTT socket identifier. The range is 0-5.
+     *      - <msgID>       The message identifier given to AT+QMTPUB.
+     *      - <result>      0: sent and acknowledged, 1: retransmitting, 2: failed
+     *      - <value>       The number of retransmissions when <result> is 1.
+     */
+    const std::string urcQMTPUB("+QMTPUB: ");
     const std::string errorCodeCME("+CME ERROR: ");
     const std::string errorCode("\r\r\nERROR\r\n");
 
@@ -105,14 +123,29 @@ namespace muffin {
     #else
     , mRxBufferSize(15*KILLOBYTE)
     #endif
-        , mRxBuffer(mRxBufferSize)
+        , mRxRing(2 * KILLOBYTE)
+        , mResponseRing(mRxBufferSize)
+        , mResponseOffset(0)
+        , mIsPumping(false)
+        , mIsDataMode(false)
         , mTimeoutMillis(50)
         , mBaudRate(baudrate_e::BDR_115200)
+        , mIsFlowControlEnabled(false)
         , xHandle(NULL)
         , xSemaphore(NULL)
+        , xRxEvent(NULL)
         , mTaskInterval(50)
     {
         mInitFlags.reset();
+
+        mUrcParser.Register(UrcParser::urc_e::RDY,      urcRDY,     false);
+        mUrcParser.Register(UrcParser::urc_e::CFUN,     urcCFUN,    false);
+        mUrcParser.Register(UrcParser::urc_e::CPIN,     urcCPIN,    true);
+        mUrcParser.Register(UrcParser::urc_e::QIND,     urcQIND,    false);
+        mUrcParser.Register(UrcParser::urc_e::APPRDY,   urcAPPRDY,  false);
+        mUrcParser.Register(UrcParser::urc_e::QMTRECV,  urcQMTRECV, true, urcQMTRECVEnd);
+        mUrcParser.Register(UrcParser::urc_e::QMTSTAT,  urcQMTSTAT, true);
+        mUrcParser.Register(UrcParser::urc_e::QMTPUB,   urcQMTPUB,  true);
     }
 
     Processor::~Processor()
@@ -127,6 +160,16 @@ namespace muffin {
             return Status(Status::Code::GOOD);
         }
 
+        if (mInitFlags.test(init_flags_e::RING_BUFFER_ALLOCATED) == false)
+        {
+            if (mRxRing.Init() != Status::Code::GOOD || mResponseRing.Init() != Status::Code::GOOD)
+            {
+                LOG_ERROR(logger, "FAILED TO ALLOCATE RING BUFFERS DUE TO OUT OF MEMEORY");
+                return Status(Status::Code::BAD_OUT_OF_MEMORY);
+            }
+            mInitFlags.set(init_flags_e::RING_BUFFER_ALLOCATED);
+        }
+
         if (mInitFlags.test(init_flags_e::SERIAL_PORT_INITIALIZED) == false)
         {
             mSerial.setTimeout(mTimeoutMillis);
@@ -148,6 +191,12 @@ namespace muffin {
                 LOG_ERROR(logger, "FAILED TO CREATE SEMAPHORE");
                 return Status(Status::Code::BAD_UNEXPECTED_ERROR);
             }
+            xRxEvent = xSemaphoreCreateBinary();
+            if (xRxEvent == NULL)
+            {
+                LOG_ERROR(logger, "FAILED TO CREATE SEMAPHORE");
+                return Status(Status::Code::BAD_UNEXPECTED_ERROR);
+            }
             mInitFlags.set(init_flags_e::TASK_SEMAPHORE_CREATED);
             LOG_INFO(logger, "Created task semaphore");
         }
@@ -168,6 +217,19 @@ namespace muffin {
             {
             case pdPASS:
                 mInitFlags.set(init_flags_e::PROCESSOR_TASK_CREATED);
+                /**
+                 * @note 수신 FIFO가 차거나 수신이 멈추면 UART 이벤트 태스크에서 바로 링 버퍼를 채우고
+                 *       URC 태스크를 깨워 주기를 기다리지 않고 데이터를 처리하도록 합니다.
+                 */
+                mSerial.onReceive([this]()
+                {
+                    pumpRxD();
+                    TaskHandle_t handle = xHandle;
+                    if (handle != NULL)
+                    {
+                        xTaskNotifyGive(handle);
+                    }
+                });
                 break;
             case pdFAIL:
                 LOG_ERROR(logger, "FAILED TO CREATE WITHOUT SPECIFIC REASON");
@@ -190,8 +252,55 @@ namespace muffin {
 
     Status Processor::SetBaudRate(const baudrate_e baudRate)
     {
-        assert(false);
-        return Status(Status::Code::BAD_SERVICE_UNSUPPORTED);
+        if (xSemaphoreTake(xSemaphore, 1000)  != pdTRUE)
+        {
+            LOG_WARNING(logger, "THE MODULE IS BUSY. TRY LATER.");
+            return Status(Status::Code::BAD_TOO_MANY_OPERATIONS);
+        }
+
+        mSerial.flush();
+        mSerial.updateBaudRate(static_cast<uint32_t>(baudRate));
+        mBaudRate = baudRate;
+        xSemaphoreGive(xSemaphore);
+
+        LOG_INFO(logger, "Set baud rate to %u bps", static_cast<uint32_t>(baudRate));
+        return Status(Status::Code::GOOD);
+    }
+
+    Status Processor::SetFlowControl(const bool enable)
+    {
+        if (HasFlowControlPins() == false)
+        {
+            return Status(Status::Code::BAD_NOT_SUPPORTED);
+        }
+
+        if (xSemaphoreTake(xSemaphore, 1000)  != pdTRUE)
+        {
+            LOG_WARNING(logger, "THE MODULE IS BUSY. TRY LATER.");
+            return Status(Status::Code::BAD_TOO_MANY_OPERATIONS);
+        }
+
+        bool isConfigured = true;
+        if (enable == true)
+        {
+            isConfigured = mSerial.setPins(mPinRxD, mPinTxD, mPinCTS, mPinRTS) &&
+                           mSerial.setHwFlowCtrlMode(UART_HW_FLOWCTRL_CTS_RTS, 64);
+        }
+        else
+        {
+            isConfigured = mSerial.setHwFlowCtrlMode(UART_HW_FLOWCTRL_DISABLE, 64);
+        }
+        xSemaphoreGive(xSemaphore);
+
+        if (isConfigured == false)
+        {
+            LOG_ERROR(logger, "FAILED TO CONFIGURE HARDWARE FLOW CONTROL");
+            return Status(Status::Code::BAD_CONFIGURATION_ERROR);
+        }
+
+        mIsFlowControlEnabled = enable;
+        LOG_INFO(logger, "Hardware flow control: %s", enable ? "enabled" : "disabled");
+        return Status(Status::Code::GOOD);
     }
 
     Status Processor::SetTimeout(const uint16_t timeout)
@@ -205,6 +314,26 @@ namespace muffin {
         return static_cast<uint32_t>(mBaudRate);
     }
 
+    Processor::baudrate_e Processor::GetMaxBaudRate() const
+    {
+        if (HasFlowControlPins() == true)
+        {
+            return baudrate_e::BDR_921600;
+        }
+
+        return baudrate_e::BDR_460800;
+    }
+
+    bool Processor::HasFlowControlPins() const
+    {
+        return mPinRTS >= 0 && mPinCTS >= 0;
+    }
+
+    bool Processor::IsFlowControlEnabled() const
+    {
+        return mIsFlowControlEnabled;
+    }
+
     uint32_t Processor::GetTimeout() const
     {
         return mTimeoutMillis;
@@ -212,21 +341,78 @@ namespace muffin {
 
     Status Processor::Write(const std::string& command)
     {
+        if (mIsDataMode.load(std::memory_order_acquire) == true)
+        {
+            LOG_WARNING(logger, "AT COMMANDS ARE NOT ALLOWED IN DATA MODE");
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
         if (xSemaphoreTake(xSemaphore, 1000)  != pdTRUE)
         {
             LOG_WARNING(logger, "THE MODULE IS BUSY. TRY LATER.");
             return Status(Status::Code::BAD_TOO_MANY_OPERATIONS);
         }
 
-        mSerial.println(command.c_str());
+        mSerial.write(reinterpret_cast<const uint8_t*>(command.data()), command.size());
+        mSerial.println();
         mSerial.flush();
         xSemaphoreGive(xSemaphore);
         return Status(Status::Code::GOOD);
     }
 
+    size_t Processor::WriteRaw(const uint8_t* data, const size_t length)
+    {
+        if (xSemaphoreTake(xSemaphore, 100)  != pdTRUE)
+        {
+            return 0;
+        }
+
+        const size_t written = mSerial.write(data, length);
+        xSemaphoreGive(xSemaphore);
+        return written;
+    }
+
+    void Processor::SetDataMode(const bool isDataMode)
+    {
+        if (xSemaphoreTake(xSemaphore, 1000)  != pdTRUE)
+        {
+            LOG_WARNING(logger, "THE MODULE IS BUSY. FORCES DATA MODE: %s", isDataMode ? "ON" : "OFF");
+            mIsDataMode.store(isDataMode, std::memory_order_release);
+            return;
+        }
+
+        /**
+         * @note 모드가 바뀌는 시점에 읽지 않은 응답은 다른 모드의 데이터와 섞이지 않도록 버립니다.
+         *       분석 중이던 줄은 URC 태스크가 모드 전환을 확인할 때 초기화합니다.
+         */
+        uint8_t chunk[128];
+        while (mResponseRing.Read(chunk, sizeof(chunk)) > 0)
+        {
+        }
+        mResponse.clear();
+        mResponseOffset = 0;
+        mIsDataMode.store(isDataMode, std::memory_order_release);
+        xSemaphoreGive(xSemaphore);
+
+        LOG_INFO(logger, "Data mode: %s", isDataMode ? "ON" : "OFF");
+    }
+
+    bool Processor::IsDataMode() const
+    {
+        return mIsDataMode.load(std::memory_order_acquire);
+    }
+
     size_t Processor::GetAvailableBytes()
     {
-        return mRxBuffer.GetAvailableBytes();
+        if (xSemaphoreTake(xSemaphore, 100)  != pdTRUE)
+        {
+            LOG_WARNING(logger, "THE MODULE IS BUSY. TRY LATER.");
+            return 0;
+        }
+
+        const size_t availableBytes = mResponse.length() - mResponseOffset + mResponseRing.GetAvailableBytes();
+        xSemaphoreGive(xSemaphore);
+        return availableBytes;
     }
 
     int16_t Processor::Read()
@@ -236,10 +422,17 @@ namespace muffin {
             LOG_WARNING(logger, "THE MODULE IS BUSY. TRY LATER.");
             return -1;
         }
-        // parseQMTRECV(&rxd);
-        // parseQMTSTAT(&rxd);
 
-        int16_t value = mRxBuffer.Read();
+        if (mResponseOffset == mResponse.length())
+        {
+            drainResponse();
+        }
+
+        int16_t value = -1;
+        if (mResponseOffset < mResponse.length())
+        {
+            value = static_cast<uint8_t>(mResponse[mResponseOffset++]);
+        }
         xSemaphoreGive(xSemaphore);
         return value;
     }
@@ -252,9 +445,148 @@ namespace muffin {
             return "";
         }
 
-        const std::vector<uint8_t> rxd= mRxBuffer.ReadBetweenPatterns(patternBegin, patternEnd);
+        drainResponse();
+
+        std::string rxd;
+        const size_t posBegin = mResponse.find(patternBegin, mResponseOffset);
+        if (posBegin != std::string::npos)
+        {
+            const size_t posEnd = mResponse.find(patternEnd, posBegin + patternBegin.length());
+            if (posEnd != std::string::npos)
+            {
+                const size_t length = posEnd + patternEnd.length() - posBegin;
+                rxd = mResponse.substr(posBegin, length);
+                mResponse.erase(posBegin, length);
+            }
+        }
+
         xSemaphoreGive(xSemaphore);
-        return std::string(rxd.begin(), rxd.end());
+        return rxd;
+    }
+
+    void Processor::drainResponse()
+    {
+        /**
+         * @note 이미 읽은 응답을 한꺼번에 지워 읽을 때마다 문자열의 앞부분을 지우지 않도록 합니다.
+         */
+        if (mResponseOffset > 0)
+        {
+            mResponse.erase(0, mResponseOffset);
+            mResponseOffset = 0;
+        }
+
+        uint8_t chunk[128];
+        size_t length = 0;
+        while ((length = mResponseRing.Read(chunk, sizeof(chunk))) > 0)
+        {
+            mResponse.append(reinterpret_cast<const char*>(chunk), length);
+        }
+
+        if (mResponse.length() > mRxBufferSize)
+        {
+            LOG_WARNING(logger, "BUFFER CAPACITY EXCEEDED. REMOVES THE OLDEST %u BYTES", mResponse.length() - mRxBufferSize);
+            mResponse.erase(0, mResponse.length() - mRxBufferSize);
+        }
+    }
+
+    void Processor::pumpRxD()
+    {
+        /**
+         * @note UART 이벤트 태스크와 URC 태스크가 모두 호출하므로 한 번에 한 태스크만 생산자가
+         *       되도록 합니다. 생산자가 되지 못한 태스크의 데이터는 생산 중인 태스크가 가져갑니다.
+         */
+        if (mIsPumping.exchange(true, std::memory_order_acquire) == true)
+        {
+            return;
+        }
+
+        uint8_t chunk[128];
+        while (mSerial.available() > 0)
+        {
+            const size_t vacant = mRxRing.GetCapacity() - mRxRing.GetAvailableBytes();
+            if (vacant == 0)
+            {
+                break;
+            }
+
+            const size_t length = mSerial.read(chunk, std::min(vacant, sizeof(chunk)));
+            if (length == 0)
+            {
+                break;
+            }
+            mRxRing.Write(chunk, length);
+        }
+
+        mIsPumping.store(false, std::memory_order_release);
+    }
+
+    void Processor::forwardResponse(const std::string& response)
+    {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(response.data());
+        size_t remained = response.length();
+        uint8_t retryCount = 0;
+
+        while (remained > 0)
+        {
+            const size_t written = mResponseRing.Write(data, remained);
+            data     += written;
+            remained -= written;
+            if (remained == 0)
+            {
+                break;
+            }
+
+            if (++retryCount > 100)
+            {
+                LOG_WARNING(logger, "BUFFER CAPACITY EXCEEDED. DISCARDS %u BYTES", remained);
+                break;
+            }
+            vTaskDelay(10 / portTICK_PERIOD_MS);
+        }
+    }
+
+    void Processor::dispatchUrc(const UrcParser::urc_e type, const std::string& urc)
+    {
+        switch (type)
+        {
+        case UrcParser::urc_e::RDY:
+            triggerCallbackRDY();
+            break;
+        case UrcParser::urc_e::CFUN:
+            triggerCallbackCFUN();
+            break;
+        case UrcParser::urc_e::CPIN:
+            parseCPIN(urc);
+            break;
+        case UrcParser::urc_e::QIND:
+            triggerCallbackQIND();
+            break;
+        case UrcParser::urc_e::APPRDY:
+            triggerCallbackAPPRDY();
+            break;
+        case UrcParser::urc_e::QMTRECV:
+            parseQMTRECV(urc);
+            break;
+        case UrcParser::urc_e::QMTSTAT:
+            parseQMTSTAT(urc);
+            break;
+        case UrcParser::urc_e::QMTPUB:
+            parseQMTPUB(urc);
+            break;
+        default:
+            break;
+        }
+    }
+
+    bool Processor::WaitForRxD(const uint32_t timeoutMillis)
+    {
+        if (xRxEvent == NULL)
+        {
+            vTaskDelay(mTaskInterval / portTICK_PERIOD_MS);
+            return false;
+        }
+
+        return xSemaphoreTake(xRxEvent, pdMS_TO_TICKS(timeoutMillis)) == pdTRUE;
     }
 
     void Processor::stopUrcHandleTask()
@@ -286,6 +618,7 @@ namespace muffin {
     void Processor::implementUrcHandleTask()
     {
         uint32_t statusReportMillis = millis(); 
+        bool wasDataMode = false;
 
         while (true)
         {
@@ -299,148 +632,84 @@ namespace muffin {
                 deviceStatus.SetTaskRemainedStack(task_name_e::CATM1_PROCESSOR_TASK, RemainedStackSize);
             }
 
-            if (mHasOTA == true)
+            /**
+             * @note UART 이벤트를 놓친 경우에 대비하여 주기마다 직접 링 버퍼를 채웁니다.
+             */
+            pumpRxD();
+
+            const bool isDataMode = mIsDataMode.load(std::memory_order_acquire);
+            if (isDataMode != wasDataMode)
+            {
+                mUrcParser.Reset();
+                wasDataMode = isDataMode;
+            }
+
+            std::string response;
+            std::string urc;
+            uint8_t chunk[128];
+            size_t length = 0;
+            while ((length = mRxRing.Read(chunk, sizeof(chunk))) > 0)
             {
-                while (mSerial.available() > 0)
+                if (isDataMode == true)
                 {
-                    mRxBuffer.Write(mSerial.read());
+                    if (mCallbackDataMode != nullptr)
+                    {
+                        mCallbackDataMode(chunk, length);
+                    }
+                    continue;
                 }
-                vTaskDelay(mTaskInterval / portTICK_PERIOD_MS);
-            }
-            else
-            {
-                if (xSemaphoreTake(xSemaphore, 100) != pdTRUE)
+
+                if (mHasOTA == true)
                 {
-                    LOG_WARNING(logger, "THE MODULE IS BUSY. TRY LATER");
+                    response.append(reinterpret_cast<const char*>(chunk), length);
                     continue;
                 }
-                
-                while (mSerial.available() > 0)
+
+                for (size_t index = 0; index < length; ++index)
                 {
-                    if (mRxBuffer.GetSize() < mRxBuffer.GetCapacity())
-                    {
-                        mRxBuffer.Write(mSerial.read());
-                    }
-                    else
+                    const UrcParser::urc_e type = mUrcParser.Feed(chunk[index], &response, &urc);
+                    if (type != UrcParser::urc_e::NONE)
                     {
-                        xSemaphoreGive(xSemaphore);
-                        vTaskDelay(100 / portTICK_PERIOD_MS);
-                        if (xSemaphoreTake(xSemaphore, 1000) != pdTRUE)
-                        {
-                            LOG_WARNING(logger, "THE MODULE IS BUSY. TRY LATER");
-                            continue;
-                        }
+                        dispatchUrc(type, urc);
                     }
                 }
 
-                // while (mSerial.available() > 0)
-                // {
-                //     mRxBuffer.Write(mSerial.read());
-                // }
-
-                parseRDY();
-                parseCFUN();
-                parseCPIN();
-                parseQIND();
-                parseAPPRDY();
-                parseQMTRECV();
-                parseQMTSTAT();
-
-                xSemaphoreGive(xSemaphore);
-                vTaskDelay(mTaskInterval / portTICK_PERIOD_MS);
+                if (response.length() >= sizeof(chunk))
+                {
+                    forwardResponse(response);
+                    response.clear();
+                    xSemaphoreGive(xRxEvent);
+                }
             }
 
-        
-        }
-    }
-
-    void Processor::wrapUrcHandleTask(void* pvParameters)
-    {
-        static_cast<Processor*>(pvParameters)->implementUrcHandleTask();
-    }
-
-    void Processor::parseRDY()
-    {
-        if (mRxBuffer.HasPattern(urcRDY) == false)
-        {
-            return;
-        }
-        else
-        {
-            if (mRxBuffer.Peek() == 0)
+            if (response.empty() == false)
             {
-                mRxBuffer.Read();
+                forwardResponse(response);
+                xSemaphoreGive(xRxEvent);
             }
 
-            mRxBuffer.RemovePattern(urcRDY);
-            triggerCallbackRDY();
-        }
-    }
-
-    void Processor::parseCFUN()
-    {
-        if (mRxBuffer.HasPattern(urcCFUN) == false)
-        {
-            return;
-        }
-        else
-        {
-            mRxBuffer.RemovePattern(urcCFUN);
-            triggerCallbackCFUN();
-        }
-    }
-
-    void Processor::parseCPIN()
-    {
-        if (mRxBuffer.HasPattern(urcCPIN) == false)
-        {
-            return;
-        }
-        else
-        {
-            std::vector<uint8_t> rxd = mRxBuffer.ReadBetweenPatterns(urcCPIN, "\r\n");
-            const std::string data(rxd.begin(), rxd.end());
-            const size_t posStart = data.find(" ") + 1;
-            const size_t posFinish = data.find("\r", posStart);
-            const std::string param = data.substr(posStart, posFinish-posStart);
-            triggerCallbackCPIN(param.c_str());
+            if (mRxRing.GetAvailableBytes() == 0)
+            {
+                ulTaskNotifyTake(pdTRUE, mTaskInterval / portTICK_PERIOD_MS);
+            }
         }
     }
 
-    void Processor::parseQIND()
+    void Processor::wrapUrcHandleTask(void* pvParameters)
     {
-        if (mRxBuffer.HasPattern(urcQIND) == false)
-        {
-            return;
-        }
-        else
-        {
-            mRxBuffer.RemovePattern(urcQIND);
-            triggerCallbackQIND();
-        }
+        static_cast<Processor*>(pvParameters)->implementUrcHandleTask();
     }
 
-    void Processor::parseAPPRDY()
+    void Processor::parseCPIN(const std::string& data)
     {
-        if (mRxBuffer.HasPattern(urcAPPRDY) == false)
-        {
-            return;
-        }
-        else
-        {
-            mRxBuffer.RemovePattern(urcAPPRDY);
-            triggerCallbackAPPRDY();
-        }
+        const size_t posStart = urcCPIN.length();
+        const size_t posFinish = data.find("\r", posStart);
+        const std::string param = data.substr(posStart, posFinish-posStart);
+        triggerCallbackCPIN(param.c_str());
     }
 
-    void Processor::parseQMTRECV()
+    void Processor::parseQMTRECV(const std::string& vectorRxD)
     {
-        if (mRxBuffer.HasPattern(urcQMTRECV) == false)
-        {
-            return;
-        }
-        
-        std::vector<uint8_t> vectorRxD = mRxBuffer.ReadBetweenPatterns(urcQMTRECV, "}\"\r\n");
         std::vector<std::string> vectorToken;
         std::string currentToken;
         bool isFirstToken = true;
@@ -511,7 +780,7 @@ namespace muffin {
 
         if (vectorToken.size() != 4 || vectorToken[2].length() < 2 || vectorToken[3].length() < 2)
         {
-            LOG_ERROR(logger, "RxD: %s", std::string(vectorRxD.begin(), vectorRxD.end()).c_str());
+            LOG_ERROR(logger, "RxD: %s", vectorRxD.c_str());
             return;
         }
     
@@ -539,16 +808,8 @@ namespace muffin {
         // void triggerCallbackQMTRECV();
     }
 
-    void Processor::parseQMTSTAT()
+    void Processor::parseQMTSTAT(const std::string& data)
     {
-        if (mRxBuffer.HasPattern(urcQMTSTAT) == false)
-        {   
-            return;
-        }
-
-        std::vector<uint8_t> vectorRxD = mRxBuffer.ReadBetweenPatterns(urcQMTSTAT, "\r\n");
-        const std::string data(vectorRxD.begin(), vectorRxD.end());
-        
         LOG_INFO(logger,"rxd : %s",data.c_str());
 
         size_t idx = data.find(',');
@@ -596,6 +857,52 @@ namespace muffin {
         triggerCallbackQMTSTAT(socketID, errorCode);
     }
 
+    void Processor::parseQMTPUB(const std::string& data)
+    {
+        uint8_t socketID    = 0;
+        uint16_t messageID  = 0;
+        uint8_t result      = 0;
+        uint8_t value       = 0;
+
+        if (ParseQMTPUB(data, &socketID, &messageID, &result, &value) == false)
+        {
+            LOG_ERROR(logger, "INVALID RESPONSE: %s", data.c_str());
+            return;
+        }
+
+        triggerCallbackQMTPUB(socketID, messageID, result, value);
+    }
+
+    bool Processor::ParseQMTPUB(const std::string& data, uint8_t* socketID, uint16_t* messageID, uint8_t* result, uint8_t* value)
+    {
+        ASSERT((socketID != nullptr && messageID != nullptr && result != nullptr && value != nullptr), "OUTPUT PARAMETERS CANNOT BE NULL POINTERS");
+
+        const std::string prefix("+QMTPUB: ");
+        const size_t position = data.find(prefix);
+        if (position == std::string::npos)
+        {
+            return false;
+        }
+
+        unsigned int parsedSocketID  = 0;
+        unsigned int parsedMessageID = 0;
+        unsigned int parsedResult    = 0;
+        unsigned int parsedValue     = 0;
+        const int count = sscanf(data.c_str() + position + prefix.length(), "%u,%u,%u,%u",
+            &parsedSocketID, &parsedMessageID, &parsedResult, &parsedValue);
+
+        if (count < 3 || parsedSocketID > 5 || parsedMessageID > UINT16_MAX || parsedResult > 2)
+        {
+            return false;
+        }
+
+        *socketID   = static_cast<uint8_t>(parsedSocketID);
+        *messageID  = static_cast<uint16_t>(parsedMessageID);
+        *result     = static_cast<uint8_t>(parsedResult);
+        *value      = count == 4 ? static_cast<uint8_t>(parsedValue) : 0;
+        return true;
+    }
+
     void Processor::RegisterCallbackRDY(const std::function<void()>& cb)
     {
         mCallbackRDY = cb;
@@ -626,6 +933,16 @@ namespace muffin {
         mCallbackQMTSTAT = cb;
     }
 
+    void Processor::RegisterCallbackQMTPUB(const std::function<void(uint8_t, uint16_t, uint8_t, uint8_t)>& cb)
+    {
+        mCallbackQMTPUB = cb;
+    }
+
+    void Processor::RegisterCallbackDataMode(const std::function<void(const uint8_t*, size_t)>& cb)
+    {
+        mCallbackDataMode = cb;
+    }
+
     void Processor::triggerCallbackRDY()
     {
         if (mCallbackRDY != nullptr)
@@ -715,4 +1032,15 @@ namespace muffin {
             assert(mCallbackQMTSTAT);
         }
     }
-}
\ No newline at end of file
+
+    void Processor::triggerCallbackQMTPUB(const uint8_t socketID, const uint16_t messageID, const uint8_t result, const uint8_t value)
+    {
+        /**
+         * @note MQTT 클라이언트가 생성되기 전에는 콜백이 등록되지 않으므로 URC를 무시합니다.
+         */
+        if (mCallbackQMTPUB != nullptr)
+        {
+            mCallbackQMTPUB(socketID, messageID, result, value);
+        }
+    }
+}
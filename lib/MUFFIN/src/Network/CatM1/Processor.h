@@ -14,7 +14,7 @@
  * @todo LTE Cat.M1 모뎀 부팅 시 들어오는 URC 중 "QUSIM", "QMTRECV", "QMTSTAT" 메시지 처리 구현해야 함
  *       특히, QUSIM은 USIM 카드가 사용 가능한 상태인지와 같은 정보를 나타내는 것으로 보이는데 이에 대한 
  *       내용이 BG96 관련 문서에는 없어서 정확한 내용을 확인해야 합니다.
- * @todo mRxBuffer에 있는 데이터가 오랫동안 비워지지 않을 경우에 대한 처리를 구현해야 함
+ * @todo mResponseRing에 있는 데이터가 오랫동안 비워지지 않을 경우에 대한 처리를 구현해야 함
  * 
  * @copyright Copyright Edgecross Inc. (c) 2024
  */
@@ -24,11 +24,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <bitset>
 #include <HardwareSerial.h>
 
-#include "Common/DataStructure/CircularBuffer.h"
+#include "Common/DataStructure/SpscRingBuffer.h"
 #include "Common/Status.h"
+#include "Network/CatM1/UrcParser.h"
 
 
 
@@ -46,7 +48,25 @@ namespace muffin {
     #else
         const uint16_t mRxBufferSize;
     #endif
-        CircularBuffer mRxBuffer;
+        /**
+         * @brief UART 수신 이벤트에서 URC 태스크로 수신 데이터를 전달하는 버퍼입니다.
+         */
+        SpscRingBuffer mRxRing;
+        /**
+         * @brief URC 태스크에서 명령 응답을 읽는 태스크로 URC가 제거된 데이터를 전달하는 버퍼입니다.
+         */
+        SpscRingBuffer mResponseRing;
+        UrcParser mUrcParser;
+        /**
+         * @brief mResponseRing에서 꺼냈지만 아직 읽지 않은 응답으로, xSemaphore로 보호됩니다.
+         */
+        std::string mResponse;
+        size_t mResponseOffset;
+        std::atomic<bool> mIsPumping;
+        /**
+         * @brief 모듈이 데이터 모드이면 수신 데이터를 URC 분석 없이 데이터 모드 콜백으로 전달합니다.
+         */
+        std::atomic<bool> mIsDataMode;
         const uint16_t mTimeoutMillis;
     #ifdef MODLINK_L
         const uint8_t mPinTxD =  5;
@@ -58,6 +78,17 @@ namespace muffin {
         const uint8_t mPinTxD =  4;
         const uint8_t mPinRxD =  5;
     #endif
+        /**
+         * @brief RTS/CTS 핀이 모뎀과 연결된 보드에서만 빌드 플래그로 핀 번호를 지정합니다.
+         */
+    #if defined(CATM1_PIN_RTS) && defined(CATM1_PIN_CTS)
+        const int8_t mPinRTS = CATM1_PIN_RTS;
+        const int8_t mPinCTS = CATM1_PIN_CTS;
+    #else
+        const int8_t mPinRTS = -1;
+        const int8_t mPinCTS = -1;
+    #endif
+    public:
         typedef enum class BG96BaudRateEnum
             : uint32_t
         {
@@ -70,43 +101,83 @@ namespace muffin {
             BDR_460800      =  460800,
             BDR_921600      =  921600   // highest speed
         } baudrate_e;
+    private:
         baudrate_e mBaudRate;
+        bool mIsFlowControlEnabled;
 
     public:
         Status Init();
+        /**
+         * @brief ESP32 쪽 UART의 통신 속도만 변경합니다. 모뎀의 속도는 AT+IPR 명령으로 먼저 변경해야 합니다.
+         */
         Status SetBaudRate(const baudrate_e baudRate);
+        /**
+         * @return BAD_NOT_SUPPORTED RTS/CTS 핀이 연결되지 않은 보드인 경우
+         */
+        Status SetFlowControl(const bool enable);
         Status SetTimeout(const uint16_t timeout);
         uint32_t GetBaudRate() const;
+        /**
+         * @brief 보드의 배선으로 사용할 수 있는 최대 통신 속도를 반환합니다. 흐름 제어가 없으면
+         *        수신 FIFO가 넘치지 않도록 460,800bps로 제한합니다.
+         */
+        baudrate_e GetMaxBaudRate() const;
+        bool HasFlowControlPins() const;
+        bool IsFlowControlEnabled() const;
         uint32_t GetTimeout() const;
     public:
         Status Write(const std::string& command);
+        /**
+         * @brief 데이터 모드에서 PPP 프레임과 같은 원시 바이트를 그대로 전송합니다.
+         * @return size_t 전송한 바이트 수로, 다른 태스크가 포트를 사용 중이면 0입니다.
+         */
+        size_t WriteRaw(const uint8_t* data, const size_t length);
+        /**
+         * @brief 모듈이 "CONNECT" 응답으로 데이터 모드에 진입하거나 빠져나온 다음에 호출합니다.
+         */
+        void SetDataMode(const bool isDataMode);
+        bool IsDataMode() const;
         int16_t Read();
         std::string ReadBetweenPatterns(const std::string& patternBegin, const std::string& patternEnd);
         size_t GetAvailableBytes();
+        /**
+         * @brief 모듈로부터 새로운 데이터가 수신될 때까지 대기합니다.
+         * @return false 제한 시간 내에 수신된 데이터가 없는 경우
+         */
+        bool WaitForRxD(const uint32_t timeoutMillis);
         void StopUrcHandleTask(bool forOTA);
+    private:
+        void pumpRxD();
+        void forwardResponse(const std::string& response);
+        void drainResponse();
+        void dispatchUrc(const UrcParser::urc_e type, const std::string& urc);
     private:
         void stopUrcHandleTask();
         void implementUrcHandleTask();
         static void wrapUrcHandleTask(void* pvParameters);
     private:
-        void parseRDY();
-        void parseCFUN();
-        void parseCPIN();
-        void parseQIND();
-        void parseAPPRDY();
-        void parseQMTRECV();
-        void parseQMTSTAT();
+        void parseCPIN(const std::string& data);
+        void parseQMTRECV(const std::string& data);
+        void parseQMTSTAT(const std::string& data);
+        void parseQMTPUB(const std::string& data);
+    public:
+        /**
+         * @brief "+QMTPUB: <socket>,<msgID>,<result>[,<value>]" 형식의 URC를 해석합니다.
+         */
+        static bool ParseQMTPUB(const std::string& data, uint8_t* socketID, uint16_t* messageID, uint8_t* result, uint8_t* value);
     private:
         typedef enum LteModuleProcessorInitializationFlagEnum
             : uint8_t
         {
             SERIAL_PORT_INITIALIZED  = 0,
             TASK_SEMAPHORE_CREATED   = 1,
-            PROCESSOR_TASK_CREATED   = 2
+            PROCESSOR_TASK_CREATED   = 2,
+            RING_BUFFER_ALLOCATED    = 3
         } init_flags_e;
         std::bitset<4> mInitFlags;
         TaskHandle_t xHandle;
         SemaphoreHandle_t xSemaphore;
+        SemaphoreHandle_t xRxEvent;
         const uint8_t mTaskInterval;
         bool mHasOTA = false;
 
@@ -118,6 +189,8 @@ namespace muffin {
         void RegisterCallbackAPPRDY(const std::function<void()>& cb);
         // void RegisterCallbackQMTRECV(const std::function<void()>& cb);
         void RegisterCallbackQMTSTAT(const std::function<void(uint8_t, uint8_t)>& cb);
+        void RegisterCallbackQMTPUB(const std::function<void(uint8_t, uint16_t, uint8_t, uint8_t)>& cb);
+        void RegisterCallbackDataMode(const std::function<void(const uint8_t*, size_t)>& cb);
     private:
         void triggerCallbackRDY();
         void triggerCallbackCFUN();
@@ -126,6 +199,7 @@ namespace muffin {
         void triggerCallbackAPPRDY();
         // void triggerCallbackQMTRECV();
         void triggerCallbackQMTSTAT(const uint8_t socketID, const uint8_t errorCode);
+        void triggerCallbackQMTPUB(const uint8_t socketID, const uint16_t messageID, const uint8_t result, const uint8_t value);
     private:
         std::function<void()> mCallbackRDY;
         std::function<void()> mCallbackCFUN;
@@ -135,5 +209,7 @@ namespace muffin {
         // std::function<void()> mCallbackQMTRECV;
         std::function<void(uint8_t, uint8_t)> mCallbackQMTSTAT;
         std::function<void(uint8_t, uint8_t)> vCallbackQMTSTAT;
+        std::function<void(uint8_t, uint16_t, uint8_t, uint8_t)> mCallbackQMTPUB;
+        std::function<void(const uint8_t*, size_t)> mCallbackDataMode;
     };
 }
\ No newline at end of file
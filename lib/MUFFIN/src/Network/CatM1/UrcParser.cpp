@@ -0,0 +1,165 @@
+/**
+ * @file UrcParser.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief LTE Cat.M1 모듈의 수신 데이터에서 URC를 분류하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include "Common/Logger/Logger.h"
+#include "UrcParser.h"
+
+
+
+namespace muffin {
+
+    UrcParser::UrcParser()
+        : mState(state_e::MATCHING)
+        , mCurrent(nullptr)
+    {
+    }
+
+    void UrcParser::Register(const urc_e type, const std::string& pattern, const bool isPrefix, const std::string& terminator)
+    {
+        /**
+         * @note 진행 중인 URC가 등록된 패턴을 가리키고 있을 수 있으므로 분석 상태를 초기화합니다.
+         */
+        Reset();
+
+        pattern_t entry;
+        entry.Type        = type;
+        entry.Pattern     = pattern;
+        entry.Terminator  = terminator;
+        entry.IsPrefix    = isPrefix;
+        mPatterns.emplace_back(entry);
+    }
+
+    UrcParser::urc_e UrcParser::Feed(const uint8_t byte, std::string* response, std::string* urc)
+    {
+        switch (mState)
+        {
+        case state_e::MATCHING:
+        {
+            /**
+             * @note 모듈이 부팅되면서 "RDY" 앞에 NULL 문자를 보내는 경우가 있어 줄의 시작에서는 무시합니다.
+             */
+            if (mLine.empty() == true && byte == 0)
+            {
+                return urc_e::NONE;
+            }
+
+            mLine += static_cast<char>(byte);
+
+            bool isCandidate = false;
+            const pattern_t* pattern = match(&isCandidate);
+            if (pattern != nullptr && pattern->IsPrefix == false)
+            {
+                urc->swap(mLine);
+                mLine.clear();
+                return pattern->Type;
+            }
+            else if (pattern != nullptr)
+            {
+                mCurrent = pattern;
+                mState = state_e::IN_URC;
+                return urc_e::NONE;
+            }
+            else if (isCandidate == true)
+            {
+                return urc_e::NONE;
+            }
+
+            response->append(mLine);
+            mLine.clear();
+            mState = byte == '\n' ? state_e::MATCHING : state_e::PASS_THROUGH;
+            return urc_e::NONE;
+        }
+
+        case state_e::PASS_THROUGH:
+            response->push_back(static_cast<char>(byte));
+            if (byte == '\n')
+            {
+                mState = state_e::MATCHING;
+            }
+            return urc_e::NONE;
+
+        case state_e::IN_URC:
+            mLine += static_cast<char>(byte);
+            if (hasTerminator(*mCurrent) == true)
+            {
+                const urc_e type = mCurrent->Type;
+                urc->swap(mLine);
+                mLine.clear();
+                mCurrent = nullptr;
+                mState = state_e::MATCHING;
+                return type;
+            }
+            else if (mLine.length() > MAX_URC_LENGTH)
+            {
+                LOG_ERROR(logger, "URC EXCEEDED %u BYTES: %.32s", MAX_URC_LENGTH, mLine.c_str());
+                mLine.clear();
+                mCurrent = nullptr;
+                mState = byte == '\n' ? state_e::MATCHING : state_e::DISCARDING;
+            }
+            return urc_e::NONE;
+
+        case state_e::DISCARDING:
+            if (byte == '\n')
+            {
+                mState = state_e::MATCHING;
+            }
+            return urc_e::NONE;
+
+        default:
+            Reset();
+            return urc_e::NONE;
+        }
+    }
+
+    void UrcParser::Reset()
+    {
+        mLine.clear();
+        mCurrent = nullptr;
+        mState = state_e::MATCHING;
+    }
+
+    const UrcParser::pattern_t* UrcParser::match(bool* isCandidate) const
+    {
+        *isCandidate = false;
+
+        for (const auto& pattern : mPatterns)
+        {
+            if (mLine.length() < pattern.Pattern.length())
+            {
+                if (pattern.Pattern.compare(0, mLine.length(), mLine) == 0)
+                {
+                    *isCandidate = true;
+                }
+            }
+            else if (mLine.length() == pattern.Pattern.length() && mLine == pattern.Pattern)
+            {
+                return &pattern;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool UrcParser::hasTerminator(const pattern_t& pattern) const
+    {
+        const std::string& terminator = pattern.Terminator;
+        if (mLine.length() < pattern.Pattern.length() + terminator.length())
+        {
+            return false;
+        }
+
+        return mLine.compare(mLine.length() - terminator.length(), terminator.length(), terminator) == 0;
+    }
+}
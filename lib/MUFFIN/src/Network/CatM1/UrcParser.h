@@ -0,0 +1,91 @@
+/**
+ * @file UrcParser.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief LTE Cat.M1 모듈의 수신 데이터에서 URC를 분류하는 클래스를 선언합니다.
+ * @details 수신한 바이트를 한 번씩만 검사하는 줄 단위 상태 기계로, 줄의 시작이 URC 패턴과
+ *          일치하지 않는 순간 해당 줄은 명령 응답으로 즉시 전달합니다. 따라서 프롬프트('>')와
+ *          같이 줄바꿈으로 끝나지 않는 응답도 지연 없이 전달됩니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <string>
+#include <sys/_stdint.h>
+#include <vector>
+
+
+
+namespace muffin {
+
+    class UrcParser
+    {
+    public:
+        typedef enum class UrcTypeEnum
+            : uint8_t
+        {
+            NONE     = 0,
+            RDY      = 1,
+            CFUN     = 2,
+            CPIN     = 3,
+            QIND     = 4,
+            APPRDY   = 5,
+            QMTRECV  = 6,
+            QMTSTAT  = 7,
+            QMTPUB   = 8
+        } urc_e;
+    public:
+        UrcParser();
+        virtual ~UrcParser() {}
+    public:
+        /**
+         * @brief 분류할 URC 패턴을 등록합니다.
+         * @param pattern 줄의 시작부터 비교할 문자열입니다.
+         * @param isPrefix false이면 줄 전체가 pattern과 일치해야 하며, true이면 pattern으로
+         *        시작하는 줄을 terminator가 수신될 때까지 하나의 URC로 취급합니다.
+         */
+        void Register(const urc_e type, const std::string& pattern, const bool isPrefix, const std::string& terminator = "\r\n");
+        /**
+         * @brief 수신한 바이트 하나를 처리합니다.
+         * @param response URC가 아닌 것으로 판정된 바이트가 덧붙여집니다.
+         * @param urc URC 한 줄이 완성되면 해당 줄이 저장됩니다.
+         * @return urc_e 완성된 URC의 종류로, 완성된 URC가 없으면 NONE입니다.
+         */
+        urc_e Feed(const uint8_t byte, std::string* response, std::string* urc);
+        void Reset();
+    private:
+        typedef enum class ParserStateEnum
+            : uint8_t
+        {
+            MATCHING      = 0,
+            PASS_THROUGH  = 1,
+            IN_URC        = 2,
+            DISCARDING    = 3
+        } state_e;
+
+        typedef struct UrcPatternType
+        {
+            urc_e Type;
+            std::string Pattern;
+            std::string Terminator;
+            bool IsPrefix;
+        } pattern_t;
+    private:
+        const pattern_t* match(bool* isCandidate) const;
+        bool hasTerminator(const pattern_t& pattern) const;
+    private:
+        std::vector<pattern_t> mPatterns;
+        std::string mLine;
+        state_e mState;
+        const pattern_t* mCurrent;
+        const size_t MAX_URC_LENGTH = 8 * 1024;
+    };
+}
@@ -15,6 +15,8 @@
 
 
 
+#define MUFFIN_LOG_MODULE   muffin::log_module_e::W5500
+
 #include <sys/_stdint.h>
 
 #include "Common/Assert.hpp"
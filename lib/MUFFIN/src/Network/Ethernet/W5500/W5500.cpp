@@ -17,6 +17,8 @@
 
 
 
+#define MUFFIN_LOG_MODULE   muffin::log_module_e::W5500
+
 #include <esp32-hal-gpio.h>
 #include <vector>
 #include "Common/Assert.hpp"
@@ -53,7 +53,7 @@ namespace muffin { namespace ethernetIP {
         Status contains(const std::string& tag) const;
 
     private:
-        psram::vector<tag_batch_struct_t> mBatches;
+        psram::vector<tag_batch_struct_t, heap_tag_e::ETHERNET_IP> mBatches;
         size_t maxBatchSize;
     
     };
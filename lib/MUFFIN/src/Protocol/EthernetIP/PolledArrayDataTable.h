@@ -41,7 +41,8 @@ namespace muffin { namespace ethernetIP {
         void Clear();
 
     private:
-        psram::map<std::string, psram::map<size_t, cip_data_t>> mTagArrayData;
+        using indexMap = psram::map<size_t, cip_data_t, std::less<size_t>, heap_tag_e::ETHERNET_IP>;
+        psram::map<std::string, indexMap, std::less<std::string>, heap_tag_e::ETHERNET_IP> mTagArrayData;
     };
 
 }}
@@ -636,6 +636,8 @@ namespace muffin { namespace http {
         ASSERT((strlen(command) < (BUFFER_SIZE - 1)), "BUFFER OVERFLOW ERROR");
         
         const uint32_t timeoutMillis = TIMEOUT_IN_SECOND * SECOND_IN_MILLIS;
+        const uint32_t startMillis = millis();
+        uint32_t elapsedMillis;
         uint32_t errorCode;
         std::string rxd;
         size_t pos;
@@ -660,6 +662,13 @@ namespace muffin { namespace http {
             goto CME_ERROR;
         }
 
+        /**
+         * @note 모뎀과의 통신 속도 협상 결과를 확인할 수 있도록 다운로드 처리량을 기록합니다.
+         */
+        elapsedMillis = millis() - startMillis;
+        LOG_DEBUG(logger, "Downloaded %u bytes in %u ms: %u B/s at %u bps", length, elapsedMillis,
+            elapsedMillis == 0 ? 0 : static_cast<uint32_t>(static_cast<uint64_t>(length) * 1000 / elapsedMillis), catM1->GetBaudRate());
+
         ret = readUntilRSC(timeoutMillis, &rxd);
         if (ret != Status::Code::GOOD)
         {
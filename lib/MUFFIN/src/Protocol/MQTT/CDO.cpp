@@ -2,105 +2,427 @@
  * @file CDO.cpp
  * @author Lee, Sang-jin (lsj31@edgecross.ai)
  * @author Kim, Joo-sung (joosung5732@edgecross.ai)
- * 
- * @brief MQTT 브로커로부터 수신한 메시지를 집적하여 관리하는 클래스를 선언합니다.
- * 
- * @date 2025-01-22
- * @version 1.3.1
- * 
- * @copyright Copyright (c) Edgecross Inc. 2024-2025
+ *
+ * @brief 디바이스에서 생성된 모든 메시지를 MQTT 브로커로 전송하는 프로세스를 관리하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
  */
 
 
 
 
+#include <new>
+
 #include "CDO.h"
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/HeapStats.h"
+#include "OutboundLog.h"
+#include "PayloadCompressor.h"
 
+#if defined(MT11)
+    #include "Common/PSRAM.hpp"
+#endif
 
 
 
 namespace muffin { namespace mqtt {
 
+    MessageHandle::MessageHandle()
+        : mOwner(nullptr)
+        , mSlot(0)
+        , mLane(lane_e::BULK)
+    {
+    }
+
+    MessageHandle::MessageHandle(CDO* owner, const uint8_t slot, const lane_e lane)
+        : mOwner(owner)
+        , mSlot(slot)
+        , mLane(lane)
+    {
+    }
+
+    MessageHandle::MessageHandle(MessageHandle&& obj) noexcept
+        : mOwner(obj.mOwner)
+        , mSlot(obj.mSlot)
+        , mLane(obj.mLane)
+    {
+        obj.mOwner = nullptr;
+    }
+
+    MessageHandle& MessageHandle::operator=(MessageHandle&& obj) noexcept
+    {
+        if (this != &obj)
+        {
+            Release();
+            mOwner = obj.mOwner;
+            mSlot  = obj.mSlot;
+            mLane  = obj.mLane;
+            obj.mOwner = nullptr;
+        }
+        return *this;
+    }
+
+    MessageHandle::~MessageHandle()
+    {
+        Release();
+    }
+
+    bool MessageHandle::IsValid() const
+    {
+        return mOwner != nullptr;
+    }
+
+    lane_e MessageHandle::GetLane() const
+    {
+        return mLane;
+    }
+
+    const Message& MessageHandle::Get() const
+    {
+        ASSERT((mOwner != nullptr), "INVALID MESSAGE HANDLE");
+        return mOwner->mSlab[mSlot];
+    }
+
+    void MessageHandle::Release()
+    {
+        if (mOwner == nullptr)
+        {
+            return;
+        }
+
+        mOwner->releaseSlot(mSlot);
+        mOwner = nullptr;
+    }
+
+
     CDO::CDO()
     {
-        mQueueHandle = xQueueCreate(MAX_QUEUE_LENGTH, MESSAGE_SIZE);
-        if (mQueueHandle == NULL)
+    #if defined(MT11)
+        void* memory = psram::allocate(sizeof(Message) * MAX_QUEUE_LENGTH);
+        if (memory != nullptr)
+        {
+            mSlab = static_cast<Message*>(memory);
+            for (uint8_t slot = 0; slot < MAX_QUEUE_LENGTH; ++slot)
+            {
+                new (&mSlab[slot]) Message();
+            }
+        }
+    #else
+        mSlab = new(std::nothrow) Message[MAX_QUEUE_LENGTH];
+    #endif
+
+        mFreeSlotQueue = xQueueCreate(MAX_QUEUE_LENGTH, SLOT_INDEX_SIZE);
+        mPriorityQueue = xQueueCreate(MAX_QUEUE_LENGTH, SLOT_INDEX_SIZE);
+        mBulkQueue     = xQueueCreate(MAX_QUEUE_LENGTH, SLOT_INDEX_SIZE);
+        mDiagnosticQueue = xQueueCreate(DIAGNOSTIC_MAX_SLOTS, SLOT_INDEX_SIZE);
+
+        if (mSlab == nullptr || mFreeSlotQueue == NULL || mPriorityQueue == NULL || mBulkQueue == NULL || mDiagnosticQueue == NULL)
         {
             std::cerr << "\n\n\033[31m" << "FAILED TO ALLOCATE MEMORY FOR MESSAGE QUEUE" << std::endl;
             vTaskDelay(1000 / portTICK_PERIOD_MS);
             std::abort();
         }
+
+        mIsCoalesced.assign(MAX_QUEUE_LENGTH, 0);
+        for (uint8_t slot = 0; slot < MAX_QUEUE_LENGTH; ++slot)
+        {
+            xQueueSend(mFreeSlotQueue, &slot, 0);
+        }
     }
-    
+
     CDO::~CDO()
     {
-        vQueueDelete(mQueueHandle);
+        vQueueDelete(mDiagnosticQueue);
+        vQueueDelete(mBulkQueue);
+        vQueueDelete(mPriorityQueue);
+        vQueueDelete(mFreeSlotQueue);
+
+    #if defined(MT11)
+        for (uint8_t slot = 0; slot < MAX_QUEUE_LENGTH; ++slot)
+        {
+            mSlab[slot].~Message();
+        }
+        psram::deallocate(mSlab);
+    #else
+        delete[] mSlab;
+    #endif
     }
 
     uint8_t CDO::Count()
     {
-        return static_cast<uint8_t>(uxQueueMessagesWaiting(mQueueHandle));
+        return MAX_QUEUE_LENGTH - countFreeSlots();
     }
 
-    Status CDO::Store(const Message& message, const uint32_t timeoutMillis)
+    uint8_t CDO::Count(const lane_e lane)
+    {
+        return static_cast<uint8_t>(uxQueueMessagesWaiting(retrieveLaneQueue(lane)));
+    }
+
+    pressure_e CDO::GetPressure()
     {
-        ASSERT((Count() < MAX_QUEUE_LENGTH), "NO SPACE TO STORE: CHECK THE NUMBER OF STORED MESSAGE BY CALLING \"COUNT\" FUNCTION");
-        
-        Message* movedMessage = new(std::nothrow) Message(message);
-        ASSERT((movedMessage != nullptr), "MOVE OPERATION ON MQTT MESSAGE CANNOT FAIL");
-        
-        BaseType_t ret = xQueueSend(mQueueHandle, (void*)&movedMessage, static_cast<TickType_t>(timeoutMillis));
-        
-        if (ret == pdTRUE)
+        const uint8_t freeSlots = countFreeSlots();
+        if (freeSlots <= PRIORITY_RESERVED_SLOTS)
         {
-            return Status(Status::Code::GOOD);
+            return pressure_e::FULL;
+        }
+        else if ((MAX_QUEUE_LENGTH - freeSlots) >= SPILL_THRESHOLD)
+        {
+            return pressure_e::HIGH;
         }
         else
         {
-            delete movedMessage;
-            return Status(Status::Code::BAD);
+            return pressure_e::NORMAL;
         }
     }
 
-    std::pair<Status, Message> CDO::Retrieve(const uint32_t timeoutMillis)
+    Status CDO::Store(Message&& message, const uint32_t timeoutMillis)
     {
-        ASSERT((Count() != 0), "NO STORED MESSAGE FOUND: CHECK IF THERE'S A MESSAGE BY CALLING \"COUNT\" FUNCTION");
-        
-        Message* pMessage;
-        BaseType_t ret = xQueueReceive(mQueueHandle, &pMessage, static_cast<TickType_t>(timeoutMillis));
+        payloadCompressor.Compress(&message);
+        const lane_e lane = classify(message.GetTopicCode());
 
-        if (ret == pdTRUE)
+        if (lane == lane_e::DIAGNOSTIC)
         {
-            Message message = std::move(*pMessage);
-            delete pMessage;
-            return std::make_pair(Status(Status::Code::GOOD), message);
+            /**
+             * @note 진단 메시지가 주기 데이터의 슬롯을 차지하지 않도록 큐에 여유가 있을 때만 저장합니다.
+             */
+            uint8_t slot = 0;
+            if (GetPressure() != pressure_e::NORMAL ||
+                uxQueueSpacesAvailable(mDiagnosticQueue) == 0 ||
+                xQueueReceive(mFreeSlotQueue, &slot, 0) != pdTRUE)
+            {
+                return Status(Status::Code::BAD_WOULD_BLOCK);
+            }
+
+            mSlab[slot] = std::move(message);
+            heapStats.Allocate(heap_tag_e::CDO_MESSAGE, mSlab[slot].GetPayloadLength());
+            xQueueSend(mDiagnosticQueue, &slot, 0);
+            return Status(Status::Code::GOOD);
         }
-        else
+
+        if (lane == lane_e::BULK && GetPressure() != pressure_e::NORMAL)
+        {
+            if (outboundLog.IsInitialized() == true)
+            {
+                /**
+                 * @note 큐의 여유 공간이 부족한 경우에는 주기 데이터를 플래시 메모리에 저장합니다.
+                 *       저장된 메시지는 CDO가 비어있을 때 MQTT 태스크에서 발행됩니다.
+                 */
+                Status ret = outboundLog.Append(message);
+                if (ret == Status::Code::GOOD)
+                {
+                    return ret;
+                }
+                LOG_WARNING(logger, "FAILED TO SPILL MESSAGE TO FLASH: %s", ret.c_str());
+            }
+
+            if (GetPressure() == pressure_e::FULL)
+            {
+                LOG_WARNING(logger, "NO SPACE TO STORE BULK MESSAGE");
+                return Status(Status::Code::BAD_WOULD_BLOCK);
+            }
+        }
+
+        uint8_t slot = 0;
+        if (xQueueReceive(mFreeSlotQueue, &slot, pdMS_TO_TICKS(timeoutMillis)) != pdTRUE)
+        {
+            LOG_WARNING(logger, "NO SPACE TO STORE MESSAGE");
+            return Status(Status::Code::BAD_WOULD_BLOCK);
+        }
+
+        mSlab[slot] = std::move(message);
+        heapStats.Allocate(heap_tag_e::CDO_MESSAGE, mSlab[slot].GetPayloadLength());
+        BaseType_t ret = xQueueSend(retrieveLaneQueue(lane), &slot, 0);
+        ASSERT((ret == pdTRUE), "LANE QUEUE CANNOT BE FULL WHILE A SLOT IS AVAILABLE");
+        (void)ret;
+
+        return Status(Status::Code::GOOD);
+    }
+
+    Status CDO::Store(const Message& message, const uint32_t timeoutMillis)
+    {
+        Message copied(message);
+        return Store(std::move(copied), timeoutMillis);
+    }
+
+    Status CDO::PublishDiagnostic(const topic_e topic, const std::string& payload)
+    {
+        ASSERT((classify(topic) == lane_e::DIAGNOSTIC), "TOPIC DOES NOT BELONG TO THE DIAGNOSTIC LANE");
+
+        Status ret = Store(Message(topic, payload), 0);
+        if (ret != Status::Code::GOOD && topic != topic_e::LOG_STREAM)
         {
-            return std::make_pair(Status(Status::Code::BAD), Message());
+            LOG_WARNING(logger, "DROPPED DIAGNOSTIC MESSAGE: %s", ret.c_str());
         }
+        return ret;
     }
 
-    std::pair<Status, Message> CDO::Peek(const uint32_t timeoutMillis)
+    std::pair<Status, MessageHandle> CDO::Acquire()
     {
-        ASSERT((Count() != 0), "NO STORED MESSAGE FOUND: CHECK IF THERE'S A MESSAGE BY CALLING \"COUNT\" FUNCTION");
-    
-        Message* pMessage;
-        BaseType_t ret = xQueuePeek(mQueueHandle, &pMessage, static_cast<TickType_t>(timeoutMillis));
-      
-        if (ret == pdTRUE)
+        uint8_t slot = 0;
+        if (xQueueReceive(mPriorityQueue, &slot, 0) == pdTRUE)
         {
-            Message message = *pMessage;
-            return std::make_pair(Status(Status::Code::GOOD), message);
+            return std::make_pair(Status(Status::Code::GOOD), MessageHandle(this, slot, lane_e::PRIORITY));
+        }
+
+        if (xQueueReceive(mBulkQueue, &slot, 0) == pdTRUE)
+        {
+            return std::make_pair(Status(Status::Code::GOOD), MessageHandle(this, slot, lane_e::BULK));
+        }
+
+        if (xQueueReceive(mDiagnosticQueue, &slot, 0) == pdTRUE)
+        {
+            return std::make_pair(Status(Status::Code::GOOD), MessageHandle(this, slot, lane_e::DIAGNOSTIC));
+        }
+
+        return std::make_pair(Status(Status::Code::BAD_NO_DATA), MessageHandle());
+    }
+
+    std::pair<Status, MessageHandle> CDO::Adopt(Message&& message)
+    {
+        uint8_t slot = 0;
+        if (GetPressure() != pressure_e::NORMAL || xQueueReceive(mFreeSlotQueue, &slot, 0) != pdTRUE)
+        {
+            return std::make_pair(Status(Status::Code::BAD_WOULD_BLOCK), MessageHandle());
+        }
+
+        mSlab[slot] = std::move(message);
+        heapStats.Allocate(heap_tag_e::CDO_MESSAGE, mSlab[slot].GetPayloadLength());
+        return std::make_pair(Status(Status::Code::GOOD), MessageHandle(this, slot, lane_e::BULK));
+    }
+
+    Status CDO::Requeue(MessageHandle&& handle)
+    {
+        ASSERT((handle.mOwner == this), "MESSAGE HANDLE DOES NOT BELONG TO THIS CDO");
+
+        if (xQueueSendToFront(retrieveLaneQueue(handle.mLane), &handle.mSlot, 0) != pdTRUE)
+        {
+            return Status(Status::Code::BAD_UNEXPECTED_ERROR);
+        }
+
+        handle.mOwner = nullptr;
+        return Status(Status::Code::GOOD);
+    }
+
+    std::pair<Status, Message> CDO::Retrieve()
+    {
+        std::pair<Status, MessageHandle> handle = Acquire();
+        if (handle.first != Status::Code::GOOD)
+        {
+            return std::make_pair(handle.first, Message());
+        }
+
+        heapStats.Release(heap_tag_e::CDO_MESSAGE, mSlab[handle.second.mSlot].GetPayloadLength());
+        Message message(std::move(mSlab[handle.second.mSlot]));
+        return std::make_pair(Status(Status::Code::GOOD), std::move(message));
+    }
+
+    Status CDO::Coalesce(MessageHandle* target, MessageHandle* source, const size_t maxPayloadSize)
+    {
+        ASSERT((target->mOwner == this && source->mOwner == this), "MESSAGE HANDLE DOES NOT BELONG TO THIS CDO");
+
+        Message& into = mSlab[target->mSlot];
+        const Message& from = mSlab[source->mSlot];
+        if (into.GetTopicCode() != from.GetTopicCode() || into.IsCompressed() == true || from.IsCompressed() == true)
+        {
+            return Status(Status::Code::BAD_NOT_SUPPORTED);
+        }
+
+        const bool isCoalesced = mIsCoalesced[target->mSlot] != 0;
+        const char* intoPayload = into.GetPayload();
+        const char* fromPayload = from.GetPayload();
+        if (into.GetPayloadLength() == 0 || from.GetPayloadLength() == 0 ||
+            fromPayload[0] != '{' || (isCoalesced == false && intoPayload[0] != '{'))
+        {
+            return Status(Status::Code::BAD_NOT_SUPPORTED);
+        }
+
+        const size_t length = isCoalesced
+            ? into.GetPayloadLength() + 1 + from.GetPayloadLength()
+            : 1 + into.GetPayloadLength() + 1 + from.GetPayloadLength() + 1;
+        if (length > maxPayloadSize)
+        {
+            return Status(Status::Code::BAD_ENCODING_LIMITS_EXCEEDED);
+        }
+
+        std::string payload;
+        payload.reserve(length);
+        if (isCoalesced == true)
+        {
+            payload.append(intoPayload, into.GetPayloadLength() - 1);
         }
         else
         {
-            return std::make_pair(Status(Status::Code::BAD), Message());
+            payload.push_back('[');
+            payload.append(intoPayload, into.GetPayloadLength());
+        }
+        payload.push_back(',');
+        payload.append(fromPayload, from.GetPayloadLength());
+        payload.push_back(']');
+
+        heapStats.Release(heap_tag_e::CDO_MESSAGE, into.GetPayloadLength());
+        into.SetPayload(payload);
+        heapStats.Allocate(heap_tag_e::CDO_MESSAGE, into.GetPayloadLength());
+        mIsCoalesced[target->mSlot] = 1;
+        source->Release();
+        return Status(Status::Code::GOOD);
+    }
+
+    lane_e CDO::classify(const topic_e topic) const
+    {
+        switch (topic)
+        {
+        case topic_e::LAST_WILL:
+        case topic_e::JARVIS_RESPONSE:
+        case topic_e::JARVIS_INTERFACE_RESPONSE:
+        case topic_e::ALARM:
+        case topic_e::ERROR:
+        case topic_e::PUSH:
+        case topic_e::FOTA_STATUS:
+        case topic_e::REMOTE_CONTROL_RESPONSE:
+        case topic_e::SPARKPLUG_NBIRTH:
+        case topic_e::SPARKPLUG_NDEATH:
+            return lane_e::PRIORITY;
+        case topic_e::LOG_RESPONSE:
+        case topic_e::TRACE_RESPONSE:
+        case topic_e::REPLAY_RESPONSE:
+        case topic_e::LOG_STREAM:
+        case topic_e::METRICS:
+            return lane_e::DIAGNOSTIC;
+        default:
+            return lane_e::BULK;
+        }
+    }
+
+    QueueHandle_t CDO::retrieveLaneQueue(const lane_e lane) const
+    {
+        switch (lane)
+        {
+        case lane_e::PRIORITY:
+            return mPriorityQueue;
+        case lane_e::DIAGNOSTIC:
+            return mDiagnosticQueue;
+        default:
+            return mBulkQueue;
         }
     }
 
+    uint8_t CDO::countFreeSlots() const
+    {
+        return static_cast<uint8_t>(uxQueueMessagesWaiting(mFreeSlotQueue));
+    }
+
+    void CDO::releaseSlot(const uint8_t slot)
+    {
+        heapStats.Release(heap_tag_e::CDO_MESSAGE, mSlab[slot].GetPayloadLength());
+        mSlab[slot] = Message();
+        mIsCoalesced[slot] = 0;
+        xQueueSend(mFreeSlotQueue, &slot, 0);
+    }
+
 
     CDO cdo;
-}}
\ No newline at end of file
+}}
@@ -2,17 +2,22 @@
  * @file CDO.h
  * @author Lee, Sang-jin (lsj31@edgecross.ai)
  * @author Kim, Joo-sung (joosung5732@edgecross.ai)
- * 
+ *
  * @brief 디바이스에서 생성된 모든 메시지를 MQTT 브로커로 전송하는 프로세스를 관리하는 클래스를 선언합니다.
  * @details Centralized Outgoing-MQTT-messages Dispatcher(CDO) 클래스는 네트워크
  *          인터페이스의 유형에 구애받지 않고 디바이스에서 생성한 모든 메시지를 MQTT 브로커로 전송하는 프로세스를
  *          한 곳에 집적해서 관리하기 위한 기능을 제공합니다.
- * @todo 현재는 LTE Cat.M1 만 구현이 되어있습니다.
- * 
- * @date 2025-01-22
- * @version 1.3.1
- * 
- * @copyright Copyright (c) Edgecross Inc. 2024-2025
+ *
+ *          메시지는 미리 할당된 슬롯(slab)에 이동(move) 방식으로 저장되며, 알람 및 원격제어 응답과
+ *          같은 우선 메시지와 주기 데이터는 서로 다른 레인(lane)을 통해 전달됩니다. 우선 레인에는
+ *          전용 슬롯이 예약되어 있어 주기 데이터가 몰리더라도 항상 저장할 수 있습니다. 원격 로그와
+ *          같은 진단 메시지는 가장 낮은 우선순위의 레인으로 전달되며, 큐에 여유가 있을 때만 적은
+ *          수의 슬롯을 사용합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
  */
 
 
@@ -22,6 +27,7 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <vector>
 
 #include "Common/Status.h"
 #include "Include/Message.h"
@@ -30,22 +36,122 @@
 
 namespace muffin { namespace mqtt {
 
+    typedef enum class CdoLaneEnum
+        : uint8_t
+    {
+        PRIORITY    = 0,
+        BULK        = 1,
+        DIAGNOSTIC  = 2
+    } lane_e;
+
+    typedef enum class CdoPressureEnum
+        : uint8_t
+    {
+        NORMAL  = 0,
+        HIGH    = 1,
+        FULL    = 2
+    } pressure_e;
+
+
+    class CDO;
+
+    /**
+     * @brief CDO 슬롯에 저장된 메시지에 대한 이동 전용(move-only) 핸들입니다.
+     * @details 핸들이 소멸될 때 슬롯이 반환됩니다. 발행에 실패한 경우에는 CDO::Requeue()
+     *          함수를 호출하여 메시지를 레인의 맨 앞으로 되돌릴 수 있습니다.
+     */
+    class MessageHandle
+    {
+    public:
+        MessageHandle();
+        MessageHandle(MessageHandle&& obj) noexcept;
+        MessageHandle& operator=(MessageHandle&& obj) noexcept;
+        MessageHandle(const MessageHandle&) = delete;
+        MessageHandle& operator=(const MessageHandle&) = delete;
+        virtual ~MessageHandle();
+    public:
+        bool IsValid() const;
+        lane_e GetLane() const;
+        const Message& Get() const;
+        void Release();
+    private:
+        friend class CDO;
+        MessageHandle(CDO* owner, const uint8_t slot, const lane_e lane);
+    private:
+        CDO* mOwner;
+        uint8_t mSlot;
+        lane_e mLane;
+    };
+
+
     class CDO
     {
     public:
         CDO();
         virtual ~CDO();
     public:
+        /**
+         * @return 발행 중인 메시지를 포함하여 사용 중인 슬롯의 수
+         */
         uint8_t Count();
+        uint8_t Count(const lane_e lane);
+        pressure_e GetPressure();
+    public:
+        /**
+         * @return Status::Code::BAD_WOULD_BLOCK 저장할 공간이 없는 경우, 메시지 생산자는
+         *         메시지를 병합하거나 플래시 메모리에 저장하는 등의 조치를 취해야 합니다.
+         * @note 진단 레인의 메시지는 대기하거나 플래시 메모리에 저장하지 않으며, 로그를 남기지
+         *       않고 BAD_WOULD_BLOCK을 반환합니다.
+         * @note 저장에 실패한 경우에는 message를 옮기지 않으므로 같은 메시지로 다시 시도할 수 있습니다.
+         */
+        Status Store(Message&& message, const uint32_t timeoutMillis = 1000);
         Status Store(const Message& message, const uint32_t timeoutMillis = 1000);
-        std::pair<Status, Message> Retrieve(const uint32_t timeoutMillis = 1000);
-        std::pair<Status, Message> Peek(const uint32_t timeoutMillis = 1000);
+        /**
+         * @brief 진단 토픽의 메시지를 만들어 진단 레인에 저장합니다.
+         * @details 큐에 여유가 없으면 대기하지 않고 메시지를 버립니다. 로그 스트림은 로그 태스크에서
+         *          저장하므로 실패하더라도 로그를 남기지 않습니다.
+         * @return Status::Code::BAD_WOULD_BLOCK 메시지를 버린 경우
+         */
+        Status PublishDiagnostic(const topic_e topic, const std::string& payload);
+        std::pair<Status, MessageHandle> Acquire();
+        /**
+         * @brief 플래시 메모리에서 꺼낸 메시지를 레인에 넣지 않고 슬롯에 저장하여 핸들로 넘겨줍니다.
+         * @return BAD_WOULD_BLOCK 새로운 메시지를 저장할 슬롯이 부족한 경우
+         */
+        std::pair<Status, MessageHandle> Adopt(Message&& message);
+        Status Requeue(MessageHandle&& handle);
+        std::pair<Status, Message> Retrieve();
+        /**
+         * @brief source의 JSON 페이로드를 target에 병합하고 source의 슬롯을 반환합니다.
+         * @details 병합된 페이로드는 원본 JSON 객체들을 순서대로 담은 JSON 배열입니다.
+         * @return GOOD이 아닌 경우 두 핸들은 변경되지 않습니다. 토픽이 다르거나 압축된
+         *         메시지와 같이 병합할 수 없는 경우 BAD_NOT_SUPPORTED, 병합 결과가
+         *         maxPayloadSize를 넘는 경우 BAD_ENCODING_LIMITS_EXCEEDED를 반환합니다.
+         */
+        Status Coalesce(MessageHandle* target, MessageHandle* source, const size_t maxPayloadSize);
+    private:
+        friend class MessageHandle;
+        lane_e classify(const topic_e topic) const;
+        QueueHandle_t retrieveLaneQueue(const lane_e lane) const;
+        uint8_t countFreeSlots() const;
+        void releaseSlot(const uint8_t slot);
     private:
         const uint8_t MAX_QUEUE_LENGTH = 100;
-        const size_t MESSAGE_SIZE = sizeof(Message*);
-        QueueHandle_t mQueueHandle = NULL;
+        const uint8_t PRIORITY_RESERVED_SLOTS = 20;
+        const uint8_t SPILL_THRESHOLD = 70;
+        const uint8_t DIAGNOSTIC_MAX_SLOTS = 4;
+        const size_t SLOT_INDEX_SIZE = sizeof(uint8_t);
+        Message* mSlab = nullptr;
+        QueueHandle_t mFreeSlotQueue = NULL;
+        QueueHandle_t mPriorityQueue = NULL;
+        QueueHandle_t mBulkQueue = NULL;
+        QueueHandle_t mDiagnosticQueue = NULL;
+        /**
+         * @brief 슬롯의 페이로드가 Coalesce()로 만든 JSON 배열인지를 나타냅니다.
+         */
+        std::vector<uint8_t> mIsCoalesced;
     };
 
 
     extern CDO cdo;
-}}
\ No newline at end of file
+}}
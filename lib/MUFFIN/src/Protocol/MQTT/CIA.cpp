@@ -52,6 +52,11 @@ namespace muffin { namespace mqtt {
         BaseType_t ret = xQueueSend(mQueueHandle, (void*)&movedMessage, static_cast<TickType_t>(timeoutMillis));
         if (ret == pdTRUE)
         {
+            TaskHandle_t consumer = mConsumer;
+            if (consumer != NULL)
+            {
+                xTaskNotifyGive(consumer);
+            }
             return Status(Status::Code::GOOD);
         }
         else
@@ -60,6 +65,11 @@ namespace muffin { namespace mqtt {
         }
     }
 
+    void CIA::SetConsumer(TaskHandle_t consumer)
+    {
+        mConsumer = consumer;
+    }
+
     std::pair<Status, Message> CIA::Retrieve(const uint32_t timeoutMillis)
     {
         ASSERT((Count() != 0), "NO STORED MESSAGE FOUND: CHECK IF THERE'S A MESSAGE BY CALLING \"COUNT\" FUNCTION");
@@ -20,6 +20,7 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <freertos/task.h>
 
 #include "Common/Status.h"
 #include "Include/Message.h"
@@ -38,10 +39,17 @@ namespace muffin { namespace mqtt {
         Status Store(const Message& message, const uint32_t timeoutMillis = 1000);
         std::pair<Status, Message> Retrieve(const uint32_t timeoutMillis = 1000);
         std::pair<Status, Message> Peek(const uint32_t timeoutMillis = 1000);
+    public:
+        /**
+         * @brief 메시지가 저장될 때마다 태스크 알림을 받을 소비자 태스크를 등록합니다.
+         * @note 등록된 태스크는 ulTaskNotifyTake()로 대기하여 수신 메시지를 지연 없이 처리할 수 있습니다.
+         */
+        void SetConsumer(TaskHandle_t consumer);
     private:
         const uint8_t MAX_QUEUE_LENGTH = 10;
         const size_t MESSAGE_SIZE = sizeof(Message*);
         QueueHandle_t mQueueHandle = NULL;
+        volatile TaskHandle_t mConsumer = NULL;
     };
 
 
@@ -28,7 +28,14 @@ namespace muffin { namespace mqtt {
     CatMQTT::CatMQTT(BrokerInfo& broker, Message& lwt)
         : mBrokerInfo(std::move(broker))
         , mMessageLWT(std::move(lwt))
+        , xPublishResult(xSemaphoreCreateBinary())
+        , mIsPublishPending(false)
+        , mPendingMessageID(0)
+        , mPendingResult(0)
+        , mPendingValue(0)
+        , mNextMessageID(0)
     {
+        ASSERT((xPublishResult != NULL), "FAILED TO CREATE SEMAPHORE");
         mInitFlags.reset();
         mInitFlags.set(init_flag_e::ENABLE_LWT_MSG);
         mState = state_e::CONSTRUCTED;
@@ -47,6 +54,10 @@ namespace muffin { namespace mqtt {
         // ASSERT((mState != state_e::INITIALIZED), "REINITIALIZATION IS FORBIDDEN");
         mState = state_e::DISCONNECTED;
 
+        mInflightWindow.SetCapacity(mBrokerInfo.GetInflightWindow());
+        catM1->mProcessor.RegisterCallbackQMTPUB(std::bind(&CatMQTT::onEventQMTPUB, this,
+            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
+
         Status ret = Status(Status::Code::UNCERTAIN);
 
         if (mInitFlags.test(init_flag_e::INITIALIZED_PDP) == false)
@@ -118,6 +129,17 @@ namespace muffin { namespace mqtt {
             mInitFlags.set(init_flag_e::INITIALIZED_KAT);
         }        
 
+        if (mInitFlags.test(init_flag_e::INITIALIZED_SSN) == false)
+        {
+            ret = setSession(mutexHandle);
+            if (ret != Status::Code::GOOD)
+            {
+                LOG_ERROR(logger, "FAIL TO SET SESSION TYPE: %s", ret.c_str());
+                goto INIT_FAILED;
+            }
+            mInitFlags.set(init_flag_e::INITIALIZED_SSN);
+        }
+
         LOG_INFO(logger, "Initialized successfully");
         mInitFlags.set(init_flag_e::INITIALIZED_ALL);
         mState = (mState == state_e::CONNECTED) ? state_e::CONNECTED : state_e::INITIALIZED;
@@ -156,6 +178,7 @@ namespace muffin { namespace mqtt {
         }
         
         LOG_INFO(logger, "Connected to broker: %s", ret.c_str());
+        mInflightWindow.ExpireAll();
         mState = state_e::CONNECTED;
         return ret;
     }
@@ -495,7 +518,7 @@ namespace muffin { namespace mqtt {
     Status CatMQTT::Publish(const size_t mutexHandle, const Message& message)
     {
         // ASSERT((mState == state_e::CONNECTED), "MUST BE CONNECTED TO THE BROKER PRIOR TO \"Unsubscribe()\"");
-        ASSERT((strlen(message.GetPayload()) < 4097), "PAYLOAD SIZE CANNOT EXCEED 4,096 BYTES");
+        ASSERT((message.GetPayloadLength() <= MAX_PAYLOAD_SIZE), "PAYLOAD SIZE CANNOT EXCEED 4,096 BYTES");
         ASSERT((message.GetSocketID() == mBrokerInfo.GetSocketID()), 
             "INVALID SOCKET ID: \"Broker\": %u,  \"Message\": %u",
             static_cast<uint8_t>(mBrokerInfo.GetSocketID()), 
@@ -508,59 +531,168 @@ namespace muffin { namespace mqtt {
             return Status(Status::Code::BAD_REQUEST_CANCELLED_BY_CLIENT);
         }
 
-        const uint8_t msgSocketID   = static_cast<uint8_t>(message.GetSocketID());
-        const uint16_t msgMessageID = message.GetMessageID();
-        const uint8_t msgQoS        = static_cast<uint8_t>(message.GetQoS());
+        /**
+         * @note 결과 URC는 URC 태스크에서 처리되므로 명령을 전송하기 전에 대기 상태를 설정하고,
+         *       결과가 전달될 때까지 세마포어를 기다립니다.
+         */
+        xSemaphoreTake(xPublishResult, 0);
+        mPendingMessageID = message.GetMessageID();
+        mIsPublishPending = true;
+
+        Status ret = sendPublish(mutexHandle, message, message.GetMessageID(), message.GetQoS());
+        if (ret != Status::Code::GOOD)
+        {
+            mIsPublishPending = false;
+            LOG_ERROR(logger, "FAILED TO PUBLISH: %s", ret.c_str());
+            return ret;
+        }
+
+        const bool hasResult = xSemaphoreTake(xPublishResult, pdMS_TO_TICKS(PUBLISH_TIMEOUT_MILLIS)) == pdTRUE;
+        mIsPublishPending = false;
+        if (hasResult == false)
+        {
+            LOG_ERROR(logger, "FAILED TO PUBLISH: NO RESULT FROM THE MODULE");
+            return Status(Status::Code::BAD_TIMEOUT);
+        }
+
+        switch (mPendingResult)
+        {
+        case 0:
+            LOG_INFO(logger, "Packet sent successfully and received ACK from server: %u", static_cast<uint8_t>(mBrokerInfo.GetSocketID()));
+            return Status(Status::Code::GOOD);
+        case 1:
+            LOG_WARNING(logger, "RETRANSMITTING PUBLISH PACKETS: \"SocketID\": %u, \"Retrans\": %u", static_cast<uint8_t>(mBrokerInfo.GetSocketID()), mPendingValue);
+            return Status(Status::Code::UNCERTAIN);
+        case 2:
+            LOG_ERROR(logger, "FAILED TO SEND PUBLISH PACKETS: %u", static_cast<uint8_t>(mBrokerInfo.GetSocketID()));
+            return Status(Status::Code::BAD_REQUEST_NOT_COMPLETE);
+        default:
+            LOG_ERROR(logger, "UNDEFINED RESULT: %u", mPendingResult);
+            return Status(Status::Code::BAD_UNKNOWN_RESPONSE);
+        }
+    }
+
+    Status CatMQTT::Deliver(const size_t mutexHandle, MessageHandle* handle)
+    {
+        ASSERT((handle != nullptr && handle->IsValid() == true), "INVALID MESSAGE HANDLE");
+
+        if (mInflightWindow.GetCapacity() == 0)
+        {
+            return IMQTT::Deliver(mutexHandle, handle);
+        }
+
+        if (mState != state_e::CONNECTED)
+        {
+            LOG_ERROR(logger, "REQUEST FAILED: NOT CONNECTED TO THE BROKER");
+            return Status(Status::Code::BAD_REQUEST_CANCELLED_BY_CLIENT);
+        }
+
+        const Message& message = handle->Get();
+        ASSERT((message.GetPayloadLength() <= MAX_PAYLOAD_SIZE), "PAYLOAD SIZE CANNOT EXCEED 4,096 BYTES");
+
+        if (++mNextMessageID == 0)
+        {
+            mNextMessageID = 1;
+        }
+        const uint16_t messageID = mNextMessageID;
+
+        /**
+         * @note 결과 URC는 URC 태스크에서 처리되므로 명령을 전송하기 전에 윈도우에 먼저 등록합니다.
+         */
+        Status ret = mInflightWindow.Insert(messageID, std::move(*handle));
+        if (ret != Status::Code::GOOD)
+        {
+            return ret;
+        }
+
+        ret = sendPublish(mutexHandle, message, messageID, qos_e::QoS_1);
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_WARNING(logger, "NOT PUBLISHED: %s", ret.c_str());
+            mInflightWindow.Withdraw(messageID, handle);
+            return ret;
+        }
+
+        mInflightWindow.MarkSent(messageID);
+        return Status(Status::Code::GOOD);
+    }
+
+    Status CatMQTT::Poll(const size_t mutexHandle)
+    {
+        if (mInflightWindow.GetCapacity() == 0 || mState != state_e::CONNECTED)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        mInflightWindow.Retransmit(ACK_TIMEOUT_MILLIS,
+            [this, mutexHandle](const uint16_t messageID, const Message& message)
+            {
+                return sendPublish(mutexHandle, message, messageID, qos_e::QoS_1) == Status::Code::GOOD;
+            }
+        );
+        return Status(Status::Code::GOOD);
+    }
+
+    Status CatMQTT::Evict(MessageHandle* handle)
+    {
+        return mInflightWindow.Evict(handle);
+    }
+
+    Status CatMQTT::sendPublish(const size_t mutexHandle, const Message& message, const uint16_t messageID, const qos_e qos)
+    {
+        const uint8_t msgSocketID   = static_cast<uint8_t>(mBrokerInfo.GetSocketID());
+        const uint8_t msgQoS        = static_cast<uint8_t>(qos);
         const uint8_t msgRetain     = static_cast<uint8_t>(message.IsRetain());
-        const size_t msgLength      = strlen(message.GetPayload());
+        const size_t msgLength      = message.GetPayloadLength();
 
         const std::string command = "AT+QMTPUB="
             + std::to_string(msgSocketID)   + ","
-            + std::to_string(msgMessageID)  + ","
+            + std::to_string(messageID)     + ","
             + std::to_string(msgQoS)        + ","
             + std::to_string(msgRetain)     + ",\""
             + message.GetTopicString()      + "\","
             + std::to_string(msgLength);
 
-        const uint32_t timeoutMillis = 15 * 1000;
         const uint32_t startedMillis = millis();
         std::string rxd;
 
         Status ret = catM1->Execute(command, mutexHandle);
         if (ret != Status::Code::GOOD)
         {
-            LOG_ERROR(logger, "FAILED TO PUBLISH: %s", ret.c_str());
             return ret;
         }
 
         bool hasReadyToSendSignal = false;
-        while (uint32_t(millis() - startedMillis) < timeoutMillis)
+        while (hasReadyToSendSignal == false && uint32_t(millis() - startedMillis) < PUBLISH_TIMEOUT_MILLIS)
         {
             while (catM1->GetAvailableBytes() > 0)
             {
                 if (catM1->Read() == static_cast<int16_t>('>'))
                 {
                     hasReadyToSendSignal = true;
-                    goto HAS_RTS_SIGNAL;
+                    break;
                 }
             }
+
+            if (hasReadyToSendSignal == false)
+            {
+                catM1->WaitForRxD(PUBLISH_TIMEOUT_MILLIS - uint32_t(millis() - startedMillis));
+            }
         }
+
         if (hasReadyToSendSignal == false)
         {
             LOG_ERROR(logger, "FAILED TO PUBLISH DUE TO NO RTS"); // ready to send
             return Status(Status::Code::BAD_TIMEOUT);
         }
 
-HAS_RTS_SIGNAL:
-        ret = catM1->Execute(message.GetPayload(), mutexHandle);
+        ret = catM1->Execute(std::string(message.GetPayload(), msgLength), mutexHandle);
         if (ret != Status::Code::GOOD)
         {
-            LOG_ERROR(logger, "FAILED TO PUBLISH: %s", ret.c_str());
             return ret;
         }
 
-        ret = readUntilOKorERROR(timeoutMillis, &rxd);
-
+        ret = readUntilOKorERROR(PUBLISH_TIMEOUT_MILLIS, &rxd);
         if (ret != Status::Code::GOOD)
         {
             LOG_ERROR(logger, "FAILED TO PUBLISH: %s: %s", ret.c_str(),
@@ -568,109 +700,39 @@ HAS_RTS_SIGNAL:
             return ret;
         }
 
-        const std::string patternBegin = "\r\n+QMTPUB: ";
-        const std::string patternEnd   = "\r\n";
-        
-        if (rxd.find(patternBegin) == std::string::npos)
-        {
-            rxd.clear();
-        }
-        else if (rxd.find(patternBegin) != std::string::npos && 
-                 rxd.find(patternEnd)   == std::string::npos)
-        {
-            const size_t startPos = rxd.find(patternBegin);
-            rxd.erase(0, startPos);
-        }
-        else if (rxd.find(patternBegin) != std::string::npos && 
-                 rxd.find(patternEnd)   != std::string::npos)
-        {
-            const size_t startPos = rxd.find(patternBegin);
-            rxd.erase(0, startPos);
-            //LOG_DEBUG(logger, "goto the label \"PATTERN_FOUND\"");
-            goto PATTERN_FOUND;
-        }
-
-        while (millis() - startedMillis < timeoutMillis)
-        {
-            const std::string betweenPatterns = catM1->ReadBetweenPatterns(patternBegin, patternEnd);
-            if (betweenPatterns.length() == 0)
-            {
-                vTaskDelay(50 / portTICK_PERIOD_MS);
-                continue;
-            }
-            //LOG_DEBUG(logger, "RxD: %s", rxd.c_str());
-            rxd.append(betweenPatterns);
-            //LOG_DEBUG(logger, "RxD: %s", rxd.c_str());
-            break;
-        }
+        return ret;
+    }
 
-PATTERN_FOUND:
-        //LOG_DEBUG(logger, "RxD: %s", rxd.c_str());
-        std::vector<size_t> vecDelimiter;
-        vecDelimiter.emplace_back(rxd.find(' '));
-        if (vecDelimiter.front() == std::string::npos)
+    void CatMQTT::onEventQMTPUB(const uint8_t socketID, const uint16_t messageID, const uint8_t result, const uint8_t value)
+    {
+        if (socketID != static_cast<uint8_t>(mBrokerInfo.GetSocketID()))
         {
-            LOG_ERROR(logger, "UNKNOWN RESPONSE: %s", rxd.c_str());
-            return Status(Status::Code::BAD_UNKNOWN_RESPONSE);
+            return;
         }
 
-        size_t position = std::string::npos;
-        do
+        if (mIsPublishPending == true && messageID == mPendingMessageID)
         {
-            position = rxd.find(',', vecDelimiter.back() + 1);
-            if (position != std::string::npos && position != rxd.length())
-            {
-                vecDelimiter.emplace_back(position);
-            }
-        } while (position != std::string::npos);
-        vecDelimiter.emplace_back(rxd.find('\r', vecDelimiter.back() + 1));
-
-        constexpr uint8_t MINIMUM_DELIMITER_COUNT = 4;
-        constexpr uint8_t MAXIMUM_DELIMITER_COUNT = 5;
-        if (vecDelimiter.size() != MINIMUM_DELIMITER_COUNT && MAXIMUM_DELIMITER_COUNT != vecDelimiter.size())
-        {
-            LOG_ERROR(logger, "INVALID NUMBER OF DELIMITER: %s", rxd.c_str());
-            return Status(Status::Code::BAD_UNKNOWN_RESPONSE);
+            mPendingResult = result;
+            mPendingValue  = value;
+            xSemaphoreGive(xPublishResult);
+            return;
         }
 
-        std::vector<size_t>::iterator it = vecDelimiter.begin();
-        const std::string strSocketID  = rxd.substr(*it + 1, *(it + 1) - *it - 1);
-        const std::string strMessageID = rxd.substr(*(++it) + 1, *(it + 1) - *(it) - 1);
-        const std::string strResult    = rxd.substr(*(++it) + 1, *(it + 1) - *(it) - 1);
-        const std::string strRetrans   = (it + 1) == vecDelimiter.end() ?
-            "" : rxd.substr(*(++it) + 1, *(it + 1) - *(it) - 1);
-        const int32_t rxdSocketID  = Convert.ToInt32(strSocketID.c_str());
-        const int32_t rxdMessageID = Convert.ToInt32(strMessageID.c_str());
-        const int32_t rxdResult    = Convert.ToInt32(strResult.c_str());
-        const int32_t rxdRetrans   = strRetrans == "" ? 0 : Convert.ToInt32(strResult.c_str());
-
-        if (rxdSocketID == INT32_MAX || rxdMessageID == INT32_MAX || rxdResult == INT32_MAX || rxdRetrans == INT32_MAX)
-        {
-            //LOG_DEBUG(logger, "UNKNOWN RESPONSE: %s", rxd.c_str());
-            return Status(Status::Code::BAD_UNKNOWN_RESPONSE);
-        }
-        else if (rxdSocketID != msgSocketID || rxdMessageID != msgMessageID)
+        switch (result)
         {
-            //LOG_DEBUG(logger, "INVALID SOCKET OR MESSAGE ID: %u, %u", rxdSocketID, rxdMessageID);
-            return Status(Status::Code::BAD_UNKNOWN_RESPONSE);
-        }
-        else
-        {
-            switch (rxdResult)
+        case 0:
+            if (mInflightWindow.Acknowledge(messageID) != Status::Code::GOOD)
             {
-            case 0:
-                LOG_INFO(logger, "Packet sent successfully and received ACK from server: %u", rxdSocketID);
-                return Status(Status::Code::GOOD);
-            case 1:
-                LOG_WARNING(logger, "RETRANSMITTING PUBLISH PACKETS: \"SocketID\": %u, \"Retrans\": %u", rxdSocketID, rxdRetrans);
-                return Status(Status::Code::UNCERTAIN);
-            case 2:
-                LOG_ERROR(logger, "FAILED TO SEND PUBLISH PACKETS: %u", rxdSocketID);
-                return Status(Status::Code::BAD_REQUEST_NOT_COMPLETE);
-            default:
-                LOG_ERROR(logger, "UNDEFINED RESULT: %u", rxdResult);
-                return Status(Status::Code::BAD_UNKNOWN_RESPONSE);
+                LOG_WARNING(logger, "UNKNOWN MESSAGE ID ACKNOWLEDGED: %u", messageID);
             }
+            break;
+        case 1:
+            LOG_WARNING(logger, "RETRANSMITTING PUBLISH PACKETS: \"MessageID\": %u, \"Retrans\": %u", messageID, value);
+            break;
+        default:
+            LOG_ERROR(logger, "FAILED TO SEND PUBLISH PACKETS: \"MessageID\": %u", messageID);
+            mInflightWindow.Expire(messageID);
+            break;
         }
     }
 
@@ -868,6 +930,38 @@ PATTERN_FOUND:
         }
     }
 
+    Status CatMQTT::setSession(const size_t mutexHandle)
+    {
+        char command[32];
+        memset(command, '\0', sizeof(command));
+
+        const uint8_t socketID = static_cast<uint8_t>(mBrokerInfo.GetSocketID());
+        const uint8_t isCleanSession = mBrokerInfo.IsCleanSession() ? 1 : 0;
+
+        sprintf(command, "AT+QMTCFG=\"session\",%u,%u", socketID, isCleanSession);
+        const uint32_t timeoutMillis = 300;
+        std::string rxd;
+
+        Status ret = catM1->Execute(command, mutexHandle);
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "FAILED TO SET SESSION TYPE: %s", ret.c_str());
+            return ret;
+        }
+
+        ret = readUntilOKorERROR(timeoutMillis, &rxd);
+        if (ret == Status::Code::GOOD)
+        {
+            LOG_INFO(logger, "Clean session: %u", isCleanSession);
+            return ret;
+        }
+        else
+        {
+            LOG_ERROR(logger, "FAILED TO SET SESSION TYPE: %s", ret.c_str());
+            return ret;
+        }
+    }
+
 /*    Status CatMQTT::checkPdpContext()
     {
         ASSERT(false, "THE FUNCTION IS NOT IMPLEMENTED!");
@@ -1452,7 +1546,11 @@ PATTERN_FOUND:
             }
             else
             {
-                continue;
+                const uint32_t elapsedMillis = millis() - startMillis;
+                if (elapsedMillis < timeoutMillis)
+                {
+                    catM1->WaitForRxD(timeoutMillis - elapsedMillis);
+                }
             }
         }
 
@@ -1589,6 +1687,12 @@ PATTERN_FOUND:
         }
     }
 
+    size_t CatMQTT::GetMaxPayloadSize(const topic_e topic)
+    {
+        (void)topic;
+        return MAX_PAYLOAD_SIZE;
+    }
+
     Status CatMQTT::ResetTEMP()
     {
         mInitFlags.reset();
@@ -35,6 +35,8 @@
 #pragma once
 
 #include <bitset>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <vector>
 
 #include "Common/Status.h"
@@ -42,6 +44,7 @@
 #include "Protocol/MQTT/Include/BrokerInfo.h"
 #include "Protocol/MQTT/Include/Message.h"
 #include "Protocol/MQTT/IMQTT.h"
+#include "Protocol/MQTT/InflightWindow.h"
 
 
 
@@ -60,6 +63,13 @@ namespace muffin { namespace mqtt {
         virtual Status Subscribe(const size_t mutexHandle, const std::vector<Message>& messages) override;
         virtual Status Unsubscribe(const size_t mutexHandle, const std::vector<Message>& messages) override;
         virtual Status Publish(const size_t mutexHandle, const Message& message) override;
+        /**
+         * @brief 브로커 설정의 윈도우 크기만큼 결과 URC를 기다리지 않고 QoS 1 메시지를 연속으로 발행합니다.
+         */
+        virtual Status Deliver(const size_t mutexHandle, MessageHandle* handle) override;
+        virtual Status Poll(const size_t mutexHandle) override;
+        virtual Status Evict(MessageHandle* handle) override;
+        virtual size_t GetMaxPayloadSize(const topic_e topic) override;
         virtual Status ResetTEMP() override;
     public:
         void OnEventReset();
@@ -69,6 +79,7 @@ namespace muffin { namespace mqtt {
         Status setVersion(const size_t mutexHandle);
         Status setLastWill(const size_t mutexHandle);
         Status setKeepAlive(const size_t mutexHandle);
+        Status setSession(const size_t mutexHandle);
     private:
         // Status checkPdpContext();
         // Status checkSslContext();
@@ -82,13 +93,26 @@ namespace muffin { namespace mqtt {
         Status closeSession(const size_t mutexHandle);
     private:
         // void onEventQMTSTAT(const uint8_t socketID, const uint8_t errorCode);
+        void onEventQMTPUB(const uint8_t socketID, const uint16_t messageID, const uint8_t result, const uint8_t value);
+        Status sendPublish(const size_t mutexHandle, const Message& message, const uint16_t messageID, const qos_e qos);
         Status readUntilOKorERROR(const uint32_t timeoutMillis, std::string* rxd);
         Status processCmeErrorCode(const std::string& rxd);
     private:
         BrokerInfo mBrokerInfo;
         Message mMessageLWT;
+        const size_t MAX_PAYLOAD_SIZE = 4096;
         network::lte::pdp_ctx_e mContextPDP;
         network::lte::ssl_ctx_e mContextSSL;
+    private:
+        InflightWindow mInflightWindow;
+        SemaphoreHandle_t xPublishResult;
+        volatile bool mIsPublishPending;
+        uint16_t mPendingMessageID;
+        uint8_t mPendingResult;
+        uint8_t mPendingValue;
+        uint16_t mNextMessageID;
+        const uint32_t PUBLISH_TIMEOUT_MILLIS = 15 * 1000;
+        const uint32_t ACK_TIMEOUT_MILLIS = 30 * 1000;
     private:
         typedef enum CatMqttInitializationFlagEnum
             : uint8_t
@@ -100,8 +124,9 @@ namespace muffin { namespace mqtt {
             INITIALIZED_KAT   = 4, // Set if keep alive time is initialized, reset otherwise
             INITIALIZED_ALL   = 5, // Set if initialization succeded, reset otherwise
             ENABLE_LWT_MSG    = 6, // Set if LWT should be configured, reset otherwise
+            INITIALIZED_SSN   = 7, // Set if session type is initialized, reset otherwise
         } init_flag_e;
-        std::bitset<7> mInitFlags;
+        std::bitset<8> mInitFlags;
         typedef enum CatMqttStateEnum
             : int8_t
         {
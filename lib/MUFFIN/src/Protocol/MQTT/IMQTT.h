@@ -21,7 +21,9 @@
 
 #include "Common/Status.h"
 #include "Network/INetwork.h"
+#include "Protocol/MQTT/CDO.h"
 #include "Protocol/MQTT/Include/Message.h"
+#include "Protocol/MQTT/OutboundLog.h"
 
 
 
@@ -36,9 +38,61 @@ namespace muffin { namespace mqtt {
         virtual Status Connect(const size_t mutexHandle) = 0;
         virtual Status Disconnect(const size_t mutexHandle) = 0;
         virtual Status IsConnected() = 0;
+        /**
+         * @brief 마지막 연결에서 브로커가 이전 세션을 이어받았는지 여부를 반환합니다.
+         * @note 세션 유지 여부를 알 수 없는 클라이언트는 false를 반환하여 항상 다시 구독하도록 합니다.
+         */
+        virtual bool IsSessionPresent()
+        {
+            return false;
+        }
         virtual Status Subscribe(const size_t mutexHandle, const std::vector<Message>& messages) = 0;
         virtual Status Unsubscribe(const size_t mutexHandle, const std::vector<Message>& messages) = 0;
         virtual Status Publish(const size_t mutexHandle, const Message& message) = 0;
+        /**
+         * @brief CDO에서 꺼낸 메시지를 발행합니다. 발행이 완료되면 핸들을 해제하며, 확인 응답을
+         *        기다려야 하는 경우에는 핸들을 넘겨받아 응답을 수신한 뒤에 해제합니다. 플래시 메모리에서
+         *        꺼낸 메시지는 해제할 때 OutboundLog의 레코드를 지웁니다.
+         * @return GOOD이 아닌 경우 핸들은 호출자에게 남아 있으며, BAD_WOULD_BLOCK은 확인 응답을
+         *         기다리는 메시지가 너무 많아 잠시 후에 다시 시도해야 함을 의미합니다.
+         */
+        virtual Status Deliver(const size_t mutexHandle, MessageHandle* handle)
+        {
+            Status ret = Publish(mutexHandle, handle->Get());
+            if (ret == Status::Code::GOOD)
+            {
+                /**
+                 * @note QoS 0으로 발행하면 확인 응답이 없으므로 전송을 마치면 레코드를 지웁니다.
+                 */
+                const uint32_t sequence = handle->Get().GetOutboundSequence();
+                handle->Release();
+                if (sequence != 0)
+                {
+                    outboundLog.Acknowledge(sequence);
+                }
+            }
+            return ret;
+        }
+        /**
+         * @brief 확인 응답을 받지 못한 메시지의 재전송 등 발행 주기마다 필요한 처리를 수행합니다.
+         */
+        virtual Status Poll(const size_t mutexHandle)
+        {
+            (void)mutexHandle;
+            return Status(Status::Code::GOOD);
+        }
+        /**
+         * @brief 확인 응답을 받지 못한 메시지의 핸들을 하나씩 호출자에게 넘겨줍니다.
+         * @return BAD_NO_DATA 넘겨줄 메시지가 없는 경우
+         */
+        virtual Status Evict(MessageHandle*)
+        {
+            return Status(Status::Code::BAD_NO_DATA);
+        }
+        /**
+         * @brief 주어진 토픽으로 한 번에 발행할 수 있는 페이로드의 최대 크기를 반환합니다.
+         */
+        virtual size_t GetMaxPayloadSize(const topic_e topic) = 0;
         virtual Status ResetTEMP() = 0;
     };
 }}
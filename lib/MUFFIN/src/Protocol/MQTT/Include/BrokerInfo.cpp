@@ -33,6 +33,9 @@ namespace muffin { namespace mqtt {
         , mVersion(version)
         , mEnableSSL(enableSSL)
         , mEnableValidateCert(enableValidateCert)
+        , mPayloadFormat(payload_format_e::JSON)
+        , mInflightWindow(0)
+        , mIsCleanSession(false)
     {
         ASSERT((strlen(host) < 101), "HOST NAME CAN'T EXCEED 100 BYTES");
         ASSERT((0 < port), "INVALID PORT NUMBER");
@@ -50,6 +53,9 @@ namespace muffin { namespace mqtt {
         , mClientID(clientID)
         , mEnableSSL(enableSSL)
         , mEnableValidateCert(enableValidateCert)
+        , mPayloadFormat(payload_format_e::JSON)
+        , mInflightWindow(0)
+        , mIsCleanSession(false)
     {
         ASSERT((strlen(host) < 101), "HOST NAME CAN'T EXCEED 100 BYTES");
         ASSERT((0 < port), "INVALID PORT NUMBER");
@@ -68,6 +74,9 @@ namespace muffin { namespace mqtt {
         , mClientID(std::move(obj.mClientID))
         , mEnableSSL(std::move(obj.mEnableSSL))
         , mEnableValidateCert(std::move(obj.mEnableValidateCert))
+        , mPayloadFormat(std::move(obj.mPayloadFormat))
+        , mInflightWindow(std::move(obj.mInflightWindow))
+        , mIsCleanSession(std::move(obj.mIsCleanSession))
     {
     }
 
@@ -89,6 +98,9 @@ namespace muffin { namespace mqtt {
             mClientID           = obj.mClientID;
             mEnableSSL          = obj.mEnableSSL;
             mEnableValidateCert = obj.mEnableValidateCert;
+            mPayloadFormat      = obj.mPayloadFormat;
+            mInflightWindow     = obj.mInflightWindow;
+            mIsCleanSession     = obj.mIsCleanSession;
         }
 
         return *this;
@@ -106,7 +118,10 @@ namespace muffin { namespace mqtt {
             mVersion            == obj.mVersion      &&
             mClientID           == obj.mClientID     &&
             mEnableSSL          == obj.mEnableSSL    &&
-            mEnableValidateCert == obj.mEnableValidateCert
+            mEnableValidateCert == obj.mEnableValidateCert &&
+            mPayloadFormat      == obj.mPayloadFormat &&
+            mInflightWindow     == obj.mInflightWindow &&
+            mIsCleanSession     == obj.mIsCleanSession
         );
     }
 
@@ -215,6 +230,24 @@ namespace muffin { namespace mqtt {
         return Status(Status::Code::GOOD);
     }
 
+    Status BrokerInfo::SetPayloadFormat(const payload_format_e format)
+    {
+        mPayloadFormat = format;
+        return Status(Status::Code::GOOD);
+    }
+
+    Status BrokerInfo::SetInflightWindow(const uint8_t windowSize)
+    {
+        mInflightWindow = windowSize;
+        return Status(Status::Code::GOOD);
+    }
+
+    Status BrokerInfo::SetCleanSession(const bool isCleanSession)
+    {
+        mIsCleanSession = isCleanSession;
+        return Status(Status::Code::GOOD);
+    }
+
     const char* BrokerInfo::GetHost() const
     {
         return mHost.c_str();
@@ -274,6 +307,21 @@ namespace muffin { namespace mqtt {
         return mEnableValidateCert;
     }
 
+    payload_format_e BrokerInfo::GetPayloadFormat() const
+    {
+        return mPayloadFormat;
+    }
+
+    uint8_t BrokerInfo::GetInflightWindow() const
+    {
+        return mInflightWindow;
+    }
+
+    bool BrokerInfo::IsCleanSession() const
+    {
+        return mIsCleanSession;
+    }
+
     socket_e BrokerInfo::GetSocketID() const
     {
         return mSocketID;
@@ -47,6 +47,16 @@ namespace muffin { namespace mqtt {
         Status SetClientID(const std::string& clientID);
         Status EnableSSL(const bool enableSSL);
         Status EnableValidateCert(const bool enableValidateCert);
+        Status SetPayloadFormat(const payload_format_e format);
+        /**
+         * @brief 0보다 크면 CDO의 메시지를 QoS 1로 발행하며, 확인 응답을 기다릴 수 있는 최대 메시지 수를 의미합니다.
+         */
+        Status SetInflightWindow(const uint8_t windowSize);
+        /**
+         * @brief false이면 브로커가 연결이 끊어진 동안에도 구독 정보와 QoS 1 메시지를 보관하는
+         *        영구 세션으로 접속합니다. 클라이언트 ID가 재부팅 후에도 같아야 합니다.
+         */
+        Status SetCleanSession(const bool isCleanSession);
     public:
         const char* GetHost() const;
         uint16_t GetPort() const;
@@ -58,6 +68,9 @@ namespace muffin { namespace mqtt {
         const char* GetClientID() const;
         bool IsSslEnabled() const;
         bool IsValidateCert() const;
+        payload_format_e GetPayloadFormat() const;
+        uint8_t GetInflightWindow() const;
+        bool IsCleanSession() const;
     private:
         std::string mHost;
         uint16_t mPort;
@@ -69,5 +82,8 @@ namespace muffin { namespace mqtt {
         std::string mClientID;
         bool mEnableSSL;
         bool mEnableValidateCert;
+        payload_format_e mPayloadFormat;
+        uint8_t mInflightWindow;
+        bool mIsCleanSession;
     };
 }}
\ No newline at end of file
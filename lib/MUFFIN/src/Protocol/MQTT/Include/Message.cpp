@@ -34,6 +34,13 @@ namespace muffin { namespace mqtt {
         , mIsRetainSet(false)
         , mIsTopicSet(false)
         , mIsPayloadSet(false)
+        , mSocketID(socket_e::SOCKET_0)
+        , mMessageID(0)
+        , mQoS(qos_e::QoS_0)
+        , mRetainFlag(false)
+        , mTopicCode(topic_e::LAST_WILL)
+        , mIsCompressed(false)
+        , mOutboundSequence(0)
     {
     }
 
@@ -50,6 +57,8 @@ namespace muffin { namespace mqtt {
         , mRetainFlag(isRetain)
         , mTopicCode(topic)
         , mPayload(payload)
+        , mIsCompressed(false)
+        , mOutboundSequence(0)
     {
     }
 
@@ -66,6 +75,8 @@ namespace muffin { namespace mqtt {
         , mRetainFlag(obj.mRetainFlag)
         , mTopicCode(obj.mTopicCode)
         , mPayload(obj.mPayload)
+        , mIsCompressed(obj.mIsCompressed)
+        , mOutboundSequence(obj.mOutboundSequence)
     {
     }
 
@@ -82,9 +93,33 @@ namespace muffin { namespace mqtt {
         , mRetainFlag(std::move(obj.mRetainFlag))
         , mTopicCode(std::move(obj.mTopicCode))
         , mPayload(std::move(obj.mPayload))
+        , mIsCompressed(std::move(obj.mIsCompressed))
+        , mOutboundSequence(std::move(obj.mOutboundSequence))
     {
     }
 
+    Message& Message::operator=(Message&& obj) noexcept
+    {
+        if (this != &obj)
+        {
+            mIsSocketIdSet   = obj.mIsSocketIdSet;
+            mIsMessageIdSet  = obj.mIsMessageIdSet;
+            mIsQosSet        = obj.mIsQosSet;
+            mIsRetainSet     = obj.mIsRetainSet;
+            mIsTopicSet      = obj.mIsTopicSet;
+            mIsPayloadSet    = obj.mIsPayloadSet;
+            mSocketID        = obj.mSocketID;
+            mMessageID       = obj.mMessageID;
+            mQoS             = obj.mQoS;
+            mRetainFlag      = obj.mRetainFlag;
+            mTopicCode       = obj.mTopicCode;
+            mPayload         = std::move(obj.mPayload);
+            mIsCompressed    = obj.mIsCompressed;
+            mOutboundSequence = obj.mOutboundSequence;
+        }
+        return *this;
+    }
+
     Message::~Message()
     {
     }
@@ -125,6 +160,16 @@ namespace muffin { namespace mqtt {
         mIsPayloadSet = true;
     }
 
+    void Message::SetCompressed(const bool isCompressed)
+    {
+        mIsCompressed = isCompressed;
+    }
+
+    void Message::SetOutboundSequence(const uint32_t sequence)
+    {
+        mOutboundSequence = sequence;
+    }
+
     socket_e Message::GetSocketID() const
     {
         ASSERT((mIsSocketIdSet == true), "SOCKET ID NOT FOUND");
@@ -158,7 +203,7 @@ namespace muffin { namespace mqtt {
     const char* Message::GetTopicString() const
     {
         ASSERT((mIsTopicSet == true), "TOPIC CODE NOT FOUND");
-        return topic.ToString(mTopicCode);
+        return topic.ToString(mTopicCode, mIsCompressed);
     }
 
     const char* Message::GetPayload() const
@@ -166,4 +211,20 @@ namespace muffin { namespace mqtt {
         ASSERT((mIsPayloadSet == true), "PAYLOAD NOT FOUND");
         return mPayload.c_str();
     }
+
+    size_t Message::GetPayloadLength() const
+    {
+        ASSERT((mIsPayloadSet == true), "PAYLOAD NOT FOUND");
+        return mPayload.length();
+    }
+
+    bool Message::IsCompressed() const
+    {
+        return mIsCompressed;
+    }
+
+    uint32_t Message::GetOutboundSequence() const
+    {
+        return mOutboundSequence;
+    }
 }}
\ No newline at end of file
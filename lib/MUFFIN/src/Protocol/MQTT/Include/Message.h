@@ -31,6 +31,7 @@ namespace muffin { namespace mqtt {
         Message(const topic_e topic, const std::string& payload, const socket_e socketID = socket_e::SOCKET_0, const uint16_t messageID = 0, const qos_e qos = qos_e::QoS_0, const bool isRetain = false);
         Message(const Message& obj);
         Message(Message&& obj) noexcept;
+        Message& operator=(Message&& obj) noexcept;
         virtual ~Message();
     public:
         void SetSocketID(const socket_e socketID);
@@ -39,6 +40,16 @@ namespace muffin { namespace mqtt {
         void SetRetain(const bool isRetain);
         void SetTopic(const topic_e topicCode);
         void SetPayload(const std::string& payload);
+        /**
+         * @brief 페이로드가 heatshrink 형식으로 압축되었음을 표시합니다. 압축된 메시지는
+         *        토픽에 압축 접미사가 붙어 발행됩니다.
+         */
+        void SetCompressed(const bool isCompressed);
+        /**
+         * @brief 플래시 메모리에 보관된 레코드에서 읽은 메시지에 OutboundLog가 부여한 번호를 설정합니다.
+         *        브로커의 확인 응답을 받으면 이 번호로 레코드를 지우며, 0은 보관된 레코드가 아님을 뜻합니다.
+         */
+        void SetOutboundSequence(const uint32_t sequence);
     public:
         socket_e GetSocketID() const;
         uint16_t GetMessageID() const;
@@ -47,6 +58,9 @@ namespace muffin { namespace mqtt {
         topic_e GetTopicCode() const;
         const char* GetTopicString() const;
         const char* GetPayload() const;
+        size_t GetPayloadLength() const;
+        bool IsCompressed() const;
+        uint32_t GetOutboundSequence() const;
     private:
         bool mIsSocketIdSet;
         bool mIsMessageIdSet;
@@ -61,5 +75,7 @@ namespace muffin { namespace mqtt {
         bool mRetainFlag;
         topic_e mTopicCode;
         std::string mPayload;
+        bool mIsCompressed;
+        uint32_t mOutboundSequence;
     };
 }}
\ No newline at end of file
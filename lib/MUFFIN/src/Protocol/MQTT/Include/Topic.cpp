@@ -17,6 +17,7 @@
 
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
+#include "IM/Custom/Constants.h"
 #include "IM/Custom/MacAddress/MacAddress.h"
 #include "Topic.h"
 
@@ -95,6 +96,127 @@ namespace muffin { namespace mqtt {
             "submodels/%s/submodel-elements/BasicConfiguration",
             SM_ID_B64_CONFIGURATION
         );
+
+        snprintf(
+            mSparkplugBirth,
+            sizeof(mSparkplugBirth),
+            "spBv1.0/%s/NBIRTH/%s",
+            SPARKPLUG_GROUP_ID,
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mSparkplugData,
+            sizeof(mSparkplugData),
+            "spBv1.0/%s/NDATA/%s",
+            SPARKPLUG_GROUP_ID,
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mSparkplugDeath,
+            sizeof(mSparkplugDeath),
+            "spBv1.0/%s/NDEATH/%s",
+            SPARKPLUG_GROUP_ID,
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mLogRequest,
+            sizeof(mLogRequest),
+            "diag/log/%s",
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mLogResponse,
+            sizeof(mLogResponse),
+            "diag/log/resp/%s",
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mLogStream,
+            sizeof(mLogStream),
+            "diag/log/stream/%s",
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mLogConfig,
+            sizeof(mLogConfig),
+            "diag/log/cfg/%s",
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mMetrics,
+            sizeof(mMetrics),
+            "diag/metrics/%s",
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mTraceRequest,
+            sizeof(mTraceRequest),
+            "diag/trace/%s",
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mTraceResponse,
+            sizeof(mTraceResponse),
+            "diag/trace/resp/%s",
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mReplayRequest,
+            sizeof(mReplayRequest),
+            "diag/replay/%s",
+            macAddress.GetEthernet()
+        );
+
+        snprintf(
+            mReplayResponse,
+            sizeof(mReplayResponse),
+            "diag/replay/resp/%s",
+            macAddress.GetEthernet()
+        );
+
+        mCompressedTopics.clear();
+        for (uint8_t code = 0; code <= static_cast<uint8_t>(topic_e::REPLAY_RESPONSE); ++code)
+        {
+            const topic_e topicCode = static_cast<topic_e>(code);
+            if (IsCompressible(topicCode) == false)
+            {
+                continue;
+            }
+
+            std::string compressed(ToString(topicCode));
+            compressed.append(COMPRESSED_TOPIC_SUFFIX);
+            mCompressedTopics.emplace(topicCode, std::move(compressed));
+        }
+    }
+
+    bool Topic::IsCompressible(const topic_e topicCode) const
+    {
+        /**
+         * @note 대용량 배치 및 AAS 서브모델을 발행하는 토픽에 한하여 압축을 허용합니다.
+         *       Sparkplug B 토픽은 네임스페이스 규격상 접미사를 붙일 수 없으므로 제외합니다.
+         */
+        switch (topicCode)
+        {
+        case topic_e::DAQ_INPUT:
+        case topic_e::DAQ_OUTPUT:
+        case topic_e::DAQ_PARAM:
+        case topic_e::AAS_OPERATIONALDATA_RTM:
+        case topic_e::AAS_OPERATIONALDATA_JP:
+        case topic_e::AAS_CONFIGURATION:
+            return true;
+        default:
+            return false;
+        }
     }
      
     const char* Topic::ToString(const topic_e topicCode)
@@ -169,6 +291,30 @@ namespace muffin { namespace mqtt {
 
         case topic_e::AAS_CONFIGURATION:
             return mAAS_CONFIGURATION;
+        case topic_e::SPARKPLUG_NBIRTH:
+            return mSparkplugBirth;
+        case topic_e::SPARKPLUG_NDATA:
+            return mSparkplugData;
+        case topic_e::SPARKPLUG_NDEATH:
+            return mSparkplugDeath;
+        case topic_e::LOG_REQUEST:
+            return mLogRequest;
+        case topic_e::LOG_RESPONSE:
+            return mLogResponse;
+        case topic_e::LOG_STREAM:
+            return mLogStream;
+        case topic_e::LOG_CONFIG:
+            return mLogConfig;
+        case topic_e::METRICS:
+            return mMetrics;
+        case topic_e::TRACE_REQUEST:
+            return mTraceRequest;
+        case topic_e::TRACE_RESPONSE:
+            return mTraceResponse;
+        case topic_e::REPLAY_REQUEST:
+            return mReplayRequest;
+        case topic_e::REPLAY_RESPONSE:
+            return mReplayResponse;
             
         default:
             ASSERT(false, "UNDEFINED TOPIC CODE: %u", static_cast<uint8_t>(topicCode));
@@ -176,6 +322,23 @@ namespace muffin { namespace mqtt {
         }
     }
 
+    const char* Topic::ToString(const topic_e topicCode, const bool isCompressed)
+    {
+        if (isCompressed == false)
+        {
+            return ToString(topicCode);
+        }
+
+        auto it = mCompressedTopics.find(topicCode);
+        if (it == mCompressedTopics.end())
+        {
+            ASSERT(false, "COMPRESSED TOPIC IS NOT DEFINED: %u", static_cast<uint8_t>(topicCode));
+            return ToString(topicCode);
+        }
+
+        return it->second.c_str();
+    }
+
     std::pair<bool, topic_e> Topic::ToCode(const char* topicString)
     {
         if (strcmp(topicString, mJarvisRequest) == 0)
@@ -254,6 +417,22 @@ namespace muffin { namespace mqtt {
         {
             return std::make_pair(true, topic_e::FOTA_STATUS);
         }
+        else if (strcmp(topicString, mLogRequest) == 0)
+        {
+            return std::make_pair(true, topic_e::LOG_REQUEST);
+        }
+        else if (strcmp(topicString, mLogConfig) == 0)
+        {
+            return std::make_pair(true, topic_e::LOG_CONFIG);
+        }
+        else if (strcmp(topicString, mTraceRequest) == 0)
+        {
+            return std::make_pair(true, topic_e::TRACE_REQUEST);
+        }
+        else if (strcmp(topicString, mReplayRequest) == 0)
+        {
+            return std::make_pair(true, topic_e::REPLAY_REQUEST);
+        }
         else
         {
             return std::make_pair(false, topic_e::LAST_WILL);
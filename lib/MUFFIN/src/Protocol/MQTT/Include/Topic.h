@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <map>
+#include <string>
 #include <sys/_stdint.h>
 
 #include "TypeDefinitions.h"
@@ -31,6 +33,12 @@ namespace muffin { namespace mqtt {
     public:
         void Init();
         const char* ToString(const topic_e topicCode);
+        /**
+         * @brief 압축된 페이로드를 발행할 때 사용하는 토픽을 반환합니다. 압축 토픽이 정의되지 않은
+         *        토픽 코드는 원래의 토픽을 반환합니다.
+         */
+        const char* ToString(const topic_e topicCode, const bool isCompressed);
+        bool IsCompressible(const topic_e topicCode) const;
         std::pair<bool, topic_e> ToCode(const char* topicString);
     private:
         const char* mLastWill        = "mfm/status/lwt";
@@ -58,6 +66,22 @@ namespace muffin { namespace mqtt {
         char mAAS_OPERATIONALDATA_RTM[256] = {'\0'};
         char mAAS_OPERATIONALDATA_JP[256] = {'\0'};
         char mAAS_CONFIGURATION[256] = {'\0'};
+
+        char mSparkplugBirth[48] = {'\0'};
+        char mSparkplugData[48] = {'\0'};
+        char mSparkplugDeath[48] = {'\0'};
+
+        char mLogRequest[22] = {'\0'};
+        char mLogResponse[27] = {'\0'};
+        char mLogStream[29] = {'\0'};
+        char mLogConfig[26] = {'\0'};
+        char mMetrics[26] = {'\0'};
+        char mTraceRequest[24] = {'\0'};
+        char mTraceResponse[29] = {'\0'};
+        char mReplayRequest[25] = {'\0'};
+        char mReplayResponse[30] = {'\0'};
+    private:
+        std::map<topic_e, std::string> mCompressedTopics;
     };
 
 
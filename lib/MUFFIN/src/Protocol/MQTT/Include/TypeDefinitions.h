@@ -65,7 +65,19 @@ namespace muffin { namespace mqtt {
         REMOTE_CONTROL_RESPONSE             = 19,
         AAS_OPERATIONALDATA_RTM             = 20,
         AAS_OPERATIONALDATA_JP              = 21,
-        AAS_CONFIGURATION                   = 22
+        AAS_CONFIGURATION                   = 22,
+        SPARKPLUG_NBIRTH                    = 23,
+        SPARKPLUG_NDATA                     = 24,
+        SPARKPLUG_NDEATH                    = 25,
+        LOG_REQUEST                         = 26,
+        LOG_RESPONSE                        = 27,
+        LOG_STREAM                          = 28,
+        LOG_CONFIG                          = 29,
+        METRICS                             = 30,
+        TRACE_REQUEST                       = 31,
+        TRACE_RESPONSE                      = 32,
+        REPLAY_REQUEST                      = 33,
+        REPLAY_RESPONSE                     = 34
     } topic_e;  
 
     typedef enum class MqttQoSEnum
@@ -75,4 +87,11 @@ namespace muffin { namespace mqtt {
         QoS_1 = 1,
         QoS_2 = 2
     } qos_e;
+
+    typedef enum class MqttPayloadFormatEnum
+        : uint8_t
+    {
+        JSON         = 0,
+        SPARKPLUG_B  = 1
+    } payload_format_e;
 }}
\ No newline at end of file
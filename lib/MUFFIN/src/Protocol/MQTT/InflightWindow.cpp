@@ -0,0 +1,281 @@
+/**
+ * @file InflightWindow.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 브로커의 확인 응답(PUBACK)을 기다리는 QoS 1 메시지를 관리하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+#include <utility>
+
+#include "Common/Assert.hpp"
+#include "Common/Logger/Logger.h"
+#include "Common/Sync/LockGuard.hpp"
+#include "InflightWindow.h"
+#include "OutboundLog.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    InflightWindow::InflightWindow()
+        : mCapacity(0)
+    {
+        for (uint8_t index = 0; index < MAX_CAPACITY; ++index)
+        {
+            mEntries[index].PacketID        = 0;
+            mEntries[index].SentMillis      = 0;
+            mEntries[index].IsExpired       = false;
+            mEntries[index].IsSending       = false;
+            mEntries[index].IsAcknowledged  = false;
+        }
+    }
+
+    void InflightWindow::SetCapacity(const uint8_t capacity)
+    {
+        LockGuard lock(mMutex);
+
+        if (capacity > MAX_CAPACITY)
+        {
+            LOG_WARNING(logger, "IN-FLIGHT WINDOW IS LIMITED TO %u MESSAGES", MAX_CAPACITY);
+            mCapacity = MAX_CAPACITY;
+            return;
+        }
+
+        mCapacity = capacity;
+    }
+
+    uint8_t InflightWindow::GetCapacity() const
+    {
+        return mCapacity;
+    }
+
+    uint8_t InflightWindow::Count()
+    {
+        LockGuard lock(mMutex);
+
+        uint8_t count = 0;
+        for (uint8_t index = 0; index < MAX_CAPACITY; ++index)
+        {
+            if (mEntries[index].Handle.IsValid() == true)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    bool InflightWindow::IsFull()
+    {
+        return Count() >= mCapacity;
+    }
+
+    Status InflightWindow::Insert(const uint16_t packetID, MessageHandle&& handle)
+    {
+        ASSERT((handle.IsValid() == true), "INVALID MESSAGE HANDLE");
+        LockGuard lock(mMutex);
+
+        uint8_t count = 0;
+        entry_t* vacant = nullptr;
+        for (uint8_t index = 0; index < MAX_CAPACITY; ++index)
+        {
+            if (mEntries[index].Handle.IsValid() == true)
+            {
+                ++count;
+            }
+            else if (vacant == nullptr)
+            {
+                vacant = &mEntries[index];
+            }
+        }
+
+        if (count >= mCapacity || vacant == nullptr)
+        {
+            return Status(Status::Code::BAD_WOULD_BLOCK);
+        }
+
+        vacant->PacketID        = packetID;
+        vacant->SentMillis      = millis();
+        vacant->IsExpired       = false;
+        vacant->IsSending       = true;
+        vacant->IsAcknowledged  = false;
+        vacant->Handle          = std::move(handle);
+        return Status(Status::Code::GOOD);
+    }
+
+    void InflightWindow::MarkSent(const uint16_t packetID)
+    {
+        LockGuard lock(mMutex);
+
+        entry_t* entry = find(packetID);
+        if (entry == nullptr)
+        {
+            return;
+        }
+
+        entry->SentMillis  = millis();
+        entry->IsSending   = false;
+        if (entry->IsAcknowledged == true)
+        {
+            complete(entry);
+        }
+    }
+
+    Status InflightWindow::Withdraw(const uint16_t packetID, MessageHandle* handle)
+    {
+        ASSERT((handle != nullptr), "OUTPUT PARAMETER <MessageHandle* handle> CANNOT BE A NULL POINTER");
+        LockGuard lock(mMutex);
+
+        entry_t* entry = find(packetID);
+        if (entry == nullptr)
+        {
+            return Status(Status::Code::BAD_NOT_FOUND);
+        }
+
+        entry->IsSending = false;
+        *handle = std::move(entry->Handle);
+        return Status(Status::Code::GOOD);
+    }
+
+    Status InflightWindow::Acknowledge(const uint16_t packetID)
+    {
+        LockGuard lock(mMutex);
+
+        entry_t* entry = find(packetID);
+        if (entry == nullptr)
+        {
+            return Status(Status::Code::BAD_NOT_FOUND);
+        }
+
+        if (entry->IsSending == true)
+        {
+            entry->IsAcknowledged = true;
+        }
+        else
+        {
+            complete(entry);
+        }
+        return Status(Status::Code::GOOD);
+    }
+
+    Status InflightWindow::Expire(const uint16_t packetID)
+    {
+        LockGuard lock(mMutex);
+
+        entry_t* entry = find(packetID);
+        if (entry == nullptr)
+        {
+            return Status(Status::Code::BAD_NOT_FOUND);
+        }
+
+        entry->IsExpired = true;
+        return Status(Status::Code::GOOD);
+    }
+
+    void InflightWindow::Retransmit(const uint32_t timeoutMillis, const std::function<bool(const uint16_t, const Message&)>& resend)
+    {
+        for (uint8_t index = 0; index < MAX_CAPACITY; ++index)
+        {
+            entry_t& entry = mEntries[index];
+            {
+                LockGuard lock(mMutex);
+                if (entry.Handle.IsValid() == false || entry.IsSending == true)
+                {
+                    continue;
+                }
+
+                if (entry.IsExpired == false && (millis() - entry.SentMillis) < timeoutMillis)
+                {
+                    continue;
+                }
+                entry.IsSending = true;
+            }
+
+            /**
+             * @note 전송 중으로 표시된 메시지는 확인 응답을 받더라도 해제되지 않으므로 잠금 없이
+             *       메시지를 참조할 수 있습니다.
+             */
+            const uint16_t packetID = entry.PacketID;
+            const bool isResent = resend(packetID, entry.Handle.Get());
+
+            LockGuard lock(mMutex);
+            entry.IsSending = false;
+            if (entry.IsAcknowledged == true)
+            {
+                complete(&entry);
+                continue;
+            }
+
+            if (isResent == false)
+            {
+                LOG_WARNING(logger, "FAILED TO RETRANSMIT PACKET ID: %u", packetID);
+                return;
+            }
+
+            LOG_VERBOSE(logger, "Retransmitted packet ID: %u", packetID);
+            entry.SentMillis  = millis();
+            entry.IsExpired   = false;
+        }
+    }
+
+    void InflightWindow::ExpireAll()
+    {
+        LockGuard lock(mMutex);
+
+        for (uint8_t index = 0; index < MAX_CAPACITY; ++index)
+        {
+            mEntries[index].IsExpired = true;
+        }
+    }
+
+    Status InflightWindow::Evict(MessageHandle* handle)
+    {
+        ASSERT((handle != nullptr), "OUTPUT PARAMETER <MessageHandle* handle> CANNOT BE A NULL POINTER");
+        LockGuard lock(mMutex);
+
+        for (uint8_t index = 0; index < MAX_CAPACITY; ++index)
+        {
+            entry_t& entry = mEntries[index];
+            if (entry.Handle.IsValid() == false || entry.IsSending == true)
+            {
+                continue;
+            }
+
+            *handle = std::move(entry.Handle);
+            return Status(Status::Code::GOOD);
+        }
+
+        return Status(Status::Code::BAD_NO_DATA);
+    }
+
+    void InflightWindow::complete(entry_t* entry)
+    {
+        const uint32_t sequence = entry->Handle.Get().GetOutboundSequence();
+        entry->Handle.Release();
+        if (sequence != 0)
+        {
+            outboundLog.Acknowledge(sequence);
+        }
+    }
+
+    InflightWindow::entry_t* InflightWindow::find(const uint16_t packetID)
+    {
+        for (uint8_t index = 0; index < MAX_CAPACITY; ++index)
+        {
+            if (mEntries[index].Handle.IsValid() == true && mEntries[index].PacketID == packetID)
+            {
+                return &mEntries[index];
+            }
+        }
+
+        return nullptr;
+    }
+}}
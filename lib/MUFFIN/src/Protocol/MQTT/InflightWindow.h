@@ -0,0 +1,104 @@
+/**
+ * @file InflightWindow.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 브로커의 확인 응답(PUBACK)을 기다리는 QoS 1 메시지를 관리하는 클래스를 선언합니다.
+ * @details 발행한 메시지의 CDO 핸들을 패킷 ID와 함께 보관하며, 확인 응답을 수신한 경우에만
+ *          핸들을 해제하여 CDO 슬롯을 반환합니다. 윈도우의 크기만큼 확인 응답을 기다리지 않고
+ *          연속으로 발행할 수 있으므로 왕복 지연이 긴 링크에서도 처리량을 유지할 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <functional>
+#include <sys/_stdint.h>
+
+#include "CDO.h"
+#include "Common/Status.h"
+#include "Common/Sync/Mutex.hpp"
+
+
+
+namespace muffin { namespace mqtt {
+
+    class InflightWindow
+    {
+    public:
+        InflightWindow();
+        virtual ~InflightWindow() {}
+    public:
+        /**
+         * @brief 확인 응답을 기다릴 수 있는 최대 메시지 수를 설정합니다. 0이면 QoS 1 발행을 사용하지 않습니다.
+         */
+        void SetCapacity(const uint8_t capacity);
+        uint8_t GetCapacity() const;
+        uint8_t Count();
+        bool IsFull();
+    public:
+        /**
+         * @brief 메시지를 발행하기 전에 윈도우에 등록합니다. 발행 중에 확인 응답이 먼저 수신되더라도
+         *        MarkSent() 함수가 호출될 때까지 핸들은 해제되지 않습니다.
+         * @return BAD_WOULD_BLOCK 윈도우가 가득 찬 경우로, 핸들은 호출자에게 남아 있습니다.
+         */
+        Status Insert(const uint16_t packetID, MessageHandle&& handle);
+        void MarkSent(const uint16_t packetID);
+        /**
+         * @brief 발행에 실패한 메시지의 핸들을 호출자에게 되돌려 줍니다.
+         */
+        Status Withdraw(const uint16_t packetID, MessageHandle* handle);
+        /**
+         * @return BAD_NOT_FOUND 해당 패킷 ID로 발행한 메시지가 없는 경우
+         */
+        Status Acknowledge(const uint16_t packetID);
+        /**
+         * @brief 전송 실패가 보고된 메시지를 다음 Retransmit() 호출 시 재전송되도록 만료 처리합니다.
+         */
+        Status Expire(const uint16_t packetID);
+        /**
+         * @brief 확인 응답 대기 시간이 지난 메시지를 다시 발행합니다. 재전송 중에는 윈도우를 잠그지
+         *        않으므로 다른 태스크에서 확인 응답을 처리할 수 있습니다.
+         * @param resend 재전송 함수로, false를 반환하면 나머지 메시지의 재전송을 중단합니다.
+         */
+        void Retransmit(const uint32_t timeoutMillis, const std::function<bool(const uint16_t, const Message&)>& resend);
+        /**
+         * @brief 재연결 직후에 모든 메시지가 즉시 재전송되도록 만료 처리합니다.
+         */
+        void ExpireAll();
+        /**
+         * @brief 확인 응답을 받지 못한 메시지의 핸들을 하나씩 호출자에게 넘겨줍니다. 서비스를 멈출 때
+         *        메시지를 플래시 메모리에 보존하기 위해 사용합니다.
+         * @return BAD_NO_DATA 넘겨줄 메시지가 없는 경우
+         */
+        Status Evict(MessageHandle* handle);
+    public:
+        static const uint8_t MAX_CAPACITY = 16;
+    private:
+        typedef struct InflightEntryType
+        {
+            uint16_t PacketID;
+            uint32_t SentMillis;
+            bool IsExpired;
+            bool IsSending;
+            bool IsAcknowledged;
+            MessageHandle Handle;
+        } entry_t;
+    private:
+        entry_t* find(const uint16_t packetID);
+        /**
+         * @brief 확인 응답을 받은 메시지의 핸들을 해제하고, 플래시 메모리에서 꺼낸 메시지이면 레코드를 지웁니다.
+         */
+        void complete(entry_t* entry);
+    private:
+        Mutex mMutex;
+        uint8_t mCapacity;
+        entry_t mEntries[MAX_CAPACITY];
+    };
+}}
@@ -20,6 +20,7 @@
 
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
+#include "Common/Sync/LockGuard.hpp"
 #include "Common/Time/TimeUtils.h"
 #include "IM/Custom/Constants.h"
 #include "IM/Custom/FirmwareVersion/FirmwareVersion.h"
@@ -29,6 +30,7 @@
 #include "Protocol/MQTT/Include/Helper.h"
 #include "Protocol/MQTT/Include/Topic.h"
 #include "Protocol/MQTT/LwipMQTT/LwipMQTT.h"
+#include "Protocol/MQTT/PayloadCompressor.h"
 
 
 
@@ -43,12 +45,21 @@ namespace muffin { namespace mqtt {
         LwipMQTT* mqtt = static_cast<LwipMQTT*>(pvParameter);
         while (true)
         {
-            vTaskDelay(1000 / portTICK_PERIOD_MS);
+            /**
+             * @note 확인 응답을 기다리는 메시지가 있으면 PUBACK을 빠르게 처리하여 윈도우를
+             *       비울 수 있도록 수신 주기를 줄입니다. PubSubClient는 소켓 수신 이벤트를
+             *       제공하지 않으므로 원격제어 요청의 지연을 줄이기 위해 유휴 상태에서도
+             *       짧은 주기로 수신을 확인합니다.
+             */
+            const uint32_t delayMillis = mqtt->mInflightWindow.Count() == 0 ? 20 : 10;
+            vTaskDelay(delayMillis / portTICK_PERIOD_MS);
 
             if (!startTask)
             {
                 continue;
             }
+
+            LockGuard lock(mqtt->mClientMutex);
             mqtt->mClient.loop();
         }
     }
@@ -70,6 +81,14 @@ namespace muffin { namespace mqtt {
             }
         );
         LOG_INFO(logger, "Set a callback for subscription event");
+
+        mInflightWindow.SetCapacity(mBrokerInfo.GetInflightWindow());
+        mClient.setPubAckCallback(
+            [this](uint16_t packetID)
+            {
+                this->callbackPubAck(packetID);
+            }
+        );
         log_d("Remained Heap: %u Bytes", ESP.getFreeHeap());
         
     #if defined(MT11)
@@ -171,21 +190,26 @@ namespace muffin { namespace mqtt {
     {
         log_d("Remained Heap: %u Bytes", ESP.getFreeHeap());
         LOG_INFO(logger, "Start to connect to MQTT broker");
-        mClient.connect(
-            mBrokerInfo.GetClientID(),
-            mBrokerInfo.GetUsername(),
-            mBrokerInfo.GetPassword(),
-            mMessageLWT.GetTopicString(),
-            static_cast<uint8_t>(mMessageLWT.GetQoS()),
-            mMessageLWT.IsRetain(),
-            mMessageLWT.GetPayload()
-        );
+        {
+            LockGuard lock(mClientMutex);
+            mClient.connect(
+                mBrokerInfo.GetClientID(),
+                mBrokerInfo.GetUsername(),
+                mBrokerInfo.GetPassword(),
+                mMessageLWT.GetTopicString(),
+                static_cast<uint8_t>(mMessageLWT.GetQoS()),
+                mMessageLWT.IsRetain(),
+                mMessageLWT.GetPayload(),
+                mBrokerInfo.IsCleanSession()
+            );
+        }
         
         for (uint8_t trialCount = 0; trialCount < MAX_RETRY_COUNT; ++trialCount)
         {
-            if (mClient.connected() == true)
+            if (IsConnected() == Status::Code::GOOD)
             {
-                LOG_INFO(logger, "Connected to the Broker");
+                LOG_INFO(logger, "Connected to the Broker. Session present: %s", IsSessionPresent() ? "true" : "false");
+                mInflightWindow.ExpireAll();
                 startTask = true;
                 return Status(Status::Code::GOOD);
             }
@@ -198,6 +222,7 @@ namespace muffin { namespace mqtt {
 
     Status LwipMQTT::Disconnect(const size_t mutexHandle)
     {
+        LockGuard lock(mClientMutex);
         mClient.disconnect();
         startTask = false;
         return Status(Status::Code::GOOD);
@@ -205,6 +230,7 @@ namespace muffin { namespace mqtt {
 
     Status LwipMQTT::IsConnected()
     {
+        LockGuard lock(mClientMutex);
         if (mClient.connected() == true)
         {
             return Status(Status::Code::GOOD);
@@ -215,6 +241,12 @@ namespace muffin { namespace mqtt {
         }
     }
 
+    bool LwipMQTT::IsSessionPresent()
+    {
+        LockGuard lock(mClientMutex);
+        return mClient.isSessionPresent();
+    }
+
     Status LwipMQTT::Subscribe(const size_t mutexHandle, const std::vector<Message>& messages)
     {
         uint8_t trialCount = 0;
@@ -223,7 +255,13 @@ namespace muffin { namespace mqtt {
         {
             for (trialCount = 0; trialCount < MAX_RETRY_COUNT; ++trialCount)
             {
-                if (mClient.subscribe(message.GetTopicString()) == true)
+                bool isSubscribed = false;
+                {
+                    LockGuard lock(mClientMutex);
+                    isSubscribed = mClient.subscribe(message.GetTopicString(), static_cast<uint8_t>(message.GetQoS()));
+                }
+
+                if (isSubscribed == true)
                 {
                     LOG_INFO(logger, "Subscribing: %s", message.GetTopicString());
                     break;
@@ -254,7 +292,13 @@ namespace muffin { namespace mqtt {
         {
             for (trialCount = 0; trialCount < MAX_RETRY_COUNT; ++trialCount)
             {
-                if (mClient.unsubscribe(message.GetTopicString()) == true)
+                bool isUnsubscribed = false;
+                {
+                    LockGuard lock(mClientMutex);
+                    isUnsubscribed = mClient.unsubscribe(message.GetTopicString());
+                }
+
+                if (isUnsubscribed == true)
                 {
                     LOG_INFO(logger, "Unsubscribing: %s", message.GetTopicString());
                     break;
@@ -283,7 +327,14 @@ namespace muffin { namespace mqtt {
         LOG_DEBUG(logger,"paylaod : %s",message.GetPayload());
         for (; trialCount < MAX_RETRY_COUNT; ++trialCount)
         {
-            if (mClient.publish(message.GetTopicString(), message.GetPayload()) == true)
+            const uint8_t* payload = reinterpret_cast<const uint8_t*>(message.GetPayload());
+            bool isPublished = false;
+            {
+                LockGuard lock(mClientMutex);
+                isPublished = mClient.publish(message.GetTopicString(), payload, message.GetPayloadLength());
+            }
+
+            if (isPublished == true)
             {
                 return Status(Status::Code::GOOD);
             }
@@ -298,6 +349,75 @@ namespace muffin { namespace mqtt {
         return Status(Status::Code::BAD_COMMUNICATION_ERROR);
     }
 
+    Status LwipMQTT::Deliver(const size_t mutexHandle, MessageHandle* handle)
+    {
+        ASSERT((handle != nullptr && handle->IsValid() == true), "INVALID MESSAGE HANDLE");
+
+        if (mInflightWindow.GetCapacity() == 0)
+        {
+            return IMQTT::Deliver(mutexHandle, handle);
+        }
+
+        LockGuard lock(mClientMutex);
+        const Message& message = handle->Get();
+        const uint8_t* payload = reinterpret_cast<const uint8_t*>(message.GetPayload());
+        const uint16_t packetID = mClient.nextMessageId();
+
+        /**
+         * @note PUBACK은 다른 태스크에서 처리되므로 발행하기 전에 윈도우에 먼저 등록합니다.
+         */
+        Status ret = mInflightWindow.Insert(packetID, std::move(*handle));
+        if (ret != Status::Code::GOOD)
+        {
+            return ret;
+        }
+
+        if (mClient.publish(message.GetTopicString(), payload, message.GetPayloadLength(), message.IsRetain(), packetID, false) == false)
+        {
+            LOG_WARNING(logger, "NOT PUBLISHED: %s", getState());
+            mInflightWindow.Withdraw(packetID, handle);
+            return Status(Status::Code::BAD_COMMUNICATION_ERROR);
+        }
+
+        mInflightWindow.MarkSent(packetID);
+        return Status(Status::Code::GOOD);
+    }
+
+    Status LwipMQTT::Poll(const size_t mutexHandle)
+    {
+        LockGuard lock(mClientMutex);
+        if (mInflightWindow.GetCapacity() == 0 || mClient.connected() == false)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        mInflightWindow.Retransmit(ACK_TIMEOUT_MILLIS,
+            [this](const uint16_t packetID, const Message& message)
+            {
+                const uint8_t* payload = reinterpret_cast<const uint8_t*>(message.GetPayload());
+                return mClient.publish(message.GetTopicString(), payload, message.GetPayloadLength(), message.IsRetain(), packetID, true);
+            }
+        );
+        return Status(Status::Code::GOOD);
+    }
+
+    Status LwipMQTT::Evict(MessageHandle* handle)
+    {
+        return mInflightWindow.Evict(handle);
+    }
+
+    size_t LwipMQTT::GetMaxPayloadSize(const topic_e topic)
+    {
+        /**
+         * @note PubSubClient는 고정 헤더, 토픽 길이 필드 및 토픽 문자열을 페이로드와 함께
+         *       하나의 버퍼에 기록합니다. 압축이 활성화된 토픽은 접미사가 붙은 토픽의 길이를 사용합니다.
+         */
+        const char* topicString = mqtt::topic.ToString(topic, payloadCompressor.IsEnabled(topic));
+        const size_t packetIdSize = mInflightWindow.GetCapacity() == 0 ? 0 : 2;
+        const size_t overhead = MQTT_MAX_HEADER_SIZE + 2 + strlen(topicString) + packetIdSize;
+        return BUFFER_SIZE > overhead ? BUFFER_SIZE - overhead : 0;
+    }
+
     const char* LwipMQTT::getState()
     {
         switch (mClient.state())
@@ -352,6 +472,15 @@ namespace muffin { namespace mqtt {
         return;
     }
 
+    void LwipMQTT::callbackPubAck(const uint16_t packetID)
+    {
+        Status ret = mInflightWindow.Acknowledge(packetID);
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_WARNING(logger, "UNKNOWN PACKET ID ACKNOWLEDGED: %u", packetID);
+        }
+    }
+
 
     /**
      * @btodo [담당자] 김주성 전임연구원
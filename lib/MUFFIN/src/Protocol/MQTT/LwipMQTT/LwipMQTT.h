@@ -20,7 +20,9 @@
 #include <WiFiClientSecure.h>
 
 #include "Common/Status.h"
+#include "Common/Sync/Mutex.hpp"
 #include "Protocol/MQTT/IMQTT.h"
+#include "Protocol/MQTT/InflightWindow.h"
 #include "Protocol/MQTT/Include/BrokerInfo.h"
 #include "Protocol/MQTT/Include/Message.h"
 #include "Protocol/MQTT/LwipMQTT/PubSubClient.h"
@@ -40,13 +42,19 @@ namespace muffin { namespace mqtt {
         virtual Status Connect(const size_t mutexHandle) override;
         virtual Status Disconnect(const size_t mutexHandle) override;
         virtual Status IsConnected() override;
+        virtual bool IsSessionPresent() override;
         virtual Status Subscribe(const size_t mutexHandle, const std::vector<Message>& messages) override;
         virtual Status Unsubscribe(const size_t mutexHandle, const std::vector<Message>& messages) override;
         virtual Status Publish(const size_t mutexHandle, const Message& message) override;
+        virtual Status Deliver(const size_t mutexHandle, MessageHandle* handle) override;
+        virtual Status Poll(const size_t mutexHandle) override;
+        virtual Status Evict(MessageHandle* handle) override;
+        virtual size_t GetMaxPayloadSize(const topic_e topic) override;
         virtual Status ResetTEMP() override;
     private:
         const char* getState();
         void callback(char* topic, byte * payload, unsigned int length);
+        void callbackPubAck(const uint16_t packetID);
     private:
         TimerHandle_t xTimer = NULL;
     public:
@@ -61,12 +69,19 @@ namespace muffin { namespace mqtt {
     private:
         const BrokerInfo mBrokerInfo;
         const Message mMessageLWT;
+        InflightWindow mInflightWindow;
+        /**
+         * @brief PubSubClient는 송신과 수신에 하나의 버퍼와 소켓을 사용하므로 수신 태스크의
+         *        loop()와 MQTT 태스크의 발행, 연결, 구독이 동시에 실행되지 않도록 보호합니다.
+         */
+        Mutex mClientMutex;
     #if defined(MT11)
         const uint16_t BUFFER_SIZE = 1024*4;
     #else
         const uint16_t BUFFER_SIZE = 1024;
     #endif
         const uint8_t KEEP_ALIVE  =  10;
+        const uint32_t ACK_TIMEOUT_MILLIS = 10 * 1000;
     public:
         static void implLwipMqttTask(void* pvParameter);
     };
@@ -270,6 +270,7 @@ boolean PubSubClient::connect(const char *id, const char *user, const char *pass
                 if (buffer[3] == 0) {
                     lastInActivity = millis();
                     pingOutstanding = false;
+                    sessionPresent = (buffer[2] & 0x01) != 0;
                     _state = MQTT_CONNECTED;
                     return true;
                 } else {
@@ -418,6 +419,11 @@ boolean PubSubClient::loop() {
                             callback(topic,payload,len-llen-3-tl);
                         }
                     }
+                } else if (type == MQTTPUBACK) {
+                    if (pubAckCallback) {
+                        msgId = (this->buffer[llen+1]<<8)+this->buffer[llen+2];
+                        pubAckCallback(msgId);
+                    }
                 } else if (type == MQTTPINGREQ) {
                     this->buffer[0] = MQTTPINGRESP;
                     this->buffer[1] = 0;
@@ -473,6 +479,45 @@ boolean PubSubClient::publish(const char* topic, const uint8_t* payload, unsigne
     return false;
 }
 
+boolean PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int plength, boolean retained, uint16_t msgId, boolean duplicate) {
+    if (connected()) {
+        if (this->bufferSize < MQTT_MAX_HEADER_SIZE + 2+strnlen(topic, this->bufferSize) + 2 + plength) {
+            // Too long
+            return false;
+        }
+        // Leave room in the buffer for header and variable length field
+        uint16_t length = MQTT_MAX_HEADER_SIZE;
+        length = writeString(topic,this->buffer,length);
+        this->buffer[length++] = (msgId >> 8);
+        this->buffer[length++] = (msgId & 0xFF);
+
+        // Add payload
+        uint16_t i;
+        for (i=0;i<plength;i++) {
+            this->buffer[length++] = payload[i];
+        }
+
+        // Write the header
+        uint8_t header = MQTTPUBLISH | MQTTQOS1;
+        if (duplicate) {
+            header |= 8;
+        }
+        if (retained) {
+            header |= 1;
+        }
+        return write(header,this->buffer,length-MQTT_MAX_HEADER_SIZE);
+    }
+    return false;
+}
+
+uint16_t PubSubClient::nextMessageId() {
+    nextMsgId++;
+    if (nextMsgId == 0) {
+        nextMsgId = 1;
+    }
+    return nextMsgId;
+}
+
 boolean PubSubClient::publish_P(const char* topic, const char* payload, boolean retained) {
     return publish_P(topic, (const uint8_t*)payload, payload ? strnlen(payload, this->bufferSize) : 0, retained);
 }
@@ -754,6 +799,11 @@ PubSubClient& PubSubClient::setCallback(MQTT_CALLBACK_SIGNATURE) {
     return *this;
 }
 
+PubSubClient& PubSubClient::setPubAckCallback(MQTT_PUBACK_CALLBACK_SIGNATURE) {
+    this->pubAckCallback = pubAckCallback;
+    return *this;
+}
+
 PubSubClient& PubSubClient::setClient(Client& client){
     this->_client = &client;
     return *this;
@@ -768,6 +818,10 @@ int PubSubClient::state() {
     return this->_state;
 }
 
+boolean PubSubClient::isSessionPresent() {
+    return this->sessionPresent;
+}
+
 boolean PubSubClient::setBufferSize(uint16_t size) {
     if (size == 0) {
         // Cannot set it back to 0
@@ -79,8 +79,10 @@
 #if defined(ESP8266) || defined(ESP32)
 #include <functional>
 #define MQTT_CALLBACK_SIGNATURE std::function<void(char*, uint8_t*, unsigned int)> callback
+#define MQTT_PUBACK_CALLBACK_SIGNATURE std::function<void(uint16_t)> pubAckCallback
 #else
 #define MQTT_CALLBACK_SIGNATURE void (*callback)(char*, uint8_t*, unsigned int)
+#define MQTT_PUBACK_CALLBACK_SIGNATURE void (*pubAckCallback)(uint16_t)
 #endif
 
 #define CHECK_STRING_LENGTH(l,s) if (l+2+strnlen(s, this->bufferSize) > this->bufferSize) {_client->stop();return false;}
@@ -98,7 +100,9 @@ private:
    unsigned long lastOutActivity;
    unsigned long lastInActivity;
    bool pingOutstanding;
+   bool sessionPresent = false;
    MQTT_CALLBACK_SIGNATURE;
+   MQTT_PUBACK_CALLBACK_SIGNATURE = nullptr;
    uint32_t readPacket(uint8_t*);
    boolean readByte(uint8_t * result);
    boolean readByte(uint8_t * result, uint16_t * index);
@@ -136,6 +140,8 @@ public:
    PubSubClient& setServer(uint8_t * ip, uint16_t port);
    PubSubClient& setServer(const char * domain, uint16_t port);
    PubSubClient& setCallback(MQTT_CALLBACK_SIGNATURE);
+   // Called from loop() with the packet identifier of every PUBACK received
+   PubSubClient& setPubAckCallback(MQTT_PUBACK_CALLBACK_SIGNATURE);
    PubSubClient& setClient(Client& client);
    PubSubClient& setStream(Stream& stream);
    PubSubClient& setKeepAlive(uint16_t keepAlive);
@@ -154,6 +160,11 @@ public:
    boolean publish(const char* topic, const char* payload, boolean retained);
    boolean publish(const char* topic, const uint8_t * payload, unsigned int plength);
    boolean publish(const char* topic, const uint8_t * payload, unsigned int plength, boolean retained);
+   // Publish at QoS 1 with the given packet identifier. Set duplicate when retransmitting
+   // a message that has not been acknowledged yet.
+   boolean publish(const char* topic, const uint8_t * payload, unsigned int plength, boolean retained, uint16_t msgId, boolean duplicate);
+   // Allocate the next non-zero packet identifier, shared with SUBSCRIBE and UNSUBSCRIBE
+   uint16_t nextMessageId();
    boolean publish_P(const char* topic, const char* payload, boolean retained);
    boolean publish_P(const char* topic, const uint8_t * payload, unsigned int plength, boolean retained);
    // Start to publish a message.
@@ -178,6 +189,8 @@ public:
    boolean unsubscribe(const char* topic);
    boolean loop();
    boolean connected();
+   // Returns the session present flag of the last CONNACK
+   boolean isSessionPresent();
    int state();
 
 };
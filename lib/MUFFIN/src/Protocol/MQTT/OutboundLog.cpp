@@ -0,0 +1,517 @@
+/**
+ * @file OutboundLog.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 전송하지 못한 MQTT 메시지를 플래시 메모리에 보관하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <algorithm>
+#include <Preferences.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Common/Assert.hpp"
+#include "Common/Logger/Logger.h"
+#include "Common/Sync/LockGuard.hpp"
+#include "IM/Custom/Constants.h"
+#include "OutboundLog.h"
+#include "Storage/ESP32FS/ESP32FS.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    OutboundLog::OutboundLog()
+        : mIsInitialized(false)
+        , mHeadSegment(0)
+        , mTailSegment(0)
+        , mHeadOffset(0)
+        , mTailSize(0)
+        , mPendingBytes(0)
+        , mReadSegment(0)
+        , mReadOffset(0)
+        , mNextSequence(1)
+        , mUnsyncedAckCount(0)
+        , mDrainRate(10)
+        , mDroppedSegmentCount(0)
+    {
+    }
+
+    Status OutboundLog::Init()
+    {
+        LockGuard lock(mMutex);
+        if (mIsInitialized == true)
+        {
+            return Status(Status::Code::GOOD);
+        }
+
+        File root = esp32FS.Open("/");
+        if (!root || root.isDirectory() == false)
+        {
+            LOG_ERROR(logger, "FAILED TO OPEN ROOT DIRECTORY");
+            return Status(Status::Code::BAD_DEVICE_FAILURE);
+        }
+
+        bool hasSegment = false;
+        uint32_t minIndex = UINT32_MAX;
+        uint32_t maxIndex = 0;
+        size_t totalBytes = 0;
+        size_t minIndexSize = 0;
+
+        File file = root.openNextFile();
+        while (file)
+        {
+            const std::pair<bool, uint32_t> index = parseSegmentIndex(file.name());
+            if (index.first == true)
+            {
+                hasSegment = true;
+                totalBytes += file.size();
+                if (index.second < minIndex)
+                {
+                    minIndex = index.second;
+                    minIndexSize = file.size();
+                }
+                maxIndex = std::max(maxIndex, index.second);
+            }
+            file.close();
+            file = root.openNextFile();
+        }
+        root.close();
+
+        if (hasSegment == false)
+        {
+            mHeadSegment  = 0;
+            mTailSegment  = 0;
+            mHeadOffset   = 0;
+            mTailSize     = 0;
+            mPendingBytes = 0;
+            mReadSegment  = 0;
+            mReadOffset   = 0;
+            mIsInitialized = true;
+            LOG_INFO(logger, "Outbound log is empty");
+            return Status(Status::Code::GOOD);
+        }
+
+        loadCursor();
+        if (mHeadSegment != minIndex || mHeadOffset > minIndexSize)
+        {
+            mHeadOffset = 0;
+        }
+        mHeadSegment = minIndex;
+
+        /**
+         * @note 마지막 세그먼트의 끝 레코드가 손상되었을 수 있으므로 부팅 후에는
+         *       항상 새로운 세그먼트에 기록합니다. 재부팅이 반복되어 세그먼트 수가
+         *       한도를 넘으면 기록 중과 마찬가지로 가장 오래된 세그먼트를 버립니다.
+         */
+        mTailSegment  = maxIndex;
+        mPendingBytes = totalBytes - mHeadOffset;
+        mReadSegment  = mHeadSegment;
+        mReadOffset   = mHeadOffset;
+        Status ret = openNextWriteSegment();
+        if (ret != Status::Code::GOOD)
+        {
+            return ret;
+        }
+        mIsInitialized = true;
+
+        LOG_INFO(logger, "Outbound log recovered: %u Bytes pending, segment #%u to #%u",
+            mPendingBytes, mHeadSegment, maxIndex);
+        return Status(Status::Code::GOOD);
+    }
+
+    bool OutboundLog::IsInitialized() const
+    {
+        return mIsInitialized;
+    }
+
+    bool OutboundLog::IsEmpty()
+    {
+        return GetPendingBytes() == 0;
+    }
+
+    size_t OutboundLog::GetPendingBytes()
+    {
+        LockGuard lock(mMutex);
+        return mPendingBytes;
+    }
+
+    uint32_t OutboundLog::GetDroppedSegmentCount() const
+    {
+        return mDroppedSegmentCount.load();
+    }
+
+    void OutboundLog::SetDrainRate(const uint8_t messagesPerCycle)
+    {
+        ASSERT((messagesPerCycle > 0), "DRAIN RATE CANNOT BE SET TO 0");
+        mDrainRate = messagesPerCycle;
+    }
+
+    uint8_t OutboundLog::GetDrainRate() const
+    {
+        return mDrainRate;
+    }
+
+    Status OutboundLog::Append(const Message& message)
+    {
+        if (mIsInitialized == false)
+        {
+            return Status(Status::Code::BAD_INVALID_STATE);
+        }
+
+        /**
+         * @note 코덱의 CRC32 인스턴스는 상태를 가지므로 Read()와 동시에 인코딩하지 않도록 잠근 다음에 인코딩합니다.
+         */
+        LockGuard lock(mMutex);
+        std::vector<uint8_t> record;
+        Status ret = mCodec.Encode(message, &record);
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "PAYLOAD TOO LARGE TO STORE: %u Bytes", message.GetPayloadLength());
+            return ret;
+        }
+
+        if ((mTailSize > 0) && (mTailSize + record.size() > SEGMENT_SIZE))
+        {
+            ret = openNextWriteSegment();
+            if (ret != Status::Code::GOOD)
+            {
+                return ret;
+            }
+        }
+
+        File file = esp32FS.Open(makeSegmentPath(mTailSegment), "a", true);
+        if (!file)
+        {
+            LOG_ERROR(logger, "FAILED TO OPEN OUTBOUND SEGMENT #%u", mTailSegment);
+            return Status(Status::Code::BAD_DEVICE_FAILURE);
+        }
+
+        const size_t written = file.write(record.data(), record.size());
+        file.flush();
+        file.close();
+
+        if (written != record.size())
+        {
+            LOG_ERROR(logger, "FAILED TO WRITE OUTBOUND RECORD: %u/%u Bytes", written, record.size());
+            /**
+             * @note 불완전하게 기록된 레코드 뒤에 이어 쓰지 않도록 세그먼트를 넘깁니다.
+             */
+            mTailSize     += written;
+            mPendingBytes += written;
+            openNextWriteSegment();
+            return Status(Status::Code::BAD_DEVICE_FAILURE);
+        }
+
+        mTailSize     += written;
+        mPendingBytes += written;
+        return Status(Status::Code::GOOD);
+    }
+
+    std::pair<Status, Message> OutboundLog::Read()
+    {
+        LockGuard lock(mMutex);
+        if (mUnacked.size() >= MAX_UNACKED_COUNT)
+        {
+            return std::make_pair(Status(Status::Code::BAD_WOULD_BLOCK), Message());
+        }
+
+        while (mPendingBytes > 0)
+        {
+            File file = esp32FS.Open(makeSegmentPath(mReadSegment), "r", false);
+            if (!file)
+            {
+                if (mReadSegment == mTailSegment)
+                {
+                    break;
+                }
+                ++mReadSegment;
+                mReadOffset = 0;
+                continue;
+            }
+
+            const size_t fileSize = file.size();
+            if (mReadOffset >= fileSize)
+            {
+                file.close();
+                if (mReadSegment == mTailSegment)
+                {
+                    break;
+                }
+                ++mReadSegment;
+                mReadOffset = 0;
+                continue;
+            }
+
+            std::vector<uint8_t> record(OutboundRecordCodec::HEADER_SIZE);
+            file.seek(mReadOffset);
+            const size_t headerSize = file.read(record.data(), record.size());
+            const std::pair<Status, uint16_t> length = mCodec.ParseHeader(record.data(), headerSize);
+
+            std::pair<Status, Message> message = std::make_pair(length.first, Message());
+            if (length.first == Status::Code::GOOD)
+            {
+                record.resize(OutboundRecordCodec::HEADER_SIZE + length.second);
+                const size_t payloadSize = file.read(record.data() + OutboundRecordCodec::HEADER_SIZE, length.second);
+                record.resize(OutboundRecordCodec::HEADER_SIZE + payloadSize);
+                message = mCodec.Decode(&record);
+            }
+            file.close();
+
+            read_t entry;
+            entry.Sequence        = mNextSequence;
+            entry.Segment         = mReadSegment;
+            entry.Offset          = mReadOffset;
+            entry.Size            = record.size();
+            entry.IsAcknowledged  = false;
+
+            if (message.first != Status::Code::GOOD)
+            {
+                /**
+                 * @note 손상된 레코드부터 세그먼트의 끝까지는 확인된 것으로 등록하여 앞선 레코드가
+                 *       모두 확인되면 함께 지워지도록 합니다.
+                 */
+                LOG_WARNING(logger, "CORRUPTED RECORD IN OUTBOUND SEGMENT #%u AT %u. SKIPPING THE SEGMENT", mReadSegment, mReadOffset);
+                if (mReadSegment == mTailSegment)
+                {
+                    openNextWriteSegment();
+                }
+                entry.Sequence        = 0;
+                entry.Size            = fileSize - mReadOffset;
+                entry.IsAcknowledged  = true;
+                mUnacked.emplace_back(entry);
+                ++mReadSegment;
+                mReadOffset = 0;
+                advanceHead();
+                continue;
+            }
+
+            mNextSequence = mNextSequence == UINT32_MAX ? 1 : mNextSequence + 1;
+            mUnacked.emplace_back(entry);
+            mReadOffset += entry.Size;
+            message.second.SetOutboundSequence(entry.Sequence);
+            return message;
+        }
+
+        return std::make_pair(Status(Status::Code::BAD_NO_DATA), Message());
+    }
+
+    Status OutboundLog::Acknowledge(const uint32_t sequence)
+    {
+        LockGuard lock(mMutex);
+        for (auto& entry : mUnacked)
+        {
+            if (entry.Sequence == sequence && entry.IsAcknowledged == false)
+            {
+                entry.IsAcknowledged = true;
+                advanceHead();
+                return Status(Status::Code::GOOD);
+            }
+        }
+
+        return Status(Status::Code::BAD_NOT_FOUND);
+    }
+
+    Status OutboundLog::Unread(const uint32_t sequence)
+    {
+        LockGuard lock(mMutex);
+        if (mUnacked.empty() == true || mUnacked.back().Sequence != sequence || mUnacked.back().IsAcknowledged == true)
+        {
+            return Status(Status::Code::BAD_NOT_FOUND);
+        }
+
+        mReadSegment = mUnacked.back().Segment;
+        mReadOffset  = mUnacked.back().Offset;
+        mUnacked.pop_back();
+        return Status(Status::Code::GOOD);
+    }
+
+    void OutboundLog::Rewind()
+    {
+        LockGuard lock(mMutex);
+        mUnacked.clear();
+        mReadSegment = mHeadSegment;
+        mReadOffset  = mHeadOffset;
+    }
+
+    void OutboundLog::advanceHead()
+    {
+        bool isAdvanced = false;
+        while (mUnacked.empty() == false && mUnacked.front().IsAcknowledged == true)
+        {
+            const read_t entry = mUnacked.front();
+            mUnacked.pop_front();
+
+            while (mHeadSegment < entry.Segment)
+            {
+                removeHeadSegment();
+            }
+            mHeadOffset    = entry.Offset + entry.Size;
+            mPendingBytes -= std::min(mPendingBytes, entry.Size);
+            ++mUnsyncedAckCount;
+            isAdvanced = true;
+        }
+
+        if (isAdvanced == false)
+        {
+            return;
+        }
+
+        if (mPendingBytes == 0)
+        {
+            while (mHeadSegment != mTailSegment)
+            {
+                esp32FS.Remove(makeSegmentPath(mHeadSegment++));
+            }
+            esp32FS.Remove(makeSegmentPath(mTailSegment));
+            mHeadOffset  = 0;
+            mTailSize    = 0;
+            mReadSegment = mTailSegment;
+            mReadOffset  = 0;
+            saveCursor();
+            LOG_INFO(logger, "Outbound log has been drained");
+            return;
+        }
+
+        if (mUnsyncedAckCount >= CURSOR_SYNC_INTERVAL)
+        {
+            saveCursor();
+        }
+    }
+
+    std::string OutboundLog::makeSegmentPath(const uint32_t index) const
+    {
+        char path[32] = {'\0'};
+        snprintf(path, sizeof(path), "/%s%08u.bin", MQTT_OUTBOUND_PREFIX, index);
+        return std::string(path);
+    }
+
+    std::pair<bool, uint32_t> OutboundLog::parseSegmentIndex(const char* name) const
+    {
+        if (name == nullptr)
+        {
+            return std::make_pair(false, 0);
+        }
+
+        if (name[0] == '/')
+        {
+            ++name;
+        }
+
+        const size_t prefixLength = strlen(MQTT_OUTBOUND_PREFIX);
+        if (strncmp(name, MQTT_OUTBOUND_PREFIX, prefixLength) != 0)
+        {
+            return std::make_pair(false, 0);
+        }
+
+        char* end = nullptr;
+        const unsigned long index = strtoul(name + prefixLength, &end, 10);
+        if (end == name + prefixLength || strcmp(end, ".bin") != 0)
+        {
+            return std::make_pair(false, 0);
+        }
+
+        return std::make_pair(true, static_cast<uint32_t>(index));
+    }
+
+    Status OutboundLog::openNextWriteSegment()
+    {
+        ++mTailSegment;
+        mTailSize = 0;
+
+        while ((mTailSegment - mHeadSegment + 1) > MAX_SEGMENT_COUNT)
+        {
+            LOG_WARNING(logger, "OUTBOUND LOG IS FULL. DROPPING THE OLDEST SEGMENT #%u", mHeadSegment);
+            ++mDroppedSegmentCount;
+            Status ret = removeHeadSegment();
+            if (ret != Status::Code::GOOD)
+            {
+                return ret;
+            }
+        }
+
+        return Status(Status::Code::GOOD);
+    }
+
+    Status OutboundLog::removeHeadSegment()
+    {
+        ASSERT((mHeadSegment != mTailSegment), "CANNOT REMOVE THE SEGMENT BEING WRITTEN");
+
+        const std::string path = makeSegmentPath(mHeadSegment);
+        File file = esp32FS.Open(path, "r", false);
+        if (file)
+        {
+            const size_t fileSize = file.size();
+            file.close();
+
+            const size_t remained = fileSize > mHeadOffset ? fileSize - mHeadOffset : 0;
+            mPendingBytes -= std::min(mPendingBytes, remained);
+        }
+
+        Status ret = esp32FS.Remove(path);
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "FAILED TO REMOVE OUTBOUND SEGMENT #%u: %s", mHeadSegment, ret.c_str());
+        }
+
+        ++mHeadSegment;
+        mHeadOffset = 0;
+
+        /**
+         * @note 가득 차서 버린 세그먼트의 레코드는 더 이상 확인 응답을 기다리지 않습니다.
+         */
+        while (mUnacked.empty() == false && mUnacked.front().Segment < mHeadSegment)
+        {
+            mUnacked.pop_front();
+        }
+        if (mReadSegment < mHeadSegment)
+        {
+            mReadSegment = mHeadSegment;
+            mReadOffset  = 0;
+        }
+        saveCursor();
+        return ret;
+    }
+
+    void OutboundLog::saveCursor()
+    {
+        Preferences pf;
+        if (pf.begin(NVS_NAMESPACE_OUTBOUND, false) == false)
+        {
+            LOG_ERROR(logger, "FAILED TO BEGIN NVS PARTITION");
+            return;
+        }
+
+        pf.putULong("head", mHeadSegment);
+        pf.putULong("offset", mHeadOffset);
+        pf.end();
+        mUnsyncedAckCount = 0;
+    }
+
+    void OutboundLog::loadCursor()
+    {
+        Preferences pf;
+        if (pf.begin(NVS_NAMESPACE_OUTBOUND, true) == false)
+        {
+            mHeadOffset = 0;
+            return;
+        }
+
+        mHeadSegment = pf.getULong("head", 0);
+        mHeadOffset  = pf.getULong("offset", 0);
+        pf.end();
+    }
+
+
+    OutboundLog outboundLog;
+}}
@@ -0,0 +1,126 @@
+/**
+ * @file OutboundLog.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 전송하지 못한 MQTT 메시지를 플래시 메모리에 보관하는 클래스를 선언합니다.
+ * @details 메시지는 고정 크기의 세그먼트 파일에 append-only 방식으로 기록되며, 각 레코드는
+ *          CRC32 체크섬으로 보호됩니다. Read()는 확인 응답을 기다리는 레코드 뒤에서 이어 읽으며,
+ *          브로커로부터 발행이 확인된 레코드는 Acknowledge() 호출 시 앞에서부터 연속으로 확인된
+ *          만큼 커서가 이동합니다. 모두 소진된 세그먼트 파일은 삭제됩니다.
+ *
+ * @note 전원 차단 등으로 인해 마지막 레코드가 손상된 경우, 해당 세그먼트의 나머지 레코드는
+ *       건너뛰고 다음 세그먼트부터 읽습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+#include <sys/_stdint.h>
+
+#include "Common/Status.h"
+#include "Common/Sync/Mutex.hpp"
+#include "Include/Message.h"
+#include "OutboundRecordCodec.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    class OutboundLog
+    {
+    public:
+        OutboundLog();
+        virtual ~OutboundLog() {}
+    public:
+        Status Init();
+        bool IsInitialized() const;
+        bool IsEmpty();
+        size_t GetPendingBytes();
+        /**
+         * @brief 가득 차서 버린 세그먼트의 누적 개수를 반환합니다.
+         * @note 발행 태스크가 유실을 감지하는 데 사용하므로 잠금 없이 읽을 수 있습니다.
+         */
+        uint32_t GetDroppedSegmentCount() const;
+    public:
+        /**
+         * @brief 한 번의 발행 주기에서 플래시로부터 꺼내어 발행할 최대 메시지 수를 설정합니다.
+         */
+        void SetDrainRate(const uint8_t messagesPerCycle);
+        uint8_t GetDrainRate() const;
+    public:
+        Status Append(const Message& message);
+        /**
+         * @brief 다음 레코드를 읽고 확인 응답을 기다리는 레코드로 등록합니다. 읽은 메시지에는
+         *        Acknowledge()에 넘겨줄 번호가 설정됩니다.
+         * @return BAD_WOULD_BLOCK 확인 응답을 기다리는 레코드가 너무 많은 경우
+         * @return BAD_NO_DATA 읽을 레코드가 없는 경우
+         */
+        std::pair<Status, Message> Read();
+        /**
+         * @brief 브로커가 발행을 확인한 레코드를 표시하고, 앞선 레코드가 모두 확인되었으면 지웁니다.
+         * @return BAD_NOT_FOUND 해당 번호의 레코드를 기다리고 있지 않은 경우
+         */
+        Status Acknowledge(const uint32_t sequence);
+        /**
+         * @brief 발행하지 못한 마지막 레코드를 다음 Read()에서 다시 읽도록 되돌립니다.
+         */
+        Status Unread(const uint32_t sequence);
+        /**
+         * @brief 확인 응답을 기다리는 모든 레코드를 잊고 확인된 위치부터 다시 읽습니다.
+         */
+        void Rewind();
+    private:
+        std::string makeSegmentPath(const uint32_t index) const;
+        std::pair<bool, uint32_t> parseSegmentIndex(const char* name) const;
+        Status openNextWriteSegment();
+        void advanceHead();
+        Status removeHeadSegment();
+        void saveCursor();
+        void loadCursor();
+    private:
+        const size_t   SEGMENT_SIZE         = 16 * 1024;
+        const uint8_t  MAX_SEGMENT_COUNT    = 6;
+        const uint8_t  CURSOR_SYNC_INTERVAL = 16;
+        const uint8_t  MAX_UNACKED_COUNT    = 16;
+    private:
+        typedef struct OutboundReadType
+        {
+            uint32_t Sequence;
+            uint32_t Segment;
+            size_t Offset;
+            size_t Size;
+            bool IsAcknowledged;
+        } read_t;
+    private:
+        Mutex mMutex;
+        OutboundRecordCodec mCodec;
+        bool mIsInitialized;
+        uint32_t mHeadSegment;
+        uint32_t mTailSegment;
+        size_t mHeadOffset;
+        size_t mTailSize;
+        size_t mPendingBytes;
+        uint32_t mReadSegment;
+        size_t mReadOffset;
+        uint32_t mNextSequence;
+        std::deque<read_t> mUnacked;
+        uint8_t mUnsyncedAckCount;
+        uint8_t mDrainRate;
+        std::atomic<uint32_t> mDroppedSegmentCount;
+    };
+
+
+    extern OutboundLog outboundLog;
+}}
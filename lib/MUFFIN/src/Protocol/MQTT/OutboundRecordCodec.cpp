@@ -0,0 +1,107 @@
+/**
+ * @file OutboundRecordCodec.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 전송하지 못한 MQTT 메시지를 플래시 메모리에 기록하는 레코드 형식의 인코더와 디코더를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <stddef.h>
+#include <string.h>
+
+#include "OutboundRecordCodec.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    OutboundRecordCodec::OutboundRecordCodec()
+    {
+        mCRC32.Init();
+    }
+
+    Status OutboundRecordCodec::Encode(const Message& message, std::vector<uint8_t>* record)
+    {
+        const char* payload = message.GetPayload();
+        const size_t length = message.GetPayloadLength();
+        if (length > UINT16_MAX)
+        {
+            return Status(Status::Code::BAD_REQUEST_TOO_LARGE);
+        }
+
+        record_header_t header;
+        header.Magic     = RECORD_MAGIC;
+        header.Topic     = static_cast<uint8_t>(message.GetTopicCode());
+        header.Flags     = static_cast<uint8_t>(message.GetQoS())                     |
+                           static_cast<uint8_t>(message.IsRetain() ? 0x04 : 0x00)     |
+                           static_cast<uint8_t>(message.IsCompressed() ? 0x08 : 0x00) |
+                           static_cast<uint8_t>(static_cast<uint8_t>(message.GetSocketID()) << 4);
+        header.MessageID = message.GetMessageID();
+        header.Length    = static_cast<uint16_t>(length);
+        header.Checksum  = 0;
+
+        record->resize(sizeof(record_header_t) + length);
+        memcpy(record->data(), &header, sizeof(record_header_t));
+        memcpy(record->data() + sizeof(record_header_t), payload, length);
+
+        header.Checksum = calculateChecksum(*record);
+        memcpy(record->data() + offsetof(record_header_t, Checksum), &header.Checksum, sizeof(header.Checksum));
+        return Status(Status::Code::GOOD);
+    }
+
+    std::pair<Status, uint16_t> OutboundRecordCodec::ParseHeader(const uint8_t* header, const size_t length) const
+    {
+        if (length < sizeof(record_header_t))
+        {
+            return std::make_pair(Status(Status::Code::BAD_DECODING_ERROR), 0);
+        }
+
+        record_header_t parsed;
+        memcpy(&parsed, header, sizeof(record_header_t));
+        if (parsed.Magic != RECORD_MAGIC)
+        {
+            return std::make_pair(Status(Status::Code::BAD_DECODING_ERROR), 0);
+        }
+
+        return std::make_pair(Status(Status::Code::GOOD), parsed.Length);
+    }
+
+    std::pair<Status, Message> OutboundRecordCodec::Decode(std::vector<uint8_t>* record)
+    {
+        const std::pair<Status, uint16_t> length = ParseHeader(record->data(), record->size());
+        if (length.first != Status::Code::GOOD || record->size() != sizeof(record_header_t) + length.second)
+        {
+            return std::make_pair(Status(Status::Code::BAD_DECODING_ERROR), Message());
+        }
+
+        record_header_t header;
+        memcpy(&header, record->data(), sizeof(record_header_t));
+        memset(record->data() + offsetof(record_header_t, Checksum), 0, sizeof(header.Checksum));
+        if (calculateChecksum(*record) != header.Checksum)
+        {
+            return std::make_pair(Status(Status::Code::BAD_DECODING_ERROR), Message());
+        }
+
+        const std::string payload(record->begin() + sizeof(record_header_t), record->end());
+        Message message(static_cast<topic_e>(header.Topic),
+                        payload,
+                        static_cast<socket_e>(header.Flags >> 4),
+                        header.MessageID,
+                        static_cast<qos_e>(header.Flags & 0x03),
+                        (header.Flags & 0x04) != 0);
+        message.SetCompressed((header.Flags & 0x08) != 0);
+        return std::make_pair(Status(Status::Code::GOOD), message);
+    }
+
+    uint32_t OutboundRecordCodec::calculateChecksum(std::vector<uint8_t>& record)
+    {
+        return mCRC32.Calculate(record.size(), record.data());
+    }
+}}
@@ -0,0 +1,72 @@
+/**
+ * @file OutboundRecordCodec.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 전송하지 못한 MQTT 메시지를 플래시 메모리에 기록하는 레코드 형식의 인코더와 디코더를 선언합니다.
+ * @details 레코드는 고정 크기의 헤더와 페이로드로 구성되며, 헤더의 체크섬은 체크섬 필드를 0으로
+ *          채운 레코드 전체의 CRC32 값입니다. 파일 입출력을 수행하지 않으므로 호스트에서도
+ *          검증할 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <utility>
+#include <vector>
+#include <sys/_stdint.h>
+
+#include "Common/CRC32/CRC32.h"
+#include "Common/Status.h"
+#include "Include/Message.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    class OutboundRecordCodec
+    {
+    public:
+        OutboundRecordCodec();
+        virtual ~OutboundRecordCodec() {}
+    public:
+        /**
+         * @return BAD_REQUEST_TOO_LARGE 페이로드가 UINT16_MAX 바이트보다 큰 경우
+         */
+        Status Encode(const Message& message, std::vector<uint8_t>* record);
+        /**
+         * @brief 레코드의 헤더를 확인하고 헤더 다음에 이어지는 페이로드의 길이를 반환합니다.
+         * @return BAD_DECODING_ERROR 헤더가 잘렸거나 레코드의 시작이 아닌 경우
+         */
+        std::pair<Status, uint16_t> ParseHeader(const uint8_t* header, const size_t length) const;
+        /**
+         * @param record 헤더와 페이로드를 모두 포함한 레코드로, 체크섬을 확인하기 위해 체크섬 필드를 0으로 채웁니다.
+         * @return BAD_DECODING_ERROR 레코드의 길이나 체크섬이 맞지 않는 경우
+         */
+        std::pair<Status, Message> Decode(std::vector<uint8_t>* record);
+    public:
+        static const size_t HEADER_SIZE = 12;
+    private:
+        typedef struct OutboundRecordHeaderType
+        {
+            uint16_t Magic;
+            uint8_t  Topic;
+            uint8_t  Flags;
+            uint16_t MessageID;
+            uint16_t Length;
+            uint32_t Checksum;
+        } record_header_t;
+        static_assert(sizeof(record_header_t) == HEADER_SIZE, "RECORD HEADER LAYOUT MUST MATCH THE STORED FORMAT");
+    private:
+        uint32_t calculateChecksum(std::vector<uint8_t>& record);
+    private:
+        const uint16_t RECORD_MAGIC = 0xA55A;
+        CRC32 mCRC32;
+    };
+}}
@@ -0,0 +1,145 @@
+/**
+ * @file PayloadCompressor.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief CDO에 저장하기 전에 MQTT 메시지의 페이로드를 압축하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+#include <stdio.h>
+
+#include "Common/Assert.hpp"
+#include "Common/Logger/Logger.h"
+#include "Common/Sync/LockGuard.hpp"
+#include "Include/Topic.h"
+#include "PayloadCompressor.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    PayloadCompressor::PayloadCompressor()
+        : mEnabledTopics(0)
+        , mMinimumSize(512)
+    {
+    }
+
+    Status PayloadCompressor::Enable(const topic_e topic)
+    {
+        if (mqtt::topic.IsCompressible(topic) == false)
+        {
+            LOG_WARNING(logger, "COMPRESSION IS NOT SUPPORTED FOR TOPIC: %u", static_cast<uint8_t>(topic));
+            return Status(Status::Code::BAD_NOT_SUPPORTED);
+        }
+
+        mEnabledTopics.fetch_or(static_cast<uint32_t>(1) << static_cast<uint8_t>(topic));
+        return Status(Status::Code::GOOD);
+    }
+
+    void PayloadCompressor::Disable(const topic_e topic)
+    {
+        ASSERT((static_cast<uint8_t>(topic) < 32), "TOPIC CODE OUT OF RANGE: %u", static_cast<uint8_t>(topic));
+        mEnabledTopics.fetch_and(~(static_cast<uint32_t>(1) << static_cast<uint8_t>(topic)));
+    }
+
+    bool PayloadCompressor::IsEnabled(const topic_e topic) const
+    {
+        return (mEnabledTopics.load() & (static_cast<uint32_t>(1) << static_cast<uint8_t>(topic))) != 0;
+    }
+
+    void PayloadCompressor::SetMinimumSize(const size_t minimumSize)
+    {
+        mMinimumSize = minimumSize;
+    }
+
+    size_t PayloadCompressor::GetMinimumSize() const
+    {
+        return mMinimumSize;
+    }
+
+    Status PayloadCompressor::Compress(Message* message)
+    {
+        ASSERT((message != nullptr), "INPUT PARAMETER <Message* message> CANNOT BE A NULL POINTER");
+
+        if (message->IsCompressed() == true ||
+            IsEnabled(message->GetTopicCode()) == false ||
+            message->GetPayloadLength() < mMinimumSize)
+        {
+            return Status(Status::Code::GOOD_NO_DATA);
+        }
+
+        LockGuard lock(mMutex);
+        const uint8_t* payload = reinterpret_cast<const uint8_t*>(message->GetPayload());
+        if (mEncoder.Encode(payload, message->GetPayloadLength(), &mOutput) == false)
+        {
+            return Status(Status::Code::GOOD_NO_DATA);
+        }
+
+        LOG_VERBOSE(logger, "Compressed: %u -> %u Bytes", message->GetPayloadLength(), mOutput.size());
+        message->SetPayload(mOutput);
+        message->SetCompressed(true);
+        return Status(Status::Code::GOOD);
+    }
+
+    void PayloadCompressor::RunBenchmark()
+    {
+        char buffer[64];
+
+        std::string daqBatch("{\"mv\":\"" ESP32_FW_VERSION "\",\"tp\":1,\"ts\":1760745600123,\"mac\":\"A0B765F1C2D4\",\"val\":[");
+        for (uint8_t i = 0; i < 150; ++i)
+        {
+            snprintf(buffer, sizeof(buffer), "%s\"%u.%02u\"", i == 0 ? "" : ",", (i * 37) % 500, (i * 13) % 100);
+            daqBatch.append(buffer);
+        }
+        daqBatch.append("],\"id\":[");
+        for (uint8_t i = 0; i < 150; ++i)
+        {
+            snprintf(buffer, sizeof(buffer), "%s\"n%05u\"", i == 0 ? "" : ",", 1000 + i);
+            daqBatch.append(buffer);
+        }
+        daqBatch.append("]}");
+        benchmark("DAQ BATCH", daqBatch);
+
+        std::string submodel("{\"idShort\":\"RealTimeMonitoring\",\"modelType\":\"SubmodelElementCollection\",\"value\":[");
+        for (uint8_t i = 0; i < 30; ++i)
+        {
+            snprintf(buffer, sizeof(buffer), "%s{\"idShort\":\"Sensor%02u\",\"modelType\":\"Property\",", i == 0 ? "" : ",", i);
+            submodel.append(buffer);
+            snprintf(buffer, sizeof(buffer), "\"valueType\":\"xs:double\",\"value\":\"%u.%03u\",", (i * 7) % 100, (i * 131) % 1000);
+            submodel.append(buffer);
+            submodel.append("\"semanticId\":{\"type\":\"ExternalReference\",\"keys\":[{\"type\":\"GlobalReference\","
+                            "\"value\":\"https://admin-shell.io/idta/OperationalData/Sensor/1/0\"}]}}");
+        }
+        submodel.append("]}");
+        benchmark("AAS SUBMODEL", submodel);
+    }
+
+    void PayloadCompressor::benchmark(const char* name, const std::string& payload)
+    {
+        LockGuard lock(mMutex);
+
+        const uint32_t startMicros = micros();
+        const bool isCompressed = mEncoder.Encode(reinterpret_cast<const uint8_t*>(payload.data()), payload.size(), &mOutput);
+        const uint32_t elapsedMicros = micros() - startMicros;
+
+        if (isCompressed == false)
+        {
+            LOG_INFO(logger, "[%s] NOT COMPRESSIBLE: %u Bytes, %u us", name, payload.size(), elapsedMicros);
+            return;
+        }
+
+        const uint32_t ratioPercent = static_cast<uint32_t>((mOutput.size() * 100) / payload.size());
+        LOG_INFO(logger, "[%s] %u -> %u Bytes (%u%%), %u us", name, payload.size(), mOutput.size(), ratioPercent, elapsedMicros);
+    }
+
+
+    PayloadCompressor payloadCompressor;
+}}
@@ -0,0 +1,72 @@
+/**
+ * @file PayloadCompressor.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief CDO에 저장하기 전에 MQTT 메시지의 페이로드를 압축하는 클래스를 선언합니다.
+ * @details 압축은 토픽 단위로 활성화하며, 압축된 메시지는 토픽 뒤에 압축 접미사를 붙여
+ *          발행하므로 수신 측은 접미사로 페이로드 형식을 구분할 수 있습니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <sys/_stdint.h>
+
+#include "Common/Status.h"
+#include "Common/Sync/Mutex.hpp"
+#include "DataFormat/Heatshrink/HeatshrinkEncoder.h"
+#include "Include/Message.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    class PayloadCompressor
+    {
+    public:
+        PayloadCompressor();
+        virtual ~PayloadCompressor() {}
+    public:
+        /**
+         * @return BAD_NOT_SUPPORTED 압축 토픽이 정의되지 않은 토픽인 경우
+         */
+        Status Enable(const topic_e topic);
+        void Disable(const topic_e topic);
+        bool IsEnabled(const topic_e topic) const;
+        /**
+         * @brief 이 크기보다 작은 페이로드는 압축하지 않습니다.
+         */
+        void SetMinimumSize(const size_t minimumSize);
+        size_t GetMinimumSize() const;
+    public:
+        /**
+         * @return GOOD 페이로드를 압축한 경우
+         * @return GOOD_NO_DATA 압축이 비활성화되었거나 압축의 이점이 없어 원본을 유지한 경우
+         */
+        Status Compress(Message* message);
+        /**
+         * @brief 대표적인 페이로드에 대해 압축률과 소요 시간을 측정하여 로그로 출력합니다.
+         */
+        void RunBenchmark();
+    private:
+        void benchmark(const char* name, const std::string& payload);
+    private:
+        Mutex mMutex;
+        HeatshrinkEncoder mEncoder;
+        std::string mOutput;
+        std::atomic<uint32_t> mEnabledTopics;
+        size_t mMinimumSize;
+    };
+
+
+    extern PayloadCompressor payloadCompressor;
+}}
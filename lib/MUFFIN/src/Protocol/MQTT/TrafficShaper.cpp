@@ -0,0 +1,215 @@
+/**
+ * @file TrafficShaper.cpp
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 토픽 유형별 토큰 버킷으로 MQTT 발행 속도를 제한하는 클래스를 정의합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#include <Arduino.h>
+
+#include "Common/Logger/Logger.h"
+#include "TrafficShaper.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    TrafficShaper::TrafficShaper()
+    {
+        ClearLimits();
+    }
+
+    void TrafficShaper::ApplyCatM1Profile()
+    {
+        SetBucket(traffic_class_e::CONTROL,  0,  0);
+        SetBucket(traffic_class_e::ALARM,    5, 20);
+        SetBucket(traffic_class_e::DAQ,      2, 10);
+        SetBucket(traffic_class_e::AAS,      1,  5);
+        SetBucket(traffic_class_e::STATUS,   1,  3);
+    }
+
+    void TrafficShaper::ClearLimits()
+    {
+        for (uint8_t idx = 0; idx < CLASS_COUNT; ++idx)
+        {
+            SetBucket(static_cast<traffic_class_e>(idx), 0, 0);
+        }
+    }
+
+    void TrafficShaper::SetBucket(const traffic_class_e trafficClass, const uint16_t ratePerSecond, const uint16_t burstSize)
+    {
+        bucket_t& bucket = mBuckets[static_cast<uint8_t>(trafficClass)];
+        bucket.RatePerSecond     = ratePerSecond;
+        bucket.CapacityMilli     = static_cast<uint32_t>(burstSize) * MILLI;
+        bucket.TokensMilli       = bucket.CapacityMilli;
+        bucket.LastRefillMillis  = millis();
+    }
+
+    traffic_class_e TrafficShaper::Classify(const topic_e topic) const
+    {
+        switch (topic)
+        {
+        case topic_e::ALARM:
+        case topic_e::ERROR:
+        case topic_e::PUSH:
+            return traffic_class_e::ALARM;
+        case topic_e::DAQ_INPUT:
+        case topic_e::DAQ_OUTPUT:
+        case topic_e::DAQ_PARAM:
+        case topic_e::OPERATION:
+        case topic_e::UPTIME:
+        case topic_e::FINISHEDGOODS:
+        case topic_e::SPARKPLUG_NDATA:
+            return traffic_class_e::DAQ;
+        case topic_e::AAS_OPERATIONALDATA_RTM:
+        case topic_e::AAS_OPERATIONALDATA_JP:
+        case topic_e::AAS_CONFIGURATION:
+            return traffic_class_e::AAS;
+        case topic_e::JARVIS_STATUS:
+        case topic_e::FOTA_CONFIG:
+        case topic_e::LOG_RESPONSE:
+        case topic_e::METRICS:
+        case topic_e::TRACE_RESPONSE:
+        case topic_e::REPLAY_RESPONSE:
+            return traffic_class_e::STATUS;
+        default:
+            return traffic_class_e::CONTROL;
+        }
+    }
+
+    bool TrafficShaper::Admit(MessageHandle* handle, const size_t maxPayloadSize)
+    {
+        bucket_t& bucket = mBuckets[static_cast<uint8_t>(Classify(handle->Get().GetTopicCode()))];
+        if (bucket.RatePerSecond == 0)
+        {
+            return true;
+        }
+
+        /**
+         * @note 같은 유형의 보류 메시지가 있으면 발행 순서를 지키기 위해 토큰이 있더라도 보류합니다.
+         */
+        if (bucket.Pending.empty() == true && tryConsume(&bucket) == true)
+        {
+            return true;
+        }
+
+        if (bucket.Pending.empty() == false &&
+            cdo.Coalesce(&bucket.Pending.back(), handle, maxPayloadSize) == Status::Code::GOOD)
+        {
+            LOG_DEBUG(logger, "Coalesced message into pending batch: %s", bucket.Pending.back().Get().GetTopicString());
+            return false;
+        }
+
+        if (bucket.Pending.size() >= MAX_PENDING_PER_CLASS)
+        {
+            return false;
+        }
+
+        bucket.Pending.emplace_back(std::move(*handle));
+        return false;
+    }
+
+    std::pair<Status, MessageHandle> TrafficShaper::AcquireReady()
+    {
+        for (auto& bucket : mBuckets)
+        {
+            /**
+             * @note 속도 제한을 해제한 유형에 남아 있는 보류 메시지는 토큰 없이 꺼냅니다.
+             */
+            if (bucket.Pending.empty() == true || (bucket.RatePerSecond != 0 && tryConsume(&bucket) == false))
+            {
+                continue;
+            }
+
+            MessageHandle handle(std::move(bucket.Pending.front()));
+            bucket.Pending.pop_front();
+            return std::make_pair(Status(Status::Code::GOOD), std::move(handle));
+        }
+
+        return std::make_pair(Status(Status::Code::BAD_NO_DATA), MessageHandle());
+    }
+
+    void TrafficShaper::Refund(const topic_e topic)
+    {
+        bucket_t& bucket = mBuckets[static_cast<uint8_t>(Classify(topic))];
+        if (bucket.RatePerSecond == 0)
+        {
+            return;
+        }
+
+        refill(&bucket);
+        bucket.TokensMilli = bucket.CapacityMilli - bucket.TokensMilli < MILLI
+            ? bucket.CapacityMilli
+            : bucket.TokensMilli + MILLI;
+    }
+
+    std::pair<Status, MessageHandle> TrafficShaper::AcquirePending()
+    {
+        for (auto& bucket : mBuckets)
+        {
+            if (bucket.Pending.empty() == true)
+            {
+                continue;
+            }
+
+            MessageHandle handle(std::move(bucket.Pending.front()));
+            bucket.Pending.pop_front();
+            return std::make_pair(Status(Status::Code::GOOD), std::move(handle));
+        }
+
+        return std::make_pair(Status(Status::Code::BAD_NO_DATA), MessageHandle());
+    }
+
+    size_t TrafficShaper::Count() const
+    {
+        size_t count = 0;
+        for (const auto& bucket : mBuckets)
+        {
+            count += bucket.Pending.size();
+        }
+        return count;
+    }
+
+    void TrafficShaper::refill(bucket_t* bucket)
+    {
+        const uint32_t now = millis();
+        const uint32_t elapsedMillis = now - bucket->LastRefillMillis;
+        if (elapsedMillis == 0)
+        {
+            return;
+        }
+
+        /**
+         * @note 초당 토큰 수는 밀리초당 밀리토큰 수와 같으므로 정수 연산만으로 충전합니다.
+         */
+        const uint64_t refilled = static_cast<uint64_t>(bucket->TokensMilli) +
+                                  static_cast<uint64_t>(elapsedMillis) * bucket->RatePerSecond;
+        bucket->TokensMilli = refilled > bucket->CapacityMilli
+            ? bucket->CapacityMilli
+            : static_cast<uint32_t>(refilled);
+        bucket->LastRefillMillis = now;
+    }
+
+    bool TrafficShaper::tryConsume(bucket_t* bucket)
+    {
+        refill(bucket);
+        if (bucket->TokensMilli < MILLI)
+        {
+            return false;
+        }
+
+        bucket->TokensMilli -= MILLI;
+        return true;
+    }
+
+
+    TrafficShaper trafficShaper;
+}}
@@ -0,0 +1,113 @@
+/**
+ * @file TrafficShaper.h
+ * @author Lee, Sang-jin (lsj31@edgecross.ai)
+ *
+ * @brief 토픽 유형별 토큰 버킷으로 MQTT 발행 속도를 제한하는 클래스를 선언합니다.
+ * @details 설비 정지와 같이 다수의 이벤트가 한꺼번에 발생하면 작은 메시지가 CDO에 몰리게
+ *          됩니다. 토큰이 소진된 유형의 메시지는 발행하지 않고 보류하며, 보류 중인 같은
+ *          토픽의 메시지는 하나의 배치로 병합하여 슬롯과 전송 횟수를 줄입니다. 원격제어 응답과
+ *          같은 제어 메시지는 속도를 제한하지 않습니다. 속도 제한은 LTE Cat.M1 링크를 사용할
+ *          때만 적용하며, 유형별 속도는 SetBucket()으로 바꿀 수 있습니다.
+ *
+ * @note MQTT 태스크에서만 사용해야 합니다.
+ *
+ * @date 2026-10-18
+ * @version 1.5.0
+ *
+ * @copyright Copyright (c) Edgecross Inc. 2024-2026
+ */
+
+
+
+
+#pragma once
+
+#include <deque>
+#include <sys/_stdint.h>
+
+#include "Common/Status.h"
+#include "Protocol/MQTT/CDO.h"
+#include "Protocol/MQTT/Include/TypeDefinitions.h"
+
+
+
+namespace muffin { namespace mqtt {
+
+    typedef enum class TrafficClassEnum
+        : uint8_t
+    {
+        CONTROL  = 0,
+        ALARM    = 1,
+        DAQ      = 2,
+        AAS      = 3,
+        STATUS   = 4
+    } traffic_class_e;
+
+
+    class TrafficShaper
+    {
+    public:
+        TrafficShaper();
+        virtual ~TrafficShaper() {}
+    public:
+        /**
+         * @param ratePerSecond 초당 충전되는 토큰의 수로, 0이면 해당 유형의 속도를 제한하지 않습니다.
+         * @param burstSize 연속해서 발행할 수 있는 최대 메시지 수입니다.
+         */
+        void SetBucket(const traffic_class_e trafficClass, const uint16_t ratePerSecond, const uint16_t burstSize);
+        /**
+         * @brief 모뎀 측 연결 끊김이 발생하는 LTE Cat.M1 링크에 맞춘 기본 속도 제한을 적용합니다.
+         */
+        void ApplyCatM1Profile();
+        /**
+         * @brief 모든 유형의 속도 제한을 해제합니다. Ethernet, Wi-Fi 링크의 기본값입니다.
+         */
+        void ClearLimits();
+        traffic_class_e Classify(const topic_e topic) const;
+    public:
+        /**
+         * @brief CDO에서 꺼낸 메시지를 바로 발행할 수 있는지 확인하고, 발행할 수 없으면 보류합니다.
+         * @return true 토큰을 소비했으므로 호출자가 메시지를 발행해야 하는 경우
+         * @return false 메시지를 보류했거나 같은 토픽의 보류 메시지에 병합하여 핸들이 비어 있는 경우,
+         *         또는 보류할 공간이 없어 핸들이 호출자에게 남아 있는 경우(IsValid()로 구분)
+         */
+        bool Admit(MessageHandle* handle, const size_t maxPayloadSize);
+        /**
+         * @brief 토큰이 충전된 유형의 보류 메시지를 오래된 순서대로 꺼냅니다.
+         * @return Status::Code::BAD_NO_DATA 발행할 수 있는 보류 메시지가 없는 경우
+         */
+        std::pair<Status, MessageHandle> AcquireReady();
+        /**
+         * @brief Admit() 또는 AcquireReady()에서 소비한 토큰을 되돌립니다.
+         * @details 발행 계층이 메시지를 받아들이지 않은 경우에 호출하여 실제로 발행한 메시지만
+         *          속도 제한에 반영합니다.
+         */
+        void Refund(const topic_e topic);
+        /**
+         * @brief 토큰과 관계없이 보류 메시지를 꺼냅니다. 서비스를 멈출 때 메시지를 보존하기 위해 사용합니다.
+         * @return Status::Code::BAD_NO_DATA 보류 메시지가 없는 경우
+         */
+        std::pair<Status, MessageHandle> AcquirePending();
+        size_t Count() const;
+    private:
+        typedef struct TokenBucketType
+        {
+            uint32_t RatePerSecond;
+            uint32_t CapacityMilli;
+            uint32_t TokensMilli;
+            uint32_t LastRefillMillis;
+            std::deque<MessageHandle> Pending;
+        } bucket_t;
+    private:
+        void refill(bucket_t* bucket);
+        bool tryConsume(bucket_t* bucket);
+    private:
+        static const uint8_t CLASS_COUNT = 5;
+        const uint8_t MAX_PENDING_PER_CLASS = 16;
+        const uint32_t MILLI = 1000;
+        bucket_t mBuckets[CLASS_COUNT];
+    };
+
+
+    extern TrafficShaper trafficShaper;
+}}
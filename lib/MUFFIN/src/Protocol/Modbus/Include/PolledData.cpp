@@ -575,4 +575,85 @@ namespace muffin { namespace modbus {
             return Status(Status::Code::GOOD);
         }
     }
-}}
\ No newline at end of file
+
+    void PolledData::Encode(const uint8_t slaveID, std::string* output) const
+    {
+        for (const auto& pair : mMapDatumByArea)
+        {
+            std::vector<datum_t> data(pair.second);
+            std::sort(data.begin(), data.end(), [](const datum_t& lhs, const datum_t& rhs)
+            {
+                return lhs.Address < rhs.Address;
+            });
+
+            size_t begin = 0;
+            while (begin < data.size())
+            {
+                size_t end = begin + 1;
+                while (end < data.size() && data[end].Address == data[end - 1].Address + 1 && (end - begin) < UINT16_MAX)
+                {
+                    ++end;
+                }
+
+                encodeRun(slaveID, pair.first, &data[begin], static_cast<uint16_t>(end - begin), output);
+                begin = end;
+            }
+        }
+    }
+
+    void PolledData::encodeRun(const uint8_t slaveID, const jvs::node_area_e area, const datum_t* run, const uint16_t count, std::string* output) const
+    {
+        /**
+         * @note 유효한 값이 모두 0 또는 1이면 비트 영역으로 보고 값을 비트 단위로 묶어 저장합니다.
+         */
+        bool isBitArea = true;
+        for (uint16_t idx = 0; idx < count; ++idx)
+        {
+            if (run[idx].IsOK == true && run[idx].Value > 1)
+            {
+                isBitArea = false;
+                break;
+            }
+        }
+
+        output->push_back(static_cast<char>(slaveID));
+        output->push_back(static_cast<char>(area));
+        output->push_back(static_cast<char>(isBitArea ? 1 : 0));
+        output->push_back(static_cast<char>(run[0].Address));
+        output->push_back(static_cast<char>(run[0].Address >> 8));
+        output->push_back(static_cast<char>(count));
+        output->push_back(static_cast<char>(count >> 8));
+
+        const size_t bitmapSize = (count + 7) / 8;
+        std::string validity(bitmapSize, '\0');
+        for (uint16_t idx = 0; idx < count; ++idx)
+        {
+            if (run[idx].IsOK == true)
+            {
+                validity[idx / 8] |= static_cast<char>(1 << (idx % 8));
+            }
+        }
+        output->append(validity);
+
+        if (isBitArea == true)
+        {
+            std::string values(bitmapSize, '\0');
+            for (uint16_t idx = 0; idx < count; ++idx)
+            {
+                if (run[idx].IsOK == true && run[idx].Value == 1)
+                {
+                    values[idx / 8] |= static_cast<char>(1 << (idx % 8));
+                }
+            }
+            output->append(values);
+            return;
+        }
+
+        for (uint16_t idx = 0; idx < count; ++idx)
+        {
+            const uint16_t value = run[idx].IsOK ? run[idx].Value : 0;
+            output->push_back(static_cast<char>(value));
+            output->push_back(static_cast<char>(value >> 8));
+        }
+    }
+}}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <map>
+#include <string>
 #include <vector>
 
 #include "Common/Status.h"
@@ -49,6 +50,10 @@ namespace muffin { namespace modbus {
         datum_t RetrieveDiscreteInput(const uint16_t address) const;
         datum_t RetrieveInputRegister(const uint16_t address) const;
         datum_t RetrieveHoldingRegister(const uint16_t address) const;
+    public:
+        void Encode(const uint8_t slaveID, std::string* output) const;
+    private:
+        void encodeRun(const uint8_t slaveID, const jvs::node_area_e area, const datum_t* run, const uint16_t count, std::string* output) const;
     private:
         std::map<jvs::node_area_e, std::vector<datum_t>> mMapDatumByArea;
     };
@@ -275,4 +275,62 @@ namespace muffin { namespace modbus {
 
         return it->second.UpdateWordArea(address, value, area);
     }
-}}
\ No newline at end of file
+
+    void PolledDataTable::Encode(std::string* output) const
+    {
+        for (const auto& pair : mMapPolledDataBySlave)
+        {
+            pair.second.Encode(pair.first, output);
+        }
+    }
+
+    Status PolledDataTable::Decode(const uint8_t* data, const size_t length)
+    {
+        constexpr size_t RUN_HEADER_SIZE = 7;
+        size_t position = 0;
+
+        while (position < length)
+        {
+            if ((length - position) < RUN_HEADER_SIZE)
+            {
+                return Status(Status::Code::BAD_DECODING_ERROR);
+            }
+
+            const uint8_t slaveID = data[position];
+            const jvs::node_area_e area = static_cast<jvs::node_area_e>(data[position + 1]);
+            const bool isBitArea = data[position + 2] == 1;
+            const uint16_t startAddress = data[position + 3] | (data[position + 4] << 8);
+            const uint16_t count = data[position + 5] | (data[position + 6] << 8);
+            position += RUN_HEADER_SIZE;
+
+            const size_t bitmapSize = (count + 7) / 8;
+            const size_t valueSize = isBitArea ? bitmapSize : count * 2;
+            if ((length - position) < (bitmapSize + valueSize))
+            {
+                return Status(Status::Code::BAD_DECODING_ERROR);
+            }
+
+            const uint8_t* validity = data + position;
+            const uint8_t* values = validity + bitmapSize;
+            for (uint16_t idx = 0; idx < count; ++idx)
+            {
+                int32_t value = -1;
+                if ((validity[idx / 8] & (1 << (idx % 8))) != 0)
+                {
+                    value = isBitArea
+                        ? ((values[idx / 8] >> (idx % 8)) & 1)
+                        : (values[idx * 2] | (values[idx * 2 + 1] << 8));
+                }
+
+                Status ret = UpdateWordArea(slaveID, startAddress + idx, value, area);
+                if (ret != Status::Code::GOOD)
+                {
+                    return ret;
+                }
+            }
+            position += bitmapSize + valueSize;
+        }
+
+        return Status(Status::Code::GOOD);
+    }
+}}
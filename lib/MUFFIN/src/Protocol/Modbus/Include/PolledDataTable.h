@@ -17,6 +17,7 @@
 #pragma once
 
 #include <map>
+#include <string>
 
 #include "Common/Status.h"
 #include "PolledData.h"
@@ -50,6 +51,18 @@ namespace muffin { namespace modbus {
         datum_t RetrieveHoldingRegister(const uint8_t slaveID, const uint16_t address) const;
     public:
         void Clear();
+    public:
+        /**
+         * @brief 모든 슬레이브의 수집 데이터를 주소가 연속된 구간 단위의 바이너리로 직렬화합니다.
+         * @details 구간마다 슬레이브 ID(1), 영역(1), 비트 영역 여부(1), 시작 주소(2), 개수(2)를
+         *          쓰고, 이어서 유효 여부 비트맵과 값을 씁니다. 값은 비트 영역이면 비트맵으로,
+         *          그 밖에는 리틀 엔디언 16비트 정수로 씁니다.
+         */
+        void Encode(std::string* output) const;
+        /**
+         * @brief Encode()로 직렬화한 데이터를 읽어 수집 데이터를 갱신합니다.
+         */
+        Status Decode(const uint8_t* data, const size_t length);
     private:
         std::map<uint8_t, PolledData> mMapPolledDataBySlave;
     };
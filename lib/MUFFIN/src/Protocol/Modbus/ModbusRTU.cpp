@@ -14,13 +14,17 @@
 
 
 
+#define MUFFIN_LOG_MODULE   muffin::log_module_e::MODBUS
+
 #include <string.h>
 
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
 #include "Common/Time/TimeUtils.h"
+#include "Common/Trace/Tracer.h"
 #include "Common/Convert/ConvertClass.h"
 #include "Core/Core.h"
+#include "Core/Replay/TrafficReplay.h"
 #include "IM/Node/NodeStore.h"
 #include "Include/ArduinoModbus/src/ModbusRTUClient.h"
 #include "ModbusRTU.h"
@@ -284,17 +288,27 @@ Status ModbusRTU::PollTemp()
 
     Status ModbusRTU::Poll()
     {
-        Status ret = implementPolling();
+        /**
+         * @note 기록한 데이터를 재생하는 중에는 설비를 폴링하지 않고 기록된 프레임을 적용합니다.
+         */
+        uint32_t stageStartMicros = micros();
+        Status ret = trafficReplay.IsReplaying() == true
+            ? trafficReplay.Inject(replay_source_e::MODBUS_RTU, static_cast<uint32_t>(mPort), 0, &mPolledDataTable)
+            : implementPolling();
         if (ret != Status::Code::GOOD)
         {
             LOG_ERROR(logger, "FAILED TO POLL DATA: %s", ret.c_str());
         }
+        trafficReplay.Record(replay_source_e::MODBUS_RTU, static_cast<uint32_t>(mPort), 0, mPolledDataTable);
+        trafficReplay.RecordStage(replay_stage_e::POLL, micros() - stageStartMicros);
         
+        stageStartMicros = micros();
         ret = updateVariableNodes();
         if (ret != Status::Code::GOOD)
         {
             LOG_ERROR(logger, "FAILED TO UPDATE NODES: %s", ret.c_str());
         }
+        trafficReplay.RecordStage(replay_stage_e::VARIABLE, micros() - stageStartMicros);
 
         return ret;
     }
@@ -310,11 +324,16 @@ Status ModbusRTU::PollTemp()
             return Status(Status::Code::BAD);
         }
 
+        tracer.Begin(trace_event_e::MODBUS_RTU_LOCK_WAIT);
         if (xSemaphoreTake(xSemaphoreModbusRTU, 2000)  != pdTRUE)
         {
+            tracer.End(trace_event_e::MODBUS_RTU_LOCK_WAIT);
+            tracer.Fault(trace_event_e::LOCK_TIMEOUT);
             LOG_WARNING(logger, "[MODBUS RTU] THE READ MODULE IS BUSY. TRY LATER.");
             return Status(Status::Code::BAD_TOO_MANY_OPERATIONS);
         }
+        tracer.End(trace_event_e::MODBUS_RTU_LOCK_WAIT);
+        tracer.Begin(trace_event_e::MODBUS_RTU_LOCK);
 
         for (const auto& slaveID : retrievedSlaveInfo.second)
         {
@@ -361,6 +380,7 @@ Status ModbusRTU::PollTemp()
                 }
             }
         }
+        tracer.End(trace_event_e::MODBUS_RTU_LOCK);
         xSemaphoreGive(xSemaphoreModbusRTU);
         return ret;
     }
@@ -14,12 +14,15 @@
 
 
 
+#define MUFFIN_LOG_MODULE   muffin::log_module_e::MODBUS
+
 #include <string.h>
 
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
 #include "Common/Time/TimeUtils.h"
 #include "Common/Convert/ConvertClass.h"
+#include "Core/Replay/TrafficReplay.h"
 #include "IM/Node/NodeStore.h"
 #include "Include/ArduinoModbus/src/ModbusTCPClient.h"
 #include "ModbusTCP.h"
@@ -140,17 +143,27 @@ namespace muffin {
 
     Status ModbusTCP::Poll()
     {
-        Status ret = implementPolling();
+        /**
+         * @note 기록한 데이터를 재생하는 중에는 설비를 폴링하지 않고 기록된 프레임을 적용합니다.
+         */
+        uint32_t stageStartMicros = micros();
+        Status ret = trafficReplay.IsReplaying() == true
+            ? trafficReplay.Inject(replay_source_e::MODBUS_TCP, static_cast<uint32_t>(mServerIP), mServerPort, &mPolledDataTable)
+            : implementPolling();
         if (ret != Status::Code::GOOD)
         {
             LOG_ERROR(logger, "FAILED TO POLL DATA: %s", ret.c_str());
         }
+        trafficReplay.Record(replay_source_e::MODBUS_TCP, static_cast<uint32_t>(mServerIP), mServerPort, mPolledDataTable);
+        trafficReplay.RecordStage(replay_stage_e::POLL, micros() - stageStartMicros);
         
+        stageStartMicros = micros();
         ret = updateVariableNodes();
         if (ret != Status::Code::GOOD)
         {
             LOG_ERROR(logger, "FAILED TO UPDATE NODES: %s", ret.c_str());
         }
+        trafficReplay.RecordStage(replay_stage_e::VARIABLE, micros() - stageStartMicros);
 
         return ret;
     }
@@ -20,6 +20,7 @@
 #include "Common/Assert.hpp"
 #include "Common/CRC32/CRC32.h"
 #include "Common/Logger/Logger.h"
+#include "Common/Metrics/HeapStats.h"
 #include "Common/DataStructure/bitset.h"
 #include "Core/MemoryPool/MemoryPool.h"
 #include "IM/Custom/Constants.h"
@@ -94,6 +95,7 @@ namespace muffin {
         {
             return Status(Status::Code::BAD_OUT_OF_MEMORY);
         }
+        heapStats.Allocate(heap_tag_e::OTA_BUFFER, BLOCK_SIZE * MAX_QUEUE_LENGTH);
 
         LOG_DEBUG(logger, "Iniialized FirmwareUpdateService");
         return Status(Status::Code::GOOD);
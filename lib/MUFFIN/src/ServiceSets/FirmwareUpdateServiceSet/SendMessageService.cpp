@@ -52,7 +52,7 @@ namespace muffin {
         LOG_INFO(logger, "\n Topic: fota/status \n Payload: %s", buffer);
 
         mqtt::Message message(mqtt::topic_e::FOTA_STATUS, buffer);
-        Status ret = mqtt::cdo.Store(message);
+        Status ret = mqtt::cdo.Store(std::move(message));
         if (ret != Status::Code::GOOD)
         {
             /**
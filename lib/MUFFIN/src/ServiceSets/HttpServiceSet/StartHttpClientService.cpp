@@ -51,7 +51,7 @@ namespace muffin {
         return ret;
     }
 
-#if defined(MT10) || defined(MB10) || defined(MT11)
+#if defined(MT10) || defined(MB10) || defined(MT11) || defined(CATM1_PPPOS)
     static Status strategyInitEthernet()
     {
         http::LwipHTTP* lwipHTTP = new(std::nothrow) http::LwipHTTP();
@@ -85,6 +85,13 @@ namespace muffin {
             return Status(Status::Code::GOOD);
         }
         
+    #if defined(CATM1_PPPOS)
+        if (jvs::config::operation.GetServerNIC().second == jvs::snic_e::LTE_CatM1)
+        {
+            return strategyInitEthernet();
+        }
+    #endif
+
         std::pair<Status, size_t> mutex = std::make_pair(Status(Status::Code::BAD), 0);
         if (jvs::config::operation.GetServerNIC().second == jvs::snic_e::LTE_CatM1)
         {
@@ -13,16 +13,27 @@
 
 
 
+#include <algorithm>
+#include <atomic>
+#include <map>
 #include <Preferences.h>
+#include <vector>
 
 #include "Common/Assert.hpp"
+#include "Common/Logger/FlashLog.h"
 #include "Common/Logger/Logger.h"
+#include "Common/Logger/MqttLog.h"
+#include "Common/Metrics/Metrics.h"
+#include "Common/Time/ScopedTimer.h"
 #include "Common/Time/TimeUtils.h"
+#include "Common/Trace/Tracer.h"
 #include "Common/Convert/ConvertClass.h"
 #include "DataFormat/JSON/JSON.h"
+#include "DataFormat/SparkplugB/SparkplugB.h"
 
 
 #include "Core/Core.h"
+#include "Core/Replay/TrafficReplay.h"
 #include "Core/Task/ModbusTask.h"
 #include "Core/Task/MelsecTask.h"
 #include "Core/Task/EthernetIpTask.h"
@@ -43,6 +54,8 @@
 #include "Network/CatM1/CatM1.h"
 #include "Protocol/MQTT/CDO.h"
 #include "Protocol/MQTT/CIA.h"
+#include "Protocol/MQTT/OutboundLog.h"
+#include "Protocol/MQTT/TrafficShaper.h"
 #include "Protocol/MQTT/CatMQTT/CatMQTT.h"
 #include "Protocol/MQTT/Include/BrokerInfo.h"
 #include "Protocol/MQTT/Include/Helper.h"
@@ -60,13 +73,57 @@
 
 
 static TaskHandle_t xHandle = NULL;
-static uint8_t RECONNECT_TRIAL_COUNT = 0;
 muffin::CallbackUpdateInitConfig cbUpdateInitConfig = nullptr;
 
 
 namespace muffin {
 
 
+    /**
+     * @note 재연결에 실패할 때마다 대기 시간을 두 배씩 늘리며, 여러 장치가 동시에 다시 접속하지
+     *       않도록 대기 시간의 절반부터 전체 사이에서 무작위로 다음 시도 시점을 정합니다.
+     */
+    static const uint32_t RECONNECT_CHECK_MILLIS        = 10 * SECOND_IN_MILLIS;
+    static const uint32_t RECONNECT_BACKOFF_MIN_MILLIS  = 5 * SECOND_IN_MILLIS;
+    static const uint32_t RECONNECT_BACKOFF_MAX_MILLIS  = 300 * SECOND_IN_MILLIS;
+    static uint32_t s_ReconnectBackoffMillis   = 0;
+    static uint32_t s_ReconnectIntervalMillis  = RECONNECT_CHECK_MILLIS;
+
+    /**
+     * @note 보류할 공간이 없는 메시지를 한 발행 주기에 최대 몇 개까지 건너뛸지 정합니다.
+     */
+    static const uint8_t MAX_DEFERRED_PER_CYCLE = 32;
+
+    /**
+     * @note 확인 응답 대기 윈도우가 가득 찬 경우 PUBACK을 처리하기 전까지 MQTT 태스크가 쉬는 시간입니다.
+     */
+    static const uint32_t INFLIGHT_WAIT_MILLIS = 20;
+
+    /**
+     * @note 정지 요청은 MQTT 태스크가 반복문의 시작에서 확인하여 스스로 종료합니다.
+     */
+    static std::atomic<bool> s_IsStopRequested(false);
+
+    static void storeUnsentMessages();
+
+    static void scheduleReconnect(const bool isConnected)
+    {
+        if (isConnected == true)
+        {
+            s_ReconnectBackoffMillis  = 0;
+            s_ReconnectIntervalMillis = RECONNECT_CHECK_MILLIS;
+            return;
+        }
+
+        s_ReconnectBackoffMillis = s_ReconnectBackoffMillis == 0
+            ? RECONNECT_BACKOFF_MIN_MILLIS
+            : std::min(2 * s_ReconnectBackoffMillis, RECONNECT_BACKOFF_MAX_MILLIS);
+
+        const uint32_t halfMillis = s_ReconnectBackoffMillis / 2;
+        s_ReconnectIntervalMillis = halfMillis + (esp_random() % (halfMillis + 1));
+        LOG_WARNING(logger, "FAILED TO RECONNECT TO THE BROKER. RETRY IN %u ms", s_ReconnectIntervalMillis);
+    }
+
     Status manageConnection()
     {
         if (mqttClient == nullptr)
@@ -77,6 +134,7 @@ namespace muffin {
 
         if (mqttClient->IsConnected() == Status::Code::GOOD)
         {
+            scheduleReconnect(true);
             return Status(Status::Code::GOOD);
         }
         
@@ -88,51 +146,98 @@ namespace muffin {
         }
         
         Status ret = mqttClient->Disconnect(mutex.second);
+        snic->ReleaseMutex();
         if (ret != Status::Code::GOOD)
         {
-            snic->ReleaseMutex();
-            goto ON_FAIL;
+            scheduleReconnect(false);
+            return ret;
         }
-        snic->ReleaseMutex();
+
+        /**
+         * @note 영구 세션으로 다시 접속하면 구독 정보와 브로커에 보관된 요청이 유지되므로
+         *       재부팅하지 않고 다음 시도를 기다립니다.
+         */
         ret = InitMqttClientService();
-        if (ret != Status::Code::GOOD)
+        if (ret == Status::Code::GOOD)
         {
-            goto ON_FAIL;
+            ret = ConnectMqttClientService();
         }
 
-        ret = ConnectMqttClientService();
         if (ret != Status::Code::GOOD)
         {
-            goto ON_FAIL;
+            scheduleReconnect(false);
+            return ret;
         }
 
         LOG_INFO(logger, "Reconnected to the MQTT broker");
-        snic->ReleaseMutex();
-        RECONNECT_TRIAL_COUNT = 0;
+        scheduleReconnect(true);
         return ret;
-        
-    ON_FAIL:
-        if (++RECONNECT_TRIAL_COUNT == MAX_RETRY_COUNT)
+    }
+
+    /**
+     * @note 플래시 메모리에서 꺼낸 메시지도 CDO의 슬롯에 옮겨 Deliver()로 발행합니다. 레코드는
+     *       브로커의 확인 응답을 받아 핸들이 해제될 때 지워지므로 연결이 끊기더라도 유실되지 않습니다.
+     * @return Status::Code::BAD_WOULD_BLOCK 확인 응답 대기 윈도우가 가득 차 발행을 멈춘 경우
+     */
+    Status drainOutboundLog(const size_t mutexHandle)
+    {
+        Status ret(Status::Code::GOOD);
+        for (uint8_t drainCount = 0; drainCount < mqtt::outboundLog.GetDrainRate(); ++drainCount)
         {
-            LOG_ERROR(logger, "FAILED TO RECONNECT TO THE BROKER");
-            LOG_INFO(logger, "Restart the device");
-        #if defined(MT10) || defined(MB10)
-            spear.Reset();
-        #endif 
-            esp_restart();
+            std::pair<Status, mqtt::Message> message = mqtt::outboundLog.Read();
+            if (message.first != Status::Code::GOOD)
+            {
+                break;
+            }
+
+            const uint32_t sequence = message.second.GetOutboundSequence();
+            std::pair<Status, mqtt::MessageHandle> handle = mqtt::cdo.Adopt(std::move(message.second));
+            if (handle.first != Status::Code::GOOD)
+            {
+                mqtt::outboundLog.Unread(sequence);
+                break;
+            }
+
+            ret = mqttClient->Deliver(mutexHandle, &handle.second);
+            if (ret != Status::Code::GOOD)
+            {
+                handle.second.Release();
+                mqtt::outboundLog.Unread(sequence);
+                if (ret == Status::Code::BAD_WOULD_BLOCK)
+                {
+                    break;
+                }
+
+                LOG_WARNING(logger, "FAILED TO PUBLISH STORED MESSAGE: %s", ret.c_str());
+                break;
+            }
         }
 
-        snic->ReleaseMutex();
         return ret;
     }
 
+    /**
+     * @return Status::Code::BAD_WOULD_BLOCK 확인 응답 대기 윈도우가 가득 차 남은 메시지를 되돌려 둔 경우
+     */
     Status publishMessages()
     {
-        if (mqtt::cdo.Count() == 0)
+        metrics.SetGauge(gauge_e::CDO_PRIORITY_DEPTH, mqtt::cdo.Count(mqtt::lane_e::PRIORITY));
+        metrics.SetGauge(gauge_e::CDO_BULK_DEPTH, mqtt::cdo.Count(mqtt::lane_e::BULK));
+
+        if (mqtt::cdo.Count() == 0 && mqtt::outboundLog.IsEmpty() == true)
         {
             return Status(Status::Code::GOOD);
         }
 
+        if (mqttClient->IsConnected() != Status::Code::GOOD)
+        {
+            /**
+             * @note 연결이 끊긴 동안에는 메시지를 폐기하지 않고 CDO에 남겨둡니다. CDO가
+             *       가득 차면 초과분은 플래시 메모리에 저장됩니다.
+             */
+            return Status(Status::Code::BAD_NOT_CONNECTED);
+        }
+
         INetwork* snic = RetrieveServiceNicService();
         std::pair<Status, size_t> mutex = snic->TakeMutex();
         if (mutex.first != Status::Code::GOOD)
@@ -140,35 +245,112 @@ namespace muffin {
             return mutex.first;
         }
         
-        Status ret(Status::Code::UNCERTAIN);
-        while (mqtt::cdo.Count() > 0)
+        Status ret = mqttClient->Poll(mutex.second);
+        std::vector<mqtt::MessageHandle> deferred;
+        while (true)
         {
             uint8_t trialCount = 0;
 
-            const std::pair<Status, mqtt::Message> message = mqtt::cdo.Peek();
-            if (message.first.ToCode() != Status::Code::GOOD)
+            std::pair<Status, mqtt::MessageHandle> message = mqtt::trafficShaper.AcquireReady();
+            if (message.first != Status::Code::GOOD)
             {
-                LOG_ERROR(logger, "FAILED TO PEEK MESSAGE: %s ", message.first.c_str());
-                continue;
+                message = mqtt::cdo.Acquire();
+                if (message.first != Status::Code::GOOD)
+                {
+                    break;
+                }
+
+                /**
+                 * @note 토큰이 소진된 유형의 메시지는 보류하거나 같은 토픽의 보류 메시지에 병합하고
+                 *       다른 유형의 메시지를 계속 발행합니다. 보류할 공간도 없는 메시지는 이번
+                 *       주기가 끝날 때 CDO에 되돌려 두므로 다른 유형의 메시지를 막지 않습니다.
+                 */
+                const size_t maxPayloadSize = mqttClient->GetMaxPayloadSize(message.second.Get().GetTopicCode());
+                if (mqtt::trafficShaper.Admit(&message.second, maxPayloadSize) == false)
+                {
+                    if (message.second.IsValid() == true)
+                    {
+                        deferred.emplace_back(std::move(message.second));
+                        if (deferred.size() >= MAX_DEFERRED_PER_CYCLE)
+                        {
+                            break;
+                        }
+                    }
+                    continue;
+                }
             }
 
-            for (; trialCount < MAX_RETRY_COUNT; ++trialCount)
+            /**
+             * @note 발행을 마치면 핸들이 해제되므로 재생 통계에 필요한 정보를 미리 읽어 둡니다.
+             */
+            const mqtt::topic_e topicCode = message.second.Get().GetTopicCode();
+            const size_t payloadLength = message.second.Get().GetPayloadLength();
+            const uint32_t deliverStartMicros = micros();
             {
-                ret = mqttClient->Publish(mutex.second, message.second);
-                if (ret == Status::Code::GOOD)
+                ScopedLatencyTimer probe(histogram_e::MQTT_PUBLISH);
+                tracer.Begin(trace_event_e::MQTT_PUBLISH);
+                for (; trialCount < MAX_RETRY_COUNT; ++trialCount)
                 {
-                    mqtt::cdo.Retrieve();
-                    break;
+                    ret = mqttClient->Deliver(mutex.second, &message.second);
+                    if (ret == Status::Code::GOOD || ret == Status::Code::BAD_WOULD_BLOCK)
+                    {
+                        break;
+                    }
                 }
+                tracer.End(trace_event_e::MQTT_PUBLISH);
+            }
+            trafficReplay.RecordStage(replay_stage_e::MQTT_DELIVER, micros() - deliverStartMicros);
+
+            if (ret == Status::Code::BAD_WOULD_BLOCK)
+            {
+                /**
+                 * @note 확인 응답을 기다리는 메시지가 가득 찬 경우에는 소비한 토큰을 되돌리고 메시지를
+                 *       보류 목록에 넣습니다. PUBACK은 뮤텍스를 반환한 뒤 다음 발행 주기에 처리합니다.
+                 */
+                mqtt::trafficShaper.Refund(topicCode);
+                deferred.emplace_back(std::move(message.second));
+                break;
+            }
+
+            if (ret == Status::Code::GOOD)
+            {
+                metrics.Increment(counter_e::MQTT_PUBLISH_SUCCESS);
+                trafficReplay.RecordPublish(topicCode, payloadLength);
             }
 
             if (trialCount == MAX_RETRY_COUNT)
             {
+                metrics.Increment(counter_e::MQTT_PUBLISH_FAILURE);
                 LOG_WARNING(logger, "FAILED TO PUBLISH MESSAGE: %s", ret.c_str());
-                mqtt::cdo.Retrieve();
+                /**
+                 * @note 진단 메시지는 다시 시도하지 않고 버립니다.
+                 */
+                if (message.second.GetLane() == mqtt::lane_e::DIAGNOSTIC)
+                {
+                    break;
+                }
+
+                if (message.second.GetLane() == mqtt::lane_e::PRIORITY ||
+                    mqtt::outboundLog.Append(message.second.Get()) != Status::Code::GOOD)
+                {
+                    mqtt::cdo.Requeue(std::move(message.second));
+                }
                 break;
             }
         }
+
+        /**
+         * @note Requeue()는 레인의 맨 앞에 넣으므로 나중에 꺼낸 메시지부터 되돌려 순서를 유지합니다.
+         */
+        for (auto it = deferred.rbegin(); it != deferred.rend(); ++it)
+        {
+            mqtt::cdo.Requeue(std::move(*it));
+        }
+
+        if (ret == Status::Code::GOOD && mqtt::cdo.Count() == 0)
+        {
+            ret = drainOutboundLog(mutex.second);
+        }
         
         snic->ReleaseMutex();
         return ret;
@@ -183,7 +365,7 @@ namespace muffin {
 
         for (uint8_t trialCount = 0; trialCount < MAX_RETRY_COUNT; ++trialCount)
         {
-            ret = mqtt::cdo.Store(message);
+            ret = mqtt::cdo.Store(std::move(message));
             if (ret == Status::Code::GOOD)
             {
                 return ret;
@@ -382,7 +564,7 @@ namespace muffin {
 
         for (uint8_t trialCount = 0; trialCount < MAX_RETRY_COUNT; ++trialCount)
         {
-            ret = mqtt::cdo.Store(message);
+            ret = mqtt::cdo.Store(std::move(message));
             if (ret == Status::Code::GOOD)
             {
                 return ret;
@@ -523,7 +705,7 @@ namespace muffin {
 
             serializedPayload = json.Serialize(messageconfig);
             mqtt::Message message(mqtt::topic_e::REMOTE_CONTROL_RESPONSE, serializedPayload);
-            Status ret = mqtt::cdo.Store(message);
+            Status ret = mqtt::cdo.Store(std::move(message));
             if (ret != Status::Code::GOOD)
             {
                 /**
@@ -551,7 +733,7 @@ namespace muffin {
             messageconfig.SourceTimestamp  = GetTimestampInMillis();
             serializedPayload = json.Serialize(messageconfig);
             mqtt::Message message(mqtt::topic_e::REMOTE_CONTROL_RESPONSE, serializedPayload);
-            ret = mqtt::cdo.Store(message);
+            ret = mqtt::cdo.Store(std::move(message));
             if (ret != Status::Code::GOOD)
             {
                 /**
@@ -586,7 +768,7 @@ namespace muffin {
         messageconfig.SourceTimestamp  = GetTimestampInMillis();
         serializedPayload = json.Serialize(messageconfig);
         mqtt::Message message(mqtt::topic_e::REMOTE_CONTROL_RESPONSE, serializedPayload);
-        ret = mqtt::cdo.Store(message);
+        ret = mqtt::cdo.Store(std::move(message));
         if (ret != Status::Code::GOOD)
         {
             /**
@@ -598,6 +780,306 @@ namespace muffin {
         return ret;
     }
 
+    Status processMessageLogRequest(const char* payload)
+    {
+        /**
+         * @note 요청마다 세그먼트 하나의 일부만 응답하며, 수신 측은 응답의 "seg"와 "next"를 다음
+         *       요청에 넣어 이어서 읽습니다. 세그먼트의 끝이면 rsc 204를 응답합니다.
+         */
+        constexpr size_t LOG_CHUNK_SIZE = 1536;
+        const std::pair<uint32_t, uint32_t> range = flashLog.GetSegmentRange();
+
+        JSON json;
+        JsonDocument request;
+        uint32_t segment = range.first;
+        size_t offset = 0;
+        if (json.Deserialize(payload, &request) == Status::Code::GOOD)
+        {
+            segment = request["seg"] | range.first;
+            offset  = request["ofs"] | 0;
+        }
+
+        if (segment < range.first)
+        {
+            segment = range.first;
+            offset  = 0;
+        }
+
+        std::string chunk;
+        Status ret = flashLog.Read(segment, offset, LOG_CHUNK_SIZE, &chunk);
+
+        JsonDocument doc;
+        doc["mv"]   = ESP32_FW_VERSION;
+        doc["ts"]   = GetTimestampInMillis();
+        doc["head"] = range.first;
+        doc["tail"] = range.second;
+        doc["seg"]  = segment;
+        doc["ofs"]  = offset;
+        switch (ret.ToCode())
+        {
+        case Status::Code::GOOD:
+            doc["rsc"]  = 200;
+            doc["next"] = offset + chunk.size();
+            doc["log"]  = chunk;
+            break;
+        case Status::Code::BAD_NO_DATA:
+            doc["rsc"]  = 204;
+            doc["next"] = offset;
+            break;
+        default:
+            doc["rsc"]  = 404;
+            doc["dsc"]  = ret.c_str();
+            break;
+        }
+
+        std::string serializedPayload;
+        serializeJson(doc, serializedPayload);
+        return mqtt::cdo.PublishDiagnostic(mqtt::topic_e::LOG_RESPONSE, serializedPayload);
+    }
+
+    Status processMessageLogConfig(const char* payload)
+    {
+        /**
+         * @note {"en":true,"lvl":3,"mod":["ModbusRTU"],"bps":512} 형식으로 원격 로그 스트리밍을
+         *       설정합니다. "lvl"은 log_level_e의 값이며, "mod"와 "bps"는 생략할 수 있습니다.
+         *       {"mlvl":{"MODBUS":3,"CRC32":-1}} 형식으로 모듈의 런타임 로그 레벨을 설정하거나
+         *       음수로 해제할 수 있으며, 두 설정을 한 번에 요청할 수도 있습니다.
+         */
+        JSON json;
+        JsonDocument request;
+        JsonDocument doc;
+        doc["mv"] = ESP32_FW_VERSION;
+        doc["ts"] = GetTimestampInMillis();
+
+        Status ret = json.Deserialize(payload, &request);
+        const uint8_t level = request["lvl"] | static_cast<uint8_t>(log_level_e::LOG_LEVEL_INFO);
+        const bool hasStreamConfig = request["en"].is<bool>();
+        const bool hasModuleConfig = request["mlvl"].is<JsonObject>();
+        if (ret != Status::Code::GOOD || (hasStreamConfig == false && hasModuleConfig == false) ||
+            level > static_cast<uint8_t>(log_level_e::LOG_LEVEL_VERBOSE))
+        {
+            doc["rsc"] = 400;
+            doc["dsc"] = "INVALID LOG CONFIG REQUEST";
+        }
+        else
+        {
+            doc["rsc"] = 200;
+        }
+
+        if (doc["rsc"] == 200 && hasModuleConfig == true)
+        {
+            std::string invalidModules;
+            for (JsonPair pair : request["mlvl"].as<JsonObject>())
+            {
+                const std::pair<bool, log_module_e> module = logger.ToModule(pair.key().c_str());
+                const int moduleLevel = pair.value() | (static_cast<int>(log_level_e::LOG_LEVEL_VERBOSE) + 1);
+                if (module.first == false || moduleLevel > static_cast<int>(log_level_e::LOG_LEVEL_VERBOSE))
+                {
+                    invalidModules.append(invalidModules.empty() ? "" : ",");
+                    invalidModules.append(pair.key().c_str());
+                    continue;
+                }
+
+                if (moduleLevel < 0)
+                {
+                    logger.ClearModuleLevel(module.second);
+                }
+                else
+                {
+                    logger.SetModuleLevel(module.second, static_cast<log_level_e>(moduleLevel));
+                }
+                LOG_INFO(logger, "Log level of module %s: %d", pair.key().c_str(), moduleLevel);
+            }
+
+            if (invalidModules.empty() == false)
+            {
+                doc["rsc"] = 400;
+                doc["dsc"] = "INVALID MODULE OR LEVEL: " + invalidModules;
+            }
+        }
+
+        if (doc["rsc"] == 200 && hasStreamConfig == true)
+        {
+            const bool isEnabled = request["en"].as<bool>();
+            std::vector<std::string> modules;
+            for (JsonVariant module : request["mod"].as<JsonArray>())
+            {
+                modules.emplace_back(module.as<const char*>());
+            }
+
+            mqttLog.SetFilter(isEnabled, static_cast<log_level_e>(level), modules, request["bps"] | 0);
+            if (isEnabled == true)
+            {
+                logger.AddSinkElement(log_sink_e::LOG_TO_MQTT_BROKER);
+            }
+            else
+            {
+                logger.RemoveSinkElement(log_sink_e::LOG_TO_MQTT_BROKER);
+            }
+            LOG_INFO(logger, "Remote log streaming %s, level: %u, modules: %u",
+                isEnabled ? "enabled" : "disabled", level, modules.size());
+
+            doc["en"]  = isEnabled;
+            doc["lvl"] = level;
+        }
+
+        std::string serializedPayload;
+        serializeJson(doc, serializedPayload);
+        return mqtt::cdo.PublishDiagnostic(mqtt::topic_e::LOG_RESPONSE, serializedPayload);
+    }
+
+    Status processMessageTraceRequest(const char* payload)
+    {
+        /**
+         * @note {"cmd":"start","fault":true}로 추적을 시작하고 {"cmd":"stop"}으로 멈춥니다.
+         *       {"cmd":"dump","ofs":0}은 레코드의 일부를 응답하며, 수신 측은 응답의 "next"를
+         *       다음 요청의 "ofs"에 넣어 이어서 읽습니다. {"cmd":"dump","to":"serial"}은 모든
+         *       레코드를 시리얼로 출력합니다. 덤프는 추적을 멈춘 상태에서만 가능합니다.
+         */
+        JSON json;
+        JsonDocument request;
+        JsonDocument doc;
+        doc["mv"] = ESP32_FW_VERSION;
+        doc["ts"] = GetTimestampInMillis();
+
+        Status ret = json.Deserialize(payload, &request);
+        const std::string command = request["cmd"] | "";
+        doc["cmd"] = command;
+
+        if (ret != Status::Code::GOOD)
+        {
+            doc["rsc"] = 400;
+            doc["dsc"] = "INVALID TRACE REQUEST";
+        }
+        else if (command == "start")
+        {
+            ret = tracer.Start(request["fault"] | false);
+            doc["rsc"] = ret == Status::Code::GOOD ? 200 : 500;
+        }
+        else if (command == "stop")
+        {
+            tracer.Stop();
+            doc["rsc"] = 200;
+        }
+        else if (command == "dump")
+        {
+            const std::string destination = request["to"] | "mqtt";
+            ret = destination == "serial"
+                ? tracer.DumpToSerial()
+                : tracer.Dump(request["ofs"] | 0, doc.as<JsonObject>());
+
+            switch (ret.ToCode())
+            {
+            case Status::Code::GOOD:
+                doc["rsc"] = 200;
+                break;
+            case Status::Code::BAD_NO_DATA:
+                doc["rsc"] = 204;
+                break;
+            case Status::Code::BAD_INVALID_STATE:
+                doc["rsc"] = 409;
+                doc["dsc"] = "STOP TRACING BEFORE DUMP";
+                break;
+            default:
+                doc["rsc"] = 500;
+                doc["dsc"] = ret.c_str();
+                break;
+            }
+        }
+        else
+        {
+            doc["rsc"] = 400;
+            doc["dsc"] = "UNKNOWN TRACE COMMAND";
+        }
+        doc["rec"] = tracer.IsRecording();
+
+        std::string serializedPayload;
+        serializeJson(doc, serializedPayload);
+        return mqtt::cdo.PublishDiagnostic(mqtt::topic_e::TRACE_RESPONSE, serializedPayload);
+    }
+
+    Status processMessageReplayRequest(const char* payload)
+    {
+        /**
+         * @note {"cmd":"record"}로 기록을 시작하고 {"cmd":"replay","speed":1,"loop":false}로
+         *       재생을 시작하며 {"cmd":"stop"}으로 멈춥니다. {"cmd":"report"}는 직전 보고 이후의
+         *       재생 통계를 응답합니다. 기록 파일은 {"cmd":"dump","ofs":0}으로 나누어 읽고
+         *       {"cmd":"load","ofs":0,"data":"..."}로 나누어 씁니다.
+         */
+        JSON json;
+        JsonDocument request;
+        JsonDocument doc;
+        doc["mv"] = ESP32_FW_VERSION;
+        doc["ts"] = GetTimestampInMillis();
+
+        Status ret = json.Deserialize(payload, &request);
+        const std::string command = request["cmd"] | "";
+        doc["cmd"] = command;
+
+        if (ret != Status::Code::GOOD)
+        {
+            doc["rsc"] = 400;
+            doc["dsc"] = "INVALID REPLAY REQUEST";
+        }
+        else if (command == "record" || command == "replay" || command == "dump" || command == "load")
+        {
+            if (command == "record")
+            {
+                ret = trafficReplay.StartRecording();
+            }
+            else if (command == "replay")
+            {
+                ret = trafficReplay.StartReplay(request["speed"] | 1, request["loop"] | false);
+            }
+            else if (command == "dump")
+            {
+                ret = trafficReplay.Dump(request["ofs"] | 0, doc.as<JsonObject>());
+            }
+            else
+            {
+                ret = trafficReplay.Load(request["ofs"] | 0, request["data"] | "");
+                doc["ofs"] = request["ofs"] | 0;
+            }
+
+            switch (ret.ToCode())
+            {
+            case Status::Code::GOOD:
+                doc["rsc"] = 200;
+                break;
+            case Status::Code::BAD_NO_DATA:
+                doc["rsc"] = 204;
+                break;
+            case Status::Code::BAD_INVALID_STATE:
+                doc["rsc"] = 409;
+                doc["dsc"] = "STOP RECORDING OR REPLAYING FIRST";
+                break;
+            default:
+                doc["rsc"] = 500;
+                doc["dsc"] = ret.c_str();
+                break;
+            }
+        }
+        else if (command == "stop")
+        {
+            trafficReplay.Stop();
+            doc["rsc"] = 200;
+        }
+        else if (command == "report")
+        {
+            trafficReplay.Report(doc["report"].to<JsonObject>());
+            doc["rsc"] = 200;
+        }
+        else
+        {
+            doc["rsc"] = 400;
+            doc["dsc"] = "UNKNOWN REPLAY COMMAND";
+        }
+
+        std::string serializedPayload;
+        serializeJson(doc, serializedPayload);
+        return mqtt::cdo.PublishDiagnostic(mqtt::topic_e::REPLAY_RESPONSE, serializedPayload);
+    }
+
     Status subscribeMessages(init_cfg_t& params)
     {
         if (mqtt::cia.Count() == 0)
@@ -644,6 +1126,18 @@ namespace muffin {
 
         case mqtt::topic_e::REMOTE_CONTROL_REQUEST:
             return processMessageRemoteControl(message.second.GetPayload());
+
+        case mqtt::topic_e::LOG_REQUEST:
+            return processMessageLogRequest(message.second.GetPayload());
+
+        case mqtt::topic_e::LOG_CONFIG:
+            return processMessageLogConfig(message.second.GetPayload());
+
+        case mqtt::topic_e::TRACE_REQUEST:
+            return processMessageTraceRequest(message.second.GetPayload());
+
+        case mqtt::topic_e::REPLAY_REQUEST:
+            return processMessageReplayRequest(message.second.GetPayload());
         
         default:
             ASSERT(false, "UNDEFINED TOPIC: 0x%02X", static_cast<uint8_t>(message.second.GetTopicCode()));
@@ -663,7 +1157,13 @@ namespace muffin {
             .ReconfigCode      = reinterpret_cast<init_cfg_t*>(pvParameters)->ReconfigCode
         };
 
-        while (true)
+        /**
+         * @note 원격제어와 같은 수신 메시지는 CIA에 저장되는 즉시 태스크 알림으로 깨어나 처리하며,
+         *       수신 메시지가 없으면 최대 1초 동안 대기한 다음 발행을 이어갑니다.
+         */
+        mqtt::cia.SetConsumer(xTaskGetCurrentTaskHandle());
+
+        while (s_IsStopRequested.load() == false)
         {
             if ((millis() - statusReportMillis) > (600 * SECOND_IN_MILLIS))
             {
@@ -695,11 +1195,13 @@ namespace muffin {
                 
                 const std::string payload =  deviceStatus.ToStringCyclical();
                 mqtt::Message message(mqtt::topic_e::JARVIS_STATUS, payload);
-                mqtt::cdo.Store(message);
+                mqtt::cdo.Store(std::move(message));
+
+                mqtt::cdo.PublishDiagnostic(mqtt::topic_e::METRICS, metrics.ToStringSnapshot());
 
             }
             
-            if (uint32_t(millis() - reconnectMillis) > (10 * SECOND_IN_MILLIS))
+            if (uint32_t(millis() - reconnectMillis) > s_ReconnectIntervalMillis)
             {
                 if (manageConnection() == Status::Code::BAD_NOT_EXECUTABLE)
                 {
@@ -708,29 +1210,85 @@ namespace muffin {
                 reconnectMillis = millis();
             }
             
-            publishMessages();
-            subscribeMessages(params);
-            vTaskDelay(SECOND_IN_MILLIS / portTICK_PERIOD_MS);
+            Status retPublish = publishMessages();
+            for (uint8_t remained = mqtt::cia.Count(); remained > 0; --remained)
+            {
+                subscribeMessages(params);
+            }
+
+            if (mqtt::cdo.Count(mqtt::lane_e::PRIORITY) > 0)
+            {
+                retPublish = publishMessages();
+            }
+
+            const uint32_t waitMillis = retPublish == Status::Code::BAD_WOULD_BLOCK
+                ? INFLIGHT_WAIT_MILLIS
+                : SECOND_IN_MILLIS;
+            ulTaskNotifyTake(pdTRUE, waitMillis / portTICK_PERIOD_MS);
         }
+
+        mqtt::cia.SetConsumer(NULL);
+        storeUnsentMessages();
+        LOG_INFO(logger, "MQTT task has been stopped");
+
+        xHandle = NULL;
+        vTaskDelete(NULL);
     }
 
-    void implStopMqttTask(TimerHandle_t)
+    static void storeUnsentMessage(mqtt::MessageHandle handle)
     {
         /**
-         * @todo 전송하지 못한 메시지는 플래시 메모리에라도 저장해야 합니다.
+         * @note 플래시 메모리에서 꺼낸 메시지는 확인 응답을 받지 못했으므로 레코드가 남아 있습니다.
          */
-        if (xHandle == NULL)
+        if (handle.GetLane() == mqtt::lane_e::DIAGNOSTIC || handle.Get().GetOutboundSequence() != 0)
         {
             return;
         }
-        
-        vTaskDelete(xHandle);
-        xHandle = NULL;
+
+        if (mqtt::outboundLog.Append(handle.Get()) != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "FAILED TO STORE UNSENT MESSAGE. THE MESSAGE IS DROPPED");
+        }
     }
 
-    Status StartMqttTaskService(init_cfg_t& config, CallbackUpdateInitConfig callbackJARVIS)
+    /**
+     * @brief 전송하지 못한 메시지를 재부팅 후에 발행할 수 있도록 플래시 메모리에 저장합니다.
+     * @note 확인 응답을 기다리는 메시지, 속도 제한으로 보류한 메시지, CDO에 남은 메시지 순서로
+     *       저장하여 발행 순서를 최대한 유지합니다. 플래시 쓰기가 이어지므로 MQTT 태스크에서만 호출합니다.
+     */
+    static void storeUnsentMessages()
     {
-        if (xHandle != NULL)
+        mqtt::MessageHandle handle;
+        while (mqttClient != nullptr && mqttClient->Evict(&handle) == Status::Code::GOOD)
+        {
+            storeUnsentMessage(std::move(handle));
+        }
+
+        while (true)
+        {
+            std::pair<Status, mqtt::MessageHandle> message = mqtt::trafficShaper.AcquirePending();
+            if (message.first != Status::Code::GOOD)
+            {
+                break;
+            }
+            storeUnsentMessage(std::move(message.second));
+        }
+
+        while (true)
+        {
+            std::pair<Status, mqtt::MessageHandle> message = mqtt::cdo.Acquire();
+            if (message.first != Status::Code::GOOD)
+            {
+                break;
+            }
+            storeUnsentMessage(std::move(message.second));
+        }
+        mqtt::outboundLog.Rewind();
+    }
+
+    Status StartMqttTaskService(init_cfg_t& config, CallbackUpdateInitConfig callbackJARVIS)
+    {
+        if (xHandle != NULL)
         {
             return Status(Status::Code::GOOD);
         }
@@ -739,6 +1297,7 @@ namespace muffin {
         {
             cbUpdateInitConfig = callbackJARVIS;
         }
+        s_IsStopRequested.store(false);
 
         BaseType_t ret = xTaskCreatePinnedToCore(implMqttTask,     // Function to be run inside of the task
                                                  "implMqttTask",   // The identifier of this task for men
@@ -776,538 +1335,584 @@ namespace muffin {
         {
             return mutex.first;
         }
+
+        if (brokerInfo.GetPayloadFormat() == mqtt::payload_format_e::SPARKPLUG_B)
+        {
+            mqtt::Message death(mqtt::topic_e::SPARKPLUG_NDEATH, sparkplug.EncodeDeath());
+            mqttClient->Publish(mutex.second, death);
+        }
         mqttClient->Disconnect(mutex.second);
-        
-        TimerHandle_t xTimer = xTimerCreate("implStopMqttTask",  // pcTimerName
-                                            SECOND_IN_MILLIS,   // xTimerPeriod,
-                                            pdFALSE,            // uxAutoReload,
-                                            (void *)0,          // pvTimerID,
-                                            implStopMqttTask);  // pxCallbackFunction
-        
-        if (xTimer == NULL)
+        s_IsStopRequested.store(true);
+
+        /**
+         * @note MQTT 태스크에서 호출한 경우에는 호출자가 곧바로 재부팅할 수 있으므로 전송하지 못한
+         *       메시지를 바로 저장하며, 다른 태스크에서 호출한 경우에는 MQTT 태스크를 깨워 저장하게 합니다.
+         */
+        if (xHandle == xTaskGetCurrentTaskHandle())
         {
-            LOG_ERROR(logger, "FAILED TO CREATE TIMER FOR STOPPING MQTT SERVICE");
-            return Status(Status::Code::BAD_UNEXPECTED_ERROR);
+            storeUnsentMessages();
         }
-        else
+        else if (xHandle != NULL)
         {
-            LOG_INFO(logger, "Created a timer for stopping mqtt service");
-            if (xTimerStart(xTimer, 0) != pdPASS)
-            {
-                LOG_ERROR(logger, "FAILED TO START TIMER FOR STOPPING MQTT SERVICE");
-                return Status(Status::Code::BAD_UNEXPECTED_ERROR);
-            }
+            xTaskNotifyGive(xHandle);
         }
         
         LOG_INFO(logger, "Stopping the MQTT service");
         return Status(Status::Code::GOOD);
     }
 
-    Status RemoteControllToMachine(remote_controll_struct_t* message, JsonArray& mc)
+    typedef enum class RemoteWriteProtocolEnum
+        : uint8_t
     {
-        std::vector<std::pair<std::string, std::string>> remoteData;
-        for (JsonObject obj : mc)
-        {
-            std::string nid = obj["nid"].as<std::string>(); 
-            std::string value = obj["val"].as<std::string>(); 
-            
-            remoteData.emplace_back(nid, value); 
-        }
+        MODBUS_RTU          = 0,
+        MODBUS_TCP          = 1,
+        MODBUS_TCP_DYNAMIC  = 2,
+        MELSEC              = 3,
+        ETHERNET_IP         = 4
+    } write_protocol_e;
+
+    typedef struct RemoteWriteTargetType
+    {
+        write_protocol_e Protocol;
+        size_t ClientIndex;
+        uint8_t SlaveID;
+        im::Node* Node;
+    } write_target_t;
+
+    /**
+     * @brief 원격제어 요청의 노드 식별자로 쓰기 대상을 바로 찾을 수 있도록 설정 정보로부터 만든 색인입니다.
+     * @note 설정이 적용되면 InvalidateRemoteWriteTable() 호출로 무효화되며, 다음 요청에서 다시 만듭니다.
+     */
+    static std::map<std::string, write_target_t> s_RemoteWriteTable;
+    static std::atomic<bool> s_IsRemoteWriteTableStale(true);
+
+    void InvalidateRemoteWriteTable()
+    {
+        s_IsRemoteWriteTableStale.store(true);
+    }
 
+    static void indexRemoteWriteTarget(const std::vector<std::string>& nodes, const write_protocol_e protocol, const size_t clientIndex, const uint8_t slaveID)
+    {
         im::NodeStore& nodeStore = im::NodeStore::GetInstance();
-        
-        std::pair<Status, im::Node*> ret = nodeStore.GetNodeReference(remoteData.at(0).first);
-        std::pair<Status, uint16_t> retConvertModbus = std::make_pair(Status(Status::Code::UNCERTAIN),0);
 
-        if (ret.first != Status::Code::GOOD)
+        for (const auto& nodeId : nodes)
         {
-            message->SourceTimestamp   = GetTimestampInMillis();
-            message->ResponseCode  = 900;
-            message->Description = "UNDEFINED NODEID : " + remoteData.at(0).first;
+            /**
+             * @note 같은 노드가 여러 설정에 포함된 경우 기존의 탐색 순서와 같이 먼저 찾은 대상을 사용합니다.
+             */
+            if (s_RemoteWriteTable.find(nodeId) != s_RemoteWriteTable.end())
+            {
+                continue;
+            }
 
-            return ret.first;
+            std::pair<Status, im::Node*> node = nodeStore.GetNodeReference(nodeId);
+            if (node.first != Status::Code::GOOD)
+            {
+                continue;
+            }
+
+            write_target_t target;
+            target.Protocol     = protocol;
+            target.ClientIndex  = clientIndex;
+            target.SlaveID      = slaveID;
+            target.Node         = node.second;
+            s_RemoteWriteTable.emplace(nodeId, target);
         }
-    
-        uint8_t writeResult = 0;
-#if defined(MT11)
-        if (mConfigVectorEthernetIP.size() != 0)
+    }
+
+    static void buildRemoteWriteTable()
+    {
+        s_RemoteWriteTable.clear();
+
+    #if defined(MT11)
+        for (auto& EIP : mConfigVectorEthernetIP)
         {
-            for (auto& EIP : mConfigVectorEthernetIP)
+            const std::pair<Status, std::vector<std::string>> nodes = EIP.GetNodes();
+            for (size_t index = 0; index < EthernetIpVector.size() && nodes.first == Status::Code::GOOD; ++index)
             {
-                for (auto& ethernetIP : EthernetIpVector)
+                const auto& ethernetIP = EthernetIpVector[index];
+                if (ethernetIP.mEipSession.targetIP == EIP.GetIPv4().second && ethernetIP.mEipSession.targetPort == EIP.GetPort().second)
                 {
-                    if (ethernetIP.mEipSession.targetIP != EIP.GetIPv4().second || ethernetIP.mEipSession.targetPort != EIP.GetPort().second)
-                    {
-                        continue;
-                    }
-
-                    std::pair<muffin::Status, std::vector<std::string>> retVector = EIP.GetNodes();
-                    if (retVector.first == Status(Status::Code::GOOD))
-                    {
-                        for (auto& nodeId : retVector.second )
-                        {
-                            if (nodeId == ret.second->GetNodeID())
-                            {   
-                                std::string tagName = ret.second->VariableNode.GetAddress().String;
-                                int16_t retBit = ret.second->VariableNode.GetBitIndex();
-                                std::string value = remoteData.at(0).second;
-                                cip_data_t datum = ethernetIP.GetSingleAddressValue(tagName);
-
-                                datum.RawData.clear();
-                                if (retBit != -1)
-                                {
-                                    bool bitValue = value == "0" ? 0 : 1;
-                                    switch (datum.DataType)
-                                    {
-                                    case CipDataType::SINT:
-                                    {
-                                        uint8_t convertValue = bitWrite(datum.Value.SINT, retBit, bitValue);
-                                        datum.RawData.emplace_back(static_cast<uint8_t>(convertValue));
-                                        break;
-                                    }
-                                    case CipDataType::INT:
-                                    {
-                                        uint16_t convertValue = bitWrite(datum.Value.INT, retBit, bitValue);
-            
-                                        datum.RawData.emplace_back(static_cast<uint8_t>(convertValue & 0xFF));         // Byte 0 (LSB)
-                                        datum.RawData.emplace_back(static_cast<uint8_t>((convertValue >> 8) & 0xFF));  // Byte 1 (MSB)
-                                        break;
-                                    }
-                                    case CipDataType::DINT:
-                                    {    
-                                        uint32_t convertValue = bitWrite(datum.Value.DINT, retBit, bitValue);
-                                        for (int i = 0; i < 4; ++i) 
-                                        {
-                                            datum.RawData.emplace_back(static_cast<uint8_t>((convertValue >> (8 * i)) & 0xFF));
-                                        }
-                                        break;
-                                    }
-                                    case CipDataType::LINT:
-                                    {
-                                        uint64_t convertValue = bitWrite(datum.Value.LINT, retBit, bitValue);
-                                        for (int i = 0; i < 8; ++i) 
-                                        {
-                                            datum.RawData.emplace_back(static_cast<uint8_t>((convertValue >> (8 * i)) & 0xFF));
-                                        }
-                                        break;
-                                    }
-                                    default:
-                                        LOG_ERROR(logger,"BIT INDEXING IS NOT SUPPORTED FOR THIS DATA TYPE");
-                                        break;
-                                    }
-                                }
-                                else
-                                {
-                                    Status res = ethernetIP.StringConvertToCipData(value, &datum);
-                                    if (res != Status::Code::GOOD)
-                                    {
-                                        LOG_ERROR(logger,"FAIL TO CONVERT STRING TO CIP DATA, ret : %s",res.c_str());
-                                        message->SourceTimestamp   = GetTimestampInMillis();
-                                        message->ResponseCode  = 900;
-                                        message->Description = "FAIL TO CONVERT STRING TO CIP DATA : " + remoteData.at(0).first;
-
-                                        return res;
-                                    }
-                                    
-                                }
-
-                                writeResult = 0;
-                                if (xSemaphoreTake(xSemaphoreEthernetIP, 10000)  != pdTRUE)
-                                {
-                                    LOG_WARNING(logger, "[EthernetIP] THE WRITE MODULE IS BUSY. TRY LATER.");
-                                    goto RC_RESPONSE;
-                                }
-                                cip_data_t response;
-
-                                uint8_t MAX_TRIAL_COUNT = 3;
-                                uint8_t trialCount = 0;
-                                
-                                for (trialCount = 0; trialCount < MAX_TRIAL_COUNT; ++trialCount)
-                                {  
-                                    if (ethernetIP.Connect())
-                                    {
-                                        break;
-                                    }
-
-                                    LOG_WARNING(logger,"[#%d] ethernetIP Client failed to connect!, serverIP : %s, serverPort: %d",trialCount, ethernetIP.mEipSession.targetIP.toString().c_str(), ethernetIP.mEipSession.targetPort);
-                                    ethernetIP.mEipSession.client->stop();
-                                    ethernetIP.mEipSession.connected = false;
-                                    delay(80);
-                                }
-
-                                if (trialCount == MAX_TRIAL_COUNT)
-                                {
-                                    LOG_ERROR(logger, "CONNECTION ERROR #%u",trialCount);
-                                    xSemaphoreGive(xSemaphoreEthernetIP);
-                                    goto RC_RESPONSE;
-                                }
-
-                                if (writeTag(ethernetIP.mEipSession, tagName, datum, response))
-                                {
-                                    if (response.Code == 0x00) 
-                                    {
-                                        LOG_DEBUG(logger,"[writeSingleTag] Write OK.\n");  
-                                        writeResult = 1;  
-                                    } 
-                                    else 
-                                    {
-                                        LOG_ERROR(logger,"[writeSingleTag] Write ERROR, Code = 0x%02X\n", response.Code);
-                                    }        
-                                }
-                                
-                                ethernetIP.mEipSession.client->stop();
-                                ethernetIP.mEipSession.connected = false;
-
-                                xSemaphoreGive(xSemaphoreEthernetIP);
-                                goto RC_RESPONSE;
-
-                            }
-                        }
-                    }
-                
+                    indexRemoteWriteTarget(nodes.second, write_protocol_e::ETHERNET_IP, index, 0);
                 }
             }
-            
         }
-        
-#endif
-#if defined(MT10) || defined(MB10) || defined(MT11)
+    #endif
 
-        retConvertModbus = ret.second->VariableNode.StringConvertWordData(remoteData.at(0).second);
-        if (retConvertModbus.first != Status::Code::GOOD)
+    #if defined(MT10) || defined(MB10) || defined(MT11)
+        for (auto& TCP : mConfigVectorMbTCP)
         {
-            message->SourceTimestamp = GetTimestampInMillis();
-            message->ResponseCode  = 900;
-            message->Description = retConvertModbus.first.ToString();
+            const std::pair<Status, std::vector<std::string>> nodes = TCP.GetNodes();
+            if (nodes.first != Status::Code::GOOD)
+            {
+                continue;
+            }
 
-           return retConvertModbus.first;
-        }
+            std::pair<Status, uint8_t> slaveID = TCP.GetSlaveID();
+            if (slaveID.first != Status::Code::GOOD)
+            {
+                slaveID.second = 0;
+            }
 
-        if (mConfigVectorMbTCP.size() != 0)
-        {
-            for (auto& TCP : mConfigVectorMbTCP)
+            for (size_t index = 0; index < ModbusTcpVector.size(); ++index)
             {
-                for (auto& modbusTCP : ModbusTcpVector)
+                if (ModbusTcpVector[index].GetServerIP() == TCP.GetIPv4().second && ModbusTcpVector[index].GetServerPort() == TCP.GetPort().second)
                 {
-                    if (modbusTCP.GetServerIP() != TCP.GetIPv4().second || modbusTCP.GetServerPort() != TCP.GetPort().second)
-                    {
-                        continue;
-                    }
-                    
-                    std::pair<muffin::Status, std::vector<std::string>> retVector = TCP.GetNodes();
-                    if (retVector.first == Status(Status::Code::GOOD))
-                    {
-                        for (auto& nodeId : retVector.second )
-                        {
-                            if (nodeId == ret.second->GetNodeID())
-                            {   
-                                std::pair<muffin::Status, uint8_t> retSlaveID =  TCP.GetSlaveID();
-                                if (retSlaveID.first != Status(Status::Code::GOOD))
-                                {
-                                    retSlaveID.second = 0;
-                                }
-                                jvs::node_area_e nodeArea = ret.second->VariableNode.GetNodeArea();
-                                jvs::addr_u modbusAddress = ret.second->VariableNode.GetAddress();
-                                int16_t retBit = ret.second->VariableNode.GetBitIndex();
-                    
-                                if (retBit != -1)
-                                {
-                                    modbus::datum_t registerData =  modbusTCP.GetAddressValue(retSlaveID.second, modbusAddress.Numeric, nodeArea);
-                                    LOG_DEBUG(logger, "RAW DATA : %u ", registerData.Value);
-                                    retConvertModbus.second = bitWrite(registerData.Value, retBit, retConvertModbus.second);
-                                    LOG_DEBUG(logger, "RAW Data after bit index conversion : %u ", retConvertModbus.second);
-                                }
-                                
-                                writeResult = 0;
-                                if (xSemaphoreTake(xSemaphoreModbusTCP, 10000)  != pdTRUE)
-                                {
-                                    LOG_WARNING(logger, "[MODBUS TCP] THE WRITE MODULE IS BUSY. TRY LATER.");
-                                    goto RC_RESPONSE;
-                                }
-
-                                LOG_DEBUG(logger, "[MODBUS TCP] 원격제어 : %u",retConvertModbus.second);
-                                switch (nodeArea)
-                                {
-                                case jvs::node_area_e::COILS:
-                                    writeResult = modbusTCP.mModbusTCPClient->coilWrite(retSlaveID.second, modbusAddress.Numeric,retConvertModbus.second);
-                                    break;
-                                case jvs::node_area_e::HOLDING_REGISTER:
-                                    writeResult = modbusTCP.mModbusTCPClient->holdingRegisterWrite(retSlaveID.second,modbusAddress.Numeric,retConvertModbus.second);
-                                    break;
-                                default:
-                                    LOG_ERROR(logger,"THIS AREA IS NOT SUPPORTED, AREA : %d ", nodeArea);
-                                    break;
-                                }
-
-                                xSemaphoreGive(xSemaphoreModbusTCP);
-
-                                goto RC_RESPONSE;
-                            }
-                            
-                        }
-                        
-                    }
+                    indexRemoteWriteTarget(nodes.second, write_protocol_e::MODBUS_TCP, index, slaveID.second);
                 }
+            }
 
         #if defined(MT11)
-                for (auto& modbusTCP : ModbusTcpVectorDynamic)
+            for (size_t index = 0; index < ModbusTcpVectorDynamic.size(); ++index)
+            {
+                if (ModbusTcpVectorDynamic[index].GetServerIP() == TCP.GetIPv4().second && ModbusTcpVectorDynamic[index].GetServerPort() == TCP.GetPort().second)
                 {
-                    if (modbusTCP.GetServerIP() != TCP.GetIPv4().second || modbusTCP.GetServerPort() != TCP.GetPort().second)
-                    {
-                        continue;
-                    }
-                    
-                    std::pair<muffin::Status, std::vector<std::string>> retVector = TCP.GetNodes();
-                    if (retVector.first == Status(Status::Code::GOOD))
-                    {
-                        for (auto& nodeId : retVector.second )
-                        {
-                            if (nodeId == ret.second->GetNodeID())
-                            {   
-                                std::pair<muffin::Status, uint8_t> retSlaveID =  TCP.GetSlaveID();
-                                if (retSlaveID.first != Status(Status::Code::GOOD))
-                                {
-                                    retSlaveID.second = 0;
-                                }
-                                jvs::node_area_e nodeArea = ret.second->VariableNode.GetNodeArea();
-                                jvs::addr_u modbusAddress = ret.second->VariableNode.GetAddress();
-                                int16_t retBit = ret.second->VariableNode.GetBitIndex();
-                    
-                                if (retBit != -1)
-                                {
-                                    modbus::datum_t registerData =  modbusTCP.GetAddressValue(retSlaveID.second, modbusAddress.Numeric, nodeArea);
-                                    LOG_DEBUG(logger, "RAW DATA : %u ", registerData.Value);
-                                    retConvertModbus.second = bitWrite(registerData.Value, retBit, retConvertModbus.second);
-                                    LOG_DEBUG(logger, "RAW Data after bit index conversion : %u ", retConvertModbus.second);
-                                }
-                                
-                                writeResult = 0;
-                                if (xSemaphoreTake(xSemaphoreModbusTCP, 10000)  != pdTRUE)
-                                {
-                                    LOG_WARNING(logger, "[MODBUS TCP] THE WRITE MODULE IS BUSY. TRY LATER.");
-                                    goto RC_RESPONSE;
-                                }
-
-                                if (modbusTCP.mModbusTCPClient->begin(modbusTCP.GetServerIP(), modbusTCP.GetServerPort()) != 1)
-                                {
-                                    LOG_ERROR(logger,"Modbus TCP Client failed to connect!, serverIP : %s, serverPort: %d", modbusTCP.GetServerIP().toString().c_str(), modbusTCP.GetServerPort());
-                                    goto RC_RESPONSE;
-                                }
-
-                                LOG_DEBUG(logger, "[MODBUS TCP] 원격제어 : %u",retConvertModbus.second);
-                                switch (nodeArea)
-                                {
-                                case jvs::node_area_e::COILS:
-                                    writeResult = modbusTCP.mModbusTCPClient->coilWrite(retSlaveID.second, modbusAddress.Numeric,retConvertModbus.second);
-                                    break;
-                                case jvs::node_area_e::HOLDING_REGISTER:
-                                    writeResult = modbusTCP.mModbusTCPClient->holdingRegisterWrite(retSlaveID.second,modbusAddress.Numeric,retConvertModbus.second);
-                                    break;
-                                default:
-                                    LOG_ERROR(logger,"THIS AREA IS NOT SUPPORTED, AREA : %d ", nodeArea);
-                                    break;
-                                }
-                                
-                                modbusTCP.mModbusTCPClient->end();
-
-                                xSemaphoreGive(xSemaphoreModbusTCP);
-
-                                goto RC_RESPONSE;
-                            }
-                        }
-                    }
+                    indexRemoteWriteTarget(nodes.second, write_protocol_e::MODBUS_TCP_DYNAMIC, index, slaveID.second);
                 }
-            #endif
             }
+        #endif
         }
 
-        if (mConfigVectorMelsec.size() != 0)
+        for (auto& melsecConfig : mConfigVectorMelsec)
         {
-            for (auto& melsecConfig : mConfigVectorMelsec)
+            const std::pair<Status, std::vector<std::string>> nodes = melsecConfig.GetNodes();
+            for (size_t index = 0; index < MelsecVector.size() && nodes.first == Status::Code::GOOD; ++index)
             {
-                for (auto& melsec : MelsecVector)
+                if (MelsecVector[index].GetServerIP() == melsecConfig.GetIPv4().second && MelsecVector[index].GetServerPort() == melsecConfig.GetPort().second)
                 {
-                    if (melsec.GetServerIP() != melsecConfig.GetIPv4().second || melsec.GetServerPort() != melsecConfig.GetPort().second)
-                    {
-                        continue;
-                    }
-                    
-                    std::pair<muffin::Status, std::vector<std::string>> retVector = melsecConfig.GetNodes();
-                    if (retVector.first == Status(Status::Code::GOOD))
-                    {
-                        for (auto& nodeId : retVector.second )
-                        {
-                            if (nodeId == ret.second->GetNodeID())
-                            {   
-                                jvs::node_area_e nodeArea = ret.second->VariableNode.GetNodeArea();
-                                jvs::addr_u modbusAddress = ret.second->VariableNode.GetAddress();
-                                int16_t retBit = ret.second->VariableNode.GetBitIndex();
-
-                                if (retBit != -1)
-                                {
-                                    modbus::datum_t registerData =  melsec.GetAddressValue(1, modbusAddress.Numeric, nodeArea);
-                                    LOG_DEBUG(logger, "RAW DATA : %u ", registerData.Value);
-                                    retConvertModbus.second = bitWrite(registerData.Value, retBit, retConvertModbus.second);
-                                    LOG_DEBUG(logger, "RAW Data after bit index conversion : %u ", retConvertModbus.second);
-                                }      
-                                
-                                writeResult = 0;
-                                if (xSemaphoreTake(xSemaphoreMelsec, 10000)  != pdTRUE)
-                                {
-                                    LOG_WARNING(logger, "[MELSEC] THE WRITE MODULE IS BUSY. TRY LATER.");
-                                    goto RC_RESPONSE;
-                                }
-
-                                uint8_t MAX_TRIAL_COUNT = 3;
-                                uint8_t trialCount = 0;
-
-                                for (trialCount = 0; trialCount < MAX_TRIAL_COUNT; ++trialCount)
-                                {
-                                    if (melsec.Connect())
-                                    {
-                                        break;
-                                    }
-
-                                    LOG_WARNING(logger,"[#%d] melsec Client failed to connect!, serverIP : %s, serverPort: %d",trialCount, melsec.GetServerIP().toString().c_str(), melsec.GetServerPort());
-                                    melsec.mMelsecClient->Close();
-                                    delay(80);
-                                }
-
-                                if (trialCount == MAX_TRIAL_COUNT)
-                                {
-                                    LOG_ERROR(logger, "CONNECTION ERROR #%u",trialCount);
-                                    xSemaphoreGive(xSemaphoreMelsec);
-                                    goto RC_RESPONSE;
-                                }
-
-                                LOG_DEBUG(logger, "[MELSEC] 원격제어 : %u",retConvertModbus.second);
-                                
-                                if (im::IsBitArea(nodeArea))
-                                {
-                                    LOG_DEBUG(logger,"AREA : %d, ADDRESS : %d",nodeArea, modbusAddress.Numeric);
-                                    writeResult = melsec.mMelsecClient->WriteBit(nodeArea, modbusAddress.Numeric, retConvertModbus.second);
-                                }
-                                else
-                                {
-                                    LOG_DEBUG(logger,"AREA : %d, ADDRESS : %d",nodeArea,modbusAddress.Numeric);
-                                    writeResult = melsec.mMelsecClient->WriteWord(nodeArea, modbusAddress.Numeric, retConvertModbus.second);
-                                }
-
-                                melsec.mMelsecClient->Close();
-                                xSemaphoreGive(xSemaphoreMelsec);
-                                goto RC_RESPONSE;
-                            }   
-                        }       
-                    }
-                }                    
+                    indexRemoteWriteTarget(nodes.second, write_protocol_e::MELSEC, index, 1);
+                }
             }
         }
-#endif
+    #endif
 
-        if (mConfigVectorMbRTU.size() != 0)
+        for (auto& RTU : mConfigVectorMbRTU)
         {
-            for (auto& RTU : mConfigVectorMbRTU)
+            const std::pair<Status, std::vector<std::string>> nodes = RTU.GetNodes();
+            if (nodes.first != Status::Code::GOOD)
+            {
+                continue;
+            }
+
+            std::pair<Status, uint8_t> slaveID = RTU.GetSlaveID();
+            if (slaveID.first != Status::Code::GOOD)
+            {
+                slaveID.second = 0;
+            }
+
+            for (size_t index = 0; index < ModbusRtuVector.size(); ++index)
             {
-                for (auto& modbusRTU : ModbusRtuVector)
+                if (ModbusRtuVector[index].mPort == RTU.GetPort().second)
                 {
-                    if (RTU.GetPort().second != modbusRTU.mPort)
-                    {
-                        continue;
-                    }
+                    indexRemoteWriteTarget(nodes.second, write_protocol_e::MODBUS_RTU, index, slaveID.second);
+                }
+            }
+        }
 
-                    std::pair<muffin::Status, std::vector<std::string>> retVector = RTU.GetNodes();
-                    if (retVector.first == Status(Status::Code::GOOD))
-                    {
-                        for (auto& nodeId : retVector.second )
-                        {
-                            if (nodeId == ret.second->GetNodeID())
-                            {
-                                std::pair<muffin::Status, uint8_t> retSlaveID =  RTU.GetSlaveID();
-                                if (retSlaveID.first != Status(Status::Code::GOOD))
-                                {
-                                    retSlaveID.second = 0;
-                                }
-
-                                jvs::node_area_e nodeArea = ret.second->VariableNode.GetNodeArea();
-                                jvs::addr_u modbusAddress = ret.second->VariableNode.GetAddress();
-                                int16_t retBit = ret.second->VariableNode.GetBitIndex();
-                    
-                                if (retBit != -1)
-                                {
-                                    modbus::datum_t registerData =  modbusRTU.GetAddressValue(retSlaveID.second, modbusAddress.Numeric, nodeArea);
-                                    LOG_DEBUG(logger, "RAW DATA : %u ", registerData.Value);
-                                    retConvertModbus.second = bitWrite(registerData.Value, retBit, retConvertModbus.second);
-                                    LOG_DEBUG(logger, "RAW Data after bit index conversion : %u ", retConvertModbus.second);
-                                }
-                                
-                                writeResult = 0;
-                            #if defined(MODLINK_L) || defined(ML10) || defined(MT11)
-                                if (xSemaphoreTake(xSemaphoreModbusRTU, 10000)  != pdTRUE)
-                                {
-                                    LOG_WARNING(logger, "[MODBUS RTU] THE WRITE MODULE IS BUSY. TRY LATER.");
-                                    goto RC_RESPONSE;
-                                }
-
-                                switch (nodeArea)
-                                {
-                                case jvs::node_area_e::COILS:
-                                    writeResult = ModbusRTUClient.coilWrite(retSlaveID.second, modbusAddress.Numeric,retConvertModbus.second);
-                                    break;
-                                case jvs::node_area_e::HOLDING_REGISTER:
-                                    writeResult = ModbusRTUClient.holdingRegisterWrite(retSlaveID.second,modbusAddress.Numeric,retConvertModbus.second);
-                                    break;
-                                default:
-                                    LOG_ERROR(logger,"THIS AREA IS NOT SUPPORTED, AREA : %d ", nodeArea);
-                                    break;
-                                }
-
-                                
-                                if (writeResult != 1)
-                                {
-                                    if (ModbusRTUClient.lastError() != nullptr)
-                                    {
-                                        LOG_ERROR(logger,"FAIL TO REMOTE CONTROLL : %s",ModbusRTUClient.lastError());
-                                        ModbusRTUClient.clearError();
-                                    }
-                                }
-                                
-                                xSemaphoreGive(xSemaphoreModbusRTU);
-                                
-                                goto RC_RESPONSE;
-                            #else
-                                spear_remote_control_msg_t msg;
-                                msg.Link = modbusRTU.mPort;
-                                msg.SlaveID = retSlaveID.second;
-                                msg.Area = nodeArea;
-                                msg.Address = modbusAddress.Numeric;
-                                msg.Value = retConvertModbus.second;
-                                Status result = spear.ExecuteService(msg);
-                                if (result == Status(Status::Code::GOOD))
-                                {
-                                    writeResult = 1;
-                                }
-                            #endif
-                                break;
-                            }
-                        }
-                    }
+        LOG_INFO(logger, "Indexed %u remote write targets", s_RemoteWriteTable.size());
+    }
+
+#if defined(MT11)
+    static bool writeEthernetIP(const write_target_t& target, const std::string& value, std::string* description)
+    {
+        ethernetIP::EthernetIP& ethernetIP = EthernetIpVector[target.ClientIndex];
+        const std::string tagName = target.Node->VariableNode.GetAddress().String;
+        const int16_t retBit = target.Node->VariableNode.GetBitIndex();
+        cip_data_t datum = ethernetIP.GetSingleAddressValue(tagName);
+
+        datum.RawData.clear();
+        if (retBit != -1)
+        {
+            bool bitValue = value == "0" ? 0 : 1;
+            switch (datum.DataType)
+            {
+            case CipDataType::SINT:
+            {
+                uint8_t convertValue = bitWrite(datum.Value.SINT, retBit, bitValue);
+                datum.RawData.emplace_back(static_cast<uint8_t>(convertValue));
+                break;
+            }
+            case CipDataType::INT:
+            {
+                uint16_t convertValue = bitWrite(datum.Value.INT, retBit, bitValue);
+
+                datum.RawData.emplace_back(static_cast<uint8_t>(convertValue & 0xFF));         // Byte 0 (LSB)
+                datum.RawData.emplace_back(static_cast<uint8_t>((convertValue >> 8) & 0xFF));  // Byte 1 (MSB)
+                break;
+            }
+            case CipDataType::DINT:
+            {    
+                uint32_t convertValue = bitWrite(datum.Value.DINT, retBit, bitValue);
+                for (int i = 0; i < 4; ++i) 
+                {
+                    datum.RawData.emplace_back(static_cast<uint8_t>((convertValue >> (8 * i)) & 0xFF));
+                }
+                break;
+            }
+            case CipDataType::LINT:
+            {
+                uint64_t convertValue = bitWrite(datum.Value.LINT, retBit, bitValue);
+                for (int i = 0; i < 8; ++i) 
+                {
+                    datum.RawData.emplace_back(static_cast<uint8_t>((convertValue >> (8 * i)) & 0xFF));
                 }
+                break;
+            }
+            default:
+                LOG_ERROR(logger,"BIT INDEXING IS NOT SUPPORTED FOR THIS DATA TYPE");
+                break;
             }
         }
+        else
+        {
+            Status res = ethernetIP.StringConvertToCipData(value, &datum);
+            if (res != Status::Code::GOOD)
+            {
+                LOG_ERROR(logger,"FAIL TO CONVERT STRING TO CIP DATA, ret : %s",res.c_str());
+                *description = "FAIL TO CONVERT STRING TO CIP DATA";
+                return false;
+            }
+        }
+
+        if (xSemaphoreTake(xSemaphoreEthernetIP, 10000)  != pdTRUE)
+        {
+            LOG_WARNING(logger, "[EthernetIP] THE WRITE MODULE IS BUSY. TRY LATER.");
+            return false;
+        }
+
+        const uint8_t MAX_TRIAL_COUNT = 3;
+        uint8_t trialCount = 0;
+        for (trialCount = 0; trialCount < MAX_TRIAL_COUNT; ++trialCount)
+        {  
+            if (ethernetIP.Connect())
+            {
+                break;
+            }
+
+            LOG_WARNING(logger,"[#%d] ethernetIP Client failed to connect!, serverIP : %s, serverPort: %d",trialCount, ethernetIP.mEipSession.targetIP.toString().c_str(), ethernetIP.mEipSession.targetPort);
+            ethernetIP.mEipSession.client->stop();
+            ethernetIP.mEipSession.connected = false;
+            delay(80);
+        }
+
+        if (trialCount == MAX_TRIAL_COUNT)
+        {
+            LOG_ERROR(logger, "CONNECTION ERROR #%u",trialCount);
+            xSemaphoreGive(xSemaphoreEthernetIP);
+            return false;
+        }
+
+        bool isWritten = false;
+        cip_data_t response;
+        if (writeTag(ethernetIP.mEipSession, tagName, datum, response))
+        {
+            if (response.Code == 0x00) 
+            {
+                LOG_DEBUG(logger,"[writeSingleTag] Write OK.\n");  
+                isWritten = true;
+            } 
+            else 
+            {
+                LOG_ERROR(logger,"[writeSingleTag] Write ERROR, Code = 0x%02X\n", response.Code);
+            }        
+        }
+        
+        ethernetIP.mEipSession.client->stop();
+        ethernetIP.mEipSession.connected = false;
+
+        xSemaphoreGive(xSemaphoreEthernetIP);
+        return isWritten;
+    }
+#endif
+
+#if defined(MT10) || defined(MB10) || defined(MT11)
+    static bool writeModbusTCP(ModbusTCP& modbusTCP, const write_target_t& target, uint16_t value, const bool isDynamic)
+    {
+        const jvs::node_area_e nodeArea = target.Node->VariableNode.GetNodeArea();
+        const jvs::addr_u modbusAddress = target.Node->VariableNode.GetAddress();
+        const int16_t retBit = target.Node->VariableNode.GetBitIndex();
+
+        if (retBit != -1)
+        {
+            modbus::datum_t registerData =  modbusTCP.GetAddressValue(target.SlaveID, modbusAddress.Numeric, nodeArea);
+            LOG_DEBUG(logger, "RAW DATA : %u ", registerData.Value);
+            value = bitWrite(registerData.Value, retBit, value);
+            LOG_DEBUG(logger, "RAW Data after bit index conversion : %u ", value);
+        }
         
-RC_RESPONSE:
-        if (writeResult == 1)
+        tracer.Begin(trace_event_e::MODBUS_TCP_LOCK_WAIT);
+        if (xSemaphoreTake(xSemaphoreModbusTCP, 10000)  != pdTRUE)
         {
-            message->ResponseCode = 200;
+            tracer.End(trace_event_e::MODBUS_TCP_LOCK_WAIT);
+            tracer.Fault(trace_event_e::LOCK_TIMEOUT);
+            LOG_WARNING(logger, "[MODBUS TCP] THE WRITE MODULE IS BUSY. TRY LATER.");
+            return false;
+        }
+        tracer.End(trace_event_e::MODBUS_TCP_LOCK_WAIT);
+        tracer.Begin(trace_event_e::MODBUS_TCP_LOCK);
+
+        if (isDynamic == true && modbusTCP.mModbusTCPClient->begin(modbusTCP.GetServerIP(), modbusTCP.GetServerPort()) != 1)
+        {
+            LOG_ERROR(logger,"Modbus TCP Client failed to connect!, serverIP : %s, serverPort: %d", modbusTCP.GetServerIP().toString().c_str(), modbusTCP.GetServerPort());
+            tracer.End(trace_event_e::MODBUS_TCP_LOCK);
+            xSemaphoreGive(xSemaphoreModbusTCP);
+            return false;
+        }
+
+        LOG_DEBUG(logger, "[MODBUS TCP] 원격제어 : %u", value);
+        int writeResult = 0;
+        switch (nodeArea)
+        {
+        case jvs::node_area_e::COILS:
+            writeResult = modbusTCP.mModbusTCPClient->coilWrite(target.SlaveID, modbusAddress.Numeric, value);
+            break;
+        case jvs::node_area_e::HOLDING_REGISTER:
+            writeResult = modbusTCP.mModbusTCPClient->holdingRegisterWrite(target.SlaveID, modbusAddress.Numeric, value);
+            break;
+        default:
+            LOG_ERROR(logger,"THIS AREA IS NOT SUPPORTED, AREA : %d ", nodeArea);
+            break;
+        }
+
+        if (isDynamic == true)
+        {
+            modbusTCP.mModbusTCPClient->end();
+        }
+
+        tracer.End(trace_event_e::MODBUS_TCP_LOCK);
+        xSemaphoreGive(xSemaphoreModbusTCP);
+        return writeResult == 1;
+    }
+
+    static bool writeMelsec(const write_target_t& target, uint16_t value)
+    {
+        Melsec& melsec = MelsecVector[target.ClientIndex];
+        const jvs::node_area_e nodeArea = target.Node->VariableNode.GetNodeArea();
+        const jvs::addr_u modbusAddress = target.Node->VariableNode.GetAddress();
+        const int16_t retBit = target.Node->VariableNode.GetBitIndex();
+
+        if (retBit != -1)
+        {
+            modbus::datum_t registerData =  melsec.GetAddressValue(1, modbusAddress.Numeric, nodeArea);
+            LOG_DEBUG(logger, "RAW DATA : %u ", registerData.Value);
+            value = bitWrite(registerData.Value, retBit, value);
+            LOG_DEBUG(logger, "RAW Data after bit index conversion : %u ", value);
+        }      
+        
+        if (xSemaphoreTake(xSemaphoreMelsec, 10000)  != pdTRUE)
+        {
+            LOG_WARNING(logger, "[MELSEC] THE WRITE MODULE IS BUSY. TRY LATER.");
+            return false;
+        }
+
+        const uint8_t MAX_TRIAL_COUNT = 3;
+        uint8_t trialCount = 0;
+        for (trialCount = 0; trialCount < MAX_TRIAL_COUNT; ++trialCount)
+        {
+            if (melsec.Connect())
+            {
+                break;
+            }
+
+            LOG_WARNING(logger,"[#%d] melsec Client failed to connect!, serverIP : %s, serverPort: %d",trialCount, melsec.GetServerIP().toString().c_str(), melsec.GetServerPort());
+            melsec.mMelsecClient->Close();
+            delay(80);
+        }
+
+        if (trialCount == MAX_TRIAL_COUNT)
+        {
+            LOG_ERROR(logger, "CONNECTION ERROR #%u",trialCount);
+            xSemaphoreGive(xSemaphoreMelsec);
+            return false;
+        }
+
+        LOG_DEBUG(logger, "[MELSEC] 원격제어 : %u", value);
+        LOG_DEBUG(logger,"AREA : %d, ADDRESS : %d",nodeArea, modbusAddress.Numeric);
+        bool isWritten = false;
+        if (im::IsBitArea(nodeArea))
+        {
+            isWritten = melsec.mMelsecClient->WriteBit(nodeArea, modbusAddress.Numeric, value);
         }
         else
         {
-            message->ResponseCode  = 900;
-            message->Description = "UNEXPECTED ERROR";
+            isWritten = melsec.mMelsecClient->WriteWord(nodeArea, modbusAddress.Numeric, value);
+        }
+
+        melsec.mMelsecClient->Close();
+        xSemaphoreGive(xSemaphoreMelsec);
+        return isWritten;
+    }
+#endif
+
+    static bool writeModbusRTU(const write_target_t& target, uint16_t value)
+    {
+        ModbusRTU& modbusRTU = ModbusRtuVector[target.ClientIndex];
+        const jvs::node_area_e nodeArea = target.Node->VariableNode.GetNodeArea();
+        const jvs::addr_u modbusAddress = target.Node->VariableNode.GetAddress();
+        const int16_t retBit = target.Node->VariableNode.GetBitIndex();
+
+        if (retBit != -1)
+        {
+            modbus::datum_t registerData =  modbusRTU.GetAddressValue(target.SlaveID, modbusAddress.Numeric, nodeArea);
+            LOG_DEBUG(logger, "RAW DATA : %u ", registerData.Value);
+            value = bitWrite(registerData.Value, retBit, value);
+            LOG_DEBUG(logger, "RAW Data after bit index conversion : %u ", value);
         }
         
-        return Status(Status::Code::GOOD);
+    #if defined(MODLINK_L) || defined(ML10) || defined(MT11)
+        tracer.Begin(trace_event_e::MODBUS_RTU_LOCK_WAIT);
+        if (xSemaphoreTake(xSemaphoreModbusRTU, 10000)  != pdTRUE)
+        {
+            tracer.End(trace_event_e::MODBUS_RTU_LOCK_WAIT);
+            tracer.Fault(trace_event_e::LOCK_TIMEOUT);
+            LOG_WARNING(logger, "[MODBUS RTU] THE WRITE MODULE IS BUSY. TRY LATER.");
+            return false;
+        }
+        tracer.End(trace_event_e::MODBUS_RTU_LOCK_WAIT);
+        tracer.Begin(trace_event_e::MODBUS_RTU_LOCK);
+
+        int writeResult = 0;
+        switch (nodeArea)
+        {
+        case jvs::node_area_e::COILS:
+            writeResult = ModbusRTUClient.coilWrite(target.SlaveID, modbusAddress.Numeric, value);
+            break;
+        case jvs::node_area_e::HOLDING_REGISTER:
+            writeResult = ModbusRTUClient.holdingRegisterWrite(target.SlaveID, modbusAddress.Numeric, value);
+            break;
+        default:
+            LOG_ERROR(logger,"THIS AREA IS NOT SUPPORTED, AREA : %d ", nodeArea);
+            break;
+        }
+
+        if (writeResult != 1)
+        {
+            if (ModbusRTUClient.lastError() != nullptr)
+            {
+                LOG_ERROR(logger,"FAIL TO REMOTE CONTROLL : %s",ModbusRTUClient.lastError());
+                ModbusRTUClient.clearError();
+            }
+        }
         
+        tracer.End(trace_event_e::MODBUS_RTU_LOCK);
+        xSemaphoreGive(xSemaphoreModbusRTU);
+        return writeResult == 1;
+    #else
+        spear_remote_control_msg_t msg;
+        msg.Link = modbusRTU.mPort;
+        msg.SlaveID = target.SlaveID;
+        msg.Area = nodeArea;
+        msg.Address = modbusAddress.Numeric;
+        msg.Value = value;
+        return spear.ExecuteService(msg) == Status::Code::GOOD;
+    #endif
+    }
+
+    static bool writeRemoteTarget(const write_target_t& target, const std::string& value, std::string* description)
+    {
+    #if defined(MT11)
+        if (target.Protocol == write_protocol_e::ETHERNET_IP && target.ClientIndex < EthernetIpVector.size())
+        {
+            return writeEthernetIP(target, value, description);
+        }
+    #endif
+
+        std::pair<Status, uint16_t> converted = target.Node->VariableNode.StringConvertWordData(value);
+        if (converted.first != Status::Code::GOOD)
+        {
+            *description = converted.first.ToString();
+            return false;
+        }
+
+        switch (target.Protocol)
+        {
+    #if defined(MT10) || defined(MB10) || defined(MT11)
+        case write_protocol_e::MODBUS_TCP:
+            if (target.ClientIndex >= ModbusTcpVector.size())
+            {
+                break;
+            }
+            return writeModbusTCP(ModbusTcpVector[target.ClientIndex], target, converted.second, false);
+        case write_protocol_e::MODBUS_TCP_DYNAMIC:
+            if (target.ClientIndex >= ModbusTcpVectorDynamic.size())
+            {
+                break;
+            }
+            return writeModbusTCP(ModbusTcpVectorDynamic[target.ClientIndex], target, converted.second, true);
+        case write_protocol_e::MELSEC:
+            if (target.ClientIndex >= MelsecVector.size())
+            {
+                break;
+            }
+            return writeMelsec(target, converted.second);
+    #endif
+        case write_protocol_e::MODBUS_RTU:
+            if (target.ClientIndex >= ModbusRtuVector.size())
+            {
+                break;
+            }
+            return writeModbusRTU(target, converted.second);
+        default:
+            break;
+        }
+
+        /**
+         * @note 설정이 적용되는 도중에 색인을 만든 경우 클라이언트 목록이 바뀌었을 수 있으므로 색인을 다시 만듭니다.
+         */
+        InvalidateRemoteWriteTable();
+        *description = "WRITE TARGET IS NOT AVAILABLE";
+        return false;
+    }
+
+    Status RemoteControllToMachine(remote_controll_struct_t* message, JsonArray& mc)
+    {
+        if (s_IsRemoteWriteTableStale.exchange(false) == true)
+        {
+            buildRemoteWriteTable();
+        }
+
+        /**
+         * @note 하나의 요청에 담긴 모든 항목을 순서대로 쓰며, 실패한 항목의 노드 식별자와
+         *       사유를 응답의 설명에 모아서 전달합니다.
+         */
+        uint16_t writtenCount = 0;
+        uint16_t requestCount = 0;
+        std::string failures;
+        for (JsonObject obj : mc)
+        {
+            ++requestCount;
+            const std::string nodeId = obj["nid"].as<std::string>();
+            const std::string value = obj["val"].as<std::string>();
+
+            std::string reason;
+            const auto it = s_RemoteWriteTable.find(nodeId);
+            if (it == s_RemoteWriteTable.end())
+            {
+                reason = "UNDEFINED NODEID";
+            }
+            else if (writeRemoteTarget(it->second, value, &reason) == true)
+            {
+                ++writtenCount;
+                continue;
+            }
+            else if (reason.empty() == true)
+            {
+                reason = "UNEXPECTED ERROR";
+            }
+
+            LOG_ERROR(logger, "FAILED TO WRITE REMOTE CONTROL: %s, %s", nodeId.c_str(), reason.c_str());
+            failures += (failures.empty() ? "" : ", ") + reason + " : " + nodeId;
+        }
+
+        if (requestCount > 0 && writtenCount == requestCount)
+        {
+            message->ResponseCode = 200;
+            return Status(Status::Code::GOOD);
+        }
+
+        message->ResponseCode = 900;
+        message->Description  = failures;
+        return writtenCount == 0 ? Status(Status::Code::BAD) : Status(Status::Code::UNCERTAIN);
     }
 
     Status RemoteControllToModlink(remote_controll_struct_t* message, JsonArray& md)
@@ -27,4 +27,8 @@ namespace muffin {
     Status StopMqttTaskService();
     Status RemoteControllToMachine(remote_controll_struct_t* message, JsonArray& mc);
     Status RemoteControllToModlink(remote_controll_struct_t* message, JsonArray& md);
+    /**
+     * @brief 설정이 변경되어 원격제어 대상 색인을 다시 만들어야 할 때 호출합니다.
+     */
+    void InvalidateRemoteWriteTable();
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "Common/Assert.hpp"
 #include "Common/Logger/Logger.h"
 #include "Common/Time/TimeUtils.h"
+#include "DataFormat/SparkplugB/SparkplugB.h"
 #include "IM/Custom/Constants.h"
 #include "IM/Custom/FirmwareVersion/FirmwareVersion.h"
 #include "IM/Custom/MacAddress/MacAddress.h"
@@ -27,6 +28,7 @@
 #include "Protocol/MQTT/Include/Topic.h"
 #include "Protocol/MQTT/CatMQTT/CatMQTT.h"
 #include "Protocol/MQTT/LwipMQTT/LwipMQTT.h"
+#include "Protocol/MQTT/TrafficShaper.h"
 #include "ServiceSets/MqttServiceSet/StartMqttClientService.h"
 
 
@@ -84,6 +86,7 @@ namespace muffin {
         if (ret == Status::Code::GOOD)
         {
             LOG_INFO(logger, "Initialized CatM1 MQTT Client");
+            mqtt::trafficShaper.ApplyCatM1Profile();
             if (mqttClient == nullptr)
             {
                 mqttClient = catMQTT;
@@ -122,6 +125,7 @@ namespace muffin {
         {
             log_d("Remained Heap: %u Bytes", ESP.getFreeHeap());
             LOG_INFO(logger, "Initialized LwIP MQTT Client");
+            mqtt::trafficShaper.ClearLimits();
             if (mqttClient == nullptr)
             {
                 mqttClient = lwipMQTT;
@@ -137,19 +141,33 @@ namespace muffin {
 
     Status subscribeTopics(const size_t mutex)
     {
-        mqtt::Message jarvis(mqtt::topic_e::JARVIS_REQUEST, "");
-        mqtt::Message jarvisStatus(mqtt::topic_e::JARVIS_INTERFACE_REQUEST, "");
-        mqtt::Message remoteControl(mqtt::topic_e::REMOTE_CONTROL_REQUEST, "");
-        mqtt::Message firmwareUpdate(mqtt::topic_e::FOTA_UPDATE, "");
+        /**
+         * @note 영구 세션에서는 연결이 끊어진 동안 도착한 요청을 브로커가 보관할 수 있도록 QoS 1로 구독합니다.
+         */
+        const mqtt::qos_e qos = brokerInfo.IsCleanSession() ? mqtt::qos_e::QoS_0 : mqtt::qos_e::QoS_1;
+        const mqtt::socket_e socketID = brokerInfo.GetSocketID();
+
+        mqtt::Message jarvis(mqtt::topic_e::JARVIS_REQUEST, "", socketID, 0, qos);
+        mqtt::Message jarvisStatus(mqtt::topic_e::JARVIS_INTERFACE_REQUEST, "", socketID, 0, qos);
+        mqtt::Message remoteControl(mqtt::topic_e::REMOTE_CONTROL_REQUEST, "", socketID, 0, qos);
+        mqtt::Message firmwareUpdate(mqtt::topic_e::FOTA_UPDATE, "", socketID, 0, qos);
+        mqtt::Message logRequest(mqtt::topic_e::LOG_REQUEST, "", socketID, 0, qos);
+        mqtt::Message logConfig(mqtt::topic_e::LOG_CONFIG, "", socketID, 0, qos);
+        mqtt::Message traceRequest(mqtt::topic_e::TRACE_REQUEST, "", socketID, 0, qos);
+        mqtt::Message replayRequest(mqtt::topic_e::REPLAY_REQUEST, "", socketID, 0, qos);
 
         std::vector<mqtt::Message> topics;
         try
         {
-            topics.reserve(4);
+            topics.reserve(8);
             topics.emplace_back(std::move(jarvis));
             topics.emplace_back(std::move(jarvisStatus));
             topics.emplace_back(std::move(remoteControl));
             topics.emplace_back(std::move(firmwareUpdate));
+            topics.emplace_back(std::move(logRequest));
+            topics.emplace_back(std::move(logConfig));
+            topics.emplace_back(std::move(traceRequest));
+            topics.emplace_back(std::move(replayRequest));
         }
         catch(const std::bad_alloc& e)
         {
@@ -179,7 +197,14 @@ namespace muffin {
         switch (jvs::config::operation.GetServerNIC().second)
         {
         case jvs::snic_e::LTE_CatM1:
+        /**
+         * @note PPPoS 빌드에서는 모듈이 데이터 모드로 동작하므로 lwIP 소켓을 사용하는 클라이언트를 생성합니다.
+         */
+        #if defined(CATM1_PPPOS)
+            return strategyInitEthernet();
+        #else
             return strategyInitCatM1();
+        #endif
 
     #if defined(MT10) || defined(MB10) || defined(MT11)
         case jvs::snic_e::Ethernet:
@@ -228,12 +253,24 @@ namespace muffin {
         }
         LOG_INFO(logger, "Published last will message");
 
+        if (mqttClient->IsSessionPresent() == true)
+        {
+            LOG_INFO(logger, "Resumed the persistent session. Skipped subscription");
+            sparkplug.RequestBirth();
+            if (jvs::config::operation.GetServerNIC().second == jvs::snic_e::LTE_CatM1)
+            {
+                catM1->ReleaseMutex();
+            }
+            return ret;
+        }
+
         for (uint8_t trialCount = 0; trialCount < MAX_RETRY_COUNT; ++trialCount)
         {
             ret = subscribeTopics(mutex.second);
             if (ret == Status::Code::GOOD)
             {
                 LOG_INFO(logger, "Subscribed topics successfully");
+                sparkplug.RequestBirth();
                 if (jvs::config::operation.GetServerNIC().second == jvs::snic_e::LTE_CatM1)
                 {
                     catM1->ReleaseMutex();
@@ -210,6 +210,19 @@ namespace muffin {
             vTaskDelay(SECOND_IN_MILLIS / portTICK_PERIOD_MS);
         } while (ret != Status::Code::GOOD);
         LOG_INFO(logger, "Synchronized with NTP server");
+
+    #if defined(CATM1_PPPOS)
+        /**
+         * @note NTP 동기화는 AT 명령으로 수행하므로 데이터 모드는 그 다음에 진입합니다.
+         */
+        ret = catM1->StartDataMode();
+        if (ret != Status::Code::GOOD)
+        {
+            LOG_ERROR(logger, "FAILED TO START PPP DATA MODE: %s", ret.c_str());
+            return ret;
+        }
+        LOG_INFO(logger, "Started PPP data mode");
+    #endif
         
         LOG_INFO(logger,"Initialized CatM1 interface");
         
@@ -0,0 +1,146 @@
+"""
+MODLINK 트래픽 기록 파일(replay.bin)을 다루는 도구입니다.
+
+하위 명령:
+  - assemble: diag/replay/resp/<mac> 토픽으로 수신한 {"cmd":"dump", ...} JSON 메시지를
+              한 줄에 하나씩 저장한 파일을 기록 파일로 합칩니다.
+  - split:    기록 파일을 diag/replay/<mac> 토픽으로 보낼 {"cmd":"load", ...} 요청으로 나누어
+              한 줄에 하나씩 출력합니다. 요청은 순서대로 보내야 합니다.
+  - info:     기록 파일의 프레임 수, 기록 시간, 드라이버별 프레임 수를 출력합니다.
+
+사용법:
+    python replay_file.py assemble <응답 파일> [-o replay.bin]
+    python replay_file.py split <기록 파일> [-o requests.jsonl]
+    python replay_file.py info <기록 파일>
+"""
+import argparse
+import base64
+import ipaddress
+import json
+import struct
+import sys
+
+
+FILE_HEADER_FORMAT = '<4sB3xQ'
+FILE_HEADER_SIZE = struct.calcsize(FILE_HEADER_FORMAT)
+FRAME_HEADER_FORMAT = '<IIHHB3x'
+FRAME_HEADER_SIZE = struct.calcsize(FRAME_HEADER_FORMAT)
+MAGIC = b'MRPL'
+VERSION = 1
+CHUNK_SIZE = 768
+SOURCES = ['ModbusRTU', 'ModbusTCP', 'Melsec']
+
+
+def assemble(lines):
+    size = None
+    chunks = {}
+
+    for line in lines:
+        line = line.strip()
+        if not line.startswith('{'):
+            continue
+
+        message = json.loads(line)
+        if message.get('cmd') != 'dump' or message.get('rsc') != 200:
+            continue
+
+        size = message.get('size', size)
+        chunks[message['ofs']] = base64.b64decode(message['data'])
+
+    # 응답이 순서대로 도착하지 않을 수 있으므로 오프셋 순서로 이어 붙이며 빠진 조각을 확인합니다.
+    binary = bytearray()
+    for offset in sorted(chunks):
+        if offset != len(binary):
+            raise ValueError('missing dump chunk at offset {}'.format(len(binary)))
+        binary += chunks[offset]
+
+    if size is not None and len(binary) != size:
+        raise ValueError('expected {} bytes but assembled {}'.format(size, len(binary)))
+    return bytes(binary)
+
+
+def split(binary):
+    requests = []
+    for offset in range(0, len(binary), CHUNK_SIZE):
+        chunk = binary[offset:offset + CHUNK_SIZE]
+        requests.append({'cmd': 'load', 'ofs': offset, 'data': base64.b64encode(chunk).decode('ascii')})
+    return requests
+
+
+def parse_frames(binary):
+    magic, version, timestamp = struct.unpack_from(FILE_HEADER_FORMAT, binary, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError('not a replay file')
+
+    frames = []
+    offset = FILE_HEADER_SIZE
+    while offset + FRAME_HEADER_SIZE <= len(binary):
+        offset_millis, address, port, length, source = struct.unpack_from(FRAME_HEADER_FORMAT, binary, offset)
+        # 기록 중에 전원이 꺼져 잘린 마지막 프레임은 장치와 마찬가지로 무시합니다.
+        if offset + FRAME_HEADER_SIZE + length > len(binary):
+            break
+        frames.append((offset_millis, source, address, port, length))
+        offset += FRAME_HEADER_SIZE + length
+
+    return timestamp, frames
+
+
+def describe_channel(source, address, port):
+    name = SOURCES[source] if source < len(SOURCES) else 'Source{}'.format(source)
+    if source == 0:
+        return '{} port {}'.format(name, address)
+    return '{} {}:{}'.format(name, ipaddress.IPv4Address(struct.pack('<I', address)), port)
+
+
+def info(binary):
+    timestamp, frames = parse_frames(binary)
+    channels = {}
+    for offset_millis, source, address, port, length in frames:
+        channel = channels.setdefault((source, address, port), [0, 0])
+        channel[0] += 1
+        channel[1] += length
+
+    print('Recorded at: {} ms (Unix time)'.format(timestamp))
+    print('Size: {} bytes, frames: {}'.format(len(binary), len(frames)))
+    print('Duration: {:.3f} s'.format(frames[-1][0] / 1000 if frames else 0))
+    for (source, address, port), (count, size) in sorted(channels.items()):
+        print('  {}: {} frames, {:.1f} bytes/frame'.format(describe_channel(source, address, port), count, size / count))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Assemble, split or inspect a MODLINK traffic replay file')
+    commands = parser.add_subparsers(dest='command')
+    command = commands.add_parser('assemble', help='assemble MQTT dump responses into a replay file')
+    command.add_argument('input', help='MQTT dump responses, one JSON message per line')
+    command.add_argument('-o', '--output', default='replay.bin', help='output file (default: replay.bin)')
+    command = commands.add_parser('split', help='split a replay file into load requests')
+    command.add_argument('input', help='replay file')
+    command.add_argument('-o', '--output', default='requests.jsonl', help='output file (default: requests.jsonl)')
+    command = commands.add_parser('info', help='print a summary of a replay file')
+    command.add_argument('input', help='replay file')
+    args = parser.parse_args()
+
+    if args.command == 'assemble':
+        with open(args.input, 'r', encoding='utf-8', errors='replace') as file:
+            binary = assemble(file.readlines())
+        with open(args.output, 'wb') as file:
+            file.write(binary)
+        print('Wrote {} bytes to {}'.format(len(binary), args.output))
+    elif args.command == 'split':
+        with open(args.input, 'rb') as file:
+            requests = split(file.read())
+        with open(args.output, 'w', encoding='utf-8') as file:
+            for request in requests:
+                file.write(json.dumps(request, separators=(',', ':')) + '\n')
+        print('Wrote {} load requests to {}'.format(len(requests), args.output))
+    elif args.command == 'info':
+        with open(args.input, 'rb') as file:
+            info(file.read())
+    else:
+        parser.print_help()
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,157 @@
+"""
+MODLINK 이벤트 추적 덤프를 Chrome trace_event 형식의 JSON 파일로 변환합니다.
+
+입력 파일은 다음 두 형식을 모두 지원합니다.
+  - 시리얼 로그: '#TRACE', '#TRACE-DATA', '#TRACE-END' 접두어가 붙은 줄
+  - MQTT 응답: diag/trace/resp/<mac> 토픽으로 수신한 {"cmd":"dump", ...} JSON 메시지를
+    한 줄에 하나씩 저장한 파일
+
+변환한 파일은 chrome://tracing 또는 https://ui.perfetto.dev 에서 열 수 있습니다.
+
+사용법:
+    python trace_to_chrome.py <입력 파일> [-o <출력 파일>]
+"""
+import argparse
+import base64
+import json
+import struct
+import sys
+
+
+RECORD_FORMAT = '<IBBBB'
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+UNKNOWN_TASK = 0xFF
+TIMESTAMP_WRAP = 1 << 32
+
+
+def parse_serial_lines(lines):
+    header = None
+    chunks = []
+
+    for line in lines:
+        line = line.strip()
+        # 시리얼 로그의 다른 출력과 섞여 있을 수 있으므로 접두어의 위치부터 읽습니다.
+        position = line.find('#TRACE')
+        if position < 0:
+            continue
+        line = line[position:]
+
+        if line.startswith('#TRACE-DATA '):
+            chunks.append(line[len('#TRACE-DATA '):])
+        elif line.startswith('#TRACE-END'):
+            break
+        elif line.startswith('#TRACE '):
+            header = json.loads(line[len('#TRACE '):])
+            chunks = []
+
+    return header, chunks
+
+
+def parse_mqtt_lines(lines):
+    header = None
+    chunks = {}
+
+    for line in lines:
+        line = line.strip()
+        if not line.startswith('{'):
+            continue
+
+        message = json.loads(line)
+        if message.get('cmd') != 'dump' or message.get('rsc') != 200:
+            continue
+
+        if 'tasks' in message:
+            header = message
+        chunks[message['ofs']] = message['data']
+
+    # 응답이 순서대로 도착하지 않을 수 있으므로 오프셋 순서로 정렬합니다.
+    return header, [chunks[offset] for offset in sorted(chunks)]
+
+
+def decode_records(chunks):
+    records = []
+    for chunk in chunks:
+        binary = base64.b64decode(chunk)
+        for offset in range(0, len(binary) - RECORD_SIZE + 1, RECORD_SIZE):
+            records.append(struct.unpack_from(RECORD_FORMAT, binary, offset))
+    return records
+
+
+def convert(header, records):
+    tasks = header.get('tasks', [])
+    events = header.get('events', [])
+    trace_events = [
+        {'name': 'process_name', 'ph': 'M', 'pid': 1, 'args': {'name': 'MODLINK'}}
+    ]
+
+    for index, name in enumerate(tasks):
+        trace_events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': index, 'args': {'name': name}})
+    trace_events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': UNKNOWN_TASK, 'args': {'name': '(unknown)'}})
+
+    # micros()는 약 71분마다 0으로 돌아가므로 시간이 크게 줄어든 경우 한 바퀴를 더합니다.
+    base = 0
+    previous = None
+    first = None
+    for timestamp, event, phase, core, task in records:
+        if previous is not None and timestamp < previous and (previous - timestamp) > (TIMESTAMP_WRAP // 2):
+            base += TIMESTAMP_WRAP
+        previous = timestamp
+
+        unwrapped = base + timestamp
+        if first is None:
+            first = unwrapped
+
+        trace_event = {
+            'name': events[event] if event < len(events) else 'Event{}'.format(event),
+            'ph': chr(phase),
+            'ts': unwrapped - first,
+            'pid': 1,
+            'tid': task,
+            'args': {'core': core},
+        }
+        if trace_event['ph'] == 'i':
+            trace_event['s'] = 't'
+        trace_events.append(trace_event)
+
+    return {
+        'traceEvents': trace_events,
+        'displayTimeUnit': 'ms',
+        'otherData': {
+            'capacity': header.get('cap'),
+            'lost': header.get('lost'),
+            'fault': header.get('fault'),
+        },
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a MODLINK trace dump to Chrome trace_event JSON')
+    parser.add_argument('input', help='serial capture or MQTT dump responses, one JSON message per line')
+    parser.add_argument('-o', '--output', default='trace.json', help='output file (default: trace.json)')
+    args = parser.parse_args()
+
+    with open(args.input, 'r', encoding='utf-8', errors='replace') as file:
+        lines = file.readlines()
+
+    header, chunks = parse_serial_lines(lines)
+    if header is None:
+        header, chunks = parse_mqtt_lines(lines)
+    if header is None:
+        print('No trace header found: dump must start at offset 0', file=sys.stderr)
+        return 1
+
+    records = decode_records(chunks)
+    if len(records) != header.get('total', len(records)):
+        print('Warning: expected {} records but decoded {}'.format(header.get('total'), len(records)), file=sys.stderr)
+
+    with open(args.output, 'w', encoding='utf-8') as file:
+        json.dump(convert(header, records), file)
+
+    print('Wrote {} events to {}'.format(len(records), args.output))
+    if header.get('fault'):
+        print('Tracing stopped on fault: {}'.format(header['fault']))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())